@@ -106,6 +106,7 @@ class LayerType:
     binaryConvolution = LayerType_binaryConvolution
     convolution = LayerType_convolution
     fullyConnected = LayerType_fullyConnected
+    groupedConvolution = LayerType_groupedConvolution
     input = LayerType_input
     pooling = LayerType_pooling
     scaling = LayerType_scaling
@@ -119,6 +120,7 @@ del LayerType_bias
 del LayerType_binaryConvolution
 del LayerType_convolution
 del LayerType_fullyConnected
+del LayerType_groupedConvolution
 del LayerType_input
 del LayerType_pooling
 del LayerType_scaling
@@ -157,9 +159,11 @@ del BinaryConvolutionMethod_bitwise
 class ConvolutionMethod:
     columnwise = ConvolutionMethod_columnwise
     diagonal = ConvolutionMethod_diagonal
+    winograd = ConvolutionMethod_winograd
 
 # Remove flat defines so callers only see the class above
 del ConvolutionMethod_columnwise
 del ConvolutionMethod_diagonal
+del ConvolutionMethod_winograd
 
 %}
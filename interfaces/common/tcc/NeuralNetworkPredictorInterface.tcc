@@ -54,8 +54,9 @@ namespace predictors
                 AddLayer(layers[i], inputLayer, underlyingLayers);
             }
 
-            // Create the predictor
+            // Create the predictor, which owns its layers, so they can be folded in place
             _predictor = std::make_shared<UnderlyingPredictor>(std::move(inputLayer), std::move(underlyingLayers));
+            _predictor->FoldLayers();
         }
         else
         {
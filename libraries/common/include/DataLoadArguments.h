@@ -28,6 +28,26 @@ namespace common
         /// <summary> The number of elements in an input data vector. </summary>
         std::string dataDimension = "";
 
+        /// <summary> The number of threads used to parse the input data file, zero means one thread per hardware thread. </summary>
+        size_t numLoadThreads = 0;
+
+        /// <summary> The maximal absolute error allowed when storing data values in reduced precision, zero means exact storage. </summary>
+        double approximationTolerance = 0.0;
+
+        /// <summary> The number of bits used to hash the feature indices of text data, zero means no hashing. When
+        /// positive, the data dimension is 2^numHashingBits, regardless of the largest feature index in the file. </summary>
+        size_t numHashingBits = 0;
+
+        /// <summary> Whether the hash also chooses the sign of each feature value. </summary>
+        bool useSignedHashing = true;
+
+        /// <summary> The seed of the hash function. </summary>
+        size_t hashingSeed = 0;
+
+        /// <summary> The largest allowed number of hashing bits. Hashed indices must fit in the 32-bit indices of
+        /// binary datasets, and the models trained on hashed data have 2^numHashingBits inputs. </summary>
+        static constexpr size_t maxNumHashingBits = 31;
+
         // not exposed on the command line
         size_t parsedDataDimension = 0;
     };
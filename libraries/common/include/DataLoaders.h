@@ -11,16 +11,24 @@
 #include "DataLoadArguments.h"
 
 // data
+#include "AutoDataVector.h"
 #include "Dataset.h"
 #include "ExampleIterator.h"
+#include "GeneralizedSparseParsingIterator.h"
+#include "MappedDataset.h"
+#include "ParallelDatasetLoader.h"
+#include "PrefetchingExampleIterator.h"
+#include "ShufflingExampleIterator.h"
+#include "WeightLabel.h"
 
 // model
 #include "DynamicMap.h"
 
 
 // stl
-#include <string>
 #include <iostream>
+#include <random>
+#include <string>
 
 namespace ell
 {
@@ -41,6 +49,95 @@ namespace common
     /// <returns> The dataset. </returns>
     data::AutoSupervisedDataset GetDataset(std::istream& stream);
 
+    /// <summary>
+    /// Gets a dataset from data load arguments. Binary CSR dataset files are read through a memory
+    /// mapping and copied into the dataset, so callers that only need to iterate over an unhashed binary
+    /// file should open it with data::MappedDataset instead. Text files are split into line-aligned
+    /// chunks that are parsed in parallel, as specified by the numLoadThreads argument.
+    /// </summary>
+    ///
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    data::AutoSupervisedDataset GetDataset(const DataLoadArguments& dataLoadArguments);
+
+    /// <summary>
+    /// Gets an example iterator that makes a single pass over the data file specified by data load
+    /// arguments, without loading the dataset into memory. Binary CSR dataset files are read through a
+    /// memory mapping, text files are parsed on a background thread. The iterator owns the open file.
+    /// </summary>
+    ///
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    ///
+    /// <returns> The example iterator. </returns>
+    data::AutoSupervisedExampleIterator GetStreamingExampleIterator(const DataLoadArguments& dataLoadArguments);
+
+    /// <summary> Gets a parser for the data vectors of text files, as specified by data load arguments. </summary>
+    ///
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    ///
+    /// <returns> The data vector parser. </returns>
+    data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator> GetDataVectorParser(const DataLoadArguments& dataLoadArguments);
+
+    /// <summary> Checks if a map is an identity map, whose model consists of nothing but its input node. </summary>
+    ///
+    /// <param name="map"> The map. </param>
+    ///
+    /// <returns> true if the map is an identity map. </returns>
+    bool IsIdentityMap(const model::DynamicMap& map);
+
+    /// <summary> Checks if a map is an identity map. Only DynamicMaps are recognized as identity maps. </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="map"> The map. </param>
+    ///
+    /// <returns> false. </returns>
+    template <typename MapType>
+    bool IsIdentityMap(const MapType& map);
+
+    /// <summary>
+    /// Gets an example iterator that runs each example of another example iterator through a map, as
+    /// the example is visited.
+    /// </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="exampleIterator"> The example iterator. </param>
+    /// <param name="map"> The map, which must outlive the returned iterator. </param>
+    ///
+    /// <returns> The mapped example iterator. </returns>
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(data::AutoSupervisedExampleIterator exampleIterator, const MapType& map);
+
+    /// <summary>
+    /// Gets an example iterator that makes a single pass over the data file specified by data load
+    /// arguments and runs each example through a map. Hashed examples are sparse vectors in a large
+    /// feature space, so they are not run through an identity map, which would make them dense.
+    /// </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    /// <param name="map"> The map, which must outlive the returned iterator. </param>
+    ///
+    /// <returns> The mapped example iterator. </returns>
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(const DataLoadArguments& dataLoadArguments, const MapType& map);
+
+    /// <summary>
+    /// Gets an example iterator that makes a single pass over the data file specified by data load
+    /// arguments, runs each example through a map, and shuffles the examples in a bounded buffer. This
+    /// is one epoch of streaming training.
+    /// </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    /// <param name="map"> The map, which must outlive the returned iterator. </param>
+    /// <param name="shuffleBufferSize"> The number of examples in the shuffle buffer, zero means no shuffling. </param>
+    /// <param name="rng"> [in,out] The random number generator used to seed the shuffle. </param>
+    ///
+    /// <returns> The mapped example iterator. </returns>
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(const DataLoadArguments& dataLoadArguments, const MapType& map, size_t shuffleBufferSize, std::default_random_engine& rng);
+
     /// <summary>
     /// Gets a dataset by loading it from an example iterator and running it through a map.
     /// </summary>
@@ -64,6 +161,21 @@ namespace common
     /// <returns> The dataset. </returns>
     template <typename MapType>
     data::AutoSupervisedDataset GetMappedDataset(std::istream& stream, const MapType& map);
+
+    /// <summary>
+    /// Gets a dataset by loading it as specified by data load arguments and running it through a map,
+    /// in a single pass over the data. Text files are parsed in parallel and each parsing thread runs
+    /// its examples through its own copy of the map. Hashed examples are not run through an identity
+    /// map, so they stay sparse.
+    /// </summary>
+    ///
+    /// <typeparam name="MapType"> Map type. </typeparam>
+    /// <param name="dataLoadArguments"> The data load arguments. </param>
+    /// <param name="map"> The map. </param>
+    ///
+    /// <returns> The dataset. </returns>
+    template <typename MapType>
+    data::AutoSupervisedDataset GetMappedDataset(const DataLoadArguments& dataLoadArguments, const MapType& map);
 }
 }
 
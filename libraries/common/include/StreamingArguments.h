@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StreamingArguments.h (common)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// utilities
+#include "CommandLineParser.h"
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace common
+{
+    /// <summary> A struct that holds command line parameters for training on a stream of examples. </summary>
+    struct StreamingArguments
+    {
+        /// <summary> Read the data file once per epoch, instead of loading it into memory. </summary>
+        bool stream = false;
+
+        /// <summary> The number of examples in the shuffle buffer, zero means that the stream is not shuffled. </summary>
+        size_t shuffleBufferSize = 0;
+
+        /// <summary> The number of examples, from the beginning of the stream, kept in memory to evaluate the predictor. </summary>
+        size_t evaluationSampleSize = 0;
+    };
+
+    /// <summary> A version of StreamingArguments that adds its members to the command line parser. </summary>
+    struct ParsedStreamingArguments : public StreamingArguments, public utilities::ParsedArgSet
+    {
+        /// <summary> Adds the arguments to the command line parser. </summary>
+        ///
+        /// <param name="parser"> [in,out] The parser. </param>
+        virtual void AddArgs(utilities::CommandLineParser& parser) override;
+    };
+}
+}
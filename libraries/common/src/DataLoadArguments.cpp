@@ -9,6 +9,9 @@
 #include "DataLoadArguments.h"
 #include "DataLoaders.h"
 
+// data
+#include "MappedDataset.h"
+
 // utilities
 #include "Files.h"
 #include "CStringParser.h"
@@ -22,6 +25,8 @@ namespace ell
 {
 namespace common
 {
+    constexpr size_t DataLoadArguments::maxNumHashingBits;
+
     void ParsedDataLoadArguments::AddArgs(utilities::CommandLineParser& parser)
     {
         parser.AddOption(
@@ -37,6 +42,41 @@ namespace common
             "dd",
             "Number of elements to read from each data vector",
             "");
+
+        parser.AddOption(
+            numLoadThreads,
+            "numLoadThreads",
+            "nlt",
+            "Number of threads used to parse the input data file (0 = one per hardware thread)",
+            0);
+
+        parser.AddOption(
+            approximationTolerance,
+            "approximationTolerance",
+            "at",
+            "Maximal absolute error allowed when storing data values in reduced precision (0 = exact)",
+            0.0);
+
+        parser.AddOption(
+            numHashingBits,
+            "numHashingBits",
+            "hb",
+            "Number of bits used to hash the feature indices into a fixed size feature space (0 = no hashing)",
+            0);
+
+        parser.AddOption(
+            useSignedHashing,
+            "useSignedHashing",
+            "ush",
+            "Whether the hash also chooses the sign of each feature value",
+            true);
+
+        parser.AddOption(
+            hashingSeed,
+            "hashingSeed",
+            "hsd",
+            "The seed of the hash function used to hash the feature indices",
+            0);
     }
 
     utilities::CommandLineParseResult ParsedDataLoadArguments::PostProcess(const utilities::CommandLineParser& parser)
@@ -49,9 +89,21 @@ namespace common
             isFileReadable = utilities::IsFileReadable(inputDataFilename);
         }
 
+        // numHashingBits
+        if (numHashingBits > maxNumHashingBits)
+        {
+            parseErrorMessages.push_back("numHashingBits must be at most " + std::to_string(maxNumHashingBits));
+            return parseErrorMessages;
+        }
+
         // dataDimension
         const char* ptr = dataDimension.c_str();
-        if (dataDimension == "auto")
+        if (numHashingBits > 0)
+        {
+            // hashed data vectors have a fixed dimension, so there is no need to scan the file
+            parsedDataDimension = size_t(1) << numHashingBits;
+        }
+        else if (dataDimension == "auto")
         {
             if (!isFileReadable)
             {
@@ -59,13 +111,20 @@ namespace common
                 return parseErrorMessages;
             }
 
-            auto stream = utilities::OpenIfstream(inputDataFilename);
-            auto exampleIterator = GetExampleIterator(stream);
-            while (exampleIterator.IsValid())
+            if (data::IsMappedDatasetFile(inputDataFilename))
+            {
+                parsedDataDimension = data::MappedDataset(inputDataFilename).NumFeatures();
+            }
+            else
             {
-                auto size = exampleIterator.Get().GetDataVector().PrefixLength();
-                parsedDataDimension = std::max(parsedDataDimension, size);
-                exampleIterator.Next();
+                auto stream = utilities::OpenIfstream(inputDataFilename);
+                auto exampleIterator = GetExampleIterator(stream);
+                while (exampleIterator.IsValid())
+                {
+                    auto size = exampleIterator.Get().GetDataVector().PrefixLength();
+                    parsedDataDimension = std::max(parsedDataDimension, size);
+                    exampleIterator.Next();
+                }
             }
         }
         else if (dataDimension != "")
@@ -19,11 +19,15 @@
 #include "AutoDataVector.h"
 #include "WeightLabel.h"
 #include "GeneralizedSparseParsingIterator.h"
+#include "HashingIndexValueIterator.h"
+#include "MappedDataset.h"
+#include "ParallelDatasetLoader.h"
 
 // model
 #include "DynamicMap.h"
 
 // stl
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 
@@ -31,6 +35,74 @@ namespace ell
 {
 namespace common
 {
+    namespace
+    {
+        // an example iterator that owns the object (such as a file) that its wrapped iterator reads from
+        template <typename SourceType>
+        class SourceOwningExampleIterator : public data::IExampleIterator<data::AutoSupervisedExample>
+        {
+        public:
+            template <typename MakeIteratorType>
+            SourceOwningExampleIterator(std::unique_ptr<SourceType> source, MakeIteratorType makeIterator)
+                : _source(std::move(source)), _exampleIterator(makeIterator(*_source))
+            {
+            }
+
+            virtual bool IsValid() const override { return _exampleIterator.IsValid(); }
+
+            virtual void Next() override { _exampleIterator.Next(); }
+
+            virtual data::AutoSupervisedExample Get() const override { return _exampleIterator.Get(); }
+
+        private:
+            std::unique_ptr<SourceType> _source;
+            data::AutoSupervisedExampleIterator _exampleIterator;
+        };
+
+        template <typename SourceType, typename MakeIteratorType>
+        data::AutoSupervisedExampleIterator MakeSourceOwningExampleIterator(std::unique_ptr<SourceType> source, MakeIteratorType makeIterator)
+        {
+            return data::AutoSupervisedExampleIterator(std::make_unique<SourceOwningExampleIterator<SourceType>>(std::move(source), makeIterator));
+        }
+
+        // an example iterator that hashes the feature indices of the examples of its wrapped iterator; text data
+        // is hashed while it is parsed, so this is only used for binary data
+        class HashingExampleIterator : public data::IExampleIterator<data::AutoSupervisedExample>
+        {
+        public:
+            HashingExampleIterator(data::AutoSupervisedExampleIterator exampleIterator, const data::FeatureHasher& featureHasher)
+                : _exampleIterator(std::move(exampleIterator)), _featureHasher(featureHasher)
+            {
+            }
+
+            virtual bool IsValid() const override { return _exampleIterator.IsValid(); }
+
+            virtual void Next() override { _exampleIterator.Next(); }
+
+            virtual data::AutoSupervisedExample Get() const override
+            {
+                auto example = _exampleIterator.Get();
+                auto hashedDataVector = data::HashDataVector<data::SparseDoubleDataVector>(example.GetDataVector(), _featureHasher);
+                return data::AutoSupervisedExample(data::AutoDataVector(std::move(hashedDataVector), 0.0), example.GetMetadata());
+            }
+
+        private:
+            data::AutoSupervisedExampleIterator _exampleIterator;
+            data::FeatureHasher _featureHasher;
+        };
+
+        data::AutoSupervisedExampleIterator GetMappedDatasetExampleIterator(const data::MappedDataset& mappedDataset, const DataLoadArguments& dataLoadArguments)
+        {
+            auto exampleIterator = mappedDataset.GetExampleIterator<data::AutoSupervisedExample>();
+            if (dataLoadArguments.numHashingBits == 0)
+            {
+                return exampleIterator;
+            }
+            data::FeatureHasher featureHasher(dataLoadArguments.numHashingBits, dataLoadArguments.useSignedHashing, dataLoadArguments.hashingSeed);
+            return data::AutoSupervisedExampleIterator(std::make_unique<HashingExampleIterator>(std::move(exampleIterator), featureHasher));
+        }
+    }
+
     data::AutoSupervisedExampleIterator GetExampleIterator(std::istream& stream)
     {
         data::SequentialLineIterator textLineIterator(stream); 
@@ -46,5 +118,46 @@ namespace common
     {
         return data::MakeDataset(GetExampleIterator(stream));
     }
+
+    data::AutoSupervisedDataset GetDataset(const DataLoadArguments& dataLoadArguments)
+    {
+        if (data::IsMappedDatasetFile(dataLoadArguments.inputDataFilename))
+        {
+            data::MappedDataset mappedDataset(dataLoadArguments.inputDataFilename);
+            return data::MakeDataset(GetMappedDatasetExampleIterator(mappedDataset, dataLoadArguments));
+        }
+
+        data::LabelParser metadataParser;
+
+        return data::MakeDatasetInParallel(dataLoadArguments.inputDataFilename, std::move(metadataParser), GetDataVectorParser(dataLoadArguments), dataLoadArguments.numLoadThreads);
+    }
+
+    data::AutoSupervisedExampleIterator GetStreamingExampleIterator(const DataLoadArguments& dataLoadArguments)
+    {
+        const auto& filename = dataLoadArguments.inputDataFilename;
+        if (data::IsMappedDatasetFile(filename))
+        {
+            auto mappedDataset = std::make_unique<data::MappedDataset>(filename);
+            auto exampleIterator = MakeSourceOwningExampleIterator(std::move(mappedDataset), [dataLoadArguments](const data::MappedDataset& dataset) { return GetMappedDatasetExampleIterator(dataset, dataLoadArguments); });
+            return data::MakePrefetchingExampleIterator(std::move(exampleIterator));
+        }
+
+        auto dataVectorParser = GetDataVectorParser(dataLoadArguments);
+        auto stream = std::make_unique<std::ifstream>(utilities::OpenIfstream(filename));
+        auto exampleIterator = MakeSourceOwningExampleIterator(std::move(stream), [dataVectorParser](std::ifstream& stream) {
+            return data::MakeSingleLineParsingExampleIterator(data::SequentialLineIterator(stream), data::LabelParser(), dataVectorParser);
+        });
+        return data::MakePrefetchingExampleIterator(std::move(exampleIterator));
+    }
+
+    data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator> GetDataVectorParser(const DataLoadArguments& dataLoadArguments)
+    {
+        return { dataLoadArguments.approximationTolerance, dataLoadArguments.numHashingBits, dataLoadArguments.useSignedHashing, dataLoadArguments.hashingSeed };
+    }
+
+    bool IsIdentityMap(const model::DynamicMap& map)
+    {
+        return map.GetModel().Size() == 1;
+    }
 }
 }
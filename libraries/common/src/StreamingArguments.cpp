@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     StreamingArguments.cpp (common)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "StreamingArguments.h"
+
+namespace ell
+{
+namespace common
+{
+    void ParsedStreamingArguments::AddArgs(utilities::CommandLineParser& parser)
+    {
+        parser.AddOption(
+            stream,
+            "stream",
+            "st",
+            "Train by reading the data file once per epoch, rather than loading it into memory",
+            false);
+
+        parser.AddOption(
+            shuffleBufferSize,
+            "shuffleBufferSize",
+            "sbs",
+            "Number of examples in the in-memory buffer used to shuffle the stream (0 = no shuffling)",
+            65536);
+
+        parser.AddOption(
+            evaluationSampleSize,
+            "evaluationSampleSize",
+            "ess",
+            "Number of examples, from the beginning of the stream, kept in memory to evaluate the predictor",
+            10000);
+    }
+}
+}
@@ -10,6 +10,52 @@ namespace ell
 {
 namespace common
 {
+    namespace DataLoadersDetail
+    {
+        template <typename MapType>
+        data::AutoSupervisedExample MapExample(const MapType& map, const data::AutoSupervisedExample& example)
+        {
+            auto mappedDataVector = map.template Compute<data::DoubleDataVector>(example.GetDataVector());
+            return data::AutoSupervisedExample(std::move(mappedDataVector), example.GetMetadata());
+        }
+
+        template <typename MapType>
+        class MappingExampleIterator : public data::IExampleIterator<data::AutoSupervisedExample>
+        {
+        public:
+            MappingExampleIterator(data::AutoSupervisedExampleIterator exampleIterator, const MapType& map)
+                : _exampleIterator(std::move(exampleIterator)), _map(map)
+            {
+            }
+
+            virtual bool IsValid() const override { return _exampleIterator.IsValid(); }
+
+            virtual void Next() override { _exampleIterator.Next(); }
+
+            virtual data::AutoSupervisedExample Get() const override
+            {
+                return MapExample(_map, _exampleIterator.Get());
+            }
+
+        private:
+            data::AutoSupervisedExampleIterator _exampleIterator;
+            const MapType& _map;
+        };
+
+        // hashed examples are sparse in a feature space of 2^numHashingBits, and the identity map would make them dense
+        template <typename MapType>
+        bool SkipMap(const DataLoadArguments& dataLoadArguments, const MapType& map)
+        {
+            return dataLoadArguments.numHashingBits > 0 && IsIdentityMap(map);
+        }
+    }
+
+    template <typename MapType>
+    bool IsIdentityMap(const MapType&)
+    {
+        return false;
+    }
+
     template <typename MapType>
     data::AutoSupervisedDataset GetMappedDataset(data::AutoSupervisedExampleIterator exampleIterator, const MapType& map)
     {
@@ -18,10 +64,7 @@ namespace common
         // generate mapped dataset
         while (exampleIterator.IsValid())
         {
-            auto example = exampleIterator.Get();
-            auto mappedDataVector = map.template Compute<data::DoubleDataVector>(example.GetDataVector());
-            auto mappedExample = data::AutoSupervisedExample(std::move(mappedDataVector), example.GetMetadata());
-            dataset.AddExample(mappedExample);
+            dataset.AddExample(DataLoadersDetail::MapExample(map, exampleIterator.Get()));
 
             exampleIterator.Next();
         }
@@ -31,7 +74,54 @@ namespace common
     template <typename MapType>
     data::AutoSupervisedDataset GetMappedDataset(std::istream& stream, const MapType& map)
     {
-        return GetMappedDataset(GetExampleIterator(stream), map);
+        // parse on a background thread, while the map is computed on this one
+        return GetMappedDataset(data::MakePrefetchingExampleIterator(GetExampleIterator(stream)), map);
+    }
+
+    template <typename MapType>
+    data::AutoSupervisedDataset GetMappedDataset(const DataLoadArguments& dataLoadArguments, const MapType& map)
+    {
+        if (DataLoadersDetail::SkipMap(dataLoadArguments, map))
+        {
+            return GetDataset(dataLoadArguments);
+        }
+
+        // binary files are mapped in a single pass over the memory mapping, hashed on the way if requested
+        if (data::IsMappedDatasetFile(dataLoadArguments.inputDataFilename))
+        {
+            return GetMappedDataset(GetStreamingExampleIterator(dataLoadArguments), map);
+        }
+
+        // text files are mapped as they are parsed, by a copy of the map on each parsing thread
+        auto mapExample = [map](const data::AutoSupervisedExample& example) { return DataLoadersDetail::MapExample(map, example); };
+        return data::MakeTransformedDatasetInParallel(dataLoadArguments.inputDataFilename, data::LabelParser(), GetDataVectorParser(dataLoadArguments), mapExample, dataLoadArguments.numLoadThreads);
+    }
+
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(data::AutoSupervisedExampleIterator exampleIterator, const MapType& map)
+    {
+        return data::AutoSupervisedExampleIterator(std::make_unique<DataLoadersDetail::MappingExampleIterator<MapType>>(std::move(exampleIterator), map));
+    }
+
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(const DataLoadArguments& dataLoadArguments, const MapType& map)
+    {
+        if (DataLoadersDetail::SkipMap(dataLoadArguments, map))
+        {
+            return GetStreamingExampleIterator(dataLoadArguments);
+        }
+        return GetMappedExampleIterator(GetStreamingExampleIterator(dataLoadArguments), map);
+    }
+
+    template <typename MapType>
+    data::AutoSupervisedExampleIterator GetMappedExampleIterator(const DataLoadArguments& dataLoadArguments, const MapType& map, size_t shuffleBufferSize, std::default_random_engine& rng)
+    {
+        auto exampleIterator = GetMappedExampleIterator(dataLoadArguments, map);
+        if (shuffleBufferSize == 0)
+        {
+            return exampleIterator;
+        }
+        return data::MakeShufflingExampleIterator(std::move(exampleIterator), shuffleBufferSize, std::default_random_engine(rng()));
     }
 }
 }
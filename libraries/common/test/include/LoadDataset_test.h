@@ -8,5 +8,6 @@
 namespace ell
 {
 void TestLoadDataset();
+void TestLoadDatasetInParallel();
 void TestLoadMappedDataset();
 }
\ No newline at end of file
@@ -29,6 +29,24 @@ void TestLoadDataset()
     auto dataset = common::GetDataset(stream);
 }
 
+void TestLoadDatasetInParallel()
+{
+    common::DataLoadArguments args;
+    args.inputDataFilename = "../../../examples/data/testData.txt";
+    args.numLoadThreads = 4;
+
+    auto stream = utilities::OpenIfstream(args.inputDataFilename);
+    auto dataset = common::GetDataset(stream);
+    auto parallelDataset = common::GetDataset(args);
+
+    bool isEqual = dataset.NumExamples() == parallelDataset.NumExamples();
+    for (size_t i = 0; isEqual && i < dataset.NumExamples(); ++i)
+    {
+        isEqual = dataset[i].GetMetadata().label == parallelDataset[i].GetMetadata().label && testing::IsEqual(dataset[i].GetDataVector().ToArray(), parallelDataset[i].GetDataVector().ToArray());
+    }
+    testing::ProcessTest("Testing parallel dataset loading", isEqual);
+}
+
 void TestLoadMappedDataset()
 {
     common::MapLoadArguments args;
@@ -37,6 +37,7 @@ int main()
         TestLoadMapWithPorts();
 
         TestLoadDataset();
+        TestLoadDatasetInParallel();
         TestLoadMappedDataset();
     }
     catch (const utilities::Exception& exception)
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ArenaDataset.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CsrDatasetView.h"
+#include "DataVectorSpan.h"
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+#include "IndexValue.h"
+#include "WeightLabel.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A dataset that stores all of its examples in a handful of large contiguous buffers, in
+    /// compressed sparse row (CSR) form: arrays of labels and weights, one array of row offsets, one array of
+    /// 32-bit indices, and one array of values. Examples are returned as lightweight spans into these buffers,
+    /// through a CsrDatasetView, so building the dataset performs a small number of large allocations (rather
+    /// than a few allocations per example), and a pass over the examples reads memory sequentially. </summary>
+    ///
+    /// <typeparam name="ElementType"> The type used to store the values. </typeparam>
+    /// <typeparam name="DataVectorSpanType"> The data vector span type returned for each example. </typeparam>
+    template <typename ElementType, typename DataVectorSpanType>
+    class ArenaDataset : public DatasetBase
+    {
+    public:
+        using ViewType = CsrDatasetView<ElementType, DataVectorSpanType>;
+        using DatasetExampleType = typename ViewType::DatasetExampleType;
+
+        /// <summary> An iterator whose Get() function returns a lightweight view of the current example. </summary>
+        using ExampleViewIterator = CsrExampleViewIterator<ViewType>;
+
+        ArenaDataset();
+
+        ArenaDataset(ArenaDataset&&) = default;
+
+        ArenaDataset(const ArenaDataset&) = delete;
+
+        /// <summary> Constructs an ArenaDataset by copying the examples from an example iterator. </summary>
+        ///
+        /// <typeparam name="IteratorExampleType"> The example type. </typeparam>
+        /// <param name="exampleIterator"> The example iterator. </param>
+        template <typename IteratorExampleType>
+        ArenaDataset(ExampleIterator<IteratorExampleType> exampleIterator);
+
+        /// <summary> Constructs an ArenaDataset from an AnyDataset. </summary>
+        ///
+        /// <param name="anyDataset"> the AnyDataset. </param>
+        ArenaDataset(const AnyDataset& anyDataset);
+
+        ArenaDataset& operator=(ArenaDataset&&) = default;
+
+        ArenaDataset& operator=(const ArenaDataset&) = delete;
+
+        /// <summary> Returns the number of examples in the data set. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _labels.size(); }
+
+        /// <summary> Returns the maximal size of any example. </summary>
+        ///
+        /// <returns> The maximal size of any example. </returns>
+        size_t NumFeatures() const { return _numFeatures; }
+
+        /// <summary> Returns the total number of non-zero elements stored in the arena. </summary>
+        ///
+        /// <returns> The number of non-zero elements. </returns>
+        size_t NumNonZeros() const { return _indices.size(); }
+
+        /// <summary> Preallocates storage, to avoid reallocations when the final size is known in advance. </summary>
+        ///
+        /// <param name="numExamples"> The expected number of examples. </param>
+        /// <param name="numNonZeros"> The expected total number of non-zero elements. </param>
+        void Reserve(size_t numExamples, size_t numNonZeros);
+
+        /// <summary> Returns a CSR view of the arena. The view remains valid until the next call to AddExample or Reset. </summary>
+        ///
+        /// <returns> The view. </returns>
+        ViewType GetView() const;
+
+        /// <summary> Returns a view of an example. The view remains valid until the next call to AddExample or Reset. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A view of the specified example. </returns>
+        DatasetExampleType GetExample(size_t index) const { return GetView().GetExample(index); }
+
+        /// <summary> Returns a view of an example. The view remains valid until the next call to AddExample or Reset. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A view of the specified example. </returns>
+        DatasetExampleType operator[](size_t index) const { return GetExample(index); }
+
+        /// <summary> Returns an iterator that traverses the examples. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = AutoSupervisedExample>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an iterator whose Get() function returns a const reference to a copy of the
+        /// current example in a given type. The copy remains valid until the next call to Next(). </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = AutoSupervisedExample>
+        ExampleConstIterator<IteratorExampleType> GetExampleConstIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an iterator that traverses views of the examples, without copying them. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        ExampleViewIterator GetExampleReferenceIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example in the AnyDataset. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, size); }
+
+        /// <summary> Appends a copy of an example to the arena. </summary>
+        ///
+        /// <typeparam name="ExampleType"> The example type. </typeparam>
+        /// <param name="example"> The example. </param>
+        template <typename ExampleType>
+        void AddExample(const ExampleType& example);
+
+        /// <summary> Appends an example, given as an index value iterator and metadata, to the arena. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> An iterator over the non-zero elements of the data vector, in increasing index order. </param>
+        /// <param name="metadata"> The metadata. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        void AddExample(IndexValueIteratorType indexValueIterator, WeightLabel metadata);
+
+        /// <summary> Erases all of the examples in the dataset. </summary>
+        void Reset();
+
+        /// <summary> Prints this object. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write data to. </param>
+        /// <param name="tabs"> The number of tabs. </param>
+        /// <param name="fromIndex"> Zero-based index of the first row to print. </param>
+        /// <param name="size"> The number of rows to print, or 0 to print until the end. </param>
+        void Print(std::ostream& os, size_t tabs = 0, size_t fromIndex = 0, size_t size = 0) const;
+
+    private:
+        size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
+
+        std::vector<double> _labels;
+        std::vector<double> _weights;
+        std::vector<uint64_t> _rowOffsets;
+        std::vector<uint32_t> _indices;
+        std::vector<ElementType> _values;
+        size_t _numFeatures = 0;
+    };
+
+    // friendly names
+    typedef ArenaDataset<double, DoubleDataVectorSpan> DoubleArenaDataset;
+    typedef ArenaDataset<float, FloatDataVectorSpan> FloatArenaDataset;
+}
+}
+
+#include "../tcc/ArenaDataset.tcc"
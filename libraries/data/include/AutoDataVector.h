@@ -17,6 +17,7 @@
 #include "TypeTraits.h"
 
 // stl
+#include <cstdint>
 #include <initializer_list>
 
 namespace ell
@@ -39,14 +40,29 @@ namespace data
         /// <summary> Constructs an auto data vector from a vector of the default type. </summary>
         ///
         /// <param name="vector"> The input vector. </param>
-        AutoDataVectorBase(DefaultDataVectorType&& vector);
+        /// <param name="approximationTolerance"> The maximal absolute error allowed per element. If positive, the
+        /// vector may be stored in a lossy reduced precision representation (such as float16 or 8-bit quantized
+        /// values) whose error is within this tolerance. </param>
+        AutoDataVectorBase(DefaultDataVectorType&& vector, double approximationTolerance = 0.0);
+
+        /// <summary> Constructs an auto data vector from a data vector of another type, without an intermediate
+        /// vector of the default type. This avoids allocating a dense intermediate for very sparse vectors. </summary>
+        ///
+        /// <typeparam name="DataVectorType"> The type of the input vector. </typeparam>
+        /// <param name="vector"> The input vector. </param>
+        /// <param name="approximationTolerance"> The maximal absolute error allowed per element. </param>
+        template <typename DataVectorType, IsDataVector<DataVectorType> Concept = true>
+        AutoDataVectorBase(DataVectorType vector, double approximationTolerance);
 
         /// <summary> Constructs an auto data vector from an index value iterator. </summary>
         ///
         /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
         /// <param name="IndexValueIterator"> The index value iterator. </param>
+        /// <param name="approximationTolerance"> The maximal absolute error allowed per element. If positive, the
+        /// vector may be stored in a lossy reduced precision representation (such as float16 or 8-bit quantized
+        /// values) whose error is within this tolerance. </param>
         template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
-        AutoDataVectorBase(IndexValueIteratorType indexValueIterator);
+        AutoDataVectorBase(IndexValueIteratorType indexValueIterator, double approximationTolerance = 0.0);
 
         /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
         ///
@@ -120,6 +136,14 @@ namespace data
         template <IterationPolicy policy, typename TransformationType>
         void AddTransformedTo(math::RowVectorReference<double> vector, TransformationType transformation) const;
 
+        /// <summary> Calls a function on each element of this data vector. </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <typeparam name="FunctionType"> A functor that takes an IndexValue. </typeparam>
+        /// <param name="function"> The function. </param>
+        template <IterationPolicy policy, typename FunctionType>
+        void ForEachElement(FunctionType function) const;
+
         /// <summary> Copies the contents of this DataVector into a double array of size PrefixLength(). </summary>
         ///
         /// <returns> The array. </returns>
@@ -160,17 +184,18 @@ namespace data
 
     private:
         // helper function used by ctors to choose the type of data vector to use
-        void FindBestRepresentation(DefaultDataVectorType defaultDataVector);
+        template <typename SourceDataVectorType>
+        void FindBestRepresentation(SourceDataVectorType sourceDataVector, double approximationTolerance = 0.0);
 
-        template <typename DataVectorType, utilities::IsSame<DataVectorType, DefaultDataVectorType> Concept = true>
-        void SetInternal(DefaultDataVectorType defaultDataVector)
+        template <typename DataVectorType, typename SourceDataVectorType, utilities::IsSame<DataVectorType, SourceDataVectorType> Concept = true>
+        void SetInternal(SourceDataVectorType sourceDataVector)
         {
             // STYLE intentional deviation from project style due to compilation difficulties
-            _pInternal = std::make_unique<DefaultDataVectorType>(std::move(defaultDataVector));
+            _pInternal = std::make_unique<SourceDataVectorType>(std::move(sourceDataVector));
         }
 
-        template <typename DataVectorType, utilities::IsDifferent<DataVectorType, DefaultDataVectorType> Concept = true>
-        void SetInternal(DefaultDataVectorType defaultDataVector);
+        template <typename DataVectorType, typename SourceDataVectorType, utilities::IsDifferent<DataVectorType, SourceDataVectorType> Concept = true>
+        void SetInternal(SourceDataVectorType sourceDataVector);
 
         // members
         std::unique_ptr<IDataVector> _pInternal;
@@ -185,12 +210,35 @@ namespace data
     template <typename IndexValueParsingIterator>
     struct AutoDataVectorParser
     {
+        /// <summary> Constructs an AutoDataVectorParser. </summary>
+        ///
+        /// <param name="approximationTolerance"> The maximal absolute error allowed when storing the parsed
+        /// values in reduced precision, or zero to store them exactly. </param>
+        /// <param name="numHashingBits"> The number of bits used to hash the parsed feature indices (see
+        /// FeatureHasher), or zero to keep the parsed indices. </param>
+        /// <param name="useSignedHashing"> true to multiply each hashed value by a hashed sign. </param>
+        /// <param name="hashingSeed"> The hash seed. </param>
+        AutoDataVectorParser(double approximationTolerance = 0.0, size_t numHashingBits = 0, bool useSignedHashing = true, uint64_t hashingSeed = 0)
+            : approximationTolerance(approximationTolerance), numHashingBits(numHashingBits), useSignedHashing(useSignedHashing), hashingSeed(hashingSeed) {}
+
         /// <summary> Parses a given text line and constructs an AutoDataVector. </summary>
         ///
         /// <param name="textLine"> The text line. </param>
         ///
         /// <returns> An AutoDataVector. </returns>
-        static AutoDataVector Parse(TextLine& textLine);
+        AutoDataVector Parse(TextLine& textLine) const;
+
+        /// <summary> The maximal absolute error allowed when storing the parsed values in reduced precision. </summary>
+        double approximationTolerance;
+
+        /// <summary> The number of bits used to hash the parsed feature indices, zero means no hashing. </summary>
+        size_t numHashingBits;
+
+        /// <summary> Whether the hash also chooses the sign of each parsed value. </summary>
+        bool useSignedHashing;
+
+        /// <summary> The hash seed. </summary>
+        uint64_t hashingSeed;
     };
 }
 }
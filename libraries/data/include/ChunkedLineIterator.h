@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ChunkedLineIterator.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "TextLine.h"
+
+// stl
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A byte range [begin, end) in a text file, whose boundaries are aligned to line boundaries. </summary>
+    struct TextFileChunk
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    /// <summary> Splits a text file into (at most) a given number of chunks of similar size, where each chunk begins at the start of a line. </summary>
+    ///
+    /// <param name="filepath"> The file path. </param>
+    /// <param name="numChunks"> The requested number of chunks. </param>
+    /// <param name="delim"> The line delimiter. </param>
+    ///
+    /// <returns> The chunks, in file order. Empty files result in an empty vector. </returns>
+    std::vector<TextFileChunk> GetTextFileChunks(const std::string& filepath, size_t numChunks, char delim = '\n');
+
+    /// <summary> An iterator that reads the lines of a single chunk of a text file. </summary>
+    class ChunkedLineIterator
+    {
+    public:
+        /// <summary> Constructs a chunked line iterator. </summary>
+        ///
+        /// <param name="filepath"> The file path. </param>
+        /// <param name="chunk"> The chunk to read, which must begin at the start of a line. </param>
+        /// <param name="delim"> The delimiter. </param>
+        ChunkedLineIterator(const std::string& filepath, TextFileChunk chunk, char delim = '\n');
+
+        ChunkedLineIterator(ChunkedLineIterator&&) = default;
+
+        ChunkedLineIterator(const ChunkedLineIterator&) = delete; // this ctor is deleted because a private member of this class cannot be copied
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _isValid; }
+
+        /// <summary> Proceeds to the next row. </summary>
+        void Next();
+
+        /// <summary> Returns a TextLine that contains the current line. </summary>
+        ///
+        /// <returns> A TextLine </returns>
+        TextLine GetTextLine() const { return _currentLine; }
+
+    private:
+        std::ifstream _stream;
+        size_t _position;
+        size_t _end;
+        bool _isValid = true;
+        TextLine _currentLine;
+        char _delim;
+    };
+}
+}
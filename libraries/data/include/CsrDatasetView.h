@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CsrDatasetView.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "DataVectorSpan.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+#include "WeightLabel.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <utility>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A lightweight read-only example, whose data vector is a view into storage owned by a dataset. </summary>
+    ///
+    /// <typeparam name="DataVectorViewType"> The data vector view type. </typeparam>
+    template <typename DataVectorViewType>
+    class SpanExample
+    {
+    public:
+        using DataVectorType = DataVectorViewType;
+
+        /// <summary> Constructs a SpanExample. </summary>
+        ///
+        /// <param name="dataVector"> The data vector view. </param>
+        /// <param name="metadata"> The metadata. </param>
+        SpanExample(DataVectorViewType dataVector, WeightLabel metadata);
+
+        /// <summary> Gets the data vector view. </summary>
+        ///
+        /// <returns> The data vector. </returns>
+        const DataVectorViewType& GetDataVector() const { return _dataVector; }
+
+        /// <summary> Gets the metadata. </summary>
+        ///
+        /// <returns> The metadata. </returns>
+        const WeightLabel& GetMetadata() const { return _metadata; }
+
+        /// <summary> Copies this example into an example with its own data vector. </summary>
+        ///
+        /// <typeparam name="TargetExampleType"> The target example type. </typeparam>
+        ///
+        /// <returns> The example. </returns>
+        template <typename TargetExampleType>
+        TargetExampleType CopyAs() const;
+
+        /// <summary> Human readable printout to an output stream. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write to. </param>
+        void Print(std::ostream& os) const;
+
+    private:
+        DataVectorViewType _dataVector;
+        WeightLabel _metadata;
+    };
+
+    /// <summary> A non-owning, read-only view of a dataset stored in compressed sparse row (CSR) form: an
+    /// array of labels, an array of weights, an array of row offsets, and parallel arrays of 32-bit
+    /// indices and values. This is the common representation of the ArenaDataset, which owns its arrays,
+    /// and the MappedDataset, whose arrays live in a memory mapped file. Copying a view never copies the
+    /// arrays. </summary>
+    ///
+    /// <typeparam name="ElementType"> The type used to store the values. </typeparam>
+    /// <typeparam name="DataVectorViewType"> The type of the data vector views returned for each example,
+    /// which is constructed from a pointer to the indices, a pointer to the values, and a size. </typeparam>
+    template <typename ElementType, typename DataVectorViewType>
+    class CsrDatasetView
+    {
+    public:
+        using DatasetExampleType = SpanExample<DataVectorViewType>;
+
+        /// <summary> Constructs an empty view. </summary>
+        CsrDatasetView() = default;
+
+        /// <summary> Constructs a view. </summary>
+        ///
+        /// <param name="numExamples"> The number of examples. </param>
+        /// <param name="labels"> Pointer to the labels, one per example. </param>
+        /// <param name="weights"> Pointer to the weights, one per example. </param>
+        /// <param name="rowOffsets"> Pointer to the row offsets, one per example plus one. </param>
+        /// <param name="indices"> Pointer to the indices, increasing within each example. </param>
+        /// <param name="values"> Pointer to the values. </param>
+        CsrDatasetView(size_t numExamples, const double* labels, const double* weights, const uint64_t* rowOffsets, const uint32_t* indices, const ElementType* values);
+
+        /// <summary> Returns the number of examples. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _numExamples; }
+
+        /// <summary> Returns the total number of non-zero elements. </summary>
+        ///
+        /// <returns> The number of non-zero elements. </returns>
+        size_t NumNonZeros() const { return _numExamples == 0 ? 0 : static_cast<size_t>(_rowOffsets[_numExamples]); }
+
+        /// <summary> Returns a view of an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A view of the specified example. </returns>
+        DatasetExampleType GetExample(size_t index) const;
+
+    private:
+        size_t _numExamples = 0;
+        const double* _labels = nullptr;
+        const double* _weights = nullptr;
+        const uint64_t* _rowOffsets = nullptr;
+        const uint32_t* _indices = nullptr;
+        const ElementType* _values = nullptr;
+    };
+
+    /// <summary> An iterator whose Get() function returns a lightweight view of the current example of a
+    /// CSR dataset. </summary>
+    ///
+    /// <typeparam name="ExampleSourceType"> The type of the object that provides the examples, through a
+    /// GetExample(index) member function. The iterator holds a copy of it. </typeparam>
+    template <typename ExampleSourceType>
+    class CsrExampleViewIterator
+    {
+    public:
+        /// <summary> Constructs a CsrExampleViewIterator. </summary>
+        ///
+        /// <param name="source"> The example source. </param>
+        /// <param name="begin"> Zero-based index of the first example. </param>
+        /// <param name="end"> Zero-based index one past the last example. </param>
+        CsrExampleViewIterator(ExampleSourceType source, size_t begin, size_t end);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _current < _end; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_current; }
+
+        /// <summary> Gets a view of the current example. </summary>
+        ///
+        /// <returns> The example view. </returns>
+        auto Get() const -> decltype(std::declval<const ExampleSourceType&>().GetExample(0)) { return _source.GetExample(_current); }
+
+    private:
+        ExampleSourceType _source;
+        size_t _current;
+        size_t _end;
+    };
+
+    /// <summary> An example iterator that copies the examples of a CSR dataset into a given example type. </summary>
+    ///
+    /// <typeparam name="ExampleSourceType"> The type of the object that provides the examples, through a
+    /// GetExample(index) member function. The iterator holds a copy of it. </typeparam>
+    /// <typeparam name="IteratorExampleType"> The example type. </typeparam>
+    template <typename ExampleSourceType, typename IteratorExampleType>
+    class CsrExampleIterator : public IExampleIterator<IteratorExampleType>
+    {
+    public:
+        /// <summary> Constructs a CsrExampleIterator. </summary>
+        ///
+        /// <param name="source"> The example source. </param>
+        /// <param name="begin"> Zero-based index of the first example. </param>
+        /// <param name="end"> Zero-based index one past the last example. </param>
+        CsrExampleIterator(ExampleSourceType source, size_t begin, size_t end);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        virtual bool IsValid() const override { return _current < _end; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        virtual void Next() override { ++_current; }
+
+        /// <summary> Gets the current example pointer to by the iterator. </summary>
+        ///
+        /// <returns> The example. </returns>
+        virtual IteratorExampleType Get() const override { return _source.GetExample(_current).template CopyAs<IteratorExampleType>(); }
+
+    private:
+        ExampleSourceType _source;
+        size_t _current;
+        size_t _end;
+    };
+
+    /// <summary> Makes an ExampleIterator that copies a range of the examples of a CSR dataset into a given example type. </summary>
+    ///
+    /// <typeparam name="IteratorExampleType"> The example type. </typeparam>
+    /// <typeparam name="ExampleSourceType"> The type of the object that provides the examples. </typeparam>
+    /// <param name="source"> The example source, which is copied into the iterator. </param>
+    /// <param name="begin"> Zero-based index of the first example. </param>
+    /// <param name="end"> Zero-based index one past the last example. </param>
+    ///
+    /// <returns> The example iterator. </returns>
+    template <typename IteratorExampleType, typename ExampleSourceType>
+    ExampleIterator<IteratorExampleType> MakeCsrExampleIterator(ExampleSourceType source, size_t begin, size_t end);
+}
+}
+
+#include "../tcc/CsrDatasetView.tcc"
@@ -43,6 +43,13 @@ namespace data
             SparseShortDataVector,
             SparseByteDataVector,
             SparseBinaryDataVector,
+            DoubleDataVectorSpan,
+            FloatDataVectorSpan,
+            HalfDataVector,
+            QuantizedByteDataVector,
+            SparseHalfDataVector,
+            SparseQuantizedByteDataVector,
+            DenseBinaryDataVector,
             AutoDataVector
         };
 
@@ -95,6 +102,14 @@ namespace data
         template <IterationPolicy policy, typename TransformationType>
         void AddTransformedTo(math::RowVectorReference<double> vector, TransformationType transformation) const;
 
+        /// <summary> Calls a function on each element of this data vector. </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <typeparam name="FunctionType"> A functor that takes an IndexValue. </typeparam>
+        /// <param name="function"> The function. </param>
+        template <IterationPolicy policy, typename FunctionType>
+        void ForEachElement(FunctionType function) const;
+
         /// <summary> Copies the contents of this DataVector into a double array of size PrefixLength(). </summary>
         ///
         /// <returns> The array. </returns>
@@ -226,6 +241,14 @@ namespace data
         template <IterationPolicy policy, typename TransformationType>
         void AddTransformedTo(math::RowVectorReference<double> vector, TransformationType transformation) const;
 
+        /// <summary> Calls a function on each element of this data vector. </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <typeparam name="FunctionType"> A functor that takes an IndexValue. </typeparam>
+        /// <param name="function"> The function. </param>
+        template <IterationPolicy policy, typename FunctionType>
+        void ForEachElement(FunctionType function) const;
+
         /// <summary> Returns a (dense) iterator of the vector elements, excluding the final suffix of zeros. </summary>
         ///
         /// <returns> A value iterator. </returns>
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DataVectorSpan.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+#ifndef DATAVECTORSPAN_H
+#define DATAVECTORSPAN_H
+
+// math
+#include "Vector.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+
+namespace ell
+{
+namespace data
+{
+    // forward declaration of DataVectorSpan
+    template <typename ElementType>
+    class DataVectorSpan;
+
+    // forward declaration of DataVectorSpanIterator
+    template <IterationPolicy policy, typename ElementType>
+    class DataVectorSpanIterator;
+
+    /// <summary> A read-only forward iterator that traverses the non-zero elements. </summary>
+    template <typename ElementType>
+    class DataVectorSpanIterator<IterationPolicy::skipZeros, ElementType> : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _offset < _numNonZeros && _indices[_offset] < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_offset; }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _indices[_offset], static_cast<double>(_values[_offset]) }; }
+
+    private:
+        // private ctor, can only be called from DataVectorSpan
+        DataVectorSpanIterator(const uint32_t* indices, const ElementType* values, size_t numNonZeros, size_t size);
+        friend DataVectorSpan<ElementType>;
+
+        const uint32_t* _indices;
+        const ElementType* _values;
+        size_t _numNonZeros;
+        size_t _size;
+        size_t _offset = 0;
+    };
+
+    /// <summary> A read-only forward iterator that traverses a prefix of the vector, including zero elements. </summary>
+    template <typename ElementType>
+    class DataVectorSpanIterator<IterationPolicy::all, ElementType> : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const;
+
+    private:
+        // private ctor, can only be called from DataVectorSpan
+        DataVectorSpanIterator(const uint32_t* indices, const ElementType* values, size_t numNonZeros, size_t size);
+        friend DataVectorSpan<ElementType>;
+
+        const uint32_t* _indices;
+        const ElementType* _values;
+        size_t _numNonZeros;
+        size_t _size;
+        size_t _offset = 0;
+        size_t _index = 0;
+    };
+
+    /// <summary> A non-owning, read-only sparse data vector that refers to a range of parallel index
+    /// and value arrays owned by someone else (for example, an ArenaDataset). Copying a span is cheap
+    /// and never copies the elements. Since it is an IDataVector, it works with all of the existing data
+    /// vector operations. </summary>
+    ///
+    /// <typeparam name="ElementType"> Type of the vector elements. </typeparam>
+    template <typename ElementType>
+    class DataVectorSpan : public DataVectorBase<DataVectorSpan<ElementType>>
+    {
+    public:
+        /// <summary> Constructs an empty span. </summary>
+        DataVectorSpan() = default;
+
+        /// <summary> Constructs a span. </summary>
+        ///
+        /// <param name="indices"> Pointer to the increasing indices of the non-zero elements. </param>
+        /// <param name="values"> Pointer to the values of the non-zero elements. </param>
+        /// <param name="numNonZeros"> The number of non-zero elements. </param>
+        DataVectorSpan(const uint32_t* indices, const ElementType* values, size_t numNonZeros);
+
+        template <IterationPolicy policy>
+        using Iterator = DataVectorSpanIterator<policy, ElementType>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const { return Iterator<policy>(_indices, _values, _numNonZeros, size); }
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const { return GetIterator<policy>(PrefixLength()); }
+
+        /// <summary> Spans are read-only, so this function always throws an exception. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element. </param>
+        /// <param name="value"> The element value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        virtual size_t PrefixLength() const override { return _numNonZeros == 0 ? 0 : static_cast<size_t>(_indices[_numNonZeros - 1]) + 1; }
+
+        /// <summary> Gets the number of non-zero elements. </summary>
+        ///
+        /// <returns> The number of non-zero elements. </returns>
+        size_t NumNonZeros() const { return _numNonZeros; }
+
+        /// <summary> Computes the squared 2-norm of the vector. </summary>
+        ///
+        /// <returns> The squared 2-norm of the vector. </returns>
+        virtual double Norm2Squared() const override;
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+    private:
+        // returns the number of non-zeros whose index is smaller than size
+        size_t CountBelow(size_t size) const;
+
+        const uint32_t* _indices = nullptr;
+        const ElementType* _values = nullptr;
+        size_t _numNonZeros = 0;
+    };
+
+    /// <summary> A span of double elements. </summary>
+    struct DoubleDataVectorSpan : public DataVectorSpan<double>
+    {
+        using DataVectorSpan<double>::DataVectorSpan;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::DoubleDataVectorSpan; }
+    };
+
+    /// <summary> A span of float elements. </summary>
+    struct FloatDataVectorSpan : public DataVectorSpan<float>
+    {
+        using DataVectorSpan<float>::DataVectorSpan;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::FloatDataVectorSpan; }
+    };
+}
+}
+
+#include "../tcc/DataVectorSpan.tcc"
+
+#endif // DATAVECTORSPAN_H
@@ -21,6 +21,7 @@
 #include <functional>
 #include <ostream>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 namespace ell
@@ -31,6 +32,12 @@ namespace data
     template <typename ExampleType>
     class Dataset;
 
+    // forward declarations of MappedDataset and ArenaDataset, which are also accessible through AnyDataset
+    class MappedDataset;
+
+    template <typename ElementType, typename DataVectorSpanType>
+    class ArenaDataset;
+
     /// <summary> Polymorphic interface for datasets, enables dynamic_cast operations. </summary>
     struct DatasetBase
     {
@@ -56,11 +63,33 @@ namespace data
         template <typename ExampleType>
         ExampleIterator<ExampleType> GetExampleIterator() const;
 
+        /// <summary> Gets an example iterator whose Get() function returns a const reference. Examples are
+        /// only converted (copied) when the underlying dataset does not store the requested example type. </summary>
+        ///
+        /// <typeparam name="ExampleType"> Example type. </typeparam>
+        ///
+        /// <returns> The example iterator. </returns>
+        template <typename ExampleType>
+        ExampleConstIterator<ExampleType> GetExampleConstIterator() const;
+
         /// <summary> Returns the number of examples in the dataset. </summary>
         ///
         /// <returns> Number of examples. </returns>
         size_t NumExamples() const { return _size; }
 
+        /// <summary> Returns the index of the first example in the underlying dataset. </summary>
+        ///
+        /// <returns> Zero-based index of the first example. </returns>
+        size_t FromIndex() const { return _fromIndex; }
+
+        /// <summary> Gets the underlying dataset, if it is a Dataset of a given example type. </summary>
+        ///
+        /// <typeparam name="ExampleType"> Example type. </typeparam>
+        ///
+        /// <returns> Pointer to the underlying dataset, or nullptr if it stores examples of a different type. </returns>
+        template <typename ExampleType>
+        const Dataset<ExampleType>* GetDataset() const;
+
     private:
         const DatasetBase* _pDataset;
         size_t _fromIndex;
@@ -100,6 +129,31 @@ namespace data
             InternalIteratorType _end;
         };
 
+        /// <summary> An IExampleConstIterator that returns references to the examples stored in the dataset, without copying them. </summary>
+        class DatasetExampleConstIterator : public IExampleConstIterator<DatasetExampleType>
+        {
+        public:
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            virtual bool IsValid() const override { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            virtual void Next() override { ++_current; }
+
+            /// <summary> Returns a const reference to the current example. </summary>
+            ///
+            /// <returns> A const reference to the example. </returns>
+            virtual const DatasetExampleType& Get() const override { return *_current; }
+
+            using InternalIteratorType = typename std::vector<DatasetExampleType>::const_iterator;
+            DatasetExampleConstIterator(InternalIteratorType begin, InternalIteratorType end);
+
+        private:
+            InternalIteratorType _current;
+            InternalIteratorType _end;
+        };
+
         Dataset() = default;
 
         Dataset(Dataset&&) = default;
@@ -182,6 +236,19 @@ namespace data
         /// <returns> The example reference iterator. </returns>
         ExampleReferenceIterator<DatasetExampleType> GetExampleReferenceIterator(size_t fromIndex = 0, size_t size = 0) const;
 
+        /// <summary> Returns an iterator whose Get() function returns a const reference to an example of a
+        /// given type. If the requested type is the dataset's example type, the iterator refers directly to
+        /// the stored examples; otherwise, each example is converted when it is visited. </summary>
+        ///
+        /// <typeparam name="IteratorExampleType"> The example type. </typeparam>
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = DatasetExampleType>
+        ExampleConstIterator<IteratorExampleType> GetExampleConstIterator(size_t fromIndex = 0, size_t size = 0) const;
+
         /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset. </summary>
         ///
         /// <param name="firstExample"> Zero-based index of the first example in the AnyDataset. </param>
@@ -252,6 +319,12 @@ namespace data
     private:
         size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
 
+        template <typename IteratorExampleType>
+        ExampleConstIterator<IteratorExampleType> GetExampleConstIterator(size_t fromIndex, size_t size, std::true_type) const;
+
+        template <typename IteratorExampleType>
+        ExampleConstIterator<IteratorExampleType> GetExampleConstIterator(size_t fromIndex, size_t size, std::false_type) const;
+
         std::vector<DatasetExampleType> _examples;
         size_t _numFeatures = 0;
     };
@@ -281,3 +354,6 @@ namespace data
 }
 
 #include "../tcc/Dataset.tcc"
+
+#include "ArenaDataset.h"
+#include "MappedDataset.h"
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetIndexView.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> An ordered view of the examples of a Dataset, represented by an array of 32-bit example indices.
+    /// The view supports the reordering operations of Dataset (RandomPermute, RandomSwap, Sort and Partition) and
+    /// bootstrap sampling, by moving indices rather than examples. This reduces the memory traffic of algorithms
+    /// that reorder a dataset many times, such as the forest trainers. The view refers to the dataset, which must
+    /// outlive it and must not be modified while the view is in use. </summary>
+    ///
+    /// <typeparam name="DatasetExampleType"> The example type of the dataset. </typeparam>
+    template <typename DatasetExampleType>
+    class DatasetIndexView
+    {
+    public:
+        /// <summary> An iterator whose Get() function returns a const reference to an example, in the order of the view. </summary>
+        class ReferenceIterator
+        {
+        public:
+            /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+            ///
+            /// <returns> true if it succeeds, false if it fails. </returns>
+            bool IsValid() const { return _current < _end; }
+
+            /// <summary> Proceeds to the Next iterate. </summary>
+            void Next() { ++_current; }
+
+            /// <summary> Returns a const reference to the current example. </summary>
+            ///
+            /// <returns> A const reference to the example. </returns>
+            const DatasetExampleType& Get() const { return _pDataset->GetExample(*_current); }
+
+        private:
+            friend DatasetIndexView<DatasetExampleType>;
+            ReferenceIterator(const Dataset<DatasetExampleType>* pDataset, const uint32_t* begin, const uint32_t* end);
+
+            const Dataset<DatasetExampleType>* _pDataset;
+            const uint32_t* _current;
+            const uint32_t* _end;
+        };
+
+        DatasetIndexView() = default;
+
+        /// <summary> Constructs a view of all of the examples in a dataset, in their original order. </summary>
+        ///
+        /// <param name="dataset"> The dataset. </param>
+        DatasetIndexView(Dataset<DatasetExampleType>& dataset);
+
+        /// <summary> Returns the number of examples in the view. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _indices.size(); }
+
+        /// <summary> Returns the maximal size of any example in the underlying dataset. </summary>
+        ///
+        /// <returns> The maximal size of any example. </returns>
+        size_t NumFeatures() const { return _pDataset->NumFeatures(); }
+
+        /// <summary> Returns the index, in the underlying dataset, of the example at a given position in the view. </summary>
+        ///
+        /// <param name="position"> Zero-based position in the view. </param>
+        ///
+        /// <returns> The index of the example in the dataset. </returns>
+        size_t GetIndex(size_t position) const { return _indices[position]; }
+
+        /// <summary> Returns a reference to the example at a given position in the view. </summary>
+        ///
+        /// <param name="position"> Zero-based position in the view. </param>
+        ///
+        /// <returns> Reference to the example. </returns>
+        DatasetExampleType& operator[](size_t position) { return _pDataset->GetExample(_indices[position]); }
+
+        /// <summary> Returns a const reference to the example at a given position in the view. </summary>
+        ///
+        /// <param name="position"> Zero-based position in the view. </param>
+        ///
+        /// <returns> Const reference to the example. </returns>
+        const DatasetExampleType& operator[](size_t position) const { return _pDataset->GetExample(_indices[position]); }
+
+        /// <summary> Returns an iterator that traverses an interval of the view. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based position of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        ReferenceIterator GetExampleReferenceIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Randomly permutes an interval of the view so that a prefix of it is uniformly distributed. </summary>
+        ///
+        /// <param name="rng"> [in,out] The random number generator. </param>
+        /// <param name="rangeFirstIndex"> Zero-based position of the first example in the interval. </param>
+        /// <param name="rangeSize"> Size of the interval, zero means all the way to the end. </param>
+        /// <param name="prefixSize"> Size of the prefix that should be uniformly distributed, zero to permute the entire interval. </param>
+        void RandomPermute(std::default_random_engine& rng, size_t rangeFirstIndex = 0, size_t rangeSize = 0, size_t prefixSize = 0);
+
+        /// <summary> Chooses an example uniformly from a given interval and swaps it with a given example. </summary>
+        ///
+        /// <param name="rng"> [in,out] The random number generator. </param>
+        /// <param name="targetPosition"> Zero-based position of the target example. </param>
+        /// <param name="rangeFirstIndex"> Position of the first example in the interval from which the example is chosen. </param>
+        /// <param name="rangeSize"> Number of examples in the interval from which the example is chosen. </param>
+        void RandomSwap(std::default_random_engine& rng, size_t targetPosition, size_t rangeFirstIndex, size_t rangeSize);
+
+        /// <summary> Sorts an interval of the view by a certain key. The key is computed once per example. </summary>
+        ///
+        /// <typeparam name="SortKeyType"> Type of the sort key. </typeparam>
+        /// <param name="sortKey"> A function that takes const reference to DatasetExampleType and returns a sort key. </param>
+        /// <param name="fromIndex"> Zero-based position of the first example to sort. </param>
+        /// <param name="size"> The number of examples to sort, zero means all the way to the end. </param>
+        template <typename SortKeyType>
+        void Sort(SortKeyType sortKey, size_t fromIndex = 0, size_t size = 0);
+
+        /// <summary> Partitions an interval of the view by a Boolean predicate, so that the examples for which the
+        /// predicate is true come first. </summary>
+        ///
+        /// <typeparam name="PartitionKeyType"> Type of predicate. </typeparam>
+        /// <param name="partitionKey"> A function that takes const reference to DatasetExampleType and returns a bool. </param>
+        /// <param name="fromIndex"> Zero-based position of the first example of the interval. </param>
+        /// <param name="size"> The number of examples in the interval, zero means all the way to the end. </param>
+        template <typename PartitionKeyType>
+        void Partition(PartitionKeyType partitionKey, size_t fromIndex = 0, size_t size = 0);
+
+        /// <summary> Returns a new view of the same dataset that contains examples drawn uniformly, with replacement,
+        /// from this view. </summary>
+        ///
+        /// <param name="rng"> [in,out] The random number generator. </param>
+        /// <param name="sampleSize"> The number of examples to draw, zero means the size of this view. </param>
+        ///
+        /// <returns> The bootstrap sample. </returns>
+        DatasetIndexView<DatasetExampleType> GetBootstrapSample(std::default_random_engine& rng, size_t sampleSize = 0) const;
+
+    private:
+        size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
+
+        Dataset<DatasetExampleType>* _pDataset = nullptr;
+        std::vector<uint32_t> _indices;
+    };
+}
+}
+
+#include "../tcc/DatasetIndexView.tcc"
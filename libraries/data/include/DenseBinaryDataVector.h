@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+#ifndef DENSEBINARYDATAVECTOR_H
+#define DENSEBINARYDATAVECTOR_H
+
+// math
+#include "Vector.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    // forward declaration
+    class DenseBinaryDataVector;
+
+    // forward declaration
+    template <IterationPolicy policy>
+    class DenseBinaryDataVectorIterator;
+
+    /// <summary> A read-only forward iterator that traverses the non-zero elements of a DenseBinaryDataVector. </summary>
+    template <>
+    class DenseBinaryDataVectorIterator<IterationPolicy::skipZeros> : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _index, 1.0 }; }
+
+    private:
+        // private ctor, can only be called from DenseBinaryDataVector
+        DenseBinaryDataVectorIterator(const uint64_t* bits, size_t size);
+        friend DenseBinaryDataVector;
+
+        // moves to the first set bit at or after a given index
+        void SkipTo(size_t index);
+
+        const uint64_t* _bits;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> A read-only forward iterator that traverses a prefix of a DenseBinaryDataVector, including zero elements. </summary>
+    template <>
+    class DenseBinaryDataVectorIterator<IterationPolicy::all> : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_index; }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const;
+
+    private:
+        // private ctor, can only be called from DenseBinaryDataVector
+        DenseBinaryDataVectorIterator(const uint64_t* bits, size_t prefixLength, size_t size);
+        friend DenseBinaryDataVector;
+
+        const uint64_t* _bits;
+        size_t _prefixLength;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> A binary data vector stored as a bitmap, with one bit per element of its prefix. This is the most
+    /// compact representation of binary vectors whose density is more than one eighth, since a sparse list of
+    /// indices needs at least a byte per non-zero element. Dot and AddTo work a 64-bit word at a time: words with few
+    /// set bits are visited one set bit at a time, and words with many set bits are processed without branches. </summary>
+    class DenseBinaryDataVector : public DataVectorBase<DenseBinaryDataVector>
+    {
+    public:
+        DenseBinaryDataVector() = default;
+
+        DenseBinaryDataVector(DenseBinaryDataVector&& other) = default;
+
+        DenseBinaryDataVector(const DenseBinaryDataVector&) = delete;
+
+        /// <summary> Constructs a data vector from an index value iterator. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> The index value iterator. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        DenseBinaryDataVector(IndexValueIteratorType indexValueIterator);
+
+        /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        DenseBinaryDataVector(std::initializer_list<IndexValue> list);
+
+        /// <summary> Constructs a data vector from an initializer list of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        DenseBinaryDataVector(std::initializer_list<double> list);
+
+        /// <summary> Constructs a data vector from a vector of index value pairs. </summary>
+        ///
+        /// <param name="vec"> The vector of index value pairs. </param>
+        DenseBinaryDataVector(std::vector<IndexValue> vec);
+
+        /// <summary> Constructs a data vector from a vector of values. </summary>
+        ///
+        /// <param name="vec"> The vector of values. </param>
+        DenseBinaryDataVector(std::vector<double> vec);
+
+        template <IterationPolicy policy>
+        using Iterator = DenseBinaryDataVectorIterator<policy>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const { return GetIterator<policy>(PrefixLength()); }
+
+        /// <summary> Sets the element at the given index to 1.0. Calls to this function must have a
+        /// monotonically increasing argument. The value argument must equal 0.0 or 1.0. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element, must be bigger than the biggest current index. </param>
+        /// <param name="value"> The element value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        virtual size_t PrefixLength() const override { return _prefixLength; }
+
+        /// <summary> Computes the vector squared 2-norm, which is the number of non-zero elements. </summary>
+        ///
+        /// <returns> The squared 2-norm of the vector. </returns>
+        virtual double Norm2Squared() const override;
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::DenseBinaryDataVector; }
+
+    private:
+        using DataVectorBase<DenseBinaryDataVector>::AppendElements;
+
+        std::vector<uint64_t> _bits;
+        size_t _prefixLength = 0;
+    };
+}
+}
+
+#include "../tcc/DenseBinaryDataVector.tcc"
+
+#endif // DENSEBINARYDATAVECTOR_H
@@ -12,6 +12,10 @@
 #include "IIterator.h"
 #include "StlContainerIterator.h"
 
+// stl
+#include <cstddef>
+#include <memory>
+
 namespace ell
 {
 namespace data
@@ -61,6 +65,88 @@ namespace data
     };
 
     using AutoSupervisedExampleIterator = ExampleIterator<AutoSupervisedExample>;
+
+    /// <summary> Interface for example iterators whose Get() function returns a const reference to an
+    /// example, which remains valid until the next call to Next(). </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    using IExampleConstIterator = typename utilities::IIterator<const ExampleType&>;
+
+    /// <summary> An example iterator that wraps an IExampleConstIterator. Unlike ExampleIterator, it
+    /// does not copy the examples that it visits when the underlying dataset already stores them in
+    /// the requested type. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    class ExampleConstIterator
+    {
+    public:
+        /// <summary> Constructs an instance of ExampleConstIterator. </summary>
+        ///
+        /// <param name="iterator"> Unique pointer to an IExampleConstIterator. </param>
+        ExampleConstIterator(std::unique_ptr<IExampleConstIterator<ExampleType>>&& iterator);
+
+        ExampleConstIterator(ExampleConstIterator<ExampleType>&&) = default;
+
+        // Copy ctor deleted because this class contains a unique_ptr
+        ExampleConstIterator(const ExampleConstIterator<ExampleType>&) = delete;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if the iterator is currently pointing to a valid iterate. </returns>
+        bool IsValid() const { return _iterator->IsValid(); }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { _iterator->Next(); }
+
+        /// <summary> Returns a const reference to the current example, which remains valid until the next call to Next(). </summary>
+        ///
+        /// <returns> A const reference to an example. </returns>
+        const ExampleType& Get() const { return _iterator->Get(); }
+
+    private:
+        std::unique_ptr<IExampleConstIterator<ExampleType>> _iterator;
+    };
+
+    /// <summary> An IExampleConstIterator that converts each example of a dataset to the requested type,
+    /// when it is first accessed. It is used when the dataset does not store examples of the requested type.
+    /// The dataset must outlive the iterator. </summary>
+    ///
+    /// <typeparam name="DatasetType"> The dataset type, which must have a GetExample(size_t) function
+    /// that returns an object with a CopyAs member function. </typeparam>
+    /// <typeparam name="IteratorExampleType"> The example type. </typeparam>
+    template <typename DatasetType, typename IteratorExampleType>
+    class ConvertingExampleConstIterator : public IExampleConstIterator<IteratorExampleType>
+    {
+    public:
+        /// <summary> Constructs a ConvertingExampleConstIterator. </summary>
+        ///
+        /// <param name="dataset"> Pointer to the dataset. </param>
+        /// <param name="begin"> Zero-based index of the first example. </param>
+        /// <param name="end"> Zero-based index one past the last example. </param>
+        ConvertingExampleConstIterator(const DatasetType* dataset, size_t begin, size_t end);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        virtual bool IsValid() const override { return _current < _end; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        virtual void Next() override;
+
+        /// <summary> Returns a const reference to the current example, converted to the requested type. </summary>
+        ///
+        /// <returns> A const reference to the example. </returns>
+        virtual const IteratorExampleType& Get() const override;
+
+    private:
+        const DatasetType* _dataset;
+        size_t _current;
+        size_t _end;
+        mutable IteratorExampleType _currentExample;
+        mutable bool _isConverted = false;
+    };
 }
 }
 
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FeatureHasher.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IndexValue.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> Implements the hashing trick: maps an arbitrarily large (and possibly very sparse) feature
+    /// index space onto a fixed space of 2^numBits indices. With signed hashing, the hash also chooses the
+    /// sign of each feature value, which makes the inner products in the hashed space unbiased estimates of
+    /// the inner products in the original space. </summary>
+    class FeatureHasher
+    {
+    public:
+        /// <summary> Constructs a FeatureHasher. </summary>
+        ///
+        /// <param name="numBits"> The number of bits in a hashed index, between 1 and 63. </param>
+        /// <param name="useSignedHashing"> true to multiply each value by a hashed sign. </param>
+        /// <param name="seed"> The hash seed. </param>
+        FeatureHasher(size_t numBits, bool useSignedHashing = true, uint64_t seed = 0);
+
+        /// <summary> Gets the number of bits in a hashed index. </summary>
+        ///
+        /// <returns> The number of bits. </returns>
+        size_t NumBits() const { return _numBits; }
+
+        /// <summary> Gets the size of the hashed feature space, 2^numBits. </summary>
+        ///
+        /// <returns> The size of the hashed feature space. </returns>
+        size_t GetOutputSize() const { return _mask + 1; }
+
+        /// <summary> Checks if the hasher uses signed hashing. </summary>
+        ///
+        /// <returns> true if the hasher uses signed hashing. </returns>
+        bool UsesSignedHashing() const { return _useSignedHashing; }
+
+        /// <summary> Maps an index-value pair to the hashed feature space. </summary>
+        ///
+        /// <param name="indexValue"> The index-value pair. </param>
+        ///
+        /// <returns> The hashed index and the (possibly negated) value. </returns>
+        IndexValue Hash(IndexValue indexValue) const;
+
+    private:
+        size_t _numBits;
+        uint64_t _mask;
+        bool _useSignedHashing;
+        uint64_t _seed;
+    };
+}
+}
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HashingIndexValueIterator.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FeatureHasher.h"
+#include "IndexValue.h"
+
+// stl
+#include <cstddef>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> An index-value iterator that wraps another index-value iterator and maps its non-zero
+    /// elements to a hashed feature space. Since hashing reorders the indices and distinct indices can
+    /// collide, the wrapped iterator is consumed when the iterator is constructed: the hashed elements are
+    /// sorted by index, colliding elements are summed, and elements that sum to zero are dropped. The
+    /// result can be used to construct any data vector type. </summary>
+    ///
+    /// <typeparam name="WrappedIndexValueIteratorType"> Type of the wrapped index value iterator. </typeparam>
+    template <typename WrappedIndexValueIteratorType>
+    class HashingIndexValueIterator : public IIndexValueIterator
+    {
+    public:
+        /// <summary> Constructs an instance of HashingIndexValueIterator. </summary>
+        ///
+        /// <param name="wrappedIterator"> The index value iterator whose non-zero elements are hashed. </param>
+        /// <param name="featureHasher"> The feature hasher. </param>
+        HashingIndexValueIterator(WrappedIndexValueIteratorType wrappedIterator, const FeatureHasher& featureHasher);
+
+        /// <summary> Returns True if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> True if the iterator is currently pointing to a valid iterate. </returns>
+        bool IsValid() const { return _current < _indexValues.size(); }
+
+        /// <summary> Proceeds to the Next iterate </summary>
+        void Next() { ++_current; }
+
+        /// <summary> Returns The current index-value pair </summary>
+        ///
+        /// <returns> The current index-value pair </returns>
+        IndexValue Get() const { return _indexValues[_current]; }
+
+    private:
+        std::vector<IndexValue> _indexValues;
+        size_t _current = 0;
+    };
+
+    /// <summary> Creates a HashingIndexValueIterator. </summary>
+    ///
+    /// <param name="wrappedIterator"> The index value iterator whose non-zero elements are hashed. </param>
+    /// <param name="featureHasher"> The feature hasher. </param>
+    template <typename WrappedIndexValueIteratorType>
+    HashingIndexValueIterator<WrappedIndexValueIteratorType> MakeHashingIndexValueIterator(WrappedIndexValueIteratorType wrappedIterator, const FeatureHasher& featureHasher)
+    {
+        return HashingIndexValueIterator<WrappedIndexValueIteratorType>(std::move(wrappedIterator), featureHasher);
+    }
+
+    /// <summary> Maps a data vector to a hashed feature space. </summary>
+    ///
+    /// <typeparam name="ReturnType"> The type of the hashed data vector. </typeparam>
+    /// <typeparam name="DataVectorType"> The type of the data vector to hash. </typeparam>
+    /// <param name="dataVector"> The data vector to hash. </param>
+    /// <param name="featureHasher"> The feature hasher. </param>
+    ///
+    /// <returns> The hashed data vector. </returns>
+    template <typename ReturnType, typename DataVectorType>
+    ReturnType HashDataVector(const DataVectorType& dataVector, const FeatureHasher& featureHasher);
+}
+}
+
+#include "../tcc/HashingIndexValueIterator.tcc"
@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MappedDataset.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CsrDatasetView.h"
+#include "DataVectorSpan.h"
+#include "Dataset.h"
+#include "Example.h"
+#include "ExampleIterator.h"
+#include "IndexValue.h"
+#include "WeightLabel.h"
+
+// math
+#include "Vector.h"
+
+// utilities
+#include "MemoryMappedFile.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    //
+    // Binary CSR dataset file format (all integers are little-endian, every section starts at an 8-byte boundary):
+    //
+    //     header       MappedDatasetHeader (40 bytes)
+    //     labels       double[numExamples]
+    //     weights      double[numExamples]
+    //     rowOffsets   uint64[numExamples + 1], where example i occupies positions [rowOffsets[i], rowOffsets[i+1]) of the next two sections
+    //     indices      uint32[numNonZeros], increasing within each example, followed by padding to an 8-byte boundary
+    //     values       float[numNonZeros] or double[numNonZeros], as specified in the header
+    //
+
+    /// <summary> The type used to store the values in a binary CSR dataset file. </summary>
+    enum class MappedDatasetValueType : uint32_t
+    {
+        floatValues = 0,
+        doubleValues = 1
+    };
+
+    /// <summary> The header at the beginning of a binary CSR dataset file. </summary>
+    struct MappedDatasetHeader
+    {
+        char magic[8];
+        uint64_t numExamples;
+        uint64_t numNonZeros;
+        uint64_t numFeatures;
+        MappedDatasetValueType valueType;
+        uint32_t reserved;
+    };
+
+    /// <summary> A lightweight read-only view of one example's data vector, which points directly into a
+    /// memory mapped binary CSR dataset file. The values are stored as floats or as doubles, as specified
+    /// in the file, and the view forwards its operations to the DataVectorSpan of the matching type. It
+    /// supports the operations that trainers and evaluators need from a data vector, and can be copied
+    /// into any other data vector type with CopyAs. </summary>
+    class MappedDataVector
+    {
+    public:
+        /// <summary> Constructs a view of a sparse vector whose values are stored as floats. </summary>
+        ///
+        /// <param name="indices"> Pointer to the increasing indices of the non-zero elements. </param>
+        /// <param name="values"> Pointer to the values of the non-zero elements. </param>
+        /// <param name="numNonZeros"> The number of non-zero elements. </param>
+        MappedDataVector(const uint32_t* indices, const float* values, size_t numNonZeros);
+
+        /// <summary> Constructs a view of a sparse vector whose values are stored as doubles. </summary>
+        ///
+        /// <param name="indices"> Pointer to the increasing indices of the non-zero elements. </param>
+        /// <param name="values"> Pointer to the values of the non-zero elements. </param>
+        /// <param name="numNonZeros"> The number of non-zero elements. </param>
+        MappedDataVector(const uint32_t* indices, const double* values, size_t numNonZeros);
+
+        /// <summary> Gets the number of non-zero elements. </summary>
+        ///
+        /// <returns> The number of non-zero elements. </returns>
+        size_t NumNonZeros() const { return _isFloat ? _floatSpan.NumNonZeros() : _doubleSpan.NumNonZeros(); }
+
+        /// <summary> Returns the first index in the suffix of zeros at the end of this vector. </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        size_t PrefixLength() const { return _isFloat ? _floatSpan.PrefixLength() : _doubleSpan.PrefixLength(); }
+
+        /// <summary> Computes the squared 2-norm of the vector. </summary>
+        ///
+        /// <returns> The squared 2-norm of the vector. </returns>
+        double Norm2Squared() const { return _isFloat ? _floatSpan.Norm2Squared() : _doubleSpan.Norm2Squared(); }
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        double Dot(math::UnorientedConstVectorReference<double> vector) const { return _isFloat ? _floatSpan.Dot(vector) : _doubleSpan.Dot(vector); }
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        void AddTo(math::RowVectorReference<double> vector) const;
+
+        /// <summary> Copies the contents of this data vector into a double array of size PrefixLength(). </summary>
+        ///
+        /// <returns> The array. </returns>
+        std::vector<double> ToArray() const { return ToArray(PrefixLength()); }
+
+        /// <summary> Copies the contents of this data vector into a double array of a given size. </summary>
+        ///
+        /// <param name="size"> The desired array size. </param>
+        ///
+        /// <returns> The array. </returns>
+        std::vector<double> ToArray(size_t size) const { return _isFloat ? _floatSpan.ToArray(size) : _doubleSpan.ToArray(size); }
+
+        /// <summary> Copies this data vector into another type of data vector. </summary>
+        ///
+        /// <typeparam name="ReturnType"> The return type. </typeparam>
+        ///
+        /// <returns> The new data vector. </returns>
+        template <typename ReturnType>
+        ReturnType CopyAs() const;
+
+        /// <summary> Human readable printout to an output stream. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write to. </param>
+        void Print(std::ostream& os) const;
+
+    private:
+        FloatDataVectorSpan _floatSpan;
+        DoubleDataVectorSpan _doubleSpan;
+        bool _isFloat;
+    };
+
+    /// <summary> A lightweight read-only view of an example in a memory mapped binary CSR dataset file. </summary>
+    using MappedExample = SpanExample<MappedDataVector>;
+
+    /// <summary> A read-only, zero-copy dataset backed by a memory mapped binary CSR dataset file. Opening
+    /// the dataset takes constant time, examples are read directly from the mapping, and several processes
+    /// that open the same file share the operating system's page cache. The header is checked when the file
+    /// is opened, and each example is checked when it is read. </summary>
+    class MappedDataset : public DatasetBase
+    {
+    public:
+        /// <summary> An iterator whose Get() function returns a lightweight view of the current example.
+        /// The iterator shares ownership of the mapping. </summary>
+        using ExampleViewIterator = CsrExampleViewIterator<MappedDataset>;
+
+        /// <summary> Opens a binary CSR dataset file. Throws a DataFormatException if the header is invalid or
+        /// the sections don't fit in the file. </summary>
+        ///
+        /// <param name="filepath"> The file path. </param>
+        MappedDataset(const std::string& filepath);
+
+        MappedDataset(const MappedDataset&) = default;
+
+        MappedDataset(MappedDataset&&) = default;
+
+        MappedDataset& operator=(const MappedDataset&) = default;
+
+        MappedDataset& operator=(MappedDataset&&) = default;
+
+        /// <summary> Returns the number of examples in the data set. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return static_cast<size_t>(_header->numExamples); }
+
+        /// <summary> Returns the maximal size of any example. </summary>
+        ///
+        /// <returns> The maximal size of any example. </returns>
+        size_t NumFeatures() const { return static_cast<size_t>(_header->numFeatures); }
+
+        /// <summary> Gets the type used to store the values in the file. </summary>
+        ///
+        /// <returns> The value type. </returns>
+        MappedDatasetValueType GetValueType() const { return _header->valueType; }
+
+        /// <summary> Returns a view of an example. Throws a DataFormatException if the example's row offsets
+        /// or feature indices are invalid. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A view of the specified example. </returns>
+        MappedExample GetExample(size_t index) const;
+
+        /// <summary> Returns a view of an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> A view of the specified example. </returns>
+        MappedExample operator[](size_t index) const { return GetExample(index); }
+
+        /// <summary> Returns an iterator that traverses the examples. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = AutoSupervisedExample>
+        ExampleIterator<IteratorExampleType> GetExampleIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an iterator whose Get() function returns a const reference to a copy of the
+        /// current example in a given type. The copy remains valid until the next call to Next(). </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <typename IteratorExampleType = AutoSupervisedExample>
+        ExampleConstIterator<IteratorExampleType> GetExampleConstIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an iterator that traverses views of the examples, without copying them. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example to iterate over. </param>
+        /// <param name="size"> The number of examples to iterate over, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        ExampleViewIterator GetExampleReferenceIterator(size_t fromIndex = 0, size_t size = 0) const;
+
+        /// <summary> Returns an AnyDataset that represents an interval of examples from this dataset. </summary>
+        ///
+        /// <param name="fromIndex"> Zero-based index of the first example in the AnyDataset. </param>
+        /// <param name="size"> The number of examples to include, a value of zero means all
+        /// the way to the end. </param>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset(size_t fromIndex = 0, size_t size = 0) const { return AnyDataset(this, fromIndex, size); }
+
+        /// <summary> Prints this object. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write data to. </param>
+        /// <param name="tabs"> The number of tabs. </param>
+        /// <param name="fromIndex"> Zero-based index of the first row to print. </param>
+        /// <param name="size"> The number of rows to print, or 0 to print until the end. </param>
+        void Print(std::ostream& os, size_t tabs = 0, size_t fromIndex = 0, size_t size = 0) const;
+
+    private:
+        size_t CorrectRangeSize(size_t fromIndex, size_t size) const;
+        void ValidateRow(size_t index) const;
+
+        std::shared_ptr<const utilities::MemoryMappedFile> _file;
+        std::string _filepath;
+        const MappedDatasetHeader* _header;
+        const uint64_t* _rowOffsets;
+        const uint32_t* _indices;
+        CsrDatasetView<float, MappedDataVector> _floatView;
+        CsrDatasetView<double, MappedDataVector> _doubleView;
+    };
+
+    /// <summary> Returns true if a file starts with the header of a binary CSR dataset file. </summary>
+    ///
+    /// <param name="filepath"> The file path. </param>
+    ///
+    /// <returns> true if the file is a binary CSR dataset file. </returns>
+    bool IsMappedDatasetFile(const std::string& filepath);
+
+    /// <summary> Writes a dataset to a stream in the binary CSR dataset format, which can then be opened with MappedDataset. </summary>
+    ///
+    /// <typeparam name="DatasetType"> The dataset type, a Dataset or a MappedDataset. </typeparam>
+    /// <param name="dataset"> The dataset. </param>
+    /// <param name="stream"> The output stream, which should be opened in binary mode. </param>
+    /// <param name="valueType"> The type used to store the values. </param>
+    template <typename DatasetType>
+    void SaveMappedDataset(const DatasetType& dataset, std::ostream& stream, MappedDatasetValueType valueType = MappedDatasetValueType::doubleValues);
+}
+}
+
+#include "../tcc/MappedDataset.tcc"
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelDatasetLoader.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ChunkedLineIterator.h"
+#include "Dataset.h"
+#include "Example.h"
+#include "SingleLineParsingExampleIterator.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary>
+    /// Creates a dataset by parsing a text file on multiple threads. The file is split into
+    /// line-aligned chunks, each chunk is parsed on its own thread (one example per line, as
+    /// in SingleLineParsingExampleIterator), and the examples are added to the dataset in
+    /// their original file order.
+    /// </summary>
+    ///
+    /// <typeparam name="MetadataParserType"> Metadata parser type. </typeparam>
+    /// <typeparam name="DataVectorParserType"> DataVector parser type. </typeparam>
+    /// <param name="filepath"> The path of the text file. </param>
+    /// <param name="metadataParser"> The metadata parser, copied to each thread. </param>
+    /// <param name="dataVectorParser"> The data vector parser, copied to each thread. </param>
+    /// <param name="numThreads"> The number of threads to use, or zero to use one thread per hardware thread. </param>
+    ///
+    /// <returns> A Dataset. </returns>
+    template <typename MetadataParserType, typename DataVectorParserType>
+    AutoSupervisedDataset MakeDatasetInParallel(const std::string& filepath, MetadataParserType metadataParser, DataVectorParserType dataVectorParser, size_t numThreads = 0);
+
+    /// <summary>
+    /// Creates a dataset by parsing a text file on multiple threads, as in MakeDatasetInParallel, and
+    /// transforming each example on the thread that parsed it. This builds a transformed (for example,
+    /// mapped) dataset in a single pass, without an intermediate dataset of untransformed examples.
+    /// </summary>
+    ///
+    /// <typeparam name="MetadataParserType"> Metadata parser type. </typeparam>
+    /// <typeparam name="DataVectorParserType"> DataVector parser type. </typeparam>
+    /// <typeparam name="TransformationType"> Transformation type, a function from a const
+    /// AutoSupervisedExample&amp; to an AutoSupervisedExample. </typeparam>
+    /// <param name="filepath"> The path of the text file. </param>
+    /// <param name="metadataParser"> The metadata parser, copied to each thread. </param>
+    /// <param name="dataVectorParser"> The data vector parser, copied to each thread. </param>
+    /// <param name="transformation"> The example transformation, copied to each thread, so it need not be thread-safe. </param>
+    /// <param name="numThreads"> The number of threads to use, or zero to use one thread per hardware thread. </param>
+    ///
+    /// <returns> A Dataset. </returns>
+    template <typename MetadataParserType, typename DataVectorParserType, typename TransformationType>
+    AutoSupervisedDataset MakeTransformedDatasetInParallel(const std::string& filepath, MetadataParserType metadataParser, DataVectorParserType dataVectorParser, TransformationType transformation, size_t numThreads = 0);
+}
+}
+
+#include "../tcc/ParallelDatasetLoader.tcc"
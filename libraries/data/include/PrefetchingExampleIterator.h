@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PrefetchingExampleIterator.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Example.h"
+#include "ExampleIterator.h"
+
+// stl
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> An example iterator that wraps another example iterator and reads ahead from it on a
+    /// background thread, into a bounded ring of examples. This allows the work done by the wrapped
+    /// iterator (such as reading and parsing a file) to overlap with the work done by the consumer of the
+    /// examples. Exceptions thrown by the wrapped iterator are rethrown on the consumer's thread. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    class PrefetchingExampleIterator : public IExampleIterator<ExampleType>
+    {
+    public:
+        /// <summary> Constructs a PrefetchingExampleIterator and starts the background thread. </summary>
+        ///
+        /// <param name="exampleIterator"> The example iterator to read ahead from. Anything that this
+        /// iterator refers to (such as an input stream) must outlive the PrefetchingExampleIterator. </param>
+        /// <param name="bufferSize"> The maximal number of examples read ahead. </param>
+        PrefetchingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize);
+
+        PrefetchingExampleIterator(const PrefetchingExampleIterator&) = delete;
+
+        PrefetchingExampleIterator& operator=(const PrefetchingExampleIterator&) = delete;
+
+        /// <summary> Stops the background thread and waits for it to finish. </summary>
+        virtual ~PrefetchingExampleIterator();
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. Blocks until
+        /// the next example is available, or until the wrapped iterator is exhausted. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        virtual bool IsValid() const override;
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        virtual void Next() override;
+
+        /// <summary> Returns the current example. </summary>
+        ///
+        /// <returns> The example. </returns>
+        virtual ExampleType Get() const override;
+
+    private:
+        void Prefetch();
+        void WaitForExample(std::unique_lock<std::mutex>& lock) const;
+
+        ExampleIterator<ExampleType> _exampleIterator;
+        std::vector<ExampleType> _ring;
+        size_t _head = 0;
+        size_t _count = 0;
+        bool _isDone = false;
+        bool _isStopping = false;
+        std::exception_ptr _exception;
+
+        mutable std::mutex _mutex;
+        mutable std::condition_variable _notEmpty;
+        std::condition_variable _notFull;
+        std::thread _thread;
+    };
+
+    /// <summary> Wraps an example iterator with a PrefetchingExampleIterator. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    /// <param name="exampleIterator"> The example iterator to read ahead from. Anything that this
+    /// iterator refers to (such as an input stream) must outlive the returned iterator. </param>
+    /// <param name="bufferSize"> The maximal number of examples read ahead. </param>
+    ///
+    /// <returns> An example iterator that reads ahead on a background thread. </returns>
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakePrefetchingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize = 1024);
+}
+}
+
+#include "../tcc/PrefetchingExampleIterator.tcc"
@@ -0,0 +1,560 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ReducedPrecisionDataVector.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DataVector.h"
+#include "IndexValue.h"
+
+#ifndef REDUCEDPRECISIONDATAVECTOR_H
+#define REDUCEDPRECISIONDATAVECTOR_H
+
+// math
+#include "Vector.h"
+
+// utilities
+#include "CompressedIntegerList.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> Converts a number to the nearest IEEE 754 half precision (float16) number. </summary>
+    ///
+    /// <param name="value"> The number. </param>
+    ///
+    /// <returns> The bits of the half precision number. </returns>
+    uint16_t DoubleToHalf(double value);
+
+    /// <summary> Converts an IEEE 754 half precision (float16) number to a float. The conversion is exact. </summary>
+    ///
+    /// <param name="bits"> The bits of the half precision number. </param>
+    ///
+    /// <returns> The float. </returns>
+    inline float HalfToFloat(uint16_t bits);
+
+    /// <summary> Stores numbers as IEEE 754 half precision (float16) numbers, which have 11 significant
+    /// bits and range up to 65504. </summary>
+    class HalfPrecisionCodec
+    {
+    public:
+        using StorageType = uint16_t;
+
+        /// <summary> Returns a codec suitable for a given set of values. </summary>
+        ///
+        /// <param name="values"> The values. </param>
+        ///
+        /// <returns> The codec. </returns>
+        static HalfPrecisionCodec Fit(const std::vector<double>&) { return HalfPrecisionCodec(); }
+
+        /// <summary> Checks whether a value is within the range of this codec. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        ///
+        /// <returns> true if the value can be encoded without clipping. </returns>
+        bool CanEncode(double) const { return true; }
+
+        /// <summary> Encodes a value. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        ///
+        /// <returns> The encoded value. </returns>
+        StorageType Encode(double value) const { return DoubleToHalf(value); }
+
+        /// <summary> Decodes a value. </summary>
+        ///
+        /// <param name="code"> The encoded value. </param>
+        ///
+        /// <returns> The decoded value. </returns>
+        double Decode(StorageType code) const { return static_cast<double>(HalfToFloat(code)); }
+    };
+
+    /// <summary> Stores numbers as 8-bit unsigned integers, with an affine mapping: a code q represents the
+    /// value (q - zeroPoint) * scale. The zero point is an integer, so the value zero is represented exactly,
+    /// and the scale is chosen so that the 256 codes cover the range of the values. </summary>
+    class AffineByteCodec
+    {
+    public:
+        using StorageType = uint8_t;
+
+        /// <summary> Constructs a codec that represents the integers 0 to 255. </summary>
+        AffineByteCodec() = default;
+
+        /// <summary> Constructs a codec whose range covers a given interval, and zero. </summary>
+        ///
+        /// <param name="minValue"> The smallest value to represent. </param>
+        /// <param name="maxValue"> The largest value to represent. </param>
+        AffineByteCodec(double minValue, double maxValue);
+
+        /// <summary> Returns a codec whose range covers a given set of values. </summary>
+        ///
+        /// <param name="values"> The values. </param>
+        ///
+        /// <returns> The codec. </returns>
+        static AffineByteCodec Fit(const std::vector<double>& values);
+
+        /// <summary> Checks whether a value is within the range of this codec. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        ///
+        /// <returns> true if the value can be encoded without clipping. </returns>
+        bool CanEncode(double value) const;
+
+        /// <summary> Encodes a value, clipping it to the range of the codec. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        ///
+        /// <returns> The encoded value. </returns>
+        StorageType Encode(double value) const;
+
+        /// <summary> Decodes a value. </summary>
+        ///
+        /// <param name="code"> The encoded value. </param>
+        ///
+        /// <returns> The decoded value. </returns>
+        double Decode(StorageType code) const { return (static_cast<double>(code) - _zeroPoint) * _scale; }
+
+        /// <summary> Gets the scale. </summary>
+        ///
+        /// <returns> The scale. </returns>
+        double GetScale() const { return _scale; }
+
+        /// <summary> Gets the zero point. </summary>
+        ///
+        /// <returns> The code that represents zero. </returns>
+        double GetZeroPoint() const { return _zeroPoint; }
+
+    private:
+        double _scale = 1.0;
+        double _zeroPoint = 0.0;
+    };
+
+    // forward declaration of ReducedPrecisionDataVector
+    template <typename CodecType>
+    class ReducedPrecisionDataVector;
+
+    // forward declaration of ReducedPrecisionDataVectorIterator
+    template <IterationPolicy policy, typename CodecType>
+    class ReducedPrecisionDataVectorIterator;
+
+    /// <summary> A read-only forward iterator that traverses the non-zero elements. </summary>
+    template <typename CodecType>
+    class ReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType> : public IIndexValueIterator
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _index, _codec.Decode(_data[_index]) }; }
+
+    private:
+        // private ctor, can only be called from ReducedPrecisionDataVector
+        ReducedPrecisionDataVectorIterator(const StorageType* data, size_t dataSize, CodecType codec, size_t size);
+        friend ReducedPrecisionDataVector<CodecType>;
+
+        void SkipZeros();
+
+        const StorageType* _data;
+        CodecType _codec;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> A read-only forward iterator that traverses a prefix of the vector, including zero elements. </summary>
+    template <typename CodecType>
+    class ReducedPrecisionDataVectorIterator<IterationPolicy::all, CodecType> : public IIndexValueIterator
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next() { ++_index; }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _index, _index < _dataSize ? _codec.Decode(_data[_index]) : 0.0 }; }
+
+    private:
+        // private ctor, can only be called from ReducedPrecisionDataVector
+        ReducedPrecisionDataVectorIterator(const StorageType* data, size_t dataSize, CodecType codec, size_t size);
+        friend ReducedPrecisionDataVector<CodecType>;
+
+        const StorageType* _data;
+        size_t _dataSize;
+        CodecType _codec;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> A dense data vector that stores its elements in reduced precision, as determined by a codec.
+    /// Dot and AddTo decode the elements on the fly, in tight loops that compilers vectorize. </summary>
+    ///
+    /// <typeparam name="CodecType"> The codec that encodes and decodes the elements. </typeparam>
+    template <typename CodecType>
+    class ReducedPrecisionDataVector : public DataVectorBase<ReducedPrecisionDataVector<CodecType>>
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        ReducedPrecisionDataVector() = default;
+
+        ReducedPrecisionDataVector(ReducedPrecisionDataVector&& other) = default;
+
+        ReducedPrecisionDataVector(const ReducedPrecisionDataVector&) = delete;
+
+        /// <summary> Constructs a data vector from an index value iterator. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> The index value iterator. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        ReducedPrecisionDataVector(IndexValueIteratorType indexValueIterator);
+
+        /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        ReducedPrecisionDataVector(std::initializer_list<IndexValue> list);
+
+        /// <summary> Constructs a data vector from an initializer list of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        ReducedPrecisionDataVector(std::initializer_list<double> list);
+
+        /// <summary> Constructs a data vector from a vector of index value pairs. </summary>
+        ///
+        /// <param name="vec"> The vector of index value pairs. </param>
+        ReducedPrecisionDataVector(std::vector<IndexValue> vec);
+
+        /// <summary> Constructs a data vector from a vector of values. </summary>
+        ///
+        /// <param name="vec"> The vector of values. </param>
+        ReducedPrecisionDataVector(std::vector<double> vec);
+
+        template <IterationPolicy policy>
+        using Iterator = ReducedPrecisionDataVectorIterator<policy, CodecType>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const { return GetIterator<policy>(PrefixLength()); }
+
+        /// <summary> Appends an element to the end of the data vector. If the value is outside of the range
+        /// of the codec, the codec is refitted and the existing elements are encoded again. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element, must be bigger than the biggest current index. </param>
+        /// <param name="value"> The element value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        virtual size_t PrefixLength() const override { return _data.size(); }
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+        /// <summary> Gets the codec. </summary>
+        ///
+        /// <returns> The codec. </returns>
+        const CodecType& GetCodec() const { return _codec; }
+
+    private:
+        // fits the codec to a dense array of values, and encodes them
+        void SetValues(const std::vector<double>& values);
+
+        CodecType _codec;
+        std::vector<StorageType> _data;
+    };
+
+    // forward declaration of SparseReducedPrecisionDataVector
+    template <typename CodecType>
+    class SparseReducedPrecisionDataVector;
+
+    // forward declaration of SparseReducedPrecisionDataVectorIterator
+    template <IterationPolicy policy, typename CodecType>
+    class SparseReducedPrecisionDataVectorIterator;
+
+    /// <summary> A read-only forward iterator that traverses the non-zero elements. </summary>
+    template <typename CodecType>
+    class SparseReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType> : public IIndexValueIterator
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _indexIterator.IsValid() && _indexIterator.Get() < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next()
+        {
+            _indexIterator.Next();
+            ++_values;
+        }
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _indexIterator.Get(), _codec.Decode(*_values) }; }
+
+    private:
+        // private ctor, can only be called from SparseReducedPrecisionDataVector
+        SparseReducedPrecisionDataVectorIterator(const utilities::CompressedIntegerList::Iterator& indexIterator, const StorageType* values, CodecType codec, size_t size);
+        friend SparseReducedPrecisionDataVector<CodecType>;
+
+        utilities::CompressedIntegerList::Iterator _indexIterator;
+        const StorageType* _values;
+        CodecType _codec;
+        size_t _size;
+    };
+
+    /// <summary> A read-only forward iterator that traverses a prefix of the vector, including zero elements. </summary>
+    template <typename CodecType>
+    class SparseReducedPrecisionDataVectorIterator<IterationPolicy::all, CodecType> : public IIndexValueIterator
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        bool IsValid() const { return _index < _size; }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        void Next();
+
+        /// <summary> Returns the current iterate. </summary>
+        ///
+        /// <returns> An IndexValue that represents the current iterate. </returns>
+        IndexValue Get() const { return IndexValue{ _index, _index == _iteratorIndex ? _codec.Decode(*_values) : 0.0 }; }
+
+    private:
+        // private ctor, can only be called from SparseReducedPrecisionDataVector
+        SparseReducedPrecisionDataVectorIterator(const utilities::CompressedIntegerList::Iterator& indexIterator, const StorageType* values, CodecType codec, size_t size);
+        friend SparseReducedPrecisionDataVector<CodecType>;
+
+        utilities::CompressedIntegerList::Iterator _indexIterator;
+        const StorageType* _values;
+        CodecType _codec;
+        size_t _iteratorIndex;
+        size_t _size;
+        size_t _index = 0;
+    };
+
+    /// <summary> A sparse data vector that stores the values of its non-zero elements in reduced precision,
+    /// as determined by a codec. </summary>
+    ///
+    /// <typeparam name="CodecType"> The codec that encodes and decodes the elements. </typeparam>
+    template <typename CodecType>
+    class SparseReducedPrecisionDataVector : public DataVectorBase<SparseReducedPrecisionDataVector<CodecType>>
+    {
+    public:
+        using StorageType = typename CodecType::StorageType;
+
+        SparseReducedPrecisionDataVector() = default;
+
+        SparseReducedPrecisionDataVector(SparseReducedPrecisionDataVector&& other) = default;
+
+        SparseReducedPrecisionDataVector(const SparseReducedPrecisionDataVector&) = delete;
+
+        /// <summary> Constructs a data vector from an index value iterator. </summary>
+        ///
+        /// <typeparam name="IndexValueIteratorType"> Type of index value iterator. </typeparam>
+        /// <param name="indexValueIterator"> The index value iterator. </param>
+        template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept = true>
+        SparseReducedPrecisionDataVector(IndexValueIteratorType indexValueIterator);
+
+        /// <summary> Constructs a data vector from an initializer list of index value pairs. </summary>
+        ///
+        /// <param name="list"> The initializer list. </param>
+        SparseReducedPrecisionDataVector(std::initializer_list<IndexValue> list);
+
+        /// <summary> Constructs a data vector from an initializer list of values. </summary>
+        ///
+        /// <param name="list"> The initializer list of values. </param>
+        SparseReducedPrecisionDataVector(std::initializer_list<double> list);
+
+        /// <summary> Constructs a data vector from a vector of index value pairs. </summary>
+        ///
+        /// <param name="vec"> The vector of index value pairs. </param>
+        SparseReducedPrecisionDataVector(std::vector<IndexValue> vec);
+
+        /// <summary> Constructs a data vector from a vector of values. </summary>
+        ///
+        /// <param name="vec"> The vector of values. </param>
+        SparseReducedPrecisionDataVector(std::vector<double> vec);
+
+        template <IterationPolicy policy>
+        using Iterator = SparseReducedPrecisionDataVectorIterator<policy, CodecType>;
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of the vector.
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        /// <param name="size"> The prefix size. </param>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator(size_t size) const { return Iterator<policy>(_indexList.GetIterator(), _values.data(), _codec, size); }
+
+        /// <summary>
+        /// Returns an indexValue iterator that points to the beginning of the vector, which iterates
+        /// over a prefix of length PrefixLength().
+        /// </summary>
+        ///
+        /// <typeparam name="policy"> The iteration policy. </typeparam>
+        ///
+        /// <returns> The iterator. </returns>
+        template <IterationPolicy policy>
+        Iterator<policy> GetIterator() const { return GetIterator<policy>(PrefixLength()); }
+
+        /// <summary> Appends an element to the end of the data vector. If the value is outside of the range
+        /// of the codec, the codec is refitted and the existing elements are encoded again. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the element, must be bigger than the biggest current index. </param>
+        /// <param name="value"> The element value. </param>
+        virtual void AppendElement(size_t index, double value) override;
+
+        /// <summary>
+        /// A data vector has infinite dimension and ends with a suffix of zeros. This function returns
+        /// the first index in this suffix. Equivalently, the returned value is one plus the index of the
+        /// last non-zero element.
+        /// </summary>
+        ///
+        /// <returns> The first index of the suffix of zeros at the end of this vector. </returns>
+        virtual size_t PrefixLength() const override { return _indexList.Size() == 0 ? 0 : _indexList.Max() + 1; }
+
+        /// <summary> Computes the dot product with another vector. </summary>
+        ///
+        /// <param name="vector"> The other vector. </param>
+        ///
+        /// <returns> A dot product. </returns>
+        virtual double Dot(const math::UnorientedConstVectorReference<double> vector) const override;
+
+        /// <summary> Adds this data vector to a math::RowVector </summary>
+        ///
+        /// <param name="vector"> [in,out] The vector to which this data vector is added. </param>
+        virtual void AddTo(math::RowVectorReference<double> vector) const override;
+
+        /// <summary> Gets the codec. </summary>
+        ///
+        /// <returns> The codec. </returns>
+        const CodecType& GetCodec() const { return _codec; }
+
+    private:
+        // fits the codec to the non-zero elements of an index value iterator, and encodes them
+        template <typename IndexValueIteratorType>
+        void SetElements(IndexValueIteratorType indexValueIterator);
+
+        CodecType _codec;
+        utilities::CompressedIntegerList _indexList;
+        std::vector<StorageType> _values;
+    };
+
+    /// <summary> A dense data vector with half precision (float16) elements. </summary>
+    struct HalfDataVector : public ReducedPrecisionDataVector<HalfPrecisionCodec>
+    {
+        using ReducedPrecisionDataVector<HalfPrecisionCodec>::ReducedPrecisionDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::HalfDataVector; }
+    };
+
+    /// <summary> A dense data vector with 8-bit affine quantized elements. </summary>
+    struct QuantizedByteDataVector : public ReducedPrecisionDataVector<AffineByteCodec>
+    {
+        using ReducedPrecisionDataVector<AffineByteCodec>::ReducedPrecisionDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::QuantizedByteDataVector; }
+    };
+
+    /// <summary> A sparse data vector with half precision (float16) elements. </summary>
+    struct SparseHalfDataVector : public SparseReducedPrecisionDataVector<HalfPrecisionCodec>
+    {
+        using SparseReducedPrecisionDataVector<HalfPrecisionCodec>::SparseReducedPrecisionDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::SparseHalfDataVector; }
+    };
+
+    /// <summary> A sparse data vector with 8-bit affine quantized elements. </summary>
+    struct SparseQuantizedByteDataVector : public SparseReducedPrecisionDataVector<AffineByteCodec>
+    {
+        using SparseReducedPrecisionDataVector<AffineByteCodec>::SparseReducedPrecisionDataVector;
+
+        /// <summary> Gets the data vector type. </summary>
+        ///
+        /// <returns> The data vector type. </returns>
+        virtual IDataVector::Type GetType() const override { return IDataVector::Type::SparseQuantizedByteDataVector; }
+    };
+}
+}
+
+#include "../tcc/ReducedPrecisionDataVector.tcc"
+
+#endif // REDUCEDPRECISIONDATAVECTOR_H
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SharedDataset.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dataset.h"
+
+// stl
+#include <cstddef>
+#include <memory>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> A read-only, random-access reference to the examples of an AnyDataset, which many trainers
+    /// and evaluators can hold at the same time without copying the data. When the AnyDataset refers to a
+    /// Dataset of the requested example type, the SharedDataset refers to its examples directly, and that
+    /// dataset must outlive the SharedDataset. Otherwise, the examples are converted once into a dataset
+    /// that is owned by the SharedDataset and shared by all of its copies. Trainers keep their mutable
+    /// per-example state in their own arrays, indexed by the position of the example in the SharedDataset. </summary>
+    ///
+    /// <typeparam name="DatasetExampleType"> The example type. </typeparam>
+    template <typename DatasetExampleType>
+    class SharedDataset
+    {
+    public:
+        SharedDataset() = default;
+
+        /// <summary> Constructs a SharedDataset from an AnyDataset. </summary>
+        ///
+        /// <param name="anyDataset"> The AnyDataset. </param>
+        SharedDataset(const AnyDataset& anyDataset);
+
+        /// <summary> Returns the number of examples in the dataset. </summary>
+        ///
+        /// <returns> The number of examples. </returns>
+        size_t NumExamples() const { return _size; }
+
+        /// <summary> Returns a const reference to an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Const reference to the specified example. </returns>
+        const DatasetExampleType& GetExample(size_t index) const { return _pDataset->GetExample(_fromIndex + index); }
+
+        /// <summary> Returns a const reference to an example. </summary>
+        ///
+        /// <param name="index"> Zero-based index of the example. </param>
+        ///
+        /// <returns> Const reference to the specified example. </returns>
+        const DatasetExampleType& operator[](size_t index) const { return _pDataset->GetExample(_fromIndex + index); }
+
+        /// <summary> Gets an iterator that traverses the examples in order. </summary>
+        ///
+        /// <returns> The example reference iterator. </returns>
+        ExampleReferenceIterator<DatasetExampleType> GetExampleReferenceIterator() const;
+
+        /// <summary> Returns an AnyDataset that refers to the same examples, which can be passed on to other
+        /// trainers and evaluators so that they share this SharedDataset's examples. </summary>
+        ///
+        /// <returns> The AnyDataset. </returns>
+        AnyDataset GetAnyDataset() const;
+
+        /// <summary> Checks if the SharedDataset had to convert the examples of the AnyDataset it was
+        /// constructed from into a dataset of its own. </summary>
+        ///
+        /// <returns> true if the examples were converted. </returns>
+        bool OwnsExamples() const { return _ownedDataset != nullptr; }
+
+    private:
+        std::shared_ptr<const Dataset<DatasetExampleType>> _ownedDataset;
+        const Dataset<DatasetExampleType>* _pDataset = nullptr;
+        size_t _fromIndex = 0;
+        size_t _size = 0;
+    };
+}
+}
+
+#include "../tcc/SharedDataset.tcc"
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ShufflingExampleIterator.h (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Example.h"
+#include "ExampleIterator.h"
+
+// stl
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    /// <summary> An example iterator that wraps another example iterator and shuffles its examples, using
+    /// a bounded in-memory buffer. Each step returns an example chosen uniformly from the buffer and
+    /// replaces it with the next example of the wrapped iterator. Examples can only move backward by about
+    /// the size of the buffer, so the result is not a uniform permutation, but it decorrelates the order of
+    /// a stream that is too large to be permuted in memory. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    template <typename ExampleType>
+    class ShufflingExampleIterator : public IExampleIterator<ExampleType>
+    {
+    public:
+        /// <summary> Constructs a ShufflingExampleIterator and fills its buffer. </summary>
+        ///
+        /// <param name="exampleIterator"> The example iterator to shuffle. </param>
+        /// <param name="bufferSize"> The number of examples in the shuffle buffer. </param>
+        /// <param name="rng"> The random number generator. </param>
+        ShufflingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize, std::default_random_engine rng);
+
+        /// <summary> Returns true if the iterator is currently pointing to a valid iterate. </summary>
+        ///
+        /// <returns> true if it succeeds, false if it fails. </returns>
+        virtual bool IsValid() const override { return !_buffer.empty(); }
+
+        /// <summary> Proceeds to the Next iterate. </summary>
+        virtual void Next() override;
+
+        /// <summary> Returns the current example. </summary>
+        ///
+        /// <returns> The example. </returns>
+        virtual ExampleType Get() const override { return _buffer[_current]; }
+
+    private:
+        void ChooseCurrent();
+
+        ExampleIterator<ExampleType> _exampleIterator;
+        std::vector<ExampleType> _buffer;
+        std::default_random_engine _random;
+        size_t _current = 0;
+    };
+
+    /// <summary> Wraps an example iterator with a ShufflingExampleIterator. </summary>
+    ///
+    /// <typeparam name="ExampleType"> Example type. </typeparam>
+    /// <param name="exampleIterator"> The example iterator to shuffle. </param>
+    /// <param name="bufferSize"> The number of examples in the shuffle buffer. </param>
+    /// <param name="rng"> The random number generator. </param>
+    ///
+    /// <returns> An example iterator that visits the examples in a shuffled order. </returns>
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakeShufflingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize, std::default_random_engine rng);
+}
+}
+
+#include "../tcc/ShufflingExampleIterator.tcc"
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ChunkedLineIterator.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ChunkedLineIterator.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <limits>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        // open in binary mode, so that stream positions and character counts agree on all platforms
+        std::ifstream OpenBinaryIfstream(const std::string& filepath)
+        {
+            std::ifstream stream(filepath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error opening file " + filepath);
+            }
+            return stream;
+        }
+    }
+
+    std::vector<TextFileChunk> GetTextFileChunks(const std::string& filepath, size_t numChunks, char delim)
+    {
+        auto stream = OpenBinaryIfstream(filepath);
+        stream.seekg(0, std::ios::end);
+        auto fileSize = static_cast<size_t>(stream.tellg());
+
+        if (numChunks == 0)
+        {
+            numChunks = 1;
+        }
+
+        std::vector<TextFileChunk> chunks;
+        size_t begin = 0;
+        for (size_t index = 1; index <= numChunks && begin < fileSize; ++index)
+        {
+            size_t end = fileSize;
+            if (index < numChunks)
+            {
+                // move the approximate boundary forward to the beginning of the next line
+                size_t target = (fileSize / numChunks) * index;
+                if (target < begin)
+                {
+                    target = begin;
+                }
+
+                stream.seekg(target);
+                stream.ignore(std::numeric_limits<std::streamsize>::max(), delim);
+                if (stream.eof())
+                {
+                    stream.clear();
+                }
+                else
+                {
+                    end = static_cast<size_t>(stream.tellg());
+                }
+            }
+
+            if (end > begin)
+            {
+                chunks.push_back({ begin, end });
+                begin = end;
+            }
+        }
+
+        return chunks;
+    }
+
+    ChunkedLineIterator::ChunkedLineIterator(const std::string& filepath, TextFileChunk chunk, char delim)
+        : _stream(OpenBinaryIfstream(filepath)), _position(chunk.begin), _end(chunk.end), _delim(delim)
+    {
+        _stream.seekg(_position);
+        Next();
+    }
+
+    void ChunkedLineIterator::Next()
+    {
+        if (_position >= _end)
+        {
+            _isValid = false;
+            return;
+        }
+
+        std::string nextLine;
+        std::getline(_stream, nextLine, _delim);
+
+        if (_stream.fail())
+        {
+            _isValid = false;
+            return;
+        }
+
+        // getline consumes the delimiter, but does not store it
+        _position += nextLine.size() + 1;
+        _currentLine = TextLine(std::move(nextLine));
+    }
+}
+}
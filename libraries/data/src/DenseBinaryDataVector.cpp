@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DenseBinaryDataVector.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <cassert>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        // words with at least this many set bits are processed with a branch-free loop over all of their bits,
+        // words with fewer set bits are processed one set bit at a time
+        const int denseWordThreshold = 16;
+
+        // returns the word that contains the bits [64 * wordIndex, size)
+        uint64_t GetWord(const std::vector<uint64_t>& bits, size_t wordIndex, size_t size)
+        {
+            auto word = bits[wordIndex];
+            auto end = size - 64 * wordIndex;
+            if (end < 64)
+            {
+                word &= (uint64_t(1) << end) - 1;
+            }
+            return word;
+        }
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::initializer_list<IndexValue> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::initializer_list<double> list)
+    {
+        AppendElements(std::move(list));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::vector<IndexValue> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    DenseBinaryDataVector::DenseBinaryDataVector(std::vector<double> vec)
+    {
+        AppendElements(std::move(vec));
+    }
+
+    void DenseBinaryDataVector::AppendElement(size_t index, double value)
+    {
+        if (value == 0)
+        {
+            return;
+        }
+
+        assert(value == 1);
+
+        if (index < _prefixLength)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+        }
+
+        _bits.resize(index / 64 + 1);
+        _bits[index / 64] |= uint64_t(1) << (index % 64);
+        _prefixLength = index + 1;
+    }
+
+    double DenseBinaryDataVector::Norm2Squared() const
+    {
+        size_t numNonZeros = 0;
+        for (auto word : _bits)
+        {
+            numNonZeros += DenseBinaryDataVectorDetail::PopCount(word);
+        }
+        return static_cast<double>(numNonZeros);
+    }
+
+    double DenseBinaryDataVector::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        auto size = std::min(_prefixLength, vector.Size());
+        auto data = vector.GetDataPointer();
+        auto increment = vector.GetIncrement();
+        auto numWords = (size + 63) / 64;
+
+        double value = 0.0;
+        for (size_t wordIndex = 0; wordIndex < numWords; ++wordIndex)
+        {
+            auto word = GetWord(_bits, wordIndex, size);
+            auto wordData = data + 64 * wordIndex * increment;
+            if (increment == 1 && 64 * (wordIndex + 1) <= size && DenseBinaryDataVectorDetail::PopCount(word) >= denseWordThreshold)
+            {
+                // select with a mask instead of branching, with four independent partial sums
+                double sums[4] = { 0, 0, 0, 0 };
+                for (int i = 0; i < 64; i += 4)
+                {
+                    sums[0] += ((word >> i) & 1) ? wordData[i] : 0.0;
+                    sums[1] += ((word >> (i + 1)) & 1) ? wordData[i + 1] : 0.0;
+                    sums[2] += ((word >> (i + 2)) & 1) ? wordData[i + 2] : 0.0;
+                    sums[3] += ((word >> (i + 3)) & 1) ? wordData[i + 3] : 0.0;
+                }
+                value += (sums[0] + sums[1]) + (sums[2] + sums[3]);
+            }
+            else
+            {
+                while (word != 0)
+                {
+                    value += wordData[DenseBinaryDataVectorDetail::CountTrailingZeros(word) * increment];
+                    word &= word - 1;
+                }
+            }
+        }
+
+        return value;
+    }
+
+    void DenseBinaryDataVector::AddTo(math::RowVectorReference<double> vector) const
+    {
+        auto size = std::min(_prefixLength, vector.Size());
+        auto data = vector.GetDataPointer();
+        auto increment = vector.GetIncrement();
+        auto numWords = (size + 63) / 64;
+
+        for (size_t wordIndex = 0; wordIndex < numWords; ++wordIndex)
+        {
+            auto word = GetWord(_bits, wordIndex, size);
+            auto wordData = data + 64 * wordIndex * increment;
+            if (increment == 1 && 64 * (wordIndex + 1) <= size && DenseBinaryDataVectorDetail::PopCount(word) >= denseWordThreshold)
+            {
+                // add each bit as a number, which the compiler vectorizes
+                for (int i = 0; i < 64; ++i)
+                {
+                    wordData[i] += static_cast<double>((word >> i) & 1);
+                }
+            }
+            else
+            {
+                while (word != 0)
+                {
+                    wordData[DenseBinaryDataVectorDetail::CountTrailingZeros(word) * increment] += 1.0;
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+}
+}
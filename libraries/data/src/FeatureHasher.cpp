@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FeatureHasher.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FeatureHasher.h"
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        // the 64 bit finalizer of MurmurHash3, a cheap hash whose output bits all depend on all of its input bits
+        uint64_t MixBits(uint64_t key)
+        {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ULL;
+            key ^= key >> 33;
+            return key;
+        }
+    }
+
+    FeatureHasher::FeatureHasher(size_t numBits, bool useSignedHashing, uint64_t seed)
+        : _numBits(numBits), _mask((uint64_t(1) << numBits) - 1), _useSignedHashing(useSignedHashing), _seed(seed)
+    {
+        if (numBits == 0 || numBits > 63)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "number of hashing bits must be between 1 and 63");
+        }
+    }
+
+    IndexValue FeatureHasher::Hash(IndexValue indexValue) const
+    {
+        auto hash = MixBits(static_cast<uint64_t>(indexValue.index) ^ _seed);
+
+        // the index is taken from the low bits and the sign from the highest bit, which is never part of the index
+        auto index = static_cast<size_t>(hash & _mask);
+        auto value = (_useSignedHashing && (hash >> 63) != 0) ? -indexValue.value : indexValue.value;
+        return { index, value };
+    }
+}
+}
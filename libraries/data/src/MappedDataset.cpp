@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MappedDataset.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MappedDataset.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cstring>
+#include <fstream>
+
+namespace ell
+{
+namespace data
+{
+    namespace
+    {
+        const char magic[] = "ELLCSR01";
+
+        size_t RoundUpToMultipleOf8(size_t size)
+        {
+            return (size + 7) / 8 * 8;
+        }
+    }
+
+    //
+    // MappedDataVector
+    //
+
+    MappedDataVector::MappedDataVector(const uint32_t* indices, const float* values, size_t numNonZeros)
+        : _floatSpan(indices, values, numNonZeros), _isFloat(true)
+    {
+    }
+
+    MappedDataVector::MappedDataVector(const uint32_t* indices, const double* values, size_t numNonZeros)
+        : _doubleSpan(indices, values, numNonZeros), _isFloat(false)
+    {
+    }
+
+    void MappedDataVector::AddTo(math::RowVectorReference<double> vector) const
+    {
+        if (_isFloat)
+        {
+            _floatSpan.AddTo(vector);
+        }
+        else
+        {
+            _doubleSpan.AddTo(vector);
+        }
+    }
+
+    void MappedDataVector::Print(std::ostream& os) const
+    {
+        if (_isFloat)
+        {
+            _floatSpan.Print(os);
+        }
+        else
+        {
+            _doubleSpan.Print(os);
+        }
+    }
+
+    //
+    // MappedDataset
+    //
+
+    MappedDataset::MappedDataset(const std::string& filepath)
+        : _file(std::make_shared<utilities::MemoryMappedFile>(filepath))
+    {
+        auto data = _file->GetData();
+        auto fileSize = _file->Size();
+        if (fileSize < sizeof(MappedDatasetHeader) || std::memcmp(data, magic, sizeof(MappedDatasetHeader::magic)) != 0)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "not a binary dataset file: " + filepath);
+        }
+
+        _header = reinterpret_cast<const MappedDatasetHeader*>(data);
+        if (_header->valueType != MappedDatasetValueType::floatValues && _header->valueType != MappedDatasetValueType::doubleValues)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "unknown value type in binary dataset file: " + filepath);
+        }
+        auto valueSize = _header->valueType == MappedDatasetValueType::floatValues ? sizeof(float) : sizeof(double);
+
+        // bound the counts by the file size before they are multiplied, so that the section sizes can't overflow
+        const size_t bytesPerExample = 2 * sizeof(double) + sizeof(uint64_t);
+        const size_t bytesPerNonZero = sizeof(uint32_t) + valueSize;
+        if (_header->numExamples >= fileSize / bytesPerExample || _header->numNonZeros > fileSize / bytesPerNonZero)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::abruptEnd, "binary dataset file is truncated: " + filepath);
+        }
+        auto numExamples = static_cast<size_t>(_header->numExamples);
+        auto numNonZeros = static_cast<size_t>(_header->numNonZeros);
+
+        // compute the section offsets and check that they fit in the file
+        size_t offset = sizeof(MappedDatasetHeader);
+        auto labelsOffset = offset;
+        offset += numExamples * sizeof(double);
+        auto weightsOffset = offset;
+        offset += numExamples * sizeof(double);
+        auto rowOffsetsOffset = offset;
+        offset += (numExamples + 1) * sizeof(uint64_t);
+        auto indicesOffset = offset;
+        offset += RoundUpToMultipleOf8(numNonZeros * sizeof(uint32_t));
+        auto valuesOffset = offset;
+        offset += numNonZeros * valueSize;
+
+        if (offset > fileSize)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::abruptEnd, "binary dataset file is truncated: " + filepath);
+        }
+
+        auto labels = reinterpret_cast<const double*>(data + labelsOffset);
+        auto weights = reinterpret_cast<const double*>(data + weightsOffset);
+        auto rowOffsets = reinterpret_cast<const uint64_t*>(data + rowOffsetsOffset);
+        auto indices = reinterpret_cast<const uint32_t*>(data + indicesOffset);
+
+        // the first and last row offsets are checked here, and the rows are checked when they are read, so that
+        // opening the file doesn't touch every page of the mapping
+        if (rowOffsets[0] != 0 || rowOffsets[numExamples] != numNonZeros)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "inconsistent row offsets in binary dataset file: " + filepath);
+        }
+
+        _filepath = filepath;
+        _rowOffsets = rowOffsets;
+        _indices = indices;
+
+        if (_header->valueType == MappedDatasetValueType::floatValues)
+        {
+            _floatView = CsrDatasetView<float, MappedDataVector>(numExamples, labels, weights, rowOffsets, indices, reinterpret_cast<const float*>(data + valuesOffset));
+        }
+        else
+        {
+            _doubleView = CsrDatasetView<double, MappedDataVector>(numExamples, labels, weights, rowOffsets, indices, reinterpret_cast<const double*>(data + valuesOffset));
+        }
+    }
+
+    MappedExample MappedDataset::GetExample(size_t index) const
+    {
+        // the views index the sections without checks
+        ValidateRow(index);
+        return _header->valueType == MappedDatasetValueType::floatValues ? _floatView.GetExample(index) : _doubleView.GetExample(index);
+    }
+
+    auto MappedDataset::GetExampleReferenceIterator(size_t fromIndex, size_t size) const -> ExampleViewIterator
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ExampleViewIterator(*this, fromIndex, fromIndex + size);
+    }
+
+    void MappedDataset::Print(std::ostream& os, size_t tabs, size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        for (size_t index = fromIndex; index < fromIndex + size; ++index)
+        {
+            os << std::string(tabs * 4, ' ');
+            GetExample(index).Print(os);
+            os << "\n";
+        }
+    }
+
+    void MappedDataset::ValidateRow(size_t index) const
+    {
+        auto begin = _rowOffsets[index];
+        auto end = _rowOffsets[index + 1];
+        if (end < begin || end > _header->numNonZeros)
+        {
+            throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "inconsistent row offsets in binary dataset file: " + _filepath);
+        }
+
+        auto numFeatures = _header->numFeatures;
+        for (auto i = begin; i < end; ++i)
+        {
+            if (_indices[i] >= numFeatures || (i > begin && _indices[i] <= _indices[i - 1]))
+            {
+                throw utilities::DataFormatException(utilities::DataFormatErrors::badFormat, "feature indices out of range or out of order in binary dataset file: " + _filepath);
+            }
+        }
+    }
+
+    size_t MappedDataset::CorrectRangeSize(size_t fromIndex, size_t size) const
+    {
+        if (size == 0 || fromIndex + size > NumExamples())
+        {
+            return NumExamples() - fromIndex;
+        }
+        return size;
+    }
+
+    bool IsMappedDatasetFile(const std::string& filepath)
+    {
+        std::ifstream stream(filepath, std::ios::binary);
+        char buffer[sizeof(MappedDatasetHeader::magic)];
+        if (!stream.read(buffer, sizeof(buffer)))
+        {
+            return false;
+        }
+        return std::memcmp(buffer, magic, sizeof(buffer)) == 0;
+    }
+}
+}
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ReducedPrecisionDataVector.cpp (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ReducedPrecisionDataVector.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ell
+{
+namespace data
+{
+    uint16_t DoubleToHalf(double value)
+    {
+        // round to float first, then to half precision with round-to-nearest-even
+        float floatValue = static_cast<float>(value);
+        uint32_t bits;
+        std::memcpy(&bits, &floatValue, sizeof(bits));
+
+        uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        const uint32_t floatInfinity = 255u << 23;
+        const uint32_t halfOverflow = (127u + 16u) << 23; // 2^16, the smallest float that rounds to infinity or beyond
+        const uint32_t halfNormalMin = 113u << 23; // 2^-14, the smallest normal half
+        const uint32_t denormalMagicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        uint16_t result;
+        if (bits >= halfOverflow)
+        {
+            result = bits > floatInfinity ? 0x7e00 : 0x7c00; // nan or infinity
+        }
+        else if (bits < halfNormalMin)
+        {
+            // let the floating point adder round the denormal into the low mantissa bits
+            float denormalMagic;
+            float absValue;
+            std::memcpy(&denormalMagic, &denormalMagicBits, sizeof(float));
+            std::memcpy(&absValue, &bits, sizeof(float));
+            absValue += denormalMagic;
+            std::memcpy(&bits, &absValue, sizeof(float));
+            result = static_cast<uint16_t>(bits - denormalMagicBits);
+        }
+        else
+        {
+            uint32_t isMantissaOdd = (bits >> 13) & 1;
+            bits += ((15u - 127u) << 23) + 0xfff; // rebias the exponent and round
+            bits += isMantissaOdd; // break ties to even
+            result = static_cast<uint16_t>(bits >> 13);
+        }
+
+        return static_cast<uint16_t>(result | (sign >> 16));
+    }
+
+    AffineByteCodec::AffineByteCodec(double minValue, double maxValue)
+    {
+        // the range must include zero, so that zero is represented exactly
+        minValue = std::min(minValue, 0.0);
+        maxValue = std::max(maxValue, 0.0);
+        if (maxValue == minValue)
+        {
+            return;
+        }
+
+        _scale = (maxValue - minValue) / 255.0;
+        _zeroPoint = std::min(std::max(std::round(-minValue / _scale), 0.0), 255.0);
+    }
+
+    AffineByteCodec AffineByteCodec::Fit(const std::vector<double>& values)
+    {
+        if (values.empty())
+        {
+            return AffineByteCodec();
+        }
+
+        auto minMax = std::minmax_element(values.begin(), values.end());
+        return AffineByteCodec(*minMax.first, *minMax.second);
+    }
+
+    bool AffineByteCodec::CanEncode(double value) const
+    {
+        auto code = value / _scale + _zeroPoint;
+        return code >= -0.5 && code <= 255.5;
+    }
+
+    uint8_t AffineByteCodec::Encode(double value) const
+    {
+        auto code = std::round(value / _scale + _zeroPoint);
+        return static_cast<uint8_t>(std::min(std::max(code, 0.0), 255.0));
+    }
+}
+}
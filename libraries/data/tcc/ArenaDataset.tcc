@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ArenaDataset.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseDataVector.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <limits>
+#include <string>
+
+namespace ell
+{
+namespace data
+{
+    template <typename ElementType, typename DataVectorSpanType>
+    ArenaDataset<ElementType, DataVectorSpanType>::ArenaDataset()
+        : _rowOffsets(1, 0)
+    {
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    template <typename IteratorExampleType>
+    ArenaDataset<ElementType, DataVectorSpanType>::ArenaDataset(ExampleIterator<IteratorExampleType> exampleIterator)
+        : ArenaDataset()
+    {
+        while (exampleIterator.IsValid())
+        {
+            AddExample(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    ArenaDataset<ElementType, DataVectorSpanType>::ArenaDataset(const AnyDataset& anyDataset)
+        : ArenaDataset(anyDataset.GetExampleIterator<AutoSupervisedExample>())
+    {
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    void ArenaDataset<ElementType, DataVectorSpanType>::Reserve(size_t numExamples, size_t numNonZeros)
+    {
+        _labels.reserve(numExamples);
+        _weights.reserve(numExamples);
+        _rowOffsets.reserve(numExamples + 1);
+        _indices.reserve(numNonZeros);
+        _values.reserve(numNonZeros);
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    auto ArenaDataset<ElementType, DataVectorSpanType>::GetView() const -> ViewType
+    {
+        return ViewType(NumExamples(), _labels.data(), _weights.data(), _rowOffsets.data(), _indices.data(), _values.data());
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> ArenaDataset<ElementType, DataVectorSpanType>::GetExampleIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return MakeCsrExampleIterator<IteratorExampleType>(GetView(), fromIndex, fromIndex + size);
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    template <typename IteratorExampleType>
+    ExampleConstIterator<IteratorExampleType> ArenaDataset<ElementType, DataVectorSpanType>::GetExampleConstIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        using IteratorType = ConvertingExampleConstIterator<ArenaDataset<ElementType, DataVectorSpanType>, IteratorExampleType>;
+        return ExampleConstIterator<IteratorExampleType>(std::make_unique<IteratorType>(this, fromIndex, fromIndex + size));
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    auto ArenaDataset<ElementType, DataVectorSpanType>::GetExampleReferenceIterator(size_t fromIndex, size_t size) const -> ExampleViewIterator
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ExampleViewIterator(GetView(), fromIndex, fromIndex + size);
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    template <typename ExampleType>
+    void ArenaDataset<ElementType, DataVectorSpanType>::AddExample(const ExampleType& example)
+    {
+        auto sparseDataVector = example.GetDataVector().template CopyAs<SparseDoubleDataVector>();
+        AddExample(sparseDataVector.template GetIterator<IterationPolicy::skipZeros>(), example.GetMetadata());
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    void ArenaDataset<ElementType, DataVectorSpanType>::AddExample(IndexValueIteratorType indexValueIterator, WeightLabel metadata)
+    {
+        auto rowBegin = _indices.size();
+        while (indexValueIterator.IsValid())
+        {
+            auto indexValue = indexValueIterator.Get();
+            if (indexValue.index > std::numeric_limits<uint32_t>::max())
+            {
+                _indices.resize(rowBegin);
+                _values.resize(rowBegin);
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "arena datasets support 32-bit indices only");
+            }
+            if (_indices.size() > rowBegin && indexValue.index <= _indices.back())
+            {
+                auto previousIndex = _indices.back();
+                _indices.resize(rowBegin);
+                _values.resize(rowBegin);
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "indices must be increasing, but index " + std::to_string(indexValue.index) + " follows " + std::to_string(previousIndex));
+            }
+            if (indexValue.value != 0)
+            {
+                _indices.push_back(static_cast<uint32_t>(indexValue.index));
+                _values.push_back(static_cast<ElementType>(indexValue.value));
+            }
+            indexValueIterator.Next();
+        }
+
+        if (_indices.size() > rowBegin)
+        {
+            auto prefixLength = static_cast<size_t>(_indices.back()) + 1;
+            if (_numFeatures < prefixLength)
+            {
+                _numFeatures = prefixLength;
+            }
+        }
+        _rowOffsets.push_back(_indices.size());
+        _labels.push_back(metadata.label);
+        _weights.push_back(metadata.weight);
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    void ArenaDataset<ElementType, DataVectorSpanType>::Reset()
+    {
+        _labels.clear();
+        _weights.clear();
+        _rowOffsets.assign(1, 0);
+        _indices.clear();
+        _values.clear();
+        _numFeatures = 0;
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    void ArenaDataset<ElementType, DataVectorSpanType>::Print(std::ostream& os, size_t tabs, size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        for (size_t index = fromIndex; index < fromIndex + size; ++index)
+        {
+            os << std::string(tabs * 4, ' ');
+            GetExample(index).Print(os);
+            os << "\n";
+        }
+    }
+
+    template <typename ElementType, typename DataVectorSpanType>
+    size_t ArenaDataset<ElementType, DataVectorSpanType>::CorrectRangeSize(size_t fromIndex, size_t size) const
+    {
+        if (size == 0 || fromIndex + size > NumExamples())
+        {
+            return NumExamples() - fromIndex;
+        }
+        return size;
+    }
+}
+}
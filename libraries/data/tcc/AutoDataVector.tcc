@@ -9,26 +9,43 @@
 #define APPROXIMATION_TOLERANCE 1.0e-9
 #define SPARSE_THRESHOLD 0.2
 
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
+#include "HashingIndexValueIterator.h"
+#include "ReducedPrecisionDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
 
+// utilities
+#include "CompressedIntegerList.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+
 namespace ell
 {
 namespace data
 {
     template <typename DefaultDataVectorType>
-    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(DefaultDataVectorType&& vector)
+    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(DefaultDataVectorType&& vector, double approximationTolerance)
     {
-        FindBestRepresentation(std::move(vector));
+        FindBestRepresentation(std::move(vector), approximationTolerance);
+    }
+
+    template <typename DefaultDataVectorType>
+    template <typename DataVectorType, IsDataVector<DataVectorType> Concept>
+    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(DataVectorType vector, double approximationTolerance)
+    {
+        FindBestRepresentation(std::move(vector), approximationTolerance);
     }
 
     template <typename DefaultDataVectorType>
     template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
-    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(IndexValueIteratorType indexValueIterator)
+    AutoDataVectorBase<DefaultDataVectorType>::AutoDataVectorBase(IndexValueIteratorType indexValueIterator, double approximationTolerance)
     {
         DefaultDataVectorType defaultDataVector(std::move(indexValueIterator));
-        FindBestRepresentation(std::move(defaultDataVector));
+        FindBestRepresentation(std::move(defaultDataVector), approximationTolerance);
     }
 
     template <typename DefaultDataVectorType>
@@ -96,6 +113,13 @@ namespace data
         _pInternal->AddTransformedTo<policy>(vector, transformation);
     }
 
+    template <typename DefaultDataVectorType>
+    template <IterationPolicy policy, typename FunctionType>
+    void AutoDataVectorBase<DefaultDataVectorType>::ForEachElement(FunctionType function) const
+    {
+        _pInternal->ForEachElement<policy>(function);
+    }
+
     template <typename DefaultDataVectorType>
     template <typename ReturnType, typename... ArgTypes>
     ReturnType AutoDataVectorBase<DefaultDataVectorType>::CopyAs(ArgTypes... args) const
@@ -118,18 +142,29 @@ namespace data
     }
 
     template <typename DefaultDataVectorType>
-    void AutoDataVectorBase<DefaultDataVectorType>::FindBestRepresentation(DefaultDataVectorType defaultDataVector)
+    template <typename SourceDataVectorType>
+    void AutoDataVectorBase<DefaultDataVectorType>::FindBestRepresentation(SourceDataVectorType sourceDataVector, double approximationTolerance)
     {
         size_t numNonZeros = 0;
+        size_t indexListBytes = 0;
+        size_t previousIndex = 0;
         bool includesNonFloats = false;
         bool includesNonShorts = false;
         bool includesNonBytes = false;
         bool includesNonBinary = false;
+        double minValue = 0.0;
+        double maxValue = 0.0;
+        double halfError = 0.0;
 
-        auto iter = GetIterator<DefaultDataVectorType, IterationPolicy::skipZeros>(defaultDataVector);
+        auto iter = GetIterator<SourceDataVectorType, IterationPolicy::skipZeros>(sourceDataVector);
         while (iter.IsValid())
         {
-            double value = iter.Get().value;
+            auto indexValue = iter.Get();
+            double value = indexValue.value;
+
+            // the size of the index list that a sparse binary vector would store
+            indexListBytes += utilities::CompressedIntegerList::GetEncodedDeltaSize(indexValue.index - previousIndex);
+            previousIndex = indexValue.index;
 
             ++numNonZeros;
             includesNonFloats |= DoesCastModifyValue<float>(value);
@@ -137,67 +172,123 @@ namespace data
             includesNonBytes |= DoesCastModifyValue<char>(value);
             includesNonBinary |= (value - 1.0 > APPROXIMATION_TOLERANCE || 1.0 - value > APPROXIMATION_TOLERANCE);
 
+            if (approximationTolerance > 0)
+            {
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+                halfError = std::max(halfError, std::abs(HalfPrecisionCodec().Decode(DoubleToHalf(value)) - value));
+            }
+
             iter.Next();
         }
 
+        // lossy representations are only worth it when every exact representation takes more than a byte per element
+        bool useQuantizedBytes = false;
+        bool useHalfPrecision = false;
+        if (approximationTolerance > 0 && includesNonBytes)
+        {
+            AffineByteCodec codec(minValue, maxValue);
+            double quantizationError = 0.0;
+            auto quantizationIter = GetIterator<SourceDataVectorType, IterationPolicy::skipZeros>(sourceDataVector);
+            while (quantizationIter.IsValid() && quantizationError <= approximationTolerance)
+            {
+                double value = quantizationIter.Get().value;
+                quantizationError = std::max(quantizationError, std::abs(codec.Decode(codec.Encode(value)) - value));
+                quantizationIter.Next();
+            }
+
+            useQuantizedBytes = quantizationError <= approximationTolerance;
+            useHalfPrecision = !useQuantizedBytes && includesNonShorts && halfError <= approximationTolerance;
+        }
+
+        // binary vectors are stored in a bitmap when it is no larger than the compressed list of indices
+        size_t bitmapBytes = 8 * ((sourceDataVector.PrefixLength() + 63) / 64);
+        indexListBytes += utilities::CompressedIntegerList::GetNumControlBytes(numNonZeros);
+        if (!includesNonBinary && numNonZeros > 0 && bitmapBytes <= indexListBytes)
+        {
+            SetInternal<DenseBinaryDataVector>(std::move(sourceDataVector));
+        }
+
         // dense
-        if (numNonZeros > SPARSE_THRESHOLD * defaultDataVector.PrefixLength())
+        else if (numNonZeros > SPARSE_THRESHOLD * sourceDataVector.PrefixLength())
         {
-            if (includesNonFloats)
+            if (useQuantizedBytes)
+            {
+                SetInternal<QuantizedByteDataVector>(std::move(sourceDataVector));
+            }
+            else if (useHalfPrecision)
             {
-                SetInternal<DoubleDataVector>(std::move(defaultDataVector));
+                SetInternal<HalfDataVector>(std::move(sourceDataVector));
+            }
+            else if (includesNonFloats)
+            {
+                SetInternal<DoubleDataVector>(std::move(sourceDataVector));
             }
             else if (includesNonShorts)
             {
-                SetInternal<FloatDataVector>(std::move(defaultDataVector));
+                SetInternal<FloatDataVector>(std::move(sourceDataVector));
             }
             else if (includesNonBytes)
             {
-                SetInternal<ShortDataVector>(std::move(defaultDataVector));
+                SetInternal<ShortDataVector>(std::move(sourceDataVector));
             }
             else
             {
-                SetInternal<ByteDataVector>(std::move(defaultDataVector));
+                SetInternal<ByteDataVector>(std::move(sourceDataVector));
             }
         }
 
         // sparse
         else
         {
-            if (includesNonFloats)
+            if (useQuantizedBytes)
+            {
+                SetInternal<SparseQuantizedByteDataVector>(std::move(sourceDataVector));
+            }
+            else if (useHalfPrecision)
             {
-                SetInternal<SparseDoubleDataVector>(std::move(defaultDataVector));
+                SetInternal<SparseHalfDataVector>(std::move(sourceDataVector));
+            }
+            else if (includesNonFloats)
+            {
+                SetInternal<SparseDoubleDataVector>(std::move(sourceDataVector));
             }
             else if (includesNonShorts)
             {
-                SetInternal<SparseFloatDataVector>(std::move(defaultDataVector));
+                SetInternal<SparseFloatDataVector>(std::move(sourceDataVector));
             }
             else if (includesNonBytes)
             {
-                SetInternal<SparseShortDataVector>(std::move(defaultDataVector));
+                SetInternal<SparseShortDataVector>(std::move(sourceDataVector));
             }
             else if (includesNonBinary)
             {
-                SetInternal<SparseByteDataVector>(std::move(defaultDataVector));
+                SetInternal<SparseByteDataVector>(std::move(sourceDataVector));
             }
             else
             {
-                SetInternal<SparseBinaryDataVector>(std::move(defaultDataVector));
+                SetInternal<SparseBinaryDataVector>(std::move(sourceDataVector));
             }
         }
     }
 
     template <typename DefaultDataVectorType>
-    template <typename DataVectorType, utilities::IsDifferent<DataVectorType, DefaultDataVectorType> Concept>
-    void AutoDataVectorBase<DefaultDataVectorType>::SetInternal(DefaultDataVectorType defaultDataVector)
+    template <typename DataVectorType, typename SourceDataVectorType, utilities::IsDifferent<DataVectorType, SourceDataVectorType> Concept>
+    void AutoDataVectorBase<DefaultDataVectorType>::SetInternal(SourceDataVectorType sourceDataVector)
     {
-        _pInternal = std::make_unique<DataVectorType>(GetIterator<DefaultDataVectorType, IterationPolicy::skipZeros>(defaultDataVector));
+        _pInternal = std::make_unique<DataVectorType>(GetIterator<SourceDataVectorType, IterationPolicy::skipZeros>(sourceDataVector));
     }
 
     template <typename IndexValueParsingIterator>
-    AutoDataVector AutoDataVectorParser<IndexValueParsingIterator>::Parse(TextLine& textLine)
+    AutoDataVector AutoDataVectorParser<IndexValueParsingIterator>::Parse(TextLine& textLine) const
     {
-        return AutoDataVector(IndexValueParsingIterator(textLine));
+        if (numHashingBits > 0)
+        {
+            // hashed indices are spread over the entire hashed space, so avoid the dense default representation
+            SparseDoubleDataVector hashedDataVector(MakeHashingIndexValueIterator(IndexValueParsingIterator(textLine), FeatureHasher(numHashingBits, useSignedHashing, hashingSeed)));
+            return AutoDataVector(std::move(hashedDataVector), approximationTolerance);
+        }
+        return AutoDataVector(IndexValueParsingIterator(textLine), approximationTolerance);
     }
 }
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CsrDatasetView.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <memory>
+
+namespace ell
+{
+namespace data
+{
+    template <typename DataVectorViewType>
+    SpanExample<DataVectorViewType>::SpanExample(DataVectorViewType dataVector, WeightLabel metadata)
+        : _dataVector(dataVector), _metadata(metadata)
+    {
+    }
+
+    template <typename DataVectorViewType>
+    template <typename TargetExampleType>
+    TargetExampleType SpanExample<DataVectorViewType>::CopyAs() const
+    {
+        using DataVectorType = typename TargetExampleType::DataVectorType;
+        return TargetExampleType(_dataVector.template CopyAs<DataVectorType>(), _metadata);
+    }
+
+    template <typename DataVectorViewType>
+    void SpanExample<DataVectorViewType>::Print(std::ostream& os) const
+    {
+        _metadata.Print(os);
+        os << '\t';
+        _dataVector.Print(os);
+    }
+
+    template <typename ElementType, typename DataVectorViewType>
+    CsrDatasetView<ElementType, DataVectorViewType>::CsrDatasetView(size_t numExamples, const double* labels, const double* weights, const uint64_t* rowOffsets, const uint32_t* indices, const ElementType* values)
+        : _numExamples(numExamples), _labels(labels), _weights(weights), _rowOffsets(rowOffsets), _indices(indices), _values(values)
+    {
+    }
+
+    template <typename ElementType, typename DataVectorViewType>
+    auto CsrDatasetView<ElementType, DataVectorViewType>::GetExample(size_t index) const -> DatasetExampleType
+    {
+        auto begin = static_cast<size_t>(_rowOffsets[index]);
+        auto end = static_cast<size_t>(_rowOffsets[index + 1]);
+        return DatasetExampleType(DataVectorViewType(_indices + begin, _values + begin, end - begin), WeightLabel{ _weights[index], _labels[index] });
+    }
+
+    template <typename ExampleSourceType>
+    CsrExampleViewIterator<ExampleSourceType>::CsrExampleViewIterator(ExampleSourceType source, size_t begin, size_t end)
+        : _source(std::move(source)), _current(begin), _end(end)
+    {
+    }
+
+    template <typename ExampleSourceType, typename IteratorExampleType>
+    CsrExampleIterator<ExampleSourceType, IteratorExampleType>::CsrExampleIterator(ExampleSourceType source, size_t begin, size_t end)
+        : _source(std::move(source)), _current(begin), _end(end)
+    {
+    }
+
+    template <typename IteratorExampleType, typename ExampleSourceType>
+    ExampleIterator<IteratorExampleType> MakeCsrExampleIterator(ExampleSourceType source, size_t begin, size_t end)
+    {
+        return ExampleIterator<IteratorExampleType>(std::make_unique<CsrExampleIterator<ExampleSourceType, IteratorExampleType>>(std::move(source), begin, end));
+    }
+}
+}
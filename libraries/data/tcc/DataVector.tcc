@@ -6,7 +6,10 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "DataVectorSpan.h"
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
+#include "ReducedPrecisionDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
 #include "TransformingIndexValueIterator.h"
@@ -48,6 +51,27 @@ namespace data
             case Type::SparseBinaryDataVector:
                 return lambda(static_cast<const SparseBinaryDataVector*>(this));
 
+            case Type::DoubleDataVectorSpan:
+                return lambda(static_cast<const DoubleDataVectorSpan*>(this));
+
+            case Type::FloatDataVectorSpan:
+                return lambda(static_cast<const FloatDataVectorSpan*>(this));
+
+            case Type::HalfDataVector:
+                return lambda(static_cast<const HalfDataVector*>(this));
+
+            case Type::QuantizedByteDataVector:
+                return lambda(static_cast<const QuantizedByteDataVector*>(this));
+
+            case Type::SparseHalfDataVector:
+                return lambda(static_cast<const SparseHalfDataVector*>(this));
+
+            case Type::SparseQuantizedByteDataVector:
+                return lambda(static_cast<const SparseQuantizedByteDataVector*>(this));
+
+            case Type::DenseBinaryDataVector:
+                return lambda(static_cast<const DenseBinaryDataVector*>(this));
+
             default:
                 throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "attempted to cast unsupported data vector type");
         }
@@ -62,6 +86,15 @@ namespace data
         });
     }
 
+    template <IterationPolicy policy, typename FunctionType>
+    void IDataVector::ForEachElement(FunctionType function) const
+    {
+        InvokeWithThis<void>([&function](const auto* pThis)
+        {
+            pThis->template ForEachElement<policy>(function);
+        });
+    }
+
     template <typename ReturnType>
     ReturnType IDataVector::CopyAs() const
     {
@@ -232,6 +265,18 @@ namespace data
         }
     }
 
+    template <class DerivedType>
+    template <IterationPolicy policy, typename FunctionType>
+    void DataVectorBase<DerivedType>::ForEachElement(FunctionType function) const
+    {
+        auto indexValueIterator = GetIterator<DerivedType, policy>(*static_cast<const DerivedType*>(this));
+        while (indexValueIterator.IsValid())
+        {
+            function(indexValueIterator.Get());
+            indexValueIterator.Next();
+        }
+    }
+
     template <class DerivedType>
     template <typename ReturnType>
     ReturnType DataVectorBase<DerivedType>::CopyAs() const
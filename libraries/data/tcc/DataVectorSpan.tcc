@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DataVectorSpan.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace data
+{
+    template <typename ElementType>
+    DataVectorSpanIterator<IterationPolicy::skipZeros, ElementType>::DataVectorSpanIterator(const uint32_t* indices, const ElementType* values, size_t numNonZeros, size_t size)
+        : _indices(indices), _values(values), _numNonZeros(numNonZeros), _size(size)
+    {
+    }
+
+    template <typename ElementType>
+    DataVectorSpanIterator<IterationPolicy::all, ElementType>::DataVectorSpanIterator(const uint32_t* indices, const ElementType* values, size_t numNonZeros, size_t size)
+        : _indices(indices), _values(values), _numNonZeros(numNonZeros), _size(size)
+    {
+    }
+
+    template <typename ElementType>
+    void DataVectorSpanIterator<IterationPolicy::all, ElementType>::Next()
+    {
+        if (_offset < _numNonZeros && _indices[_offset] == _index)
+        {
+            ++_offset;
+        }
+        ++_index;
+    }
+
+    template <typename ElementType>
+    IndexValue DataVectorSpanIterator<IterationPolicy::all, ElementType>::Get() const
+    {
+        if (_offset < _numNonZeros && _indices[_offset] == _index)
+        {
+            return IndexValue{ _index, static_cast<double>(_values[_offset]) };
+        }
+        return IndexValue{ _index, 0.0 };
+    }
+
+    template <typename ElementType>
+    DataVectorSpan<ElementType>::DataVectorSpan(const uint32_t* indices, const ElementType* values, size_t numNonZeros)
+        : _indices(indices), _values(values), _numNonZeros(numNonZeros)
+    {
+    }
+
+    template <typename ElementType>
+    void DataVectorSpan<ElementType>::AppendElement(size_t, double)
+    {
+        throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "cannot append elements to a read-only data vector span");
+    }
+
+    template <typename ElementType>
+    double DataVectorSpan<ElementType>::Norm2Squared() const
+    {
+        double result = 0.0;
+        for (size_t i = 0; i < _numNonZeros; ++i)
+        {
+            double value = static_cast<double>(_values[i]);
+            result += value * value;
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    double DataVectorSpan<ElementType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        auto count = CountBelow(vector.Size());
+        double result = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += static_cast<double>(_values[i]) * vector[_indices[i]];
+        }
+        return result;
+    }
+
+    template <typename ElementType>
+    void DataVectorSpan<ElementType>::AddTo(math::RowVectorReference<double> vector) const
+    {
+        auto count = CountBelow(vector.Size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            vector[_indices[i]] += static_cast<double>(_values[i]);
+        }
+    }
+
+    template <typename ElementType>
+    size_t DataVectorSpan<ElementType>::CountBelow(size_t size) const
+    {
+        // indices are increasing, so only a prefix of the non-zeros falls below size
+        size_t count = _numNonZeros;
+        while (count > 0 && _indices[count - 1] >= size)
+        {
+            --count;
+        }
+        return count;
+    }
+}
+}
@@ -19,19 +19,39 @@ namespace ell
 {
 namespace data
 {
+    namespace DatasetDetail
+    {
+        // all Dataset types for which GetAnyDataset() is called must be listed below, in the variadic template argument.
+        using AnyDatasetInvoker = utilities::AbstractInvoker<DatasetBase,
+            Dataset<data::AutoSupervisedExample>,
+            Dataset<data::DenseSupervisedExample>,
+            MappedDataset,
+            ArenaDataset<double, DoubleDataVectorSpan>,
+            ArenaDataset<float, FloatDataVectorSpan>>;
+    }
+
     template <typename ExampleType>
     ExampleIterator<ExampleType> AnyDataset::GetExampleIterator() const
     {
         auto fromIndex = _fromIndex;
         auto size = _size;
         auto getExampleIterator = [fromIndex, size](const auto* pDataset) { return pDataset->template GetExampleIterator<ExampleType>(fromIndex, size); };
+        return DatasetDetail::AnyDatasetInvoker::Invoke<ExampleIterator<ExampleType>>(getExampleIterator, _pDataset);
+    }
 
-        // all Dataset types for which GetAnyDataset() is called must be listed below, in the variadic template argument.
-        using Invoker = utilities::AbstractInvoker<DatasetBase,
-            Dataset<data::AutoSupervisedExample>,
-            Dataset<data::DenseSupervisedExample>>;
+    template <typename ExampleType>
+    ExampleConstIterator<ExampleType> AnyDataset::GetExampleConstIterator() const
+    {
+        auto fromIndex = _fromIndex;
+        auto size = _size;
+        auto getExampleConstIterator = [fromIndex, size](const auto* pDataset) { return pDataset->template GetExampleConstIterator<ExampleType>(fromIndex, size); };
+        return DatasetDetail::AnyDatasetInvoker::Invoke<ExampleConstIterator<ExampleType>>(getExampleConstIterator, _pDataset);
+    }
 
-        return Invoker::Invoke<ExampleIterator<ExampleType>>(getExampleIterator, _pDataset);
+    template <typename ExampleType>
+    const Dataset<ExampleType>* AnyDataset::GetDataset() const
+    {
+        return dynamic_cast<const Dataset<ExampleType>*>(_pDataset);
     }
 
     template <typename DatasetExampleType>
@@ -41,6 +61,12 @@ namespace data
     {
     }
 
+    template <typename DatasetExampleType>
+    Dataset<DatasetExampleType>::DatasetExampleConstIterator::DatasetExampleConstIterator(InternalIteratorType begin, InternalIteratorType end)
+        : _current(begin), _end(end)
+    {
+    }
+
     template <typename DatasetExampleType>
     Dataset<DatasetExampleType>::Dataset(ExampleIterator<DatasetExampleType> exampleIterator)
     {
@@ -103,6 +129,30 @@ namespace data
         return ExampleReferenceIterator<DatasetExampleType>(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size);
     }
 
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleConstIterator<IteratorExampleType> Dataset<DatasetExampleType>::GetExampleConstIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return GetExampleConstIterator<IteratorExampleType>(fromIndex, size, std::is_same<IteratorExampleType, DatasetExampleType>());
+    }
+
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleConstIterator<IteratorExampleType> Dataset<DatasetExampleType>::GetExampleConstIterator(size_t fromIndex, size_t size, std::true_type) const
+    {
+        // the requested type is the stored type, so refer to the stored examples
+        return ExampleConstIterator<IteratorExampleType>(std::make_unique<DatasetExampleConstIterator>(_examples.cbegin() + fromIndex, _examples.cbegin() + fromIndex + size));
+    }
+
+    template <typename DatasetExampleType>
+    template <typename IteratorExampleType>
+    ExampleConstIterator<IteratorExampleType> Dataset<DatasetExampleType>::GetExampleConstIterator(size_t fromIndex, size_t size, std::false_type) const
+    {
+        using IteratorType = ConvertingExampleConstIterator<Dataset<DatasetExampleType>, IteratorExampleType>;
+        return ExampleConstIterator<IteratorExampleType>(std::make_unique<IteratorType>(this, fromIndex, fromIndex + size));
+    }
+
     template <typename DatasetExampleType>
     void Dataset<DatasetExampleType>::AddExample(DatasetExampleType example)
     {
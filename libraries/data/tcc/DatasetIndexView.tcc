@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DatasetIndexView.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace ell
+{
+namespace data
+{
+    template <typename DatasetExampleType>
+    DatasetIndexView<DatasetExampleType>::ReferenceIterator::ReferenceIterator(const Dataset<DatasetExampleType>* pDataset, const uint32_t* begin, const uint32_t* end)
+        : _pDataset(pDataset), _current(begin), _end(end)
+    {
+    }
+
+    template <typename DatasetExampleType>
+    DatasetIndexView<DatasetExampleType>::DatasetIndexView(Dataset<DatasetExampleType>& dataset)
+        : _pDataset(&dataset)
+    {
+        if (dataset.NumExamples() > std::numeric_limits<uint32_t>::max())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "dataset is too big for a 32-bit index view");
+        }
+
+        _indices.resize(dataset.NumExamples());
+        std::iota(_indices.begin(), _indices.end(), 0);
+    }
+
+    template <typename DatasetExampleType>
+    auto DatasetIndexView<DatasetExampleType>::GetExampleReferenceIterator(size_t fromIndex, size_t size) const -> ReferenceIterator
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ReferenceIterator(_pDataset, _indices.data() + fromIndex, _indices.data() + fromIndex + size);
+    }
+
+    template <typename DatasetExampleType>
+    void DatasetIndexView<DatasetExampleType>::RandomPermute(std::default_random_engine& rng, size_t rangeFirstIndex, size_t rangeSize, size_t prefixSize)
+    {
+        rangeSize = CorrectRangeSize(rangeFirstIndex, rangeSize);
+
+        if (prefixSize > rangeSize || prefixSize == 0)
+        {
+            prefixSize = rangeSize;
+        }
+
+        for (size_t s = 0; s < prefixSize; ++s)
+        {
+            size_t index = rangeFirstIndex + s;
+            RandomSwap(rng, index, index, rangeSize - s);
+        }
+    }
+
+    template <typename DatasetExampleType>
+    void DatasetIndexView<DatasetExampleType>::RandomSwap(std::default_random_engine& rng, size_t targetPosition, size_t rangeFirstIndex, size_t rangeSize)
+    {
+        rangeSize = CorrectRangeSize(rangeFirstIndex, rangeSize);
+        if (targetPosition > _indices.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange);
+        }
+
+        std::uniform_int_distribution<size_t> dist(rangeFirstIndex, rangeFirstIndex + rangeSize - 1);
+        size_t j = dist(rng);
+        std::swap(_indices[targetPosition], _indices[j]);
+    }
+
+    template <typename DatasetExampleType>
+    template <typename SortKeyType>
+    void DatasetIndexView<DatasetExampleType>::Sort(SortKeyType sortKey, size_t fromIndex, size_t size)
+    {
+        size = CorrectRangeSize(fromIndex, size);
+
+        // compute each key once, and sort (key, index) pairs, which are stored contiguously
+        using KeyType = std::decay_t<decltype(sortKey(std::declval<const DatasetExampleType&>()))>;
+        std::vector<std::pair<KeyType, uint32_t>> keyIndexPairs;
+        keyIndexPairs.reserve(size);
+        for (size_t i = fromIndex; i < fromIndex + size; ++i)
+        {
+            keyIndexPairs.emplace_back(sortKey(_pDataset->GetExample(_indices[i])), _indices[i]);
+        }
+
+        std::sort(keyIndexPairs.begin(), keyIndexPairs.end(), [](const std::pair<KeyType, uint32_t>& a, const std::pair<KeyType, uint32_t>& b) { return a.first < b.first; });
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            _indices[fromIndex + i] = keyIndexPairs[i].second;
+        }
+    }
+
+    template <typename DatasetExampleType>
+    template <typename PartitionKeyType>
+    void DatasetIndexView<DatasetExampleType>::Partition(PartitionKeyType partitionKey, size_t fromIndex, size_t size)
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        const auto* pDataset = _pDataset;
+        std::partition(_indices.begin() + fromIndex, _indices.begin() + fromIndex + size, [pDataset, &partitionKey](uint32_t index) { return partitionKey(pDataset->GetExample(index)); });
+    }
+
+    template <typename DatasetExampleType>
+    DatasetIndexView<DatasetExampleType> DatasetIndexView<DatasetExampleType>::GetBootstrapSample(std::default_random_engine& rng, size_t sampleSize) const
+    {
+        if (sampleSize == 0)
+        {
+            sampleSize = _indices.size();
+        }
+
+        DatasetIndexView<DatasetExampleType> sample;
+        sample._pDataset = _pDataset;
+        if (_indices.empty())
+        {
+            return sample;
+        }
+
+        std::uniform_int_distribution<size_t> dist(0, _indices.size() - 1);
+        sample._indices.resize(sampleSize);
+        for (auto& index : sample._indices)
+        {
+            index = _indices[dist(rng)];
+        }
+        return sample;
+    }
+
+    template <typename DatasetExampleType>
+    size_t DatasetIndexView<DatasetExampleType>::CorrectRangeSize(size_t fromIndex, size_t size) const
+    {
+        if (size == 0 || fromIndex + size > _indices.size())
+        {
+            return _indices.size() - fromIndex;
+        }
+        return size;
+    }
+}
+}
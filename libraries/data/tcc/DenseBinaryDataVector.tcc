@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     DenseBinaryDataVector.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ell
+{
+namespace data
+{
+    namespace DenseBinaryDataVectorDetail
+    {
+        // returns the number of set bits in a word
+        inline int PopCount(uint64_t word)
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<int>(__popcnt64(word));
+#elif defined(_MSC_VER)
+            return static_cast<int>(__popcnt(static_cast<uint32_t>(word)) + __popcnt(static_cast<uint32_t>(word >> 32)));
+#else
+            return __builtin_popcountll(word);
+#endif
+        }
+
+        // returns the index of the lowest set bit of a non-zero word
+        inline int CountTrailingZeros(uint64_t word)
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<int>(index);
+#elif defined(_MSC_VER)
+            unsigned long index;
+            if (_BitScanForward(&index, static_cast<uint32_t>(word)))
+            {
+                return static_cast<int>(index);
+            }
+            _BitScanForward(&index, static_cast<uint32_t>(word >> 32));
+            return static_cast<int>(index) + 32;
+#else
+            return __builtin_ctzll(word);
+#endif
+        }
+    }
+
+    inline DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::DenseBinaryDataVectorIterator(const uint64_t* bits, size_t size)
+        : _bits(bits), _size(size)
+    {
+        SkipTo(0);
+    }
+
+    inline void DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::Next()
+    {
+        SkipTo(_index + 1);
+    }
+
+    inline void DenseBinaryDataVectorIterator<IterationPolicy::skipZeros>::SkipTo(size_t index)
+    {
+        if (index >= _size)
+        {
+            _index = _size;
+            return;
+        }
+
+        // clear the bits below the index in its word, and then find the next non-zero word
+        size_t wordIndex = index / 64;
+        uint64_t word = _bits[wordIndex] & (~uint64_t(0) << (index % 64));
+        size_t numWords = (_size + 63) / 64;
+        while (word == 0)
+        {
+            if (++wordIndex == numWords)
+            {
+                _index = _size;
+                return;
+            }
+            word = _bits[wordIndex];
+        }
+
+        _index = wordIndex * 64 + DenseBinaryDataVectorDetail::CountTrailingZeros(word);
+        if (_index > _size)
+        {
+            _index = _size;
+        }
+    }
+
+    inline DenseBinaryDataVectorIterator<IterationPolicy::all>::DenseBinaryDataVectorIterator(const uint64_t* bits, size_t prefixLength, size_t size)
+        : _bits(bits), _prefixLength(prefixLength), _size(size)
+    {
+    }
+
+    inline IndexValue DenseBinaryDataVectorIterator<IterationPolicy::all>::Get() const
+    {
+        if (_index >= _prefixLength)
+        {
+            return IndexValue{ _index, 0.0 };
+        }
+        return IndexValue{ _index, static_cast<double>((_bits[_index / 64] >> (_index % 64)) & 1) };
+    }
+
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    DenseBinaryDataVector::DenseBinaryDataVector(IndexValueIteratorType indexValueIterator)
+    {
+        AppendElements(std::move(indexValueIterator));
+    }
+
+    template <>
+    inline auto DenseBinaryDataVector::GetIterator<IterationPolicy::skipZeros>(size_t size) const -> Iterator<IterationPolicy::skipZeros>
+    {
+        return Iterator<IterationPolicy::skipZeros>(_bits.data(), std::min(size, _prefixLength));
+    }
+
+    template <>
+    inline auto DenseBinaryDataVector::GetIterator<IterationPolicy::all>(size_t size) const -> Iterator<IterationPolicy::all>
+    {
+        return Iterator<IterationPolicy::all>(_bits.data(), _prefixLength, size);
+    }
+}
+}
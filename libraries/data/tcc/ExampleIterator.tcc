@@ -15,5 +15,35 @@ namespace data
         : _iterator(std::move(iterator))
     {
     }
+
+    template <typename ExampleType>
+    ExampleConstIterator<ExampleType>::ExampleConstIterator(std::unique_ptr<IExampleConstIterator<ExampleType>>&& iterator)
+        : _iterator(std::move(iterator))
+    {
+    }
+
+    template <typename DatasetType, typename IteratorExampleType>
+    ConvertingExampleConstIterator<DatasetType, IteratorExampleType>::ConvertingExampleConstIterator(const DatasetType* dataset, size_t begin, size_t end)
+        : _dataset(dataset), _current(begin), _end(end)
+    {
+    }
+
+    template <typename DatasetType, typename IteratorExampleType>
+    void ConvertingExampleConstIterator<DatasetType, IteratorExampleType>::Next()
+    {
+        ++_current;
+        _isConverted = false;
+    }
+
+    template <typename DatasetType, typename IteratorExampleType>
+    const IteratorExampleType& ConvertingExampleConstIterator<DatasetType, IteratorExampleType>::Get() const
+    {
+        if (!_isConverted)
+        {
+            _currentExample = _dataset->GetExample(_current).template CopyAs<IteratorExampleType>();
+            _isConverted = true;
+        }
+        return _currentExample;
+    }
 }
 }
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     HashingIndexValueIterator.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseDataVector.h"
+
+// stl
+#include <algorithm>
+
+namespace ell
+{
+namespace data
+{
+    template <typename WrappedIndexValueIteratorType>
+    HashingIndexValueIterator<WrappedIndexValueIteratorType>::HashingIndexValueIterator(WrappedIndexValueIteratorType wrappedIterator, const FeatureHasher& featureHasher)
+    {
+        while (wrappedIterator.IsValid())
+        {
+            auto indexValue = wrappedIterator.Get();
+            if (indexValue.value != 0.0)
+            {
+                _indexValues.push_back(featureHasher.Hash(indexValue));
+            }
+            wrappedIterator.Next();
+        }
+
+        std::stable_sort(_indexValues.begin(), _indexValues.end(), [](const IndexValue& a, const IndexValue& b) { return a.index < b.index; });
+
+        // sum the values of colliding indices, in place
+        size_t size = 0;
+        for (size_t i = 0; i < _indexValues.size(); ++i)
+        {
+            if (size > 0 && _indexValues[size - 1].index == _indexValues[i].index)
+            {
+                _indexValues[size - 1].value += _indexValues[i].value;
+            }
+            else
+            {
+                _indexValues[size++] = _indexValues[i];
+            }
+        }
+        _indexValues.resize(size);
+
+        // signed hashing can cancel out colliding values
+        _indexValues.erase(std::remove_if(_indexValues.begin(), _indexValues.end(), [](const IndexValue& x) { return x.value == 0.0; }), _indexValues.end());
+    }
+
+    template <typename ReturnType, typename DataVectorType>
+    ReturnType HashDataVector(const DataVectorType& dataVector, const FeatureHasher& featureHasher)
+    {
+        auto sparseDataVector = dataVector.template CopyAs<SparseDoubleDataVector>();
+        return ReturnType(MakeHashingIndexValueIterator(sparseDataVector.template GetIterator<IterationPolicy::skipZeros>(), featureHasher));
+    }
+}
+}
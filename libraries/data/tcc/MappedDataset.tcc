@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MappedDataset.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SparseDataVector.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <cstring>
+#include <limits>
+
+namespace ell
+{
+namespace data
+{
+    template <typename ReturnType>
+    ReturnType MappedDataVector::CopyAs() const
+    {
+        return _isFloat ? _floatSpan.template CopyAs<ReturnType>() : _doubleSpan.template CopyAs<ReturnType>();
+    }
+
+    template <typename IteratorExampleType>
+    ExampleIterator<IteratorExampleType> MappedDataset::GetExampleIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return MakeCsrExampleIterator<IteratorExampleType>(*this, fromIndex, fromIndex + size);
+    }
+
+    template <typename IteratorExampleType>
+    ExampleConstIterator<IteratorExampleType> MappedDataset::GetExampleConstIterator(size_t fromIndex, size_t size) const
+    {
+        size = CorrectRangeSize(fromIndex, size);
+        return ExampleConstIterator<IteratorExampleType>(std::make_unique<ConvertingExampleConstIterator<MappedDataset, IteratorExampleType>>(this, fromIndex, fromIndex + size));
+    }
+
+    namespace MappedDatasetDetail
+    {
+        template <typename ValueType>
+        void WriteValue(std::ostream& stream, ValueType value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(ValueType));
+        }
+
+        inline void WritePadding(std::ostream& stream, size_t numBytesWritten)
+        {
+            const char zeros[8] = { 0 };
+            auto remainder = numBytesWritten % 8;
+            if (remainder != 0)
+            {
+                stream.write(zeros, 8 - remainder);
+            }
+        }
+
+        // calls a function on the non-zero elements of each example, in order
+        template <typename DatasetType, typename FunctionType>
+        void ForEachNonZero(const DatasetType& dataset, FunctionType function)
+        {
+            for (size_t rowIndex = 0; rowIndex < dataset.NumExamples(); ++rowIndex)
+            {
+                auto sparseDataVector = dataset[rowIndex].GetDataVector().template CopyAs<SparseDoubleDataVector>();
+                auto iterator = sparseDataVector.template GetIterator<IterationPolicy::skipZeros>();
+                while (iterator.IsValid())
+                {
+                    function(rowIndex, iterator.Get());
+                    iterator.Next();
+                }
+            }
+        }
+    }
+
+    template <typename DatasetType>
+    void SaveMappedDataset(const DatasetType& dataset, std::ostream& stream, MappedDatasetValueType valueType)
+    {
+        using namespace MappedDatasetDetail;
+
+        // first pass: count the non-zeros in each row
+        std::vector<uint64_t> rowOffsets(dataset.NumExamples() + 1, 0);
+        ForEachNonZero(dataset, [&rowOffsets](size_t rowIndex, IndexValue indexValue) {
+            if (indexValue.index > std::numeric_limits<uint32_t>::max())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "binary dataset files support 32-bit indices only");
+            }
+            ++rowOffsets[rowIndex + 1];
+        });
+        for (size_t rowIndex = 0; rowIndex < dataset.NumExamples(); ++rowIndex)
+        {
+            rowOffsets[rowIndex + 1] += rowOffsets[rowIndex];
+        }
+        auto numNonZeros = rowOffsets.back();
+
+        // header
+        MappedDatasetHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, "ELLCSR01", sizeof(header.magic));
+        header.numExamples = dataset.NumExamples();
+        header.numNonZeros = numNonZeros;
+        header.numFeatures = dataset.NumFeatures();
+        header.valueType = valueType;
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // labels and weights
+        for (size_t rowIndex = 0; rowIndex < dataset.NumExamples(); ++rowIndex)
+        {
+            WriteValue(stream, dataset[rowIndex].GetMetadata().label);
+        }
+        for (size_t rowIndex = 0; rowIndex < dataset.NumExamples(); ++rowIndex)
+        {
+            WriteValue(stream, dataset[rowIndex].GetMetadata().weight);
+        }
+
+        // row offsets
+        stream.write(reinterpret_cast<const char*>(rowOffsets.data()), rowOffsets.size() * sizeof(uint64_t));
+
+        // second pass: indices
+        ForEachNonZero(dataset, [&stream](size_t, IndexValue indexValue) { WriteValue(stream, static_cast<uint32_t>(indexValue.index)); });
+        WritePadding(stream, numNonZeros * sizeof(uint32_t));
+
+        // third pass: values
+        if (valueType == MappedDatasetValueType::floatValues)
+        {
+            ForEachNonZero(dataset, [&stream](size_t, IndexValue indexValue) { WriteValue(stream, static_cast<float>(indexValue.value)); });
+        }
+        else
+        {
+            ForEachNonZero(dataset, [&stream](size_t, IndexValue indexValue) { WriteValue(stream, indexValue.value); });
+        }
+
+        if (!stream.good())
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "error writing binary dataset");
+        }
+    }
+}
+}
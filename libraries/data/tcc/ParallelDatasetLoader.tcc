@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParallelDatasetLoader.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace data
+{
+    template <typename MetadataParserType, typename DataVectorParserType>
+    AutoSupervisedDataset MakeDatasetInParallel(const std::string& filepath, MetadataParserType metadataParser, DataVectorParserType dataVectorParser, size_t numThreads)
+    {
+        auto identity = [](const AutoSupervisedExample& example) { return example; };
+        return MakeTransformedDatasetInParallel(filepath, std::move(metadataParser), std::move(dataVectorParser), identity, numThreads);
+    }
+
+    template <typename MetadataParserType, typename DataVectorParserType, typename TransformationType>
+    AutoSupervisedDataset MakeTransformedDatasetInParallel(const std::string& filepath, MetadataParserType metadataParser, DataVectorParserType dataVectorParser, TransformationType transformation, size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::thread::hardware_concurrency();
+            if (numThreads == 0) // std::thread::hardware_concurrency may return 0 if it isn't implemented
+            {
+                numThreads = 1;
+            }
+        }
+
+        auto chunks = GetTextFileChunks(filepath, numThreads);
+
+        // each chunk is parsed and transformed on its own thread into a vector of examples, and each thread
+        // gets its own copy of the transformation
+        auto parseChunk = [&filepath, &metadataParser, &dataVectorParser](TextFileChunk chunk, TransformationType transformation) {
+            std::vector<AutoSupervisedExample> examples;
+            auto exampleIterator = MakeSingleLineParsingExampleIterator(ChunkedLineIterator(filepath, chunk), metadataParser, dataVectorParser);
+            while (exampleIterator.IsValid())
+            {
+                examples.push_back(transformation(exampleIterator.Get()));
+                exampleIterator.Next();
+            }
+            return examples;
+        };
+
+        std::vector<std::future<std::vector<AutoSupervisedExample>>> futures;
+        futures.reserve(chunks.size());
+        for (const auto& chunk : chunks)
+        {
+            futures.push_back(std::async(std::launch::async, parseChunk, chunk, transformation));
+        }
+
+        // collect the examples in chunk order, which preserves the order of the file
+        AutoSupervisedDataset dataset;
+        for (auto& future : futures)
+        {
+            auto examples = future.get();
+            for (auto& example : examples)
+            {
+                dataset.AddExample(std::move(example));
+            }
+        }
+
+        return dataset;
+    }
+}
+}
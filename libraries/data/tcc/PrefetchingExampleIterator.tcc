@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     PrefetchingExampleIterator.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+namespace ell
+{
+namespace data
+{
+    template <typename ExampleType>
+    PrefetchingExampleIterator<ExampleType>::PrefetchingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize)
+        : _exampleIterator(std::move(exampleIterator))
+    {
+        if (bufferSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "prefetching buffer size must be positive");
+        }
+        _ring.resize(bufferSize);
+        _thread = std::thread([this]() { Prefetch(); });
+    }
+
+    template <typename ExampleType>
+    PrefetchingExampleIterator<ExampleType>::~PrefetchingExampleIterator()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopping = true;
+        }
+        _notFull.notify_one();
+        _thread.join();
+    }
+
+    template <typename ExampleType>
+    bool PrefetchingExampleIterator<ExampleType>::IsValid() const
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        WaitForExample(lock);
+        return _count > 0;
+    }
+
+    template <typename ExampleType>
+    void PrefetchingExampleIterator<ExampleType>::Next()
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            WaitForExample(lock);
+            if (_count == 0)
+            {
+                return;
+            }
+            _ring[_head] = ExampleType();
+            _head = (_head + 1) % _ring.size();
+            --_count;
+        }
+        _notFull.notify_one();
+    }
+
+    template <typename ExampleType>
+    ExampleType PrefetchingExampleIterator<ExampleType>::Get() const
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        WaitForExample(lock);
+        if (_count == 0)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "attempted to get an example from an exhausted iterator");
+        }
+        return _ring[_head];
+    }
+
+    template <typename ExampleType>
+    void PrefetchingExampleIterator<ExampleType>::WaitForExample(std::unique_lock<std::mutex>& lock) const
+    {
+        _notEmpty.wait(lock, [this]() { return _count > 0 || _isDone; });
+
+        // rethrow a failure of the wrapped iterator only after all of the examples that preceded it are consumed
+        if (_count == 0 && _exception)
+        {
+            std::rethrow_exception(_exception);
+        }
+    }
+
+    template <typename ExampleType>
+    void PrefetchingExampleIterator<ExampleType>::Prefetch()
+    {
+        try
+        {
+            while (_exampleIterator.IsValid())
+            {
+                // read the next example without holding the lock, this is where the overlap happens
+                auto example = _exampleIterator.Get();
+                _exampleIterator.Next();
+
+                std::unique_lock<std::mutex> lock(_mutex);
+                _notFull.wait(lock, [this]() { return _count < _ring.size() || _isStopping; });
+                if (_isStopping)
+                {
+                    return;
+                }
+                _ring[(_head + _count) % _ring.size()] = std::move(example);
+                ++_count;
+                lock.unlock();
+                _notEmpty.notify_one();
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isDone = true;
+        }
+        _notEmpty.notify_one();
+    }
+
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakePrefetchingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize)
+    {
+        return ExampleIterator<ExampleType>(std::make_unique<PrefetchingExampleIterator<ExampleType>>(std::move(exampleIterator), bufferSize));
+    }
+}
+}
@@ -0,0 +1,380 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ReducedPrecisionDataVector.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "DenseDataVector.h"
+#include "SparseDataVector.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <cstring>
+
+namespace ell
+{
+namespace data
+{
+    inline float HalfToFloat(uint16_t bits)
+    {
+        // move the exponent and mantissa into place and rebias the exponent with a multiplication, which
+        // also normalizes half precision denormals; this is branch free, so loops over it vectorize
+        const uint32_t magicBits = (254 - 15) << 23;
+        const uint32_t infinityOrNanBits = (127 + 16) << 23;
+        float magic;
+        float infinityOrNan;
+        std::memcpy(&magic, &magicBits, sizeof(float));
+        std::memcpy(&infinityOrNan, &infinityOrNanBits, sizeof(float));
+
+        uint32_t result = static_cast<uint32_t>(bits & 0x7fff) << 13;
+        float value;
+        std::memcpy(&value, &result, sizeof(float));
+        value *= magic;
+        std::memcpy(&result, &value, sizeof(float));
+        result |= (value >= infinityOrNan) ? (255u << 23) : 0u;
+        result |= static_cast<uint32_t>(bits & 0x8000) << 16;
+        std::memcpy(&value, &result, sizeof(float));
+        return value;
+    }
+
+    namespace ReducedPrecisionDetail
+    {
+        // The kernels below decode on the fly. The dot product uses four independent accumulators, so that
+        // the loop is not serialized on the latency of a single floating point add.
+        template <typename CodecType>
+        double Dot(const CodecType& codec, const typename CodecType::StorageType* data, const double* vector, size_t increment, size_t size)
+        {
+            double sums[4] = { 0, 0, 0, 0 };
+            size_t i = 0;
+            if (increment == 1)
+            {
+                for (; i + 4 <= size; i += 4)
+                {
+                    sums[0] += codec.Decode(data[i]) * vector[i];
+                    sums[1] += codec.Decode(data[i + 1]) * vector[i + 1];
+                    sums[2] += codec.Decode(data[i + 2]) * vector[i + 2];
+                    sums[3] += codec.Decode(data[i + 3]) * vector[i + 3];
+                }
+            }
+            for (; i < size; ++i)
+            {
+                sums[0] += codec.Decode(data[i]) * vector[i * increment];
+            }
+            return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+        }
+
+        template <typename CodecType>
+        void AddTo(const CodecType& codec, const typename CodecType::StorageType* data, double* vector, size_t increment, size_t size)
+        {
+            if (increment == 1)
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    vector[i] += codec.Decode(data[i]);
+                }
+                return;
+            }
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                vector[i * increment] += codec.Decode(data[i]);
+            }
+        }
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType>::ReducedPrecisionDataVectorIterator(const StorageType* data, size_t dataSize, CodecType codec, size_t size)
+        : _data(data), _codec(codec), _size(std::min(size, dataSize))
+    {
+        SkipZeros();
+    }
+
+    template <typename CodecType>
+    void ReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType>::Next()
+    {
+        ++_index;
+        SkipZeros();
+    }
+
+    template <typename CodecType>
+    void ReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType>::SkipZeros()
+    {
+        while (_index < _size && _codec.Decode(_data[_index]) == 0)
+        {
+            ++_index;
+        }
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVectorIterator<IterationPolicy::all, CodecType>::ReducedPrecisionDataVectorIterator(const StorageType* data, size_t dataSize, CodecType codec, size_t size)
+        : _data(data), _dataSize(dataSize), _codec(codec), _size(size)
+    {
+    }
+
+    template <typename CodecType>
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    ReducedPrecisionDataVector<CodecType>::ReducedPrecisionDataVector(IndexValueIteratorType indexValueIterator)
+    {
+        SetValues(DoubleDataVector(std::move(indexValueIterator)).ToArray());
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVector<CodecType>::ReducedPrecisionDataVector(std::initializer_list<IndexValue> list)
+    {
+        SetValues(DoubleDataVector(std::move(list)).ToArray());
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVector<CodecType>::ReducedPrecisionDataVector(std::initializer_list<double> list)
+    {
+        SetValues(DoubleDataVector(std::move(list)).ToArray());
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVector<CodecType>::ReducedPrecisionDataVector(std::vector<IndexValue> vec)
+    {
+        SetValues(DoubleDataVector(std::move(vec)).ToArray());
+    }
+
+    template <typename CodecType>
+    ReducedPrecisionDataVector<CodecType>::ReducedPrecisionDataVector(std::vector<double> vec)
+    {
+        SetValues(DoubleDataVector(std::move(vec)).ToArray());
+    }
+
+    template <typename CodecType>
+    template <IterationPolicy policy>
+    auto ReducedPrecisionDataVector<CodecType>::GetIterator(size_t size) const -> Iterator<policy>
+    {
+        return Iterator<policy>(_data.data(), _data.size(), _codec, size);
+    }
+
+    template <typename CodecType>
+    void ReducedPrecisionDataVector<CodecType>::AppendElement(size_t index, double value)
+    {
+        if (value == 0)
+        {
+            return;
+        }
+
+        if (index < _data.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+        }
+
+        if (!_codec.CanEncode(value))
+        {
+            auto values = this->ToArray(index + 1);
+            values[index] = value;
+            SetValues(values);
+            return;
+        }
+
+        _data.resize(index + 1, _codec.Encode(0.0));
+        _data[index] = _codec.Encode(value);
+    }
+
+    template <typename CodecType>
+    double ReducedPrecisionDataVector<CodecType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        auto size = std::min(_data.size(), vector.Size());
+        return ReducedPrecisionDetail::Dot(_codec, _data.data(), vector.GetDataPointer(), vector.GetIncrement(), size);
+    }
+
+    template <typename CodecType>
+    void ReducedPrecisionDataVector<CodecType>::AddTo(math::RowVectorReference<double> vector) const
+    {
+        auto size = std::min(_data.size(), vector.Size());
+        ReducedPrecisionDetail::AddTo(_codec, _data.data(), vector.GetDataPointer(), vector.GetIncrement(), size);
+    }
+
+    template <typename CodecType>
+    void ReducedPrecisionDataVector<CodecType>::SetValues(const std::vector<double>& values)
+    {
+        _codec = CodecType::Fit(values);
+        _data.resize(values.size());
+        std::transform(values.begin(), values.end(), _data.begin(), [this](double value) { return _codec.Encode(value); });
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVectorIterator<IterationPolicy::skipZeros, CodecType>::SparseReducedPrecisionDataVectorIterator(const utilities::CompressedIntegerList::Iterator& indexIterator, const StorageType* values, CodecType codec, size_t size)
+        : _indexIterator(indexIterator), _values(values), _codec(codec), _size(size)
+    {
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVectorIterator<IterationPolicy::all, CodecType>::SparseReducedPrecisionDataVectorIterator(const utilities::CompressedIntegerList::Iterator& indexIterator, const StorageType* values, CodecType codec, size_t size)
+        : _indexIterator(indexIterator), _values(values), _codec(codec), _size(size)
+    {
+        _iteratorIndex = _indexIterator.IsValid() ? _indexIterator.Get() : _size;
+    }
+
+    template <typename CodecType>
+    void SparseReducedPrecisionDataVectorIterator<IterationPolicy::all, CodecType>::Next()
+    {
+        if (_index == _iteratorIndex)
+        {
+            _indexIterator.Next();
+            ++_values;
+            _iteratorIndex = _indexIterator.IsValid() && _indexIterator.Get() < _size ? _indexIterator.Get() : _size;
+        }
+        ++_index;
+    }
+
+    template <typename CodecType>
+    template <typename IndexValueIteratorType, IsIndexValueIterator<IndexValueIteratorType> Concept>
+    SparseReducedPrecisionDataVector<CodecType>::SparseReducedPrecisionDataVector(IndexValueIteratorType indexValueIterator)
+    {
+        SetElements(std::move(indexValueIterator));
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVector<CodecType>::SparseReducedPrecisionDataVector(std::initializer_list<IndexValue> list)
+    {
+        SetElements(SparseDoubleDataVector(std::move(list)).GetIterator<IterationPolicy::skipZeros>());
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVector<CodecType>::SparseReducedPrecisionDataVector(std::initializer_list<double> list)
+    {
+        SetElements(SparseDoubleDataVector(std::move(list)).GetIterator<IterationPolicy::skipZeros>());
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVector<CodecType>::SparseReducedPrecisionDataVector(std::vector<IndexValue> vec)
+    {
+        SetElements(SparseDoubleDataVector(std::move(vec)).GetIterator<IterationPolicy::skipZeros>());
+    }
+
+    template <typename CodecType>
+    SparseReducedPrecisionDataVector<CodecType>::SparseReducedPrecisionDataVector(std::vector<double> vec)
+    {
+        SetElements(SparseDoubleDataVector(std::move(vec)).GetIterator<IterationPolicy::skipZeros>());
+    }
+
+    template <typename CodecType>
+    void SparseReducedPrecisionDataVector<CodecType>::AppendElement(size_t index, double value)
+    {
+        if (value == 0)
+        {
+            return;
+        }
+
+        if (_indexList.Size() > 0)
+        {
+            if (index <= _indexList.Max())
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+            }
+        }
+
+        if (!_codec.CanEncode(value))
+        {
+            std::vector<double> values;
+            values.reserve(_values.size() + 1);
+            for (auto code : _values)
+            {
+                values.push_back(_codec.Decode(code));
+            }
+            values.push_back(value);
+
+            auto codec = CodecType::Fit(values);
+            for (size_t i = 0; i < _values.size(); ++i)
+            {
+                _values[i] = codec.Encode(values[i]);
+            }
+            _codec = codec;
+        }
+
+        _indexList.Append(index);
+        _values.push_back(_codec.Encode(value));
+    }
+
+    template <typename CodecType>
+    double SparseReducedPrecisionDataVector<CodecType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        double result = 0.0;
+        auto size = vector.Size();
+        auto values = _values.data();
+
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (indices[i] >= size)
+                {
+                    return result;
+                }
+                result += _codec.Decode(values[i]) * vector[indices[i]];
+            }
+            values += blockSize;
+            blockIterator.Next();
+        }
+        return result;
+    }
+
+    template <typename CodecType>
+    void SparseReducedPrecisionDataVector<CodecType>::AddTo(math::RowVectorReference<double> vector) const
+    {
+        auto size = vector.Size();
+        auto values = _values.data();
+
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (indices[i] >= size)
+                {
+                    return;
+                }
+                vector[indices[i]] += _codec.Decode(values[i]);
+            }
+            values += blockSize;
+            blockIterator.Next();
+        }
+    }
+
+    template <typename CodecType>
+    template <typename IndexValueIteratorType>
+    void SparseReducedPrecisionDataVector<CodecType>::SetElements(IndexValueIteratorType indexValueIterator)
+    {
+        // the codec can only be fitted once all of the values are known
+        std::vector<size_t> indices;
+        std::vector<double> values;
+        while (indexValueIterator.IsValid())
+        {
+            auto indexValue = indexValueIterator.Get();
+            if (indexValue.value != 0)
+            {
+                if (!indices.empty() && indexValue.index <= indices.back())
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "Can only append values to the end of a data vector");
+                }
+                indices.push_back(indexValue.index);
+                values.push_back(indexValue.value);
+            }
+            indexValueIterator.Next();
+        }
+
+        _codec = CodecType::Fit(values);
+        _indexList.Reserve(indices.size());
+        _values.reserve(values.size());
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            _indexList.Append(indices[i]);
+            _values.push_back(_codec.Encode(values[i]));
+        }
+    }
+}
+}
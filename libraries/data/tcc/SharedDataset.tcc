@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SharedDataset.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace data
+{
+    template <typename DatasetExampleType>
+    SharedDataset<DatasetExampleType>::SharedDataset(const AnyDataset& anyDataset)
+    {
+        _pDataset = anyDataset.GetDataset<DatasetExampleType>();
+        if (_pDataset != nullptr)
+        {
+            // zero-copy: refer to the examples of the original dataset
+            _fromIndex = anyDataset.FromIndex();
+            _size = anyDataset.NumExamples();
+            if (_size == 0 && _fromIndex < _pDataset->NumExamples())
+            {
+                _size = _pDataset->NumExamples() - _fromIndex;
+            }
+        }
+        else
+        {
+            _ownedDataset = std::make_shared<const Dataset<DatasetExampleType>>(anyDataset);
+            _pDataset = _ownedDataset.get();
+            _size = _pDataset->NumExamples();
+        }
+    }
+
+    template <typename DatasetExampleType>
+    ExampleReferenceIterator<DatasetExampleType> SharedDataset<DatasetExampleType>::GetExampleReferenceIterator() const
+    {
+        return _pDataset->GetExampleReferenceIterator(_fromIndex, _size);
+    }
+
+    template <typename DatasetExampleType>
+    AnyDataset SharedDataset<DatasetExampleType>::GetAnyDataset() const
+    {
+        return AnyDataset(_pDataset, _fromIndex, _size);
+    }
+}
+}
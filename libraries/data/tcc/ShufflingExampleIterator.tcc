@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ShufflingExampleIterator.tcc (data)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <utility>
+
+namespace ell
+{
+namespace data
+{
+    template <typename ExampleType>
+    ShufflingExampleIterator<ExampleType>::ShufflingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize, std::default_random_engine rng)
+        : _exampleIterator(std::move(exampleIterator)), _random(rng)
+    {
+        if (bufferSize == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "shuffle buffer size must be positive");
+        }
+
+        _buffer.reserve(bufferSize);
+        while (_buffer.size() < bufferSize && _exampleIterator.IsValid())
+        {
+            _buffer.push_back(_exampleIterator.Get());
+            _exampleIterator.Next();
+        }
+        ChooseCurrent();
+    }
+
+    template <typename ExampleType>
+    void ShufflingExampleIterator<ExampleType>::Next()
+    {
+        if (_exampleIterator.IsValid())
+        {
+            // replace the current example with the next one from the wrapped iterator
+            _buffer[_current] = _exampleIterator.Get();
+            _exampleIterator.Next();
+        }
+        else
+        {
+            // the wrapped iterator is exhausted, drain the buffer
+            std::swap(_buffer[_current], _buffer.back());
+            _buffer.pop_back();
+        }
+        ChooseCurrent();
+    }
+
+    template <typename ExampleType>
+    void ShufflingExampleIterator<ExampleType>::ChooseCurrent()
+    {
+        if (!_buffer.empty())
+        {
+            std::uniform_int_distribution<size_t> dist(0, _buffer.size() - 1);
+            _current = dist(_random);
+        }
+    }
+
+    template <typename ExampleType>
+    ExampleIterator<ExampleType> MakeShufflingExampleIterator(ExampleIterator<ExampleType> exampleIterator, size_t bufferSize, std::default_random_engine rng)
+    {
+        return ExampleIterator<ExampleType>(std::make_unique<ShufflingExampleIterator<ExampleType>>(std::move(exampleIterator), bufferSize, rng));
+    }
+}
+}
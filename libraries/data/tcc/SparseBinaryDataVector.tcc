@@ -121,12 +121,23 @@ namespace data
     double SparseBinaryDataVectorBase<IndexListType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
     {
         double value = 0.0;
+        auto size = vector.Size();
 
-        auto iter = _indexList.GetIterator();
-        while (iter.IsValid())
+        // decode the indices in blocks, which is much faster than decoding them one at a time
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
         {
-            value += vector[iter.Get()];
-            iter.Next();
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (indices[i] >= size)
+                {
+                    return value;
+                }
+                value += vector[indices[i]];
+            }
+            blockIterator.Next();
         }
 
         return value;
@@ -135,19 +146,22 @@ namespace data
     template <typename IndexListType>
     void SparseBinaryDataVectorBase<IndexListType>::AddTo(math::RowVectorReference<double> vector) const
     {
-        auto iter = _indexList.GetIterator();
         auto size = vector.Size();
 
-        while (iter.IsValid())
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
         {
-            auto index = iter.Get();
-            if (index >= size)
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
             {
-                return;
+                if (indices[i] >= size)
+                {
+                    return;
+                }
+                vector[indices[i]] += 1.0;
             }
-
-            vector[index] += 1.0;
-            iter.Next();
+            blockIterator.Next();
         }
     }
 }
@@ -148,5 +148,55 @@ namespace data
             return _indexList.Max() + 1;
         }
     }
+    template <typename ElementType, typename IndexListType>
+    double SparseDataVector<ElementType, IndexListType>::Dot(const math::UnorientedConstVectorReference<double> vector) const
+    {
+        double result = 0.0;
+        auto size = vector.Size();
+        auto values = _values.data();
+
+        // decode the indices in blocks, which is much faster than decoding them one at a time
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (indices[i] >= size)
+                {
+                    return result;
+                }
+                result += static_cast<double>(values[i]) * vector[indices[i]];
+            }
+            values += blockSize;
+            blockIterator.Next();
+        }
+        return result;
+    }
+
+    template <typename ElementType, typename IndexListType>
+    void SparseDataVector<ElementType, IndexListType>::AddTo(math::RowVectorReference<double> vector) const
+    {
+        auto size = vector.Size();
+        auto values = _values.data();
+
+        auto blockIterator = _indexList.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            auto indices = blockIterator.Get();
+            auto blockSize = blockIterator.GetBlockSize();
+            for (size_t i = 0; i < blockSize; ++i)
+            {
+                if (indices[i] >= size)
+                {
+                    return;
+                }
+                vector[indices[i]] += static_cast<double>(values[i]);
+            }
+            values += blockSize;
+            blockIterator.Next();
+        }
+    }
 }
 }
@@ -13,6 +13,9 @@ namespace ell
 void IDataVectorTests();
 void DataVectorCopyAsTests();
 void AutoDataVectorTest();
+void DenseBinaryDataVectorTest();
+void ReducedPrecisionDataVectorTests();
 void TransformedDataVectorTest();
+void FeatureHashingTest();
 void IteratorTests();
 }
\ No newline at end of file
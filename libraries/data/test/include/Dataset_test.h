@@ -11,4 +11,10 @@
 namespace ell
 {
 void DatasetCastingTests();
+void MappedDatasetTests();
+void ArenaDatasetTests();
+void DatasetConstIteratorTest();
+void DatasetIndexViewTest();
+void SharedDatasetTest();
+void ShufflingExampleIteratorTest();
 }
\ No newline at end of file
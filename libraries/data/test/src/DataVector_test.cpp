@@ -12,7 +12,11 @@
 #include "AutoDataVector.h"
 #include "DataVector.h"
 #include "DataVectorOperations.h"
+#include "DenseBinaryDataVector.h"
 #include "DenseDataVector.h"
+#include "FeatureHasher.h"
+#include "HashingIndexValueIterator.h"
+#include "ReducedPrecisionDataVector.h"
 #include "SparseBinaryDataVector.h"
 #include "SparseDataVector.h"
 #include "DataVectorOperations.h"
@@ -96,6 +100,8 @@ void IDataVectorTests()
     IDataVectorTest<data::SparseFloatDataVector>();
     IDataVectorTest<data::SparseShortDataVector>();
     IDataVectorTest<data::SparseByteDataVector>();
+    IDataVectorTest<data::HalfDataVector>();
+    IDataVectorTest<data::SparseHalfDataVector>();
     IDataVectorTest<data::AutoDataVector>();
 
     IDataVectorBinaryTest<data::DoubleDataVector>();
@@ -106,8 +112,13 @@ void IDataVectorTests()
     IDataVectorBinaryTest<data::SparseFloatDataVector>();
     IDataVectorBinaryTest<data::SparseShortDataVector>();
     IDataVectorBinaryTest<data::SparseByteDataVector>();
+    IDataVectorBinaryTest<data::HalfDataVector>();
+    IDataVectorBinaryTest<data::QuantizedByteDataVector>();
+    IDataVectorBinaryTest<data::SparseHalfDataVector>();
+    IDataVectorBinaryTest<data::SparseQuantizedByteDataVector>();
     IDataVectorBinaryTest<data::AutoDataVector>();
     IDataVectorBinaryTest<data::SparseBinaryDataVector>();
+    IDataVectorBinaryTest<data::DenseBinaryDataVector>();
 }
 
 template <typename DataVectorType1, typename DataVectorType2>
@@ -163,6 +174,7 @@ void DataVectorCopyAsTestDispatch(InitType maxType)
     DataVectorCopyAsTest<DataVectorType, data::SparseShortDataVector>(integeralInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseByteDataVector>(integeralInit);
     DataVectorCopyAsTest<DataVectorType, data::SparseBinaryDataVector>(binaryInit, false);
+    DataVectorCopyAsTest<DataVectorType, data::DenseBinaryDataVector>(binaryInit, false);
 }
 
 void DataVectorCopyAsTests()
@@ -177,6 +189,7 @@ void DataVectorCopyAsTests()
     DataVectorCopyAsTestDispatch<data::SparseShortDataVector>(InitType::integral);
     DataVectorCopyAsTestDispatch<data::SparseByteDataVector>(InitType::integral);
     DataVectorCopyAsTestDispatch<data::SparseBinaryDataVector>(InitType::binary);
+    DataVectorCopyAsTestDispatch<data::DenseBinaryDataVector>(InitType::binary);
 }
 
 void AutoDataVectorTest()
@@ -207,6 +220,149 @@ void AutoDataVectorTest()
 
     data::AutoDataVector v9{ 0, 0, 0, 0, 0, 1, 0, 0, 0 };
     testing::ProcessTest("AutoDataVector ctor", v9.GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
+
+    std::vector<double> binaryValues(128);
+    for (size_t i = 0; i < binaryValues.size(); i += 4)
+    {
+        binaryValues[i] = 1;
+    }
+    data::AutoDataVector v10(binaryValues);
+    testing::ProcessTest("AutoDataVector ctor", v10.GetInternalType() == data::IDataVector::Type::DenseBinaryDataVector);
+
+    // binary vectors take the smaller of the bitmap and the compressed index list, which crosses over
+    // near 10% density when the gaps between indices fit in a byte
+    auto makeBinaryVector = [](size_t size, size_t numOnesPerHundred) {
+        std::vector<double> values(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            values[i] = (i % 100) < numOnesPerHundred ? 1.0 : 0.0;
+        }
+        values[size - 1] = 1;
+        return data::AutoDataVector(values);
+    };
+    testing::ProcessTest("AutoDataVector binary ctor at 5% density", makeBinaryVector(1000, 5).GetInternalType() == data::IDataVector::Type::SparseBinaryDataVector);
+    testing::ProcessTest("AutoDataVector binary ctor at 11% density", makeBinaryVector(1000, 11).GetInternalType() == data::IDataVector::Type::DenseBinaryDataVector);
+    testing::ProcessTest("AutoDataVector binary ctor at 40% density", makeBinaryVector(1000, 40).GetInternalType() == data::IDataVector::Type::DenseBinaryDataVector);
+}
+
+void DenseBinaryDataVectorTest()
+{
+    // compare against the sparse representation, on vectors whose 64-bit words range from empty to full
+    const size_t size = 1000;
+    math::RowVector<double> w(size + 3);
+    for (size_t i = 0; i < w.Size(); ++i)
+    {
+        w[i] = std::sin(static_cast<double>(i));
+    }
+
+    bool isDotEqual = true;
+    bool isAddToEqual = true;
+    bool isIteratorEqual = true;
+    for (size_t period : { 1, 2, 3, 7, 13, 100 })
+    {
+        std::vector<double> values(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            values[i] = (i % period == 0 || (i > 500 && i < 700)) ? 1.0 : 0.0;
+        }
+        data::DenseBinaryDataVector u(values);
+        data::SparseBinaryDataVector v(values);
+
+        isDotEqual &= testing::IsEqual(u.Dot(w), v.Dot(w), 1.0e-9);
+        isDotEqual &= testing::IsEqual(u.Dot(w.GetSubVector(0, 333)), v.Dot(w.GetSubVector(0, 333)), 1.0e-9);
+
+        math::RowVector<double> x(size + 3);
+        math::RowVector<double> y(size + 3);
+        u.AddTo(x);
+        v.AddTo(y);
+        isAddToEqual &= x == y;
+
+        isIteratorEqual &= u.ToArray() == v.ToArray();
+        isIteratorEqual &= testing::IsEqual(u.Norm2Squared(), v.Norm2Squared());
+    }
+    testing::ProcessTest("DenseBinaryDataVector::Dot()", isDotEqual);
+    testing::ProcessTest("DenseBinaryDataVector::AddTo()", isAddToEqual);
+    testing::ProcessTest("DenseBinaryDataVector iterators", isIteratorEqual);
+}
+
+template <typename DataVectorType>
+void ReducedPrecisionDataVectorTest(double tolerance)
+{
+    std::vector<double> values{ 0.5, -3.25, 0, 7.125, 0, 0, -0.1, 12.3, 0, 100.7 };
+    DataVectorType u(values);
+    std::string name = typeid(DataVectorType).name();
+
+    auto array = u.ToArray(values.size());
+    bool isWithinTolerance = true;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        isWithinTolerance &= std::abs(array[i] - values[i]) <= tolerance;
+    }
+    testing::ProcessTest("ReducedPrecisionDataVectorTest<" + name + ">::ToArray()", isWithinTolerance);
+    testing::ProcessTest("ReducedPrecisionDataVectorTest<" + name + ">::ToArray() zeros", array[2] == 0 && array[4] == 0 && array[5] == 0 && array[8] == 0);
+
+    math::RowVector<double> w{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    double expectedDot = 0;
+    double dotTolerance = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        expectedDot += values[i] * w[i];
+        dotTolerance += tolerance * w[i];
+    }
+    testing::ProcessTest("ReducedPrecisionDataVectorTest<" + name + ">::Dot()", testing::IsEqual(u.Dot(w), expectedDot, dotTolerance));
+
+    math::RowVector<double> z(12);
+    u.AddTo(z);
+    array.resize(12);
+    testing::ProcessTest("ReducedPrecisionDataVectorTest<" + name + ">::AddTo()", testing::IsEqual(z.ToArray(), array));
+
+    // appending a value outside of the current range refits the codec
+    u.AppendElement(11, -250.0);
+    array = u.ToArray();
+    testing::ProcessTest("ReducedPrecisionDataVectorTest<" + name + ">::AppendElement()", array.size() == 12 && std::abs(array[11] + 250.0) <= 2 * tolerance + 1.0 && std::abs(array[9] - 100.7) <= 2 * tolerance + 1.0);
+}
+
+void ReducedPrecisionDataVectorTests()
+{
+    ReducedPrecisionDataVectorTest<data::HalfDataVector>(0.05);
+    ReducedPrecisionDataVectorTest<data::SparseHalfDataVector>(0.05);
+    ReducedPrecisionDataVectorTest<data::QuantizedByteDataVector>(0.5);
+    ReducedPrecisionDataVectorTest<data::SparseQuantizedByteDataVector>(0.5);
+
+    // float16 conversions round to nearest even, and handle denormals and overflow
+    testing::ProcessTest("HalfToFloat(DoubleToHalf())", data::HalfToFloat(data::DoubleToHalf(1.0)) == 1.0f && data::HalfToFloat(data::DoubleToHalf(-2.5)) == -2.5f && data::HalfToFloat(data::DoubleToHalf(65504.0)) == 65504.0f);
+    testing::ProcessTest("DoubleToHalf() rounding", data::HalfToFloat(data::DoubleToHalf(2049.0)) == 2048.0f && data::HalfToFloat(data::DoubleToHalf(2051.0)) == 2052.0f);
+    testing::ProcessTest("DoubleToHalf() denormals", data::HalfToFloat(data::DoubleToHalf(std::ldexp(1.0, -24))) == std::ldexp(1.0f, -24) && data::DoubleToHalf(std::ldexp(1.0, -26)) == 0);
+    testing::ProcessTest("DoubleToHalf() overflow", std::isinf(data::HalfToFloat(data::DoubleToHalf(1.0e6))) && data::HalfToFloat(data::DoubleToHalf(-1.0e6)) < 0);
+
+    // with a tolerance, AutoDataVector chooses a lossy representation when one is within the tolerance
+    std::vector<double> ramp;
+    for (int i = 0; i < 256; ++i)
+    {
+        ramp.push_back(i * 0.5 + 1);
+    }
+    data::AutoDataVector v1{ data::DoubleDataVector(ramp) };
+    testing::ProcessTest("AutoDataVector ctor with zero tolerance", v1.GetInternalType() == data::IDataVector::Type::FloatDataVector);
+
+    data::AutoDataVector v2(data::DoubleDataVector(ramp), 0.5);
+    testing::ProcessTest("AutoDataVector ctor with tolerance", v2.GetInternalType() == data::IDataVector::Type::QuantizedByteDataVector);
+
+    data::AutoDataVector v3(data::DoubleDataVector(ramp), 0.1);
+    testing::ProcessTest("AutoDataVector ctor with tolerance", v3.GetInternalType() == data::IDataVector::Type::HalfDataVector);
+
+    std::vector<double> fineRamp;
+    for (int i = 0; i < 256; ++i)
+    {
+        fineRamp.push_back(i * 0.01 + 1);
+    }
+    data::AutoDataVector v4(data::DoubleDataVector(fineRamp), 1.0e-6);
+    testing::ProcessTest("AutoDataVector ctor with tolerance", v4.GetInternalType() == data::IDataVector::Type::DoubleDataVector);
+
+    data::AutoDataVector v5(data::DoubleDataVector{ 0, 0, 0, 0, 0, 1.2345678901, 0, 0, 0, 0, 0, 0, 0, -3.1 }, 0.1);
+    testing::ProcessTest("AutoDataVector ctor with tolerance", v5.GetInternalType() == data::IDataVector::Type::SparseQuantizedByteDataVector);
+
+    data::AutoDataVector v6(data::DoubleDataVector{ 10, 20, 30, 40, 50, 60, 70 }, 0.1);
+    testing::ProcessTest("AutoDataVector ctor with tolerance", v6.GetInternalType() == data::IDataVector::Type::ByteDataVector);
 }
 
 void TransformedDataVectorTest()
@@ -233,6 +389,63 @@ void TransformedDataVectorTest()
     v += Sqrt(u);
 }
 
+void FeatureHashingTest()
+{
+    data::SparseDoubleDataVector u{ { 3, 1.0 }, { 1000, -2.0 }, { 123456789012, 0.5 }, { 1000000000000000, 4.0 } };
+
+    // unsigned hashing with a single bit forces collisions, which are summed
+    data::FeatureHasher unsignedHasher(1, false);
+    auto v = data::HashDataVector<data::SparseDoubleDataVector>(u, unsignedHasher);
+    auto a = v.ToArray();
+    testing::ProcessTest("FeatureHashingTest: collisions", a.size() <= 2 && testing::IsEqual(a[0] + (a.size() > 1 ? a[1] : 0.0), 3.5));
+
+    // signed hashing keeps the absolute values of features that do not collide
+    data::FeatureHasher signedHasher(40);
+    auto w = data::HashDataVector<data::SparseDoubleDataVector>(u, signedHasher);
+    std::vector<data::IndexValue> expected;
+    auto iter = u.GetIterator<data::IterationPolicy::skipZeros>();
+    while (iter.IsValid())
+    {
+        auto hashed = signedHasher.Hash(iter.Get());
+        if (std::abs(hashed.value) == std::abs(iter.Get().value))
+        {
+            expected.push_back(hashed);
+        }
+        iter.Next();
+    }
+    std::sort(expected.begin(), expected.end(), [](const data::IndexValue& a, const data::IndexValue& b) { return a.index < b.index; });
+
+    bool isHashedCorrectly = w.PrefixLength() <= signedHasher.GetOutputSize() && expected.size() == 4;
+    auto hashedIter = w.GetIterator<data::IterationPolicy::skipZeros>();
+    for (const auto& indexValue : expected)
+    {
+        isHashedCorrectly &= hashedIter.IsValid() && hashedIter.Get().index == indexValue.index && hashedIter.Get().value == indexValue.value;
+        hashedIter.Next();
+    }
+    testing::ProcessTest("FeatureHashingTest: signed hashing", isHashedCorrectly);
+
+    // a different seed gives a different hash function
+    data::FeatureHasher seededHasher(40, true, 17);
+    testing::ProcessTest("FeatureHashingTest: seed", seededHasher.Hash({ 3, 1.0 }).index != signedHasher.Hash({ 3, 1.0 }).index);
+
+    data::FeatureHasher smallHasher(6);
+    auto y = data::HashDataVector<data::SparseDoubleDataVector>(u, smallHasher);
+    auto z = data::HashDataVector<data::AutoDataVector>(u, smallHasher);
+    data::AutoDataVector x(data::HashDataVector<data::SparseDoubleDataVector>(u, signedHasher), 0.0);
+    testing::ProcessTest("FeatureHashingTest: AutoDataVector", testing::IsEqual(z.ToArray(64), y.ToArray(64)) && x.PrefixLength() == w.PrefixLength() && x.GetInternalType() == data::IDataVector::Type::SparseFloatDataVector);
+
+    bool threwException = false;
+    try
+    {
+        data::FeatureHasher badHasher(0);
+    }
+    catch (const utilities::InputException&)
+    {
+        threwException = true;
+    }
+    testing::ProcessTest("FeatureHashingTest: invalid number of bits", threwException);
+}
+
 template <typename DataVectorType>
 void IteratorTest()
 {
@@ -270,5 +483,10 @@ void IteratorTests()
     IteratorTest<data::SparseShortDataVector>();
     IteratorTest<data::SparseByteDataVector>();
     IteratorTest<data::SparseBinaryDataVector>();
+    IteratorTest<data::DenseBinaryDataVector>();
+    IteratorTest<data::HalfDataVector>();
+    IteratorTest<data::QuantizedByteDataVector>();
+    IteratorTest<data::SparseHalfDataVector>();
+    IteratorTest<data::SparseQuantizedByteDataVector>();
 }
 }
\ No newline at end of file
@@ -7,12 +7,31 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Dataset_test.h"
+#include "ArenaDataset.h"
+#include "DataVectorOperations.h"
 #include "Dataset.h"
+#include "DatasetIndexView.h"
+#include "MappedDataset.h"
+#include "SharedDataset.h"
+#include "ShufflingExampleIterator.h"
+
+// math
+#include "Vector.h"
 
 // testing
 #include "testing.h"
 
+// utilities
+#include "Files.h"
+
 // stl
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
 #include <sstream>
 
 namespace ell
@@ -66,4 +85,414 @@ void DatasetCastingTests()
     DatasetCastingTestDispatch<data::AutoSupervisedExample>();
     DatasetCastingTestDispatch<data::DenseSupervisedExample>();
 }
-}
\ No newline at end of file
+
+void MappedDatasetTest(data::MappedDatasetValueType valueType, std::string typeName)
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2.5, 0, 0, -3 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 0, 0, 0 }, data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ data::IndexValue{ 3, 0.5 }, data::IndexValue{ 12, 4 } }, data::WeightLabel{ 0.5, 1 }));
+
+    auto filepath = testing::GetTempFilePath("MappedDatasetTest." + typeName + ".bin");
+    {
+        std::ofstream stream(filepath, std::ios::binary);
+        data::SaveMappedDataset(dataset, stream, valueType);
+    }
+
+    testing::ProcessTest("IsMappedDatasetFile(" + typeName + ")", data::IsMappedDatasetFile(filepath));
+
+    // the mapping is closed before the file is removed
+    {
+        data::MappedDataset mappedDataset(filepath);
+        bool isSame = mappedDataset.NumExamples() == dataset.NumExamples() && mappedDataset.NumFeatures() == dataset.NumFeatures();
+
+        // views
+        auto iterator = mappedDataset.GetExampleReferenceIterator();
+        math::ColumnVector<double> w{ 1, 2, 3, 4, 5, 6, 7 };
+        for (size_t i = 0; iterator.IsValid(); ++i, iterator.Next())
+        {
+            auto example = iterator.Get();
+            isSame = isSame && testing::IsEqual(example.GetDataVector().ToArray(), dataset[i].GetDataVector().ToArray());
+            isSame = isSame && example.GetMetadata().weight == dataset[i].GetMetadata().weight && example.GetMetadata().label == dataset[i].GetMetadata().label;
+            isSame = isSame && testing::IsEqual(example.GetDataVector().Dot(w), dataset[i].GetDataVector().Dot(w));
+        }
+        testing::ProcessTest("MappedDataset::GetExampleReferenceIterator(" + typeName + ")", isSame);
+
+        // copies through AnyDataset
+        data::Dataset<data::DenseSupervisedExample> copiedDataset(mappedDataset.GetAnyDataset(1, 2));
+        std::stringstream ss1, ss2;
+        dataset.Print(ss1, 0, 1, 2);
+        copiedDataset.Print(ss2);
+        testing::ProcessTest("MappedDataset::GetAnyDataset(" + typeName + ")", copiedDataset.NumExamples() == 2 && ss1.str() == ss2.str());
+
+        // re-encoding straight from the mapping
+        std::stringstream savedFromDataset, savedFromMapping;
+        data::SaveMappedDataset(dataset, savedFromDataset, valueType);
+        data::SaveMappedDataset(mappedDataset, savedFromMapping, valueType);
+        testing::ProcessTest("SaveMappedDataset(MappedDataset, " + typeName + ")", savedFromDataset.str() == savedFromMapping.str());
+    }
+    std::remove(filepath.c_str());
+}
+
+// writes a binary dataset file with one field overwritten and checks that opening it or reading its examples,
+// up to a given number of them, throws
+template <typename FieldType>
+bool IsCorruptMappedDatasetRejected(const std::string& contents, size_t fieldOffset, FieldType fieldValue, size_t numExamplesToRead = std::numeric_limits<size_t>::max())
+{
+    auto corruptContents = contents;
+    std::memcpy(&corruptContents[fieldOffset], &fieldValue, sizeof(FieldType));
+
+    auto filepath = testing::GetTempFilePath("MappedDatasetValidationTest.bin");
+    {
+        std::ofstream stream(filepath, std::ios::binary);
+        stream << corruptContents;
+    }
+
+    bool isRejected = false;
+    try
+    {
+        data::MappedDataset mappedDataset(filepath);
+        for (size_t index = 0; index < mappedDataset.NumExamples() && index < numExamplesToRead; ++index)
+        {
+            mappedDataset.GetExample(index);
+        }
+    }
+    catch (const utilities::DataFormatException&)
+    {
+        isRejected = true;
+    }
+    std::remove(filepath.c_str());
+    return isRejected;
+}
+
+void MappedDatasetValidationTest()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2.5, 0, 0, -3 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 0, 0, 0 }, data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ data::IndexValue{ 3, 0.5 }, data::IndexValue{ 12, 4 } }, data::WeightLabel{ 0.5, 1 }));
+
+    std::stringstream stream;
+    data::SaveMappedDataset(dataset, stream, data::MappedDatasetValueType::floatValues);
+    auto contents = stream.str();
+
+    // section offsets of a file with 3 examples and 5 non-zeros
+    const size_t numExamplesOffset = offsetof(data::MappedDatasetHeader, numExamples);
+    const size_t numNonZerosOffset = offsetof(data::MappedDatasetHeader, numNonZeros);
+    const size_t valueTypeOffset = offsetof(data::MappedDatasetHeader, valueType);
+    const size_t rowOffsetsOffset = sizeof(data::MappedDatasetHeader) + 6 * sizeof(double);
+    const size_t indicesOffset = rowOffsetsOffset + 4 * sizeof(uint64_t);
+
+    testing::ProcessTest("MappedDataset rejects an unknown value type", IsCorruptMappedDatasetRejected(contents, valueTypeOffset, uint32_t{ 7 }));
+    testing::ProcessTest("MappedDataset rejects an overflowing number of examples", IsCorruptMappedDatasetRejected(contents, numExamplesOffset, uint64_t{ 1 } << 62));
+    testing::ProcessTest("MappedDataset rejects an overflowing number of non-zeros", IsCorruptMappedDatasetRejected(contents, numNonZerosOffset, ~uint64_t{ 0 }));
+    testing::ProcessTest("MappedDataset rejects decreasing row offsets", IsCorruptMappedDatasetRejected(contents, rowOffsetsOffset + 2 * sizeof(uint64_t), uint64_t{ 1 }));
+    testing::ProcessTest("MappedDataset rejects row offsets past the non-zeros", IsCorruptMappedDatasetRejected(contents, rowOffsetsOffset + sizeof(uint64_t), uint64_t{ 6 }));
+    testing::ProcessTest("MappedDataset rejects out of range indices", IsCorruptMappedDatasetRejected(contents, indicesOffset + 4 * sizeof(uint32_t), uint32_t{ 13 }));
+    testing::ProcessTest("MappedDataset rejects out of order indices", IsCorruptMappedDatasetRejected(contents, indicesOffset, uint32_t{ 5 }));
+
+    // the rows are checked when they are read, so the examples before a corrupt row can be read
+    testing::ProcessTest("MappedDataset checks the rows when they are read", !IsCorruptMappedDatasetRejected(contents, indicesOffset + 4 * sizeof(uint32_t), uint32_t{ 13 }, 2));
+}
+
+void MappedDatasetTests()
+{
+    MappedDatasetTest(data::MappedDatasetValueType::floatValues, "float");
+    MappedDatasetTest(data::MappedDatasetValueType::doubleValues, "double");
+    MappedDatasetValidationTest();
+}
+
+template <typename ArenaDatasetType>
+void ArenaDatasetTest(std::string typeName)
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2.5, 0, 0, -3 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 0, 0, 0 }, data::WeightLabel{ 2, -1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ data::IndexValue{ 3, 0.5 }, data::IndexValue{ 12, 4 } }, data::WeightLabel{ 0.5, 1 }));
+
+    ArenaDatasetType arenaDataset(dataset.GetExampleIterator());
+    bool isSame = arenaDataset.NumExamples() == dataset.NumExamples() && arenaDataset.NumFeatures() == dataset.NumFeatures() && arenaDataset.NumNonZeros() == 5;
+
+    // spans, through the data vector operations
+    auto iterator = arenaDataset.GetExampleReferenceIterator();
+    math::ColumnVector<double> w{ 1, 2, 3, 4, 5, 6, 7 };
+    for (size_t i = 0; iterator.IsValid(); ++i, iterator.Next())
+    {
+        auto example = iterator.Get();
+        const data::IDataVector& dataVector = example.GetDataVector();
+        isSame = isSame && testing::IsEqual(dataVector.ToArray(), dataset[i].GetDataVector().ToArray());
+        isSame = isSame && example.GetMetadata().weight == dataset[i].GetMetadata().weight && example.GetMetadata().label == dataset[i].GetMetadata().label;
+        isSame = isSame && testing::IsEqual(w * dataVector, w * dataset[i].GetDataVector());
+
+        math::RowVector<double> v1(7), v2(7);
+        v1 += dataVector;
+        v2 += dataset[i].GetDataVector();
+        isSame = isSame && v1 == v2;
+    }
+    testing::ProcessTest("ArenaDataset::GetExampleReferenceIterator(" + typeName + ")", isSame);
+
+    // copies through AnyDataset
+    data::Dataset<data::DenseSupervisedExample> copiedDataset(arenaDataset.GetAnyDataset(1, 2));
+    std::stringstream ss1, ss2;
+    dataset.Print(ss1, 0, 1, 2);
+    copiedDataset.Print(ss2);
+    testing::ProcessTest("ArenaDataset::GetAnyDataset(" + typeName + ")", copiedDataset.NumExamples() == 2 && ss1.str() == ss2.str());
+
+    // spans are read-only
+    bool threw = false;
+    try
+    {
+        auto dataVector = arenaDataset[0].GetDataVector();
+        dataVector.AppendElement(100, 1.0);
+    }
+    catch (const utilities::LogicException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("ArenaDataset span AppendElement(" + typeName + ")", threw);
+}
+
+// an index value iterator over a list of entries, which need not be in increasing index order
+class IndexValueListIterator : public data::IIndexValueIterator
+{
+public:
+    IndexValueListIterator(std::vector<data::IndexValue> entries) : _entries(std::move(entries)) {}
+
+    bool IsValid() const { return _current < _entries.size(); }
+
+    void Next() { ++_current; }
+
+    data::IndexValue Get() const { return _entries[_current]; }
+
+private:
+    std::vector<data::IndexValue> _entries;
+    size_t _current = 0;
+};
+
+// adds an example and returns the message of the exception that it throws, or an empty string
+template <typename ArenaDatasetType>
+std::string GetAddExampleErrorMessage(ArenaDatasetType& arenaDataset, std::vector<data::IndexValue> entries)
+{
+    try
+    {
+        arenaDataset.AddExample(IndexValueListIterator(std::move(entries)), data::WeightLabel{ 1, 1 });
+    }
+    catch (const utilities::InputException& exception)
+    {
+        return exception.GetMessage();
+    }
+    return "";
+}
+
+template <typename ArenaDatasetType>
+void ArenaDatasetIndexOrderTest(std::string typeName)
+{
+    ArenaDatasetType arenaDataset;
+    auto message = GetAddExampleErrorMessage(arenaDataset, { { 3, 1 }, { 1, 2 } });
+    testing::ProcessTest("ArenaDataset rejects out of order indices in the first example(" + typeName + ")", message == "indices must be increasing, but index 1 follows 3" && arenaDataset.NumExamples() == 0);
+
+    message = GetAddExampleErrorMessage(arenaDataset, { { 0, 1 }, { 5, 2 } });
+    testing::ProcessTest("ArenaDataset accepts increasing indices(" + typeName + ")", message == "" && arenaDataset.NumExamples() == 1);
+
+    message = GetAddExampleErrorMessage(arenaDataset, { { 4, 1 }, { 2, 2 } });
+    testing::ProcessTest("ArenaDataset rejects out of order indices in a later example(" + typeName + ")", message == "indices must be increasing, but index 2 follows 4" && arenaDataset.NumExamples() == 1 && arenaDataset[0].GetDataVector().ToArray() == std::vector<double>{ 1, 0, 0, 0, 0, 2 });
+}
+
+void ArenaDatasetTests()
+{
+    ArenaDatasetTest<data::DoubleArenaDataset>("double");
+    ArenaDatasetTest<data::FloatArenaDataset>("float");
+    ArenaDatasetIndexOrderTest<data::DoubleArenaDataset>("double");
+    ArenaDatasetIndexOrderTest<data::FloatArenaDataset>("float");
+}
+
+void DatasetConstIteratorTest()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ 1, 0, 2.5, 0, 0, -3 }, data::WeightLabel{ 1, 1 }));
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector{ data::IndexValue{ 3, 0.5 }, data::IndexValue{ 12, 4 } }, data::WeightLabel{ 0.5, 1 }));
+
+    // same type: references to the stored examples
+    bool isReference = true;
+    auto iterator = dataset.GetAnyDataset().GetExampleConstIterator<data::AutoSupervisedExample>();
+    for (size_t i = 0; iterator.IsValid(); ++i, iterator.Next())
+    {
+        const auto& example = iterator.Get();
+        isReference = isReference && &example == &dataset[i] && example.GetDataVectorReferenceCount() == 1;
+    }
+    testing::ProcessTest("Dataset::GetExampleConstIterator (same type)", isReference);
+
+    // different type: converted copies
+    bool isSame = true;
+    auto convertingIterator = dataset.GetExampleConstIterator<data::DenseSupervisedExample>();
+    for (size_t i = 0; convertingIterator.IsValid(); ++i, convertingIterator.Next())
+    {
+        const auto& example = convertingIterator.Get();
+        isSame = isSame && testing::IsEqual(example.GetDataVector().ToArray(), dataset[i].GetDataVector().ToArray());
+        isSame = isSame && example.GetMetadata().weight == dataset[i].GetMetadata().weight;
+    }
+    testing::ProcessTest("Dataset::GetExampleConstIterator (converted type)", isSame);
+
+    // arena datasets always convert
+    data::DoubleArenaDataset arenaDataset(dataset.GetExampleIterator());
+    isSame = true;
+    auto arenaIterator = arenaDataset.GetAnyDataset().GetExampleConstIterator<data::AutoSupervisedExample>();
+    for (size_t i = 0; arenaIterator.IsValid(); ++i, arenaIterator.Next())
+    {
+        isSame = isSame && testing::IsEqual(arenaIterator.Get().GetDataVector().ToArray(), dataset[i].GetDataVector().ToArray());
+    }
+    testing::ProcessTest("ArenaDataset::GetExampleConstIterator", isSame);
+}
+
+void DatasetIndexViewTest()
+{
+    data::AutoSupervisedDataset dataset;
+    for (int i = 0; i < 20; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(std::make_shared<data::AutoDataVector>(std::vector<double>{ static_cast<double>((i * 7) % 20), 1.0 }), data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    // the view starts in the order of the dataset
+    data::DatasetIndexView<data::AutoSupervisedExample> view(dataset);
+    bool isIdentity = view.NumExamples() == 20;
+    for (size_t i = 0; i < view.NumExamples(); ++i)
+    {
+        isIdentity &= view.GetIndex(i) == i && &view[i] == &dataset[i];
+    }
+    testing::ProcessTest("DatasetIndexView ctor", isIdentity);
+
+    // sorting the view sorts the indices and leaves the dataset unchanged
+    auto getKey = [](const data::AutoSupervisedExample& example) { return example.GetDataVector().ToArray()[0]; };
+    view.Sort(getKey, 5, 10);
+    bool isSorted = true;
+    for (size_t i = 5; i < 14; ++i)
+    {
+        isSorted &= getKey(view[i]) <= getKey(view[i + 1]);
+    }
+    bool isDatasetUnchanged = true;
+    for (size_t i = 0; i < dataset.NumExamples(); ++i)
+    {
+        isDatasetUnchanged &= dataset[i].GetMetadata().label == static_cast<double>(i);
+    }
+    testing::ProcessTest("DatasetIndexView::Sort", isSorted && isDatasetUnchanged && view.GetIndex(0) == 0 && view.GetIndex(19) == 19);
+
+    // partitioning
+    view.Partition([](const data::AutoSupervisedExample& example) { return example.GetMetadata().label < 10; });
+    bool isPartitioned = true;
+    for (size_t i = 0; i < view.NumExamples(); ++i)
+    {
+        isPartitioned &= (view[i].GetMetadata().label < 10) == (i < 10);
+    }
+    testing::ProcessTest("DatasetIndexView::Partition", isPartitioned);
+
+    // random permutations keep each example exactly once
+    std::default_random_engine rng(1234);
+    view.RandomPermute(rng, 2, 15, 5);
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < view.NumExamples(); ++i)
+    {
+        indices.push_back(view.GetIndex(i));
+    }
+    std::sort(indices.begin(), indices.end());
+    bool isPermutation = true;
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        isPermutation &= indices[i] == i;
+    }
+    testing::ProcessTest("DatasetIndexView::RandomPermute", isPermutation);
+
+    // bootstrap samples refer to the same dataset
+    auto sample = view.GetBootstrapSample(rng, 50);
+    bool isSampleValid = sample.NumExamples() == 50;
+    for (size_t i = 0; i < sample.NumExamples(); ++i)
+    {
+        isSampleValid &= sample.GetIndex(i) < dataset.NumExamples() && &sample[i] == &dataset[sample.GetIndex(i)];
+    }
+    testing::ProcessTest("DatasetIndexView::GetBootstrapSample", isSampleValid);
+
+    // the reference iterator visits the examples in the order of the view
+    auto iterator = view.GetExampleReferenceIterator(3, 4);
+    size_t position = 3;
+    bool isIteratorValid = true;
+    while (iterator.IsValid())
+    {
+        isIteratorValid &= &iterator.Get() == &view[position++];
+        iterator.Next();
+    }
+    testing::ProcessTest("DatasetIndexView::GetExampleReferenceIterator", isIteratorValid && position == 7);
+}
+
+void SharedDatasetTest()
+{
+    data::AutoSupervisedDataset dataset;
+    for (int i = 0; i < 10; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector(std::vector<double>{ 1.0, static_cast<double>(i) }), data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    // a dataset of the requested example type is referenced, not copied
+    data::SharedDataset<data::AutoSupervisedExample> shared(dataset.GetAnyDataset(2, 5));
+    bool isReference = !shared.OwnsExamples() && shared.NumExamples() == 5;
+    for (size_t i = 0; i < shared.NumExamples(); ++i)
+    {
+        isReference &= &shared[i] == &dataset[i + 2];
+    }
+    testing::ProcessTest("SharedDataset reference", isReference);
+
+    // zero size means all the way to the end
+    data::SharedDataset<data::AutoSupervisedExample> tail(dataset.GetAnyDataset(4));
+    testing::ProcessTest("SharedDataset tail", tail.NumExamples() == 6 && &tail[0] == &dataset[4]);
+
+    // the AnyDataset of a SharedDataset refers to the same examples
+    data::SharedDataset<data::AutoSupervisedExample> other(shared.GetAnyDataset());
+    testing::ProcessTest("SharedDataset::GetAnyDataset", !other.OwnsExamples() && other.NumExamples() == 5 && &other[0] == &shared[0]);
+
+    // other example types are converted once, and the copies of the SharedDataset share the conversion
+    data::SharedDataset<data::DenseSupervisedExample> converted(dataset.GetAnyDataset(2, 5));
+    auto copy = converted;
+    bool isConverted = converted.OwnsExamples() && converted.NumExamples() == 5 && &copy[0] == &converted[0];
+    auto iterator = converted.GetExampleReferenceIterator();
+    size_t index = 2;
+    while (iterator.IsValid())
+    {
+        isConverted &= iterator.Get().GetMetadata().label == static_cast<double>(index) && iterator.Get().GetDataVector()[1] == static_cast<double>(index);
+        ++index;
+        iterator.Next();
+    }
+    testing::ProcessTest("SharedDataset conversion", isConverted && index == 7);
+}
+
+void ShufflingExampleIteratorTest()
+{
+    data::AutoSupervisedDataset dataset;
+    for (int i = 0; i < 100; ++i)
+    {
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector(std::vector<double>{ static_cast<double>(i) }), data::WeightLabel{ 1, static_cast<double>(i) }));
+    }
+
+    auto getLabels = [&dataset](size_t bufferSize) {
+        std::vector<double> labels;
+        auto iterator = data::MakeShufflingExampleIterator(dataset.GetExampleIterator(), bufferSize, std::default_random_engine(1234));
+        while (iterator.IsValid())
+        {
+            labels.push_back(iterator.Get().GetMetadata().label);
+            iterator.Next();
+        }
+        return labels;
+    };
+
+    // each example is visited exactly once, in a different order
+    auto labels = getLabels(10);
+    auto sortedLabels = labels;
+    std::sort(sortedLabels.begin(), sortedLabels.end());
+    bool isPermutation = sortedLabels.size() == 100;
+    for (size_t i = 0; i < sortedLabels.size(); ++i)
+    {
+        isPermutation &= sortedLabels[i] == static_cast<double>(i);
+    }
+    testing::ProcessTest("ShufflingExampleIterator", isPermutation && labels != sortedLabels);
+
+    // a buffer of size one preserves the order, and a buffer larger than the stream is fine
+    testing::ProcessTest("ShufflingExampleIterator buffer size", getLabels(1) == sortedLabels && getLabels(1000).size() == 100);
+}
+}
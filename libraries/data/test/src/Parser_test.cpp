@@ -16,11 +16,19 @@
 #include "WeightLabel.h"
 #include "AutoDataVector.h"
 #include "Dataset.h"
+#include "HashingIndexValueIterator.h"
+#include "ParallelDatasetLoader.h"
+#include "PrefetchingExampleIterator.h"
 
 // testing
 #include "testing.h"
 
+// utilities
+#include "Files.h"
+
 // stl
+#include <cmath>
+#include <cstdio>
 #include <string>
 #include <sstream>
 #include <memory>
@@ -115,6 +123,29 @@ namespace ell
         auto dataVector2 = parser.Parse(line2);
         testing::ProcessTest("AutoDataVectorParser test", testing::IsEqual(dataVector2.ToArray(), { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5 })
             && dataVector2.GetInternalType() == data::IDataVector::Type::SparseByteDataVector);
+
+        auto hashingParser = data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>(0.0, 4);
+        data::TextLine line3("0:1 123456789012:5");
+        auto dataVector3 = hashingParser.Parse(line3);
+        auto array3 = dataVector3.ToArray(16);
+        double sum3 = 0;
+        for (auto value : array3)
+        {
+            sum3 += std::abs(value);
+        }
+        testing::ProcessTest("AutoDataVectorParser hashing test", dataVector3.PrefixLength() <= 16 && (sum3 == 6 || sum3 == 4));
+
+        auto unsignedHashingParser = data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>(0.0, 4, false, 17);
+        data::TextLine line4("0:1 123456789012:5");
+        auto dataVector4 = unsignedHashingParser.Parse(line4);
+        auto array4 = dataVector4.ToArray(16);
+        double sum4 = 0;
+        for (auto value : array4)
+        {
+            sum4 += value;
+        }
+        auto expected4 = data::HashDataVector<data::SparseDoubleDataVector>(data::SparseDoubleDataVector{ { 0, 1.0 }, { 123456789012, 5.0 } }, data::FeatureHasher(4, false, 17));
+        testing::ProcessTest("AutoDataVectorParser unsigned hashing test", sum4 == 6 && testing::IsEqual(array4, expected4.ToArray(16)));
     }
 
     void SingleFileParseTest()
@@ -147,4 +178,74 @@ namespace ell
         testing::ProcessTest("SingleFileParse test2", dataset[1].GetMetadata().label == -1 && testing::IsEqual(dataset[1].GetDataVector().ToArray(), { 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3 }));
         testing::ProcessTest("SingleFileParse test3", dataset[2].GetMetadata().label == 1 && testing::IsEqual(dataset[2].GetDataVector().ToArray(), { 2.7, 0, 0, 0, -0.3, 0, 0, 0, 0, 0, 3.14 }));
     }
-}
\ No newline at end of file
+
+    void ParallelFileParseTest()
+    {
+        // write a file with enough lines to be split into several chunks, including comments and empty lines
+        auto filepath = testing::GetTempFilePath("ParallelFileParseTest.txt");
+        {
+            auto stream = utilities::OpenOfstream(filepath);
+            stream << "// header comment\n";
+            for (int i = 0; i < 100; ++i)
+            {
+                stream << (i % 2 == 0 ? "1.0" : "-1.0") << "\t" << i << ":" << i + 1 << " " << i + 2 << ":0.5\n";
+                if (i % 7 == 0)
+                {
+                    stream << "\n    # comment\n";
+                }
+            }
+            stream << "1.0 5:5"; // last line without a newline
+        }
+
+        auto stream = utilities::OpenIfstream(filepath);
+        auto sequentialDataset = data::MakeDataset(data::MakeSingleLineParsingExampleIterator(data::SequentialLineIterator(stream), data::LabelParser(), data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>()));
+
+        for (size_t numThreads : { 1, 3, 8 })
+        {
+            auto parallelDataset = data::MakeDatasetInParallel(filepath, data::LabelParser(), data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>(), numThreads);
+
+            bool isEqual = parallelDataset.NumExamples() == sequentialDataset.NumExamples() && parallelDataset.NumFeatures() == sequentialDataset.NumFeatures();
+            for (size_t i = 0; isEqual && i < sequentialDataset.NumExamples(); ++i)
+            {
+                isEqual = parallelDataset[i].GetMetadata().label == sequentialDataset[i].GetMetadata().label && testing::IsEqual(parallelDataset[i].GetDataVector().ToArray(), sequentialDataset[i].GetDataVector().ToArray());
+            }
+            testing::ProcessTest("ParallelFileParse test with " + std::to_string(numThreads) + " threads", sequentialDataset.NumExamples() == 101 && isEqual);
+        }
+
+        stream.close();
+        std::remove(filepath.c_str());
+    }
+
+    void PrefetchingParseTest()
+    {
+        std::stringstream text;
+        for (int i = 0; i < 50; ++i)
+        {
+            text << (i % 2 == 0 ? "1.0" : "-1.0") << "\t" << i << ":" << i + 1 << "\n";
+        }
+
+        std::stringstream stream1(text.str()), stream2(text.str());
+        auto sequentialDataset = data::MakeDataset(data::MakeSingleLineParsingExampleIterator(data::SequentialLineIterator(stream1), data::LabelParser(), data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>()));
+
+        // a small buffer, so that the background thread has to wait for the consumer
+        auto exampleIterator = data::MakePrefetchingExampleIterator(data::MakeSingleLineParsingExampleIterator(data::SequentialLineIterator(stream2), data::LabelParser(), data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>()), 3);
+        size_t count = 0;
+        bool isEqual = true;
+        while (exampleIterator.IsValid())
+        {
+            auto example = exampleIterator.Get();
+            isEqual = isEqual && count < sequentialDataset.NumExamples() && example.GetMetadata().label == sequentialDataset[count].GetMetadata().label && testing::IsEqual(example.GetDataVector().ToArray(), sequentialDataset[count].GetDataVector().ToArray());
+            exampleIterator.Next();
+            ++count;
+        }
+        testing::ProcessTest("PrefetchingExampleIterator parse test", isEqual && count == 50);
+
+        // destroying an iterator that was not read to the end stops the background thread
+        std::stringstream stream3(text.str());
+        {
+            auto partialIterator = data::MakePrefetchingExampleIterator(data::MakeSingleLineParsingExampleIterator(data::SequentialLineIterator(stream3), data::LabelParser(), data::AutoDataVectorParser<data::GeneralizedSparseParsingIterator>()), 2);
+            partialIterator.Next();
+        }
+        testing::ProcessTest("PrefetchingExampleIterator early destruction", true);
+    }
+}
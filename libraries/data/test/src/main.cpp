@@ -23,13 +23,24 @@ int main()
     IDataVectorTests();
     DataVectorCopyAsTests();
     AutoDataVectorTest();
+    DenseBinaryDataVectorTest();
+    ReducedPrecisionDataVectorTests();
     TransformedDataVectorTest();
+    FeatureHashingTest();
     IteratorTests();
     ExampleCopyAsTests();
     DatasetCastingTests();
+    MappedDatasetTests();
+    ArenaDatasetTests();
+    DatasetConstIteratorTest();
+    DatasetIndexViewTest();
+    SharedDatasetTest();
+    ShufflingExampleIteratorTest();
     DataVectorParseTest();
     AutoDataVectorParseTest();
     SingleFileParseTest();
+    ParallelFileParseTest();
+    PrefetchingParseTest();
 
     if (testing::DidTestFail())
     {
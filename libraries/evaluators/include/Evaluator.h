@@ -10,6 +10,7 @@
 
 // data
 #include "Dataset.h"
+#include "SharedDataset.h"
 #include "Example.h"
 
 // stl
@@ -66,7 +67,7 @@ namespace evaluators
         /// Constructs an instance of Evaluator with a given data set and given aggregators.
         /// </summary>
         ///
-        /// <param name="anyDataset"> A dataset. </param>
+        /// <param name="anyDataset"> A dataset, which must outlive the evaluator. </param>
         /// <param name="evaluatorParameters"> The evaluation parameters. </param>
         /// <param name="aggregators"> The aggregators. </param>
         Evaluator(const data::AnyDataset& anyDataset, const EvaluatorParameters& evaluatorParameters, AggregatorTypes... aggregators);
@@ -153,7 +154,7 @@ namespace evaluators
         using ExampleType = data::Example<typename PredictorType::DataVectorType, data::WeightLabel>;
 
         // member variables
-        data::Dataset<ExampleType> _dataset;
+        data::SharedDataset<ExampleType> _dataset;
         EvaluatorParameters _evaluatorParameters;
         size_t _evaluateCounter = 0;
         typename std::tuple<AggregatorTypes...> _aggregatorTuple;
@@ -109,7 +109,7 @@ namespace evaluators
     template <typename PredictorType, typename... AggregatorTypes>
     void Evaluator<PredictorType, AggregatorTypes...>::EvaluateZero()
     {
-        auto iterator = _dataset.GetExampleIterator();
+        auto iterator = _dataset.GetExampleReferenceIterator();
 
         while (iterator.IsValid())
         {
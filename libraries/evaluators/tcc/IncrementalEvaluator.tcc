@@ -23,7 +23,7 @@ namespace evaluators
         ++BaseClassType::_evaluateCounter;
         bool evaluate = BaseClassType::_evaluateCounter % BaseClassType::_evaluatorParameters.evaluationFrequency == 0 ? true : false;
 
-        auto iterator = BaseClassType::_dataset.GetExampleIterator();
+        auto iterator = BaseClassType::_dataset.GetExampleReferenceIterator();
         size_t index = 0;
 
         while (iterator.IsValid())
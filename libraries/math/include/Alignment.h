@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Alignment.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> The alignment, in bytes, of the memory owned by vectors, matrices and tensors. This is the
+    /// size of a cache line, which is also the size of the widest SIMD registers (AVX-512). </summary>
+    constexpr size_t defaultAlignment = 64;
+
+    /// <summary> A standard allocator that aligns the memory it allocates. </summary>
+    ///
+    /// <typeparam name="ElementType"> The type of the allocated elements. </typeparam>
+    /// <typeparam name="alignment"> The alignment in bytes, which must be a power of two. </typeparam>
+    template <typename ElementType, size_t alignment = defaultAlignment>
+    class AlignedAllocator
+    {
+    public:
+        static_assert(alignment != 0 && (alignment & (alignment - 1)) == 0, "alignment must be a power of two");
+        static_assert(alignment >= alignof(void*), "alignment must be at least the alignment of a pointer");
+
+        using value_type = ElementType;
+
+        template <typename OtherType>
+        struct rebind
+        {
+            using other = AlignedAllocator<OtherType, alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename OtherType>
+        AlignedAllocator(const AlignedAllocator<OtherType, alignment>&)
+        {
+        }
+
+        /// <summary> Allocates aligned memory. </summary>
+        ///
+        /// <param name="size"> The number of elements. </param>
+        ///
+        /// <returns> A pointer to the memory, whose address is a multiple of the alignment. </returns>
+        ElementType* allocate(size_t size);
+
+        /// <summary> Frees memory allocated by allocate. </summary>
+        ///
+        /// <param name="pointer"> The pointer returned by allocate. </param>
+        /// <param name="size"> The number of elements. </param>
+        void deallocate(ElementType* pointer, size_t size);
+    };
+
+    template <typename ElementType1, typename ElementType2, size_t alignment>
+    bool operator==(const AlignedAllocator<ElementType1, alignment>&, const AlignedAllocator<ElementType2, alignment>&)
+    {
+        return true;
+    }
+
+    template <typename ElementType1, typename ElementType2, size_t alignment>
+    bool operator!=(const AlignedAllocator<ElementType1, alignment>&, const AlignedAllocator<ElementType2, alignment>&)
+    {
+        return false;
+    }
+
+    /// <summary> The container that holds the elements of vectors, matrices and tensors. </summary>
+    template <typename ElementType>
+    using AlignedVector = std::vector<ElementType, AlignedAllocator<ElementType>>;
+
+    /// <summary> Whether a matrix or tensor pads its leading dimension. </summary>
+    enum class Padding
+    {
+        /// <summary> The elements are stored contiguously. </summary>
+        none,
+
+        /// <summary> Each row of a row-major matrix, each column of a column-major matrix, and each leading
+        /// dimension of a tensor starts at an address that is a multiple of defaultAlignment. This avoids
+        /// rows that straddle cache lines and lets kernels use aligned loads, at the price of some unused memory. </summary>
+        aligned
+    };
+
+    /// <summary> Rounds up the size of a leading dimension, so that consecutive intervals start on aligned
+    /// addresses. </summary>
+    ///
+    /// <typeparam name="ElementType"> The element type. </typeparam>
+    /// <param name="size"> The number of elements in the leading dimension. </param>
+    /// <param name="padding"> The padding. </param>
+    ///
+    /// <returns> The increment between consecutive intervals. </returns>
+    template <typename ElementType>
+    size_t GetPaddedIncrement(size_t size, Padding padding)
+    {
+        const size_t elementsPerAlignment = defaultAlignment / sizeof(ElementType);
+        if (padding == Padding::none || elementsPerAlignment <= 1 || defaultAlignment % sizeof(ElementType) != 0)
+        {
+            return size;
+        }
+        return (size + elementsPerAlignment - 1) / elementsPerAlignment * elementsPerAlignment;
+    }
+
+    /// <summary> Checks if a pointer is aligned. </summary>
+    ///
+    /// <param name="pointer"> The pointer. </param>
+    /// <param name="alignment"> The alignment in bytes. </param>
+    ///
+    /// <returns> True if the address is a multiple of the alignment. </returns>
+    inline bool IsAligned(const void* pointer, size_t alignment = defaultAlignment)
+    {
+        return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+    }
+
+    /// <summary> Tells the compiler that a pointer is aligned to defaultAlignment, which lets it use aligned
+    /// loads and stores when it vectorizes a loop. The pointer must actually be aligned. </summary>
+    ///
+    /// <param name="pointer"> The pointer. </param>
+    ///
+    /// <returns> The same pointer. </returns>
+    template <typename ElementType>
+    ElementType* AssumeAligned(ElementType* pointer)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<ElementType*>(__builtin_assume_aligned(pointer, defaultAlignment));
+#else
+        return pointer;
+#endif
+    }
+}
+}
+
+#include "../tcc/Alignment.tcc"
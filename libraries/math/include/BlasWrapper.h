@@ -134,6 +134,12 @@ namespace math
         void Gemm(CBLAS_ORDER order, CBLAS_TRANSPOSE transposeA, CBLAS_TRANSPOSE transposeB, int m, int n, int k, float alpha, const float* A, int lda, const float* B, int ldb, float beta, float* C, int ldc);
         void Gemm(CBLAS_ORDER order, CBLAS_TRANSPOSE transposeA, CBLAS_TRANSPOSE transposeB, int m, int n, int k, double alpha, const double* A, int lda, const double* B, int ldb, double beta, double* C, int ldc);
         /// @}
+
+        /// <summary> Sets the number of threads used by BLAS functions. This has an effect only with
+        /// OpenBLAS, since other BLAS libraries have no standard way to control their threads. </summary>
+        ///
+        /// <param name="numThreads"> The number of threads. </param>
+        void SetNumThreads(int numThreads);
     }
 }
 }
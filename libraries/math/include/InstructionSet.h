@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     InstructionSet.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <string>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> The SIMD instruction sets that native kernels can be specialized for, in increasing order. </summary>
+    enum class InstructionSet
+    {
+        generic, // portable C++, no SIMD intrinsics
+        sse, // SSE2 (128 bit vectors)
+        avx2, // AVX2 and FMA (256 bit vectors)
+        avx512 // AVX-512F (512 bit vectors)
+    };
+
+    /// <summary> Checks if the processor (and the compiler used to build this library) support an instruction set. </summary>
+    ///
+    /// <param name="instructionSet"> The instruction set. </param>
+    ///
+    /// <returns> true if the instruction set is supported. </returns>
+    bool IsInstructionSetSupported(InstructionSet instructionSet);
+
+    /// <summary> Gets the most capable instruction set supported by the processor, which is detected once at runtime. </summary>
+    ///
+    /// <returns> The instruction set. </returns>
+    InstructionSet GetBestSupportedInstructionSet();
+
+    /// <summary> Gets the name of an instruction set. </summary>
+    ///
+    /// <param name="instructionSet"> The instruction set. </param>
+    ///
+    /// <returns> The name. </returns>
+    std::string GetInstructionSetName(InstructionSet instructionSet);
+}
+}
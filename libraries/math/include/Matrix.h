@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "Alignment.h"
 #include "Vector.h"
 
 // utilities
@@ -14,6 +15,7 @@
 
 // stl
 #include <cstddef>
+#include <functional>
 #include <limits>
 
 namespace ell
@@ -104,16 +106,18 @@ namespace math
         MatrixBase(size_t numRows, size_t numColumns, ElementType* pData = nullptr);
 
     protected:
+        void Swap(MatrixBase<ElementType, MatrixLayout::columnMajor>& other);
+
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
 
         static constexpr VectorOrientation _intervalOrientation = VectorOrientation::column;
 
-        const size_t _numIntervals = _numColumns;
-        const size_t _intervalSize = _numRows;
+        size_t _numIntervals = _numColumns;
+        size_t _intervalSize = _numRows;
         static constexpr size_t _rowIncrement = 1;
-        const size_t _columnIncrement = _increment;
+        size_t _columnIncrement = _increment;
     };
 
     /// <summary> Base class for row major rectangular dense matrices. </summary>
@@ -133,24 +137,50 @@ namespace math
         MatrixBase(size_t numRows, size_t numColumns, ElementType* pData = nullptr);
 
     protected:
+        void Swap(MatrixBase<ElementType, MatrixLayout::rowMajor>& other);
+
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
 
         static constexpr VectorOrientation _intervalOrientation = VectorOrientation::row;
 
-        const size_t _numIntervals = _numRows;
-        const size_t _intervalSize = _numColumns;
-        const size_t _rowIncrement = _increment;
+        size_t _numIntervals = _numRows;
+        size_t _intervalSize = _numColumns;
+        size_t _rowIncrement = _increment;
         static constexpr size_t _columnIncrement = 1;
     };
 
+    /// <summary>
+    /// Base class for lazily evaluated matrix expressions, such as `a * A + b * B`. Matrix expressions work like
+    /// vector expressions (see VectorExpression): they are evaluated in a single pass when they are assigned to a
+    /// matrix by MatrixReference::CopyFrom, operator+= or operator-=. All the matrices in an expression have the
+    /// same layout, so the evaluation walks each interval with unit stride.
+    ///
+    /// Each derived expression implements NumRows(), NumColumns() and GetIntervalElement(interval, index), which
+    /// computes the element at a given position of a given interval (row of a row-major matrix, column of a
+    /// column-major matrix).
+    /// </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="ExpressionType"> The derived expression type. </typeparam>
+    template <typename ElementType, MatrixLayout layout, typename ExpressionType>
+    class MatrixExpression
+    {
+    public:
+        /// <summary> Gets the derived expression. </summary>
+        ///
+        /// <returns> The derived expression. </returns>
+        const ExpressionType& GetExpression() const { return static_cast<const ExpressionType&>(*this); }
+    };
+
     /// <summary> Const reference to a dense matrix. </summary>
     ///
     /// <typeparam name="ElementType"> Matrix Element type. </typeparam>
     /// <typeparam name="layout"> Matrix layout. </typeparam>
     template <typename ElementType, MatrixLayout layout>
-    class ConstMatrixReference : public MatrixBase<ElementType, layout>
+    class ConstMatrixReference : public MatrixBase<ElementType, layout>, public MatrixExpression<ElementType, layout, ConstMatrixReference<ElementType, layout>>
     {
     public:
         using MatrixBase<ElementType, layout>::MatrixBase;
@@ -311,6 +341,14 @@ namespace math
 
         /// @}
 
+        /// <summary> Gets a matrix element, when the matrix is evaluated as part of a matrix expression. </summary>
+        ///
+        /// <param name="interval"> The interval (row of a row-major matrix, column of a column-major matrix). </param>
+        /// <param name="index"> The position of the element in the interval. </param>
+        ///
+        /// <returns> A copy of the element. </returns>
+        ElementType GetIntervalElement(size_t interval, size_t index) const { return _pData[interval * _increment + index]; }
+
     protected:
         friend class ConstMatrixReference<ElementType, TransposeMatrixLayout<layout>::value>;
 
@@ -348,6 +386,138 @@ namespace math
     template <typename ElementType, MatrixLayout layout>
     std::ostream& operator<<(std::ostream& stream, ConstMatrixReference<ElementType, layout> M);
 
+    /// <summary> A matrix expression that multiplies another expression by a scalar. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="OperandType"> The type of the scaled expression. </typeparam>
+    template <typename ElementType, MatrixLayout layout, typename OperandType>
+    class ScaledMatrixExpression : public MatrixExpression<ElementType, layout, ScaledMatrixExpression<ElementType, layout, OperandType>>
+    {
+    public:
+        /// <summary> Constructs an instance of ScaledMatrixExpression. </summary>
+        ///
+        /// <param name="scalar"> The scalar. </param>
+        /// <param name="operand"> The scaled expression. </param>
+        ScaledMatrixExpression(ElementType scalar, OperandType operand);
+
+        /// <summary> Gets the number of rows. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        size_t NumRows() const { return _operand.NumRows(); }
+
+        /// <summary> Gets the number of columns. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _operand.NumColumns(); }
+
+        /// <summary> Computes an element of the expression. </summary>
+        ///
+        /// <param name="interval"> The interval. </param>
+        /// <param name="index"> The position of the element in the interval. </param>
+        ///
+        /// <returns> The element. </returns>
+        ElementType GetIntervalElement(size_t interval, size_t index) const { return _scalar * _operand.GetIntervalElement(interval, index); }
+
+    private:
+        ElementType _scalar;
+        OperandType _operand;
+    };
+
+    /// <summary> A matrix expression that combines the elements of two other expressions with a binary
+    /// operation, such as addition. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <typeparam name="OperationType"> The binary operation type. </typeparam>
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType, typename OperationType>
+    class BinaryMatrixExpression : public MatrixExpression<ElementType, layout, BinaryMatrixExpression<ElementType, layout, LeftType, RightType, OperationType>>
+    {
+    public:
+        /// <summary> Constructs an instance of BinaryMatrixExpression. </summary>
+        ///
+        /// <param name="left"> The left expression. </param>
+        /// <param name="right"> The right expression, which has the same size as the left expression. </param>
+        /// <param name="operation"> The binary operation. </param>
+        BinaryMatrixExpression(LeftType left, RightType right, OperationType operation);
+
+        /// <summary> Gets the number of rows. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        size_t NumRows() const { return _left.NumRows(); }
+
+        /// <summary> Gets the number of columns. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _left.NumColumns(); }
+
+        /// <summary> Computes an element of the expression. </summary>
+        ///
+        /// <param name="interval"> The interval. </param>
+        /// <param name="index"> The position of the element in the interval. </param>
+        ///
+        /// <returns> The element. </returns>
+        ElementType GetIntervalElement(size_t interval, size_t index) const { return _operation(_left.GetIntervalElement(interval, index), _right.GetIntervalElement(interval, index)); }
+
+    private:
+        LeftType _left;
+        RightType _right;
+        OperationType _operation;
+    };
+
+    /// <summary> Multiplication operator for scalar and matrix expression. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+    /// <param name="scalar"> The scalar. </param>
+    /// <param name="expression"> The matrix expression. </param>
+    ///
+    /// <returns> A lazily evaluated ScaledMatrixExpression. </returns>
+    template <typename ElementType, MatrixLayout layout, typename ExpressionType>
+    ScaledMatrixExpression<ElementType, layout, ExpressionType> operator*(double scalar, const MatrixExpression<ElementType, layout, ExpressionType>& expression);
+
+    /// <summary> Addition operator for matrix expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryMatrixExpression. </returns>
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::plus<ElementType>> operator+(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right);
+
+    /// <summary> Subtraction operator for matrix expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryMatrixExpression. </returns>
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::minus<ElementType>> operator-(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right);
+
+    /// <summary> Element-wise product of matrix expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryMatrixExpression. </returns>
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::multiplies<ElementType>> ElementWiseProduct(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right);
+
     /// <summary> Non-const reference to a dense matrix. </summary>
     ///
     /// <typeparam name="ElementType"> Matrix Element type. </typeparam>
@@ -406,6 +576,13 @@ namespace math
         /// <param name="other"> The other matrix. </param>
         void CopyFrom(ConstMatrixReference<ElementType, TransposeMatrixLayout<layout>::value> other);
 
+        /// <summary> Evaluates a matrix expression into this matrix, in a single pass. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The matrix expression. </param>
+        template <typename ExpressionType>
+        void CopyFrom(const MatrixExpression<ElementType, layout, ExpressionType>& expression);
+
         /// <summary> Sets all matrix elements to zero. </summary>
         void Reset() { Fill(0); }
 
@@ -516,6 +693,20 @@ namespace math
         /// <param name="other"> The constant value. </param>
         void operator/=(ElementType value);
 
+        /// <summary> Adds a matrix expression to this matrix, in a single pass. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The matrix expression. </param>
+        template <typename ExpressionType>
+        void operator+=(const MatrixExpression<ElementType, layout, ExpressionType>& expression);
+
+        /// <summary> Subtracts a matrix expression from this matrix, in a single pass. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The matrix expression. </param>
+        template <typename ExpressionType>
+        void operator-=(const MatrixExpression<ElementType, layout, ExpressionType>& expression);
+
         /// @}
 
     protected:
@@ -532,6 +723,11 @@ namespace math
         using MatrixBase<ElementType, layout>::_columnIncrement;
 
         using ConstMatrixReference<ElementType, layout>::GetMajorVectorBegin;
+
+    private:
+        // evaluates an expression, calling assignment(thisElement, expressionElement) for each element
+        template <typename ExpressionType, typename AssignmentType>
+        void EvaluateExpression(const ExpressionType& expression, AssignmentType assignment);
     };
 
     /// <summary> A dense matrix. </summary>
@@ -579,26 +775,36 @@ namespace math
         /// <param name="numColumns"> Number of columns in the matrix. </param>
         Matrix(size_t numRows, size_t numColumns);
 
+        /// <summary> Constructs an all-zeros matrix of a given size, with optional padding. A padded matrix
+        /// is not contiguous, so it cannot be referenced as a vector. </summary>
+        ///
+        /// <param name="numRows"> Number of rows in the matrix. </param>
+        /// <param name="numColumns"> Number of columns in the matrix. </param>
+        /// <param name="padding"> Whether each row of a row-major matrix (or column of a column-major
+        /// matrix) is padded to start on an aligned address. </param>
+        Matrix(size_t numRows, size_t numColumns, Padding padding);
+
         /// <summary> Constructs a matrix from an initialization list. </summary>
         ///
         /// <param name="list"> A list of initialization lists (row by row). </param>
         Matrix(std::initializer_list<std::initializer_list<ElementType>> list);
 
         /// <summary> Constructs a matrix from an vector. The vector has
-        /// (numRows * numColumns) number of elements. </summary>
+        /// (numRows * numColumns) number of elements. The elements are copied into aligned storage,
+        /// so pass an AlignedVector to avoid the copy. </summary>
         ///
         /// <param name="numRows"> Number of rows in the matrix. </param>
         /// <param name="numColumns"> Number of columns in the matrix. </param>
-        /// <param name="list"> A list of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
+        /// <param name="data"> A vector of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
         Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType>& data);
 
-        /// <summary> Constructs a matrix from an vector. The vector has
+        /// <summary> Constructs a matrix by moving an aligned vector. The vector has
         /// (numRows * numColumns) number of elements. </summary>
         ///
         /// <param name="numRows"> Number of rows in the matrix. </param>
         /// <param name="numColumns"> Number of columns in the matrix. </param>
-        /// <param name="list"> A list of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
-        Matrix(size_t numRows, size_t numColumns, std::vector<ElementType>&& data);
+        /// <param name="data"> A vector of elements. These elements are expected to be in the layout order of this matrix's layout type. </param>
+        Matrix(size_t numRows, size_t numColumns, AlignedVector<ElementType>&& data);
 
         /// <summary> Move Constructor. </summary>
         ///
@@ -627,8 +833,6 @@ namespace math
         /// <returns> A reference to this matrix. </returns>
         Matrix<ElementType, layout>& operator=(Matrix<ElementType, layout> other);
 
-        Matrix<ElementType, layout>& operator=(Matrix<ElementType, layout>&& other) = default;
-
         /// <summary> Swaps the contents of this matrix with the contents of another matrix. </summary>
         ///
         /// <param name="other"> [in,out] The other matrix. </param>
@@ -637,14 +841,14 @@ namespace math
         /// <summary> Returns a copy of the contents of the Matrix. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Matrix. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return ConstMatrixReference<ElementType, layout>::ToArray(); }
 
     private:
         using RectangularMatrixBase<ElementType>::_pData;
         using RectangularMatrixBase<ElementType>::_numRows;
         using RectangularMatrixBase<ElementType>::_numColumns;
         using RectangularMatrixBase<ElementType>::_increment;
-        std::vector<ElementType> _data;
+        AlignedVector<ElementType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Matrix instances. </summary>
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     NativeGemm.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "InstructionSet.h"
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> A native matrix-matrix multiplication (GEMM), used when ELL is built without BLAS. It
+    /// follows the Goto/BLIS design: the operands are split into blocks that fit in the caches, each block is
+    /// packed into a contiguous buffer, and the product of the packed blocks is computed by a register-tiled
+    /// microkernel. Microkernels are written for several instruction sets, and the best one supported by the
+    /// processor is chosen at runtime. </summary>
+    namespace NativeGemm
+    {
+        /// <summary> Gets the instruction set used by the microkernels. </summary>
+        ///
+        /// <returns> The instruction set. </returns>
+        InstructionSet GetInstructionSet();
+
+        /// <summary> Sets the instruction set used by the microkernels, which is GetBestSupportedInstructionSet()
+        /// by default. This is mainly intended for testing and benchmarking. </summary>
+        ///
+        /// <param name="instructionSet"> The instruction set, which must be supported by the processor. </param>
+        void SetInstructionSet(InstructionSet instructionSet);
+
+        /// @{
+        /// <summary> Computes C = alpha * A * B + beta * C, where A is m x k, B is k x n and C is m x n. Each
+        /// matrix is given by a pointer to its first element and by the distances between consecutive elements
+        /// in a row and in a column, so any row-major, column-major or transposed layout can be used. As in
+        /// BLAS, C is not read when beta is zero. </summary>
+        ///
+        /// <param name="m"> The number of rows in A and C. </param>
+        /// <param name="n"> The number of columns in B and C. </param>
+        /// <param name="k"> The number of columns in A and rows in B. </param>
+        /// <param name="alpha"> The scalar that multiplies A * B. </param>
+        /// <param name="A"> Pointer to the first element of A. </param>
+        /// <param name="rowIncrementA"> The distance between A(i, j) and A(i + 1, j). </param>
+        /// <param name="columnIncrementA"> The distance between A(i, j) and A(i, j + 1). </param>
+        /// <param name="B"> Pointer to the first element of B. </param>
+        /// <param name="rowIncrementB"> The distance between B(i, j) and B(i + 1, j). </param>
+        /// <param name="columnIncrementB"> The distance between B(i, j) and B(i, j + 1). </param>
+        /// <param name="beta"> The scalar that multiplies C. </param>
+        /// <param name="C"> Pointer to the first element of C. </param>
+        /// <param name="rowIncrementC"> The distance between C(i, j) and C(i + 1, j). </param>
+        /// <param name="columnIncrementC"> The distance between C(i, j) and C(i, j + 1). </param>
+        void Gemm(size_t m, size_t n, size_t k, float alpha, const float* A, size_t rowIncrementA, size_t columnIncrementA, const float* B, size_t rowIncrementB, size_t columnIncrementB, float beta, float* C, size_t rowIncrementC, size_t columnIncrementC);
+        void Gemm(size_t m, size_t n, size_t k, double alpha, const double* A, size_t rowIncrementA, size_t columnIncrementA, const double* B, size_t rowIncrementB, size_t columnIncrementB, double beta, double* C, size_t rowIncrementC, size_t columnIncrementC);
+        /// @}
+    }
+}
+}
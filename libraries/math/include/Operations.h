@@ -8,6 +8,9 @@
 #pragma once
 
 #include "Matrix.h"
+#include "NativeGemm.h"
+#include "SimdKernels.h"
+#include "SparseMatrix.h"
 #include "Vector.h"
 #ifdef USE_BLAS
 #include "BlasWrapper.h"
@@ -39,6 +42,36 @@ namespace math
         /// <param name="M"> [in,out] The row major matrix to which the scalar is added. </param>
         template <typename ElementType, MatrixLayout layout>
         static void Add(ElementType s, MatrixReference<ElementType, layout> M);
+
+        /// <summary> Sparse matrix column-vector multiplication, u = s * A * v + t * u. The time is proportional
+        /// to the number of non-zeros of A. A row-major (CSR) matrix is split between threads by rows, while a
+        /// column-major (CSC) matrix scatters its columns into u on the calling thread. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="layout"> Sparse matrix layout. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="A"> The sparse matrix. </param>
+        /// <param name="v"> The column vector that multiplies the matrix on the right. </param>
+        /// <param name="t"> The scalar that multiplies u. </param>
+        /// <param name="u"> [in,out] A column vector, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void Multiply(ElementType s, const SparseMatrix<ElementType, layout>& A, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
+
+        /// <summary> Sparse matrix dense matrix multiplication, C = s * A * B + t * C. The time is proportional
+        /// to the number of non-zeros of A times the number of columns of B. A row-major (CSR) matrix is split
+        /// between threads by the rows of C, and a column-major (CSC) matrix by the columns of C. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layoutA"> Sparse matrix layout. </typeparam>
+        /// <typeparam name="layoutB"> Matrix layout of the dense matrix. </typeparam>
+        /// <typeparam name="layoutC"> Matrix layout of the result. </typeparam>
+        /// <param name="s"> The scalar that multiplies the product. </param>
+        /// <param name="A"> The sparse matrix. </param>
+        /// <param name="B"> The dense matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+        static void Multiply(ElementType s, const SparseMatrix<ElementType, layoutA>& A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutC> C);
     };
 
     /// <summary>
@@ -129,7 +162,8 @@ namespace math
     enum class ImplementationType
     {
         native,
-        openBlas
+        openBlas,
+        simd
     };
 
     /// <summary> Forward declaration of OperationsImplementation, for subsequent specialization. </summary>
@@ -146,6 +180,7 @@ namespace math
     struct OperationsImplementation<ImplementationType::native> : public DerivedOperations<OperationsImplementation<ImplementationType::native>>
     {
         using CommonOperations::Add;
+        using CommonOperations::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Add;
         using DerivedOperations<OperationsImplementation<ImplementationType::native>>::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::native>>::MultiplyAdd;
@@ -186,6 +221,139 @@ namespace math
         template <typename ElementType>
         static ElementType Dot(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v);
 
+        /// <summary> Computes the 1-norm of a vector, the sum of the absolute values of its elements. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 1-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm1(UnorientedConstVectorReference<ElementType> v);
+
+        /// <summary> Computes the 2-norm of a vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 2-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm2(UnorientedConstVectorReference<ElementType> v);
+
+        /// <summary> Multiplies a vector by a scalar, v *= s. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <typeparam name="orientation"> Vector orientation. </typeparam>
+        /// <param name="s"> The scalar that multiplies the vector. </param>
+        /// <param name="v"> [in,out] The vector, in any orientation, which is multiplied by s. </param>
+        template <typename ElementType, VectorOrientation orientation>
+        static void Multiply(ElementType s, VectorReference<ElementType, orientation> v);
+
+        /// <summary> Calculates the product of a row vector with a column vector, r = u * v. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="u"> The left vector in row orientation. </param>
+        /// <param name="v"> The right vector in column orientation. </param>
+        /// <param name="r"> [out] The scalar used to store the result. </param>
+        template <typename ElementType>
+        static void Multiply(ConstVectorReference<ElementType, VectorOrientation::row> u, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType& r);
+
+        /// <summary> Generalized matrix column-vector multiplication, u = s * M * v + t * u. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="layout"> Matrix layout. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="M"> The matrix. </param>
+        /// <param name="v"> The column vector that multiplies the matrix on the right. </param>
+        /// <param name="t"> The scalar that multiplies the left hand side vector u. </param>
+        /// <param name="u"> [in,out] A column vector, multiplied by t and used to store the result. </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u);
+
+        /// <summary> Generalized matrix matrix multiplication, C = s * A * B + t * C. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layoutA"> Matrix layout of first matrix. </typeparam>
+        /// <typeparam name="layoutB"> Matrix layout of second matrix. </typeparam>
+        /// <param name="s"> The scalar that multiplies the matrix. </param>
+        /// <param name="A"> The first matrix. </param>
+        /// <param name="B"> The second matrix. </param>
+        /// <param name="t"> The scalar that multiplies C. </param>
+        /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result in the layout of first matrix. </param>
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        static void Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C);
+    };
+
+    /// <summary>
+    /// SIMD implementation of vector and matrix operations, for float and double elements. The level 1 and level 2
+    /// operations call the hand-vectorized kernels in SimdKernels.h, which are chosen at runtime for the instruction
+    /// set of the processor, and the matrix-matrix product calls the native GEMM in NativeGemm.h. Unlike the OpenBLAS
+    /// implementation, it is always available. Function arguments follow the following naming conventions: r,s,t
+    /// represent scalars; u,v,w represent vectors; M,A,B represent matrices.
+    /// </summary>
+    template <>
+    struct OperationsImplementation<ImplementationType::simd> : public DerivedOperations<OperationsImplementation<ImplementationType::simd>>
+    {
+        using CommonOperations::Add;
+        using CommonOperations::Multiply;
+        using DerivedOperations<OperationsImplementation<ImplementationType::simd>>::Add;
+        using DerivedOperations<OperationsImplementation<ImplementationType::simd>>::Multiply;
+        using DerivedOperations<OperationsImplementation<ImplementationType::simd>>::MultiplyAdd;
+        using DerivedOperations<OperationsImplementation<ImplementationType::simd>>::ElementWiseMultiply;
+
+        /// <summary> Gets the implementation name. </summary>
+        ///
+        /// <returns> The implementation name. </returns>
+        static std::string GetImplementationName() { return "Simd"; }
+
+        /// <summary> Columnwise sum of a matrix. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix and vector element type. </typeparam>
+        /// <typeparam name="layout"> Matrix layout. </typeparam>
+        /// <param name="M"> The matrix. </param>
+        /// <param name="u"> [in,out] A row vector, used to store the result. </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void ColumnWiseSum(ConstMatrixReference<ElementType, layout> M, VectorReference<ElementType, VectorOrientation::row> u);
+
+        /// <summary> Adds a scaled vector to another vector, u += s * v. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <typeparam name="orientation"> orientation of the two vectors. </typeparam>
+        /// <param name="s"> The scalar that multiplies the right hand side vector v. </param>
+        /// <param name="v"> The right hand side vector. </param>
+        /// <param name="u"> [in,out] The left hand side vector. </param>
+        template <typename ElementType, VectorOrientation orientation>
+        static void Add(ElementType s, ConstVectorReference<ElementType, orientation> v, VectorReference<ElementType, orientation> u);
+
+        /// <summary>
+        /// Calculates a vector dot product (between vectors in any orientation), u * v.
+        /// </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="u"> The first vector, in any orientation. </param>
+        /// <param name="v"> The second vector, in any orientation. </param>
+        ///
+        /// <returns> The dot product. </returns>
+        template <typename ElementType>
+        static ElementType Dot(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v);
+
+        /// <summary> Computes the 1-norm of a vector, the sum of the absolute values of its elements. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 1-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm1(UnorientedConstVectorReference<ElementType> v);
+
+        /// <summary> Computes the 2-norm of a vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 2-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm2(UnorientedConstVectorReference<ElementType> v);
+
         /// <summary> Multiplies a vector by a scalar, v *= s. </summary>
         ///
         /// <typeparam name="ElementType"> Vector element type. </typeparam>
@@ -228,6 +396,16 @@ namespace math
         /// <param name="C"> [in,out] A matrix, multiplied by t and used to store the result in the layout of first matrix. </param>
         template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
         static void Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C);
+
+        /// <summary> Vector vector element wise multiplication, t = u .* v. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <typeparam name="orientation"> Vector orientaton of result vector. </typeparam>
+        /// <param name="u"> The first vector. </param>
+        /// <param name="v"> The second vector. </param>
+        /// <param name="t"> [in,out] The vector used to store the result. </param>
+        template <typename ElementType, VectorOrientation orientation>
+        static void ElementWiseMultiply(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v, VectorReference<ElementType, orientation> t);
     };
 
 #ifdef USE_BLAS
@@ -237,6 +415,7 @@ namespace math
     struct OperationsImplementation<ImplementationType::openBlas> : public DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>
     {
         using CommonOperations::Add;
+        using CommonOperations::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>::Add;
         using DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>::Multiply;
         using DerivedOperations<OperationsImplementation<ImplementationType::openBlas>>::MultiplyAdd;
@@ -277,6 +456,24 @@ namespace math
         template <typename ElementType>
         static ElementType Dot(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v);
 
+        /// <summary> Computes the 1-norm of a vector, the sum of the absolute values of its elements. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 1-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm1(UnorientedConstVectorReference<ElementType> v);
+
+        /// <summary> Computes the 2-norm of a vector. </summary>
+        ///
+        /// <typeparam name="ElementType"> Vector element type. </typeparam>
+        /// <param name="v"> The vector, in any orientation. </param>
+        ///
+        /// <returns> The 2-norm. </returns>
+        template <typename ElementType>
+        static ElementType Norm2(UnorientedConstVectorReference<ElementType> v);
+
         /// <summary> Calculates the product of a vector and a scalar, v = v * s. </summary>
         ///
         /// <typeparam name="ElementType"> Vector element type. </typeparam>
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Parallel.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <functional>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> Sets the number of threads used by the native math operations. When ELL is built with
+    /// OpenBLAS, this also sets the number of threads used by OpenBLAS. This function should not be called
+    /// while other threads are running math operations. </summary>
+    ///
+    /// <param name="numThreads"> The number of threads, where zero means one thread per hardware thread,
+    /// which is also the default. </param>
+    void SetNumThreads(size_t numThreads);
+
+    /// <summary> Gets the number of threads used by the native math operations. </summary>
+    ///
+    /// <returns> The number of threads. </returns>
+    size_t GetNumThreads();
+
+    /// <summary> Sets the amount of work below which math operations run on the calling thread. The work
+    /// of an operation is its number of multiply-adds (for example, m * n * k for a matrix-matrix product,
+    /// and the vector size for a vector operation). </summary>
+    ///
+    /// <param name="threshold"> The threshold. </param>
+    void SetParallelThreshold(size_t threshold);
+
+    /// <summary> Gets the amount of work below which math operations run on the calling thread. </summary>
+    ///
+    /// <returns> The threshold. </returns>
+    size_t GetParallelThreshold();
+
+    /// <summary> Splits a range of indices into contiguous blocks and calls a function on each block, on
+    /// the math thread pool. The range is split only when its total work reaches the parallel threshold.
+    /// </summary>
+    ///
+    /// <param name="size"> The size of the range [0, size). </param>
+    /// <param name="workPerIndex"> The work done for each index in the range. </param>
+    /// <param name="blockSize"> Block boundaries are multiples of this number. </param>
+    /// <param name="function"> The function, which takes the beginning and end of a block. </param>
+    void ParallelForBlocks(size_t size, size_t workPerIndex, size_t blockSize, const std::function<void(size_t, size_t)>& function);
+}
+}
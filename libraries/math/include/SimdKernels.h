@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdKernels.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "InstructionSet.h"
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> Hand-vectorized level 1 and level 2 kernels, used by the `simd` implementation of the
+    /// operations in Operations.h. Each kernel is written for several instruction sets, and the best one
+    /// supported by the processor is chosen at runtime, so that a single binary gets vector speed on any
+    /// processor without depending on BLAS. The vectorized code is used when the data has unit stride;
+    /// strided data is handled by portable loops. The arguments follow the BLAS conventions. </summary>
+    namespace SimdKernels
+    {
+        /// <summary> Gets the instruction set used by the kernels. </summary>
+        ///
+        /// <returns> The instruction set. </returns>
+        InstructionSet GetInstructionSet();
+
+        /// <summary> Sets the instruction set used by the kernels, which is GetBestSupportedInstructionSet() by
+        /// default. This is mainly intended for testing and benchmarking. </summary>
+        ///
+        /// <param name="instructionSet"> The instruction set, which must be supported by the processor. </param>
+        void SetInstructionSet(InstructionSet instructionSet);
+
+        /// @{
+        /// <summary> Computes the dot product of two vectors. </summary>
+        ///
+        /// <param name="n"> The size of the vectors. </param>
+        /// <param name="x"> Pointer to the first element of the first vector. </param>
+        /// <param name="incx"> The increment of the first vector. </param>
+        /// <param name="y"> Pointer to the first element of the second vector. </param>
+        /// <param name="incy"> The increment of the second vector. </param>
+        ///
+        /// <returns> The dot product. </returns>
+        float Dot(size_t n, const float* x, size_t incx, const float* y, size_t incy);
+        double Dot(size_t n, const double* x, size_t incx, const double* y, size_t incy);
+        /// @}
+
+        /// @{
+        /// <summary> Adds a scaled vector to another vector, y += alpha * x. </summary>
+        ///
+        /// <param name="n"> The size of the vectors. </param>
+        /// <param name="alpha"> The scalar that multiplies x. </param>
+        /// <param name="x"> Pointer to the first element of x. </param>
+        /// <param name="incx"> The increment of x. </param>
+        /// <param name="y"> [in,out] Pointer to the first element of y. </param>
+        /// <param name="incy"> The increment of y. </param>
+        void Axpy(size_t n, float alpha, const float* x, size_t incx, float* y, size_t incy);
+        void Axpy(size_t n, double alpha, const double* x, size_t incx, double* y, size_t incy);
+        /// @}
+
+        /// @{
+        /// <summary> Multiplies a vector by a scalar, x *= alpha. </summary>
+        ///
+        /// <param name="n"> The size of the vector. </param>
+        /// <param name="alpha"> The scalar. </param>
+        /// <param name="x"> [in,out] Pointer to the first element of x. </param>
+        /// <param name="incx"> The increment of x. </param>
+        void Scal(size_t n, float alpha, float* x, size_t incx);
+        void Scal(size_t n, double alpha, double* x, size_t incx);
+        /// @}
+
+        /// @{
+        /// <summary> Computes the 2-norm of a vector. </summary>
+        ///
+        /// <param name="n"> The size of the vector. </param>
+        /// <param name="x"> Pointer to the first element of the vector. </param>
+        /// <param name="incx"> The increment of the vector. </param>
+        ///
+        /// <returns> The 2-norm. </returns>
+        float Nrm2(size_t n, const float* x, size_t incx);
+        double Nrm2(size_t n, const double* x, size_t incx);
+        /// @}
+
+        /// @{
+        /// <summary> Computes the 1-norm of a vector, the sum of the absolute values of its elements. </summary>
+        ///
+        /// <param name="n"> The size of the vector. </param>
+        /// <param name="x"> Pointer to the first element of the vector. </param>
+        /// <param name="incx"> The increment of the vector. </param>
+        ///
+        /// <returns> The 1-norm. </returns>
+        float Asum(size_t n, const float* x, size_t incx);
+        double Asum(size_t n, const double* x, size_t incx);
+        /// @}
+
+        /// @{
+        /// <summary> Multiplies two vectors element-wise, z = x .* y. </summary>
+        ///
+        /// <param name="n"> The size of the vectors. </param>
+        /// <param name="x"> Pointer to the first element of x. </param>
+        /// <param name="incx"> The increment of x. </param>
+        /// <param name="y"> Pointer to the first element of y. </param>
+        /// <param name="incy"> The increment of y. </param>
+        /// <param name="z"> [out] Pointer to the first element of z. </param>
+        /// <param name="incz"> The increment of z. </param>
+        void ElementWiseMultiply(size_t n, const float* x, size_t incx, const float* y, size_t incy, float* z, size_t incz);
+        void ElementWiseMultiply(size_t n, const double* x, size_t incx, const double* y, size_t incy, double* z, size_t incz);
+        /// @}
+
+        /// @{
+        /// <summary> Computes the matrix-vector product y = alpha * A * x + beta * y, where A is m x n. The matrix
+        /// is given by the distances between consecutive elements in a row and in a column, so any row-major,
+        /// column-major or transposed layout can be used. As in BLAS, y is not read when beta is zero. </summary>
+        ///
+        /// <param name="m"> The number of rows in A. </param>
+        /// <param name="n"> The number of columns in A. </param>
+        /// <param name="alpha"> The scalar that multiplies A * x. </param>
+        /// <param name="A"> Pointer to the first element of A. </param>
+        /// <param name="rowIncrementA"> The distance between A(i, j) and A(i + 1, j). </param>
+        /// <param name="columnIncrementA"> The distance between A(i, j) and A(i, j + 1). </param>
+        /// <param name="x"> Pointer to the first element of x, which has n elements. </param>
+        /// <param name="incx"> The increment of x. </param>
+        /// <param name="beta"> The scalar that multiplies y. </param>
+        /// <param name="y"> [in,out] Pointer to the first element of y, which has m elements. </param>
+        /// <param name="incy"> The increment of y. </param>
+        void Gemv(size_t m, size_t n, float alpha, const float* A, size_t rowIncrementA, size_t columnIncrementA, const float* x, size_t incx, float beta, float* y, size_t incy);
+        void Gemv(size_t m, size_t n, double alpha, const double* A, size_t rowIncrementA, size_t columnIncrementA, const double* x, size_t incx, double beta, double* y, size_t incy);
+        /// @}
+    }
+}
+}
@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdTarget.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Macros used by the native SIMD kernels, which are compiled for several instruction sets and chosen at runtime
+// (see InstructionSet.h). The GEMM microkernels of all instruction sets are in the same translation unit, while
+// the unit-stride kernels are compiled with per-file flags (see SimdUnitStrideKernels.h).
+//
+// ELL_SIMD_TARGET(targetName) marks a function that may use the intrinsics of the given instruction set. GCC and
+// clang require this attribute, while MSVC allows any intrinsic in any function. ELL_SIMD_X86 is defined
+// when SIMD kernels are compiled at all; on other platforms only the generic kernels are available.
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ELL_SIMD_GNU
+#define ELL_SIMD_X86
+#define ELL_SIMD_TARGET(targetName) __attribute__((target(targetName)))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define ELL_SIMD_MSVC
+#define ELL_SIMD_X86
+#define ELL_SIMD_TARGET(targetName)
+#else
+#define ELL_SIMD_TARGET(targetName)
+#endif
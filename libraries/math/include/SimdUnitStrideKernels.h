@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdUnitStrideKernels.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+
+namespace ell
+{
+namespace math
+{
+    namespace SimdKernels
+    {
+        //
+        // Implementation detail of SimdKernels.cpp. The unit-stride kernels are written once, in
+        // SimdUnitStrideKernels.tcc, as templates over an instruction set wrapper, and each instruction set
+        // instantiates them in its own source file, SimdKernels<InstructionSet>.cpp, which is compiled with the
+        // compiler flags of that instruction set. These source files must not include headers that define inline
+        // functions used by the rest of the library, since the linker may choose any copy of such a function.
+        //
+        // An instruction set wrapper is a class with an ElementType, a Register type, the number of elements in
+        // a register, registerSize, and the static functions Load, Store, Set1, Add, Mul, MulAdd and Abs.
+        //
+
+        /// <summary> The unit-stride kernels of one instruction set. </summary>
+        template <typename ElementType>
+        struct UnitStrideKernels
+        {
+            ElementType (*dot)(size_t, const ElementType*, const ElementType*);
+            void (*axpy)(size_t, ElementType, const ElementType*, ElementType*);
+            void (*scal)(size_t, ElementType, ElementType*);
+            ElementType (*asum)(size_t, const ElementType*);
+            ElementType (*sumOfSquares)(size_t, const ElementType*);
+            void (*multiply)(size_t, const ElementType*, const ElementType*, ElementType*);
+        };
+
+        /// <summary> Makes the unit-stride kernels of an instruction set. </summary>
+        ///
+        /// <typeparam name="InstructionSetType"> The instruction set wrapper. </typeparam>
+        ///
+        /// <returns> The kernels. </returns>
+        template <typename InstructionSetType>
+        UnitStrideKernels<typename InstructionSetType::ElementType> MakeUnitStrideKernels();
+
+        /// @{
+        /// <summary> Gets the unit-stride kernels of the SSE, AVX2 and AVX-512 instruction sets, which are only
+        /// compiled for x86 processors. </summary>
+        ///
+        /// <typeparam name="ElementType"> The element type, float or double. </typeparam>
+        ///
+        /// <returns> The kernels. </returns>
+        namespace sse
+        {
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetUnitStrideKernels();
+        }
+
+        namespace avx2
+        {
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetUnitStrideKernels();
+        }
+
+        namespace avx512
+        {
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetUnitStrideKernels();
+        }
+        /// @}
+    }
+}
+}
+
+#include "../tcc/SimdUnitStrideKernels.tcc"
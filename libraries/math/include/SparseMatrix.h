@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix.h (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Matrix.h"
+
+// utilities
+#include "IArchivable.h"
+
+// stl
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ell
+{
+namespace math
+{
+    /// <summary> A sparse matrix in compressed form, which stores only its non-zero elements. A row-major
+    /// sparse matrix is stored in the compressed sparse row (CSR) format, and a column-major sparse matrix
+    /// is stored in the compressed sparse column (CSC) format. The elements of major vector (interval) i are
+    /// stored in positions intervalOffsets[i] to intervalOffsets[i+1]-1 of the values array, and the
+    /// minor indices of these elements (column indices in CSR, row indices in CSC) are stored in the same
+    /// positions of the indices array, in increasing order. </summary>
+    ///
+    /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+    /// <typeparam name="layout"> Matrix layout. </typeparam>
+    template <typename ElementType, MatrixLayout layout>
+    class SparseMatrix
+    {
+    public:
+        /// <summary> Constructs an empty sparse matrix. </summary>
+        SparseMatrix();
+
+        /// <summary> Constructs an all-zeros sparse matrix of a given size. </summary>
+        ///
+        /// <param name="numRows"> Number of rows in the matrix. </param>
+        /// <param name="numColumns"> Number of columns in the matrix. </param>
+        SparseMatrix(size_t numRows, size_t numColumns);
+
+        /// <summary> Constructs a sparse matrix from its compressed representation. </summary>
+        ///
+        /// <param name="numRows"> Number of rows in the matrix. </param>
+        /// <param name="numColumns"> Number of columns in the matrix. </param>
+        /// <param name="intervalOffsets"> The offsets of the intervals in the indices and values arrays. This array
+        /// has one more element than the number of intervals, its first element is zero and its last element
+        /// is the number of non-zeros. </param>
+        /// <param name="indices"> The minor indices of the non-zeros, increasing within each interval. </param>
+        /// <param name="values"> The values of the non-zeros. </param>
+        SparseMatrix(size_t numRows, size_t numColumns, std::vector<size_t> intervalOffsets, std::vector<size_t> indices, std::vector<ElementType> values);
+
+        /// <summary> Constructs a sparse matrix from the non-zero elements of a dense matrix. </summary>
+        ///
+        /// <typeparam name="denseLayout"> The layout of the dense matrix. </typeparam>
+        /// <param name="M"> The dense matrix. </param>
+        template <MatrixLayout denseLayout>
+        explicit SparseMatrix(ConstMatrixReference<ElementType, denseLayout> M);
+
+        /// <summary> Gets the number of rows. </summary>
+        ///
+        /// <returns> The number of rows. </returns>
+        size_t NumRows() const { return _numRows; }
+
+        /// <summary> Gets the number of columns. </summary>
+        ///
+        /// <returns> The number of columns. </returns>
+        size_t NumColumns() const { return _numColumns; }
+
+        /// <summary> Gets the number of intervals (rows in CSR, columns in CSC). </summary>
+        ///
+        /// <returns> The number of intervals. </returns>
+        size_t NumIntervals() const { return _intervalOffsets.size() - 1; }
+
+        /// <summary> Gets the number of stored non-zero elements. </summary>
+        ///
+        /// <returns> The number of non-zeros. </returns>
+        size_t NumNonzeros() const { return _values.size(); }
+
+        /// <summary> Gets the matrix layout. </summary>
+        ///
+        /// <returns> The matrix layout. </returns>
+        MatrixLayout GetLayout() const { return layout; }
+
+        /// <summary> Gets an element of the matrix. This takes time logarithmic in the number of non-zeros of
+        /// the interval that contains the element. </summary>
+        ///
+        /// <param name="row"> The row. </param>
+        /// <param name="column"> The column. </param>
+        ///
+        /// <returns> The element, or zero if it is not stored. </returns>
+        ElementType operator()(size_t row, size_t column) const;
+
+        /// <summary> Gets the offsets of the intervals in the indices and values arrays. </summary>
+        ///
+        /// <returns> The interval offsets. </returns>
+        const std::vector<size_t>& GetIntervalOffsets() const { return _intervalOffsets; }
+
+        /// <summary> Gets the minor indices of the non-zeros. </summary>
+        ///
+        /// <returns> The indices. </returns>
+        const std::vector<size_t>& GetIndices() const { return _indices; }
+
+        /// <summary> Gets the values of the non-zeros. </summary>
+        ///
+        /// <returns> The values. </returns>
+        const std::vector<ElementType>& GetValues() const { return _values; }
+
+        /// <summary> Gets the transpose of this matrix. Since the CSR representation of a matrix is the CSC
+        /// representation of its transpose, this copies the arrays without reordering them. </summary>
+        ///
+        /// <returns> The transposed matrix, in the opposite layout. </returns>
+        SparseMatrix<ElementType, TransposeMatrixLayout<layout>::value> Transpose() const;
+
+        /// <summary> Returns a dense copy of this matrix. </summary>
+        ///
+        /// <returns> A dense matrix. </returns>
+        Matrix<ElementType, layout> ToDense() const;
+
+        /// <summary> Equality operator. Two sparse matrices are equal if they have the same size and store the
+        /// same elements. </summary>
+        ///
+        /// <param name="other"> The other matrix. </param>
+        ///
+        /// <returns> true if the two matrices are equal. </returns>
+        bool operator==(const SparseMatrix<ElementType, layout>& other) const;
+
+        /// <summary> Inequality operator. </summary>
+        ///
+        /// <param name="other"> The other matrix. </param>
+        ///
+        /// <returns> true if the two matrices are not equal. </returns>
+        bool operator!=(const SparseMatrix<ElementType, layout>& other) const { return !(*this == other); }
+
+        /// <summary> Swaps the contents of this matrix with the contents of another matrix. </summary>
+        ///
+        /// <param name="other"> [in,out] The other matrix. </param>
+        void Swap(SparseMatrix<ElementType, layout>& other);
+
+    private:
+        size_t GetIntervalSize() const { return layout == MatrixLayout::rowMajor ? _numColumns : _numRows; }
+        void Validate() const;
+
+        size_t _numRows = 0;
+        size_t _numColumns = 0;
+        std::vector<size_t> _intervalOffsets;
+        std::vector<size_t> _indices;
+        std::vector<ElementType> _values;
+    };
+
+    /// <summary> A class that implements helper functions for archiving/unarchiving SparseMatrix instances. </summary>
+    class SparseMatrixArchiver
+    {
+    public:
+        /// <summary> Writes a sparse matrix to the archiver. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layout"> Matrix layout. </typeparam>
+        /// <param name="matrix"> The matrix to add to the archiver. </param>
+        /// <param name="name"> The name of the matrix value to add to the archiver. </param>
+        /// <param name="archiver"> The `Archiver` to add the matrix to </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void Write(const SparseMatrix<ElementType, layout>& matrix, const std::string& name, utilities::Archiver& archiver);
+
+        /// <summary> Reads a sparse matrix from the archiver. </summary>
+        ///
+        /// <typeparam name="ElementType"> Matrix element type. </typeparam>
+        /// <typeparam name="layout"> Matrix layout. </typeparam>
+        /// <param name="matrix"> The matrix that will hold the result after it has been read from the archiver. </param>
+        /// <param name="name"> The name of the matrix value in the archiver. </param>
+        /// <param name="archiver"> The `Unarchiver` to read the matrix from </param>
+        template <typename ElementType, MatrixLayout layout>
+        static void Read(SparseMatrix<ElementType, layout>& matrix, const std::string& name, utilities::Unarchiver& archiver);
+
+    private:
+        static std::string GetRowsName(const std::string& name) { return name + "_rows"; }
+        static std::string GetColumnsName(const std::string& name) { return name + "_columns"; }
+        static std::string GetIntervalOffsetsName(const std::string& name) { return name + "_intervalOffsets"; }
+        static std::string GetIndicesName(const std::string& name) { return name + "_indices"; }
+        static std::string GetValuesName(const std::string& name) { return name + "_values"; }
+    };
+
+    //
+    // friendly names
+    //
+    template <typename ElementType>
+    using RowSparseMatrix = SparseMatrix<ElementType, MatrixLayout::rowMajor>;
+
+    template <typename ElementType>
+    using ColumnSparseMatrix = SparseMatrix<ElementType, MatrixLayout::columnMajor>;
+}
+}
+
+#include "../tcc/SparseMatrix.tcc"
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "Alignment.h"
 #include "Matrix.h"
 #include "Vector.h"
 
@@ -620,12 +621,22 @@ namespace math
         /// <param name="numChannels"> Number of channels. </param>
         Tensor(size_t numRows, size_t numColumns, size_t numChannels);
 
+        /// <summary> Constructs a the zero tensor of given shape, with optional padding. A padded tensor
+        /// cannot be referenced as a vector or a matrix. </summary>
+        ///
+        /// <param name="numRows"> Number of rows. </param>
+        /// <param name="numColumns"> Number of columns. </param>
+        /// <param name="numChannels"> Number of channels. </param>
+        /// <param name="padding"> Whether the first dimension of the layout is padded so that each of its
+        /// intervals starts on an aligned address. </param>
+        Tensor(size_t numRows, size_t numColumns, size_t numChannels, Padding padding);
+
         /// <summary> Constructs a tensor of the given shape with the specified data. </summary>
         ///
         /// <param name="numRows"> Number of rows. </param>
         /// <param name="numColumns"> Number of columns. </param>
         /// <param name="numChannels"> Number of channels. </param>
-        /// <param name="data"> Vector of data elements that will be copied to this Tensor. </param>
+        /// <param name="data"> Vector of data elements that will be copied into the aligned storage of this Tensor. </param>
         Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType>& data);
 
         /// <summary> Constructs a tensor of the given shape with the specified data. </summary>
@@ -633,8 +644,8 @@ namespace math
         /// <param name="numRows"> Number of rows. </param>
         /// <param name="numColumns"> Number of columns. </param>
         /// <param name="numChannels"> Number of channels. </param>
-        /// <param name="data"> Vector of data elements that will be moved to this Tensor. </param>
-        Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType>&& data);
+        /// <param name="data"> Aligned vector of data elements that will be moved into this Tensor. </param>
+        Tensor(size_t numRows, size_t numColumns, size_t numChannels, AlignedVector<ElementType>&& data);
 
         /// <summary> Constructs a the zero tensor of given shape. </summary>
         ///
@@ -677,7 +688,7 @@ namespace math
         /// <summary> Returns a copy of the contents of the Tensor. </summary>
         ///
         /// <returns> A std::vector with a copy of the contents of the Tensor. </returns>
-        std::vector<ElementType> ToArray() const { return _data; }
+        std::vector<ElementType> ToArray() const { return ConstTensorRef::ToArray(); }
 
     private:
         Tensor(size_t numRows, size_t numColumns, size_t numChannels, ElementType* pData) : TensorReference<ElementType, dimension0, dimension1, dimension2>(numRows, numColumns, numChannels, pData) {};
@@ -687,7 +698,7 @@ namespace math
         
         // the array used to store the tensor
         using ConstTensorRef::_contents;
-        std::vector<ElementType> _data;
+        AlignedVector<ElementType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Tensor instances. </summary>
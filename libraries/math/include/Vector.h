@@ -8,13 +8,17 @@
 
 #pragma once
 
+#include "Alignment.h"
+
 // utilities
 #include "IArchivable.h"
 // stl
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <vector>
 #include <limits>
+#include <type_traits>
 
 namespace ell
 {
@@ -142,12 +146,36 @@ namespace math
         size_t _increment;
     };
 
+    /// <summary>
+    /// Base class for lazily evaluated vector expressions, such as `a * u + b * v`. An expression holds copies
+    /// of its operands (which are references) and computes nothing until it is assigned to a vector, by
+    /// VectorReference::CopyFrom, operator+= or operator-=. The assignment evaluates the entire expression in a
+    /// single loop, without temporary vectors. Vectors and transformed vectors are also expressions.
+    ///
+    /// Each derived expression implements Size(), IsContiguous(), which checks if all the vectors in the
+    /// expression have an increment of one, and GetElement&lt;isContiguous&gt;(index), which computes one element
+    /// of the expression.
+    /// </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="ExpressionType"> The derived expression type. </typeparam>
+    template <typename ElementType, VectorOrientation orientation, typename ExpressionType>
+    class VectorExpression
+    {
+    public:
+        /// <summary> Gets the derived expression. </summary>
+        ///
+        /// <returns> The derived expression. </returns>
+        const ExpressionType& GetExpression() const { return static_cast<const ExpressionType&>(*this); }
+    };
+
     /// <summary> A reference to a constant algebraic vector. </summary>
     ///
     /// <typeparam name="ElementType"> Vector element type. </typeparam>
     /// <typeparam name="orientation"> The orientation. </typeparam>
     template <typename ElementType, VectorOrientation orientation>
-    class ConstVectorReference : public VectorBase<orientation>, public UnorientedConstVectorReference<ElementType>
+    class ConstVectorReference : public VectorBase<orientation>, public UnorientedConstVectorReference<ElementType>, public VectorExpression<ElementType, orientation, ConstVectorReference<ElementType, orientation>>
     {
     public:
         using UnorientedConstVectorReference<ElementType>::UnorientedConstVectorReference;
@@ -219,6 +247,26 @@ namespace math
 
         /// @}
 
+        /// \name Expression Functions
+        /// @{
+
+        /// <summary> Checks if the vector elements are stored contiguously, namely, if the increment is one. </summary>
+        ///
+        /// <returns> true if the vector is contiguous. </returns>
+        bool IsContiguous() const { return _increment == 1; }
+
+        /// <summary> Gets a vector element, when the vector is evaluated as part of a vector expression. </summary>
+        ///
+        /// <typeparam name="isContiguous"> Whether the vector is known to be contiguous, which lets the compiler
+        /// vectorize the evaluation loop. </typeparam>
+        /// <param name="index"> Zero-based index of the element. </param>
+        ///
+        /// <returns> A copy of the specified element. </returns>
+        template <bool isContiguous>
+        ElementType GetElement(size_t index) const { return _pData[isContiguous ? index : index * _increment]; }
+
+        /// @}
+
     protected:
         using UnorientedConstVectorReference<ElementType>::_pData;
         using UnorientedConstVectorReference<ElementType>::_size;
@@ -251,7 +299,7 @@ namespace math
     /// <typeparam name="orientation"> The orientation. </typeparam>
     /// <typeparam name="TransformationType"> The transformation type. </typeparam>
     template <typename ElementType, VectorOrientation orientation, typename TransformationType>
-    class TransformedConstVectorReference
+    class TransformedConstVectorReference : public VectorExpression<ElementType, orientation, TransformedConstVectorReference<ElementType, orientation, TransformationType>>
     {
     public:
         /// <summary> Constructs an instance of TransformedConstVectorReference. </summary>
@@ -270,6 +318,25 @@ namespace math
         /// <returns> The vector reference. </returns>
         ConstVectorReference<ElementType, orientation> GetVector() const { return _vector; }
 
+        /// <summary> Gets the vector size. </summary>
+        ///
+        /// <returns> The vector size. </returns>
+        size_t Size() const { return _vector.Size(); }
+
+        /// <summary> Checks if the vector is contiguous. </summary>
+        ///
+        /// <returns> true if the vector is contiguous. </returns>
+        bool IsContiguous() const { return _vector.IsContiguous(); }
+
+        /// <summary> Gets a transformed element, when evaluated as part of a vector expression. </summary>
+        ///
+        /// <typeparam name="isContiguous"> Whether the vector is known to be contiguous. </typeparam>
+        /// <param name="index"> Zero-based index of the element. </param>
+        ///
+        /// <returns> The transformed element. </returns>
+        template <bool isContiguous>
+        ElementType GetElement(size_t index) const { return _transformation(_vector.template GetElement<isContiguous>(index)); }
+
     private:
         ConstVectorReference<ElementType, orientation> _vector;
         TransformationType _transformation;
@@ -328,6 +395,141 @@ namespace math
     template <typename ElementType, VectorOrientation orientation>
     auto Abs(ConstVectorReference<ElementType, orientation> vector);
 
+    /// <summary> A vector expression that multiplies another expression by a scalar. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="OperandType"> The type of the scaled expression. </typeparam>
+    template <typename ElementType, VectorOrientation orientation, typename OperandType>
+    class ScaledVectorExpression : public VectorExpression<ElementType, orientation, ScaledVectorExpression<ElementType, orientation, OperandType>>
+    {
+    public:
+        /// <summary> Constructs an instance of ScaledVectorExpression. </summary>
+        ///
+        /// <param name="scalar"> The scalar. </param>
+        /// <param name="operand"> The scaled expression. </param>
+        ScaledVectorExpression(ElementType scalar, OperandType operand);
+
+        /// <summary> Gets the vector size. </summary>
+        ///
+        /// <returns> The vector size. </returns>
+        size_t Size() const { return _operand.Size(); }
+
+        /// <summary> Checks if all the vectors in the expression are contiguous. </summary>
+        ///
+        /// <returns> true if all the vectors are contiguous. </returns>
+        bool IsContiguous() const { return _operand.IsContiguous(); }
+
+        /// <summary> Computes an element of the expression. </summary>
+        ///
+        /// <typeparam name="isContiguous"> Whether all the vectors are known to be contiguous. </typeparam>
+        /// <param name="index"> Zero-based index of the element. </param>
+        ///
+        /// <returns> The element. </returns>
+        template <bool isContiguous>
+        ElementType GetElement(size_t index) const { return _scalar * _operand.template GetElement<isContiguous>(index); }
+
+    private:
+        ElementType _scalar;
+        OperandType _operand;
+    };
+
+    /// <summary> A vector expression that combines the elements of two other expressions with a binary
+    /// operation, such as addition. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <typeparam name="OperationType"> The binary operation type. </typeparam>
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType, typename OperationType>
+    class BinaryVectorExpression : public VectorExpression<ElementType, orientation, BinaryVectorExpression<ElementType, orientation, LeftType, RightType, OperationType>>
+    {
+    public:
+        /// <summary> Constructs an instance of BinaryVectorExpression. </summary>
+        ///
+        /// <param name="left"> The left expression. </param>
+        /// <param name="right"> The right expression, which has the same size as the left expression. </param>
+        /// <param name="operation"> The binary operation. </param>
+        BinaryVectorExpression(LeftType left, RightType right, OperationType operation);
+
+        /// <summary> Gets the vector size. </summary>
+        ///
+        /// <returns> The vector size. </returns>
+        size_t Size() const { return _left.Size(); }
+
+        /// <summary> Checks if all the vectors in the expression are contiguous. </summary>
+        ///
+        /// <returns> true if all the vectors are contiguous. </returns>
+        bool IsContiguous() const { return _left.IsContiguous() && _right.IsContiguous(); }
+
+        /// <summary> Computes an element of the expression. </summary>
+        ///
+        /// <typeparam name="isContiguous"> Whether all the vectors are known to be contiguous. </typeparam>
+        /// <param name="index"> Zero-based index of the element. </param>
+        ///
+        /// <returns> The element. </returns>
+        template <bool isContiguous>
+        ElementType GetElement(size_t index) const { return _operation(_left.template GetElement<isContiguous>(index), _right.template GetElement<isContiguous>(index)); }
+
+    private:
+        LeftType _left;
+        RightType _right;
+        OperationType _operation;
+    };
+
+    /// <summary> Multiplication operator for scalar and vector expression. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+    /// <param name="scalar"> The scalar. </param>
+    /// <param name="expression"> The vector expression. </param>
+    ///
+    /// <returns> A lazily evaluated ScaledVectorExpression. A scalar times a vector is handled by the
+    /// overload that returns a TransformedConstVectorReference, which is also an expression. </returns>
+    template <typename ElementType, VectorOrientation orientation, typename ExpressionType, typename = std::enable_if_t<!std::is_same<ExpressionType, ConstVectorReference<ElementType, orientation>>::value>>
+    ScaledVectorExpression<ElementType, orientation, ExpressionType> operator*(double scalar, const VectorExpression<ElementType, orientation, ExpressionType>& expression);
+
+    /// <summary> Addition operator for vector expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryVectorExpression. </returns>
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::plus<ElementType>> operator+(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right);
+
+    /// <summary> Subtraction operator for vector expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryVectorExpression. </returns>
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::minus<ElementType>> operator-(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right);
+
+    /// <summary> Element-wise product of vector expressions. </summary>
+    ///
+    /// <typeparam name="ElementType"> Vector element type. </typeparam>
+    /// <typeparam name="orientation"> The orientation. </typeparam>
+    /// <typeparam name="LeftType"> The type of the left expression. </typeparam>
+    /// <typeparam name="RightType"> The type of the right expression. </typeparam>
+    /// <param name="left"> The left expression. </param>
+    /// <param name="right"> The right expression. </param>
+    ///
+    /// <returns> A lazily evaluated BinaryVectorExpression. </returns>
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::multiplies<ElementType>> ElementWiseProduct(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right);
+
     /// <summary> A reference to a non-constant algebraic vector. </summary>
     ///
     /// <typeparam name="ElementType"> Vector element type. </typeparam>
@@ -383,6 +585,13 @@ namespace math
         template <typename TransformationType>
         void CopyFrom(TransformedConstVectorReference<ElementType, orientation, TransformationType> other);
 
+        /// <summary> Evaluates a vector expression into this vector, in a single loop. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The vector expression. </param>
+        template <typename ExpressionType>
+        void CopyFrom(const VectorExpression<ElementType, orientation, ExpressionType>& expression);
+
         /// <summary> Sets all vector elements to zero. </summary>
         void Reset();
 
@@ -455,6 +664,20 @@ namespace math
         /// <param name="other"> The other vector. </param>
         void operator-=(ConstVectorReference<ElementType, orientation> other);
 
+        /// <summary> Adds a vector expression to this vector, in a single loop. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The vector expression. </param>
+        template <typename ExpressionType>
+        void operator+=(const VectorExpression<ElementType, orientation, ExpressionType>& expression);
+
+        /// <summary> Subtracts a vector expression from this vector, in a single loop. </summary>
+        ///
+        /// <typeparam name="ExpressionType"> The expression type. </typeparam>
+        /// <param name="expression"> The vector expression. </param>
+        template <typename ExpressionType>
+        void operator-=(const VectorExpression<ElementType, orientation, ExpressionType>& expression);
+
         /// <summary> Adds a constant value to this vector. </summary>
         ///
         /// <param name="other"> The constant value. </param>
@@ -481,6 +704,11 @@ namespace math
         using ConstVectorReference<ElementType, orientation>::_pData;
         using ConstVectorReference<ElementType, orientation>::_size;
         using ConstVectorReference<ElementType, orientation>::_increment;
+
+    private:
+        // evaluates an expression, calling assignment(thisElement, expressionElement) for each element
+        template <typename ExpressionType, typename AssignmentType>
+        void EvaluateExpression(const ExpressionType& expression, AssignmentType assignment);
     };
 
     /// <summary> An algebraic vector. </summary>
@@ -521,10 +749,15 @@ namespace math
         /// <param name="size"> The vector size. </param>
         Vector(size_t size = 0);
 
-        /// <summary> Constructs a vector by copying a std::vector. </summary>
+        /// <summary> Constructs a vector by copying a std::vector into aligned storage. </summary>
         ///
         /// <param name="data"> The std::vector to copy. </param>
-        Vector(std::vector<ElementType> data);
+        Vector(const std::vector<ElementType>& data);
+
+        /// <summary> Constructs a vector by moving an aligned vector. </summary>
+        ///
+        /// <param name="data"> The aligned vector to move. </param>
+        Vector(AlignedVector<ElementType>&& data);
 
         /// <summary> Constructs a vector from an initializer list. </summary>
         ///
@@ -563,7 +796,7 @@ namespace math
         using ConstVectorReference<ElementType, orientation>::_size;
 
         // member variables
-        std::vector<ElementType> _data;
+        AlignedVector<ElementType> _data;
     };
 
     /// <summary> A class that implements helper functions for archiving/unarchiving Vector instances. </summary>
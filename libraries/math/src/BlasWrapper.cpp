@@ -95,6 +95,13 @@ namespace math
         {
             cblas_dgemm(order, transposeA, transposeB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
         }
+
+        void SetNumThreads(int numThreads)
+        {
+#ifdef OPENBLAS_VERSION
+            openblas_set_num_threads(numThreads);
+#endif
+        }
     }
 }
 }
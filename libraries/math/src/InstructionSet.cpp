@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     InstructionSet.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "InstructionSet.h"
+#include "SimdTarget.h"
+
+#if defined(ELL_SIMD_MSVC)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace ell
+{
+namespace math
+{
+    namespace
+    {
+#if defined(ELL_SIMD_MSVC)
+        // checks a cpuid feature bit, and that the operating system saves the given register state (xcr0 bits)
+        bool HasCpuFeature(int leaf, int registerIndex, int bit, unsigned long long osStateMask)
+        {
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < leaf)
+            {
+                return false;
+            }
+            __cpuidex(info, leaf, 0);
+            if ((info[registerIndex] & (1 << bit)) == 0)
+            {
+                return false;
+            }
+            if (osStateMask == 0)
+            {
+                return true;
+            }
+
+            // osxsave
+            __cpuid(info, 1);
+            if ((info[2] & (1 << 27)) == 0)
+            {
+                return false;
+            }
+            return (_xgetbv(0) & osStateMask) == osStateMask;
+        }
+#endif
+
+        InstructionSet DetectBestInstructionSet()
+        {
+#if defined(ELL_SIMD_GNU)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+            {
+                return InstructionSet::avx512;
+            }
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            {
+                return InstructionSet::avx2;
+            }
+            if (__builtin_cpu_supports("sse2"))
+            {
+                return InstructionSet::sse;
+            }
+#elif defined(ELL_SIMD_MSVC)
+            // AVX-512F is leaf 7 ebx bit 16, AVX2 is leaf 7 ebx bit 5, FMA is leaf 1 ecx bit 12, SSE2 is leaf 1 edx bit 26
+            const unsigned long long avxState = 0x6; // xmm and ymm
+            const unsigned long long avx512State = 0xe6; // xmm, ymm, opmask and zmm
+            if (HasCpuFeature(7, 1, 16, avx512State))
+            {
+                return InstructionSet::avx512;
+            }
+            if (HasCpuFeature(7, 1, 5, avxState) && HasCpuFeature(1, 2, 12, avxState))
+            {
+                return InstructionSet::avx2;
+            }
+            if (HasCpuFeature(1, 3, 26, 0))
+            {
+                return InstructionSet::sse;
+            }
+#endif
+            return InstructionSet::generic;
+        }
+    }
+
+    bool IsInstructionSetSupported(InstructionSet instructionSet)
+    {
+        return static_cast<int>(instructionSet) <= static_cast<int>(GetBestSupportedInstructionSet());
+    }
+
+    InstructionSet GetBestSupportedInstructionSet()
+    {
+        static const InstructionSet bestInstructionSet = DetectBestInstructionSet();
+        return bestInstructionSet;
+    }
+
+    std::string GetInstructionSetName(InstructionSet instructionSet)
+    {
+        switch (instructionSet)
+        {
+        case InstructionSet::sse:
+            return "SSE";
+        case InstructionSet::avx2:
+            return "AVX2";
+        case InstructionSet::avx512:
+            return "AVX-512";
+        default:
+            return "Generic";
+        }
+    }
+}
+}
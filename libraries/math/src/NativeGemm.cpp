@@ -0,0 +1,523 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     NativeGemm.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "NativeGemm.h"
+#include "Parallel.h"
+#include "SimdTarget.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#if defined(ELL_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace ell
+{
+namespace math
+{
+    namespace NativeGemm
+    {
+        namespace
+        {
+            //
+            // Microkernels. A microkernel multiplies a packed MR x kc panel of A by a packed kc x NR panel of B and
+            // writes the MR x NR result to a column-major tile. In the packed A panel, the MR elements of each
+            // column are consecutive, and in the packed B panel, the NR elements of each row are consecutive.
+            //
+
+            template <typename ElementType>
+            using MicrokernelType = void (*)(size_t kc, const ElementType* a, const ElementType* b, ElementType* c);
+
+            template <typename ElementType, size_t MR, size_t NR>
+            void GenericMicrokernel(size_t kc, const ElementType* a, const ElementType* b, ElementType* c)
+            {
+                ElementType accumulators[MR * NR] = {};
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    for (size_t j = 0; j < NR; ++j)
+                    {
+                        for (size_t i = 0; i < MR; ++i)
+                        {
+                            accumulators[j * MR + i] += a[i] * b[j];
+                        }
+                    }
+                    a += MR;
+                    b += NR;
+                }
+                std::copy(accumulators, accumulators + MR * NR, c);
+            }
+
+#if defined(ELL_SIMD_X86)
+            // 4 x 4 doubles, in 2 x 4 registers of 2 doubles
+            ELL_SIMD_TARGET("sse2")
+            void SseMicrokernel(size_t kc, const double* a, const double* b, double* c)
+            {
+                __m128d c0[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+                __m128d c1[4] = { _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd() };
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m128d a0 = _mm_loadu_pd(a);
+                    __m128d a1 = _mm_loadu_pd(a + 2);
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        __m128d bj = _mm_set1_pd(b[j]);
+                        c0[j] = _mm_add_pd(c0[j], _mm_mul_pd(a0, bj));
+                        c1[j] = _mm_add_pd(c1[j], _mm_mul_pd(a1, bj));
+                    }
+                    a += 4;
+                    b += 4;
+                }
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    _mm_storeu_pd(c + 4 * j, c0[j]);
+                    _mm_storeu_pd(c + 4 * j + 2, c1[j]);
+                }
+            }
+
+            // 8 x 4 floats, in 2 x 4 registers of 4 floats
+            ELL_SIMD_TARGET("sse2")
+            void SseMicrokernel(size_t kc, const float* a, const float* b, float* c)
+            {
+                __m128 c0[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+                __m128 c1[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m128 a0 = _mm_loadu_ps(a);
+                    __m128 a1 = _mm_loadu_ps(a + 4);
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        __m128 bj = _mm_set1_ps(b[j]);
+                        c0[j] = _mm_add_ps(c0[j], _mm_mul_ps(a0, bj));
+                        c1[j] = _mm_add_ps(c1[j], _mm_mul_ps(a1, bj));
+                    }
+                    a += 8;
+                    b += 4;
+                }
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    _mm_storeu_ps(c + 8 * j, c0[j]);
+                    _mm_storeu_ps(c + 8 * j + 4, c1[j]);
+                }
+            }
+
+            // 8 x 6 doubles, in 2 x 6 registers of 4 doubles
+            ELL_SIMD_TARGET("avx2,fma")
+            void Avx2Microkernel(size_t kc, const double* a, const double* b, double* c)
+            {
+                __m256d c0[6];
+                __m256d c1[6];
+                for (size_t j = 0; j < 6; ++j)
+                {
+                    c0[j] = _mm256_setzero_pd();
+                    c1[j] = _mm256_setzero_pd();
+                }
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m256d a0 = _mm256_loadu_pd(a);
+                    __m256d a1 = _mm256_loadu_pd(a + 4);
+                    for (size_t j = 0; j < 6; ++j)
+                    {
+                        __m256d bj = _mm256_broadcast_sd(b + j);
+                        c0[j] = _mm256_fmadd_pd(a0, bj, c0[j]);
+                        c1[j] = _mm256_fmadd_pd(a1, bj, c1[j]);
+                    }
+                    a += 8;
+                    b += 6;
+                }
+                for (size_t j = 0; j < 6; ++j)
+                {
+                    _mm256_storeu_pd(c + 8 * j, c0[j]);
+                    _mm256_storeu_pd(c + 8 * j + 4, c1[j]);
+                }
+            }
+
+            // 16 x 6 floats, in 2 x 6 registers of 8 floats
+            ELL_SIMD_TARGET("avx2,fma")
+            void Avx2Microkernel(size_t kc, const float* a, const float* b, float* c)
+            {
+                __m256 c0[6];
+                __m256 c1[6];
+                for (size_t j = 0; j < 6; ++j)
+                {
+                    c0[j] = _mm256_setzero_ps();
+                    c1[j] = _mm256_setzero_ps();
+                }
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m256 a0 = _mm256_loadu_ps(a);
+                    __m256 a1 = _mm256_loadu_ps(a + 8);
+                    for (size_t j = 0; j < 6; ++j)
+                    {
+                        __m256 bj = _mm256_broadcast_ss(b + j);
+                        c0[j] = _mm256_fmadd_ps(a0, bj, c0[j]);
+                        c1[j] = _mm256_fmadd_ps(a1, bj, c1[j]);
+                    }
+                    a += 16;
+                    b += 6;
+                }
+                for (size_t j = 0; j < 6; ++j)
+                {
+                    _mm256_storeu_ps(c + 16 * j, c0[j]);
+                    _mm256_storeu_ps(c + 16 * j + 8, c1[j]);
+                }
+            }
+
+            // 16 x 12 doubles, in 2 x 12 registers of 8 doubles
+            ELL_SIMD_TARGET("avx512f")
+            void Avx512Microkernel(size_t kc, const double* a, const double* b, double* c)
+            {
+                __m512d c0[12];
+                __m512d c1[12];
+                for (size_t j = 0; j < 12; ++j)
+                {
+                    c0[j] = _mm512_setzero_pd();
+                    c1[j] = _mm512_setzero_pd();
+                }
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m512d a0 = _mm512_loadu_pd(a);
+                    __m512d a1 = _mm512_loadu_pd(a + 8);
+                    for (size_t j = 0; j < 12; ++j)
+                    {
+                        __m512d bj = _mm512_set1_pd(b[j]);
+                        c0[j] = _mm512_fmadd_pd(a0, bj, c0[j]);
+                        c1[j] = _mm512_fmadd_pd(a1, bj, c1[j]);
+                    }
+                    a += 16;
+                    b += 12;
+                }
+                for (size_t j = 0; j < 12; ++j)
+                {
+                    _mm512_storeu_pd(c + 16 * j, c0[j]);
+                    _mm512_storeu_pd(c + 16 * j + 8, c1[j]);
+                }
+            }
+
+            // 32 x 12 floats, in 2 x 12 registers of 16 floats
+            ELL_SIMD_TARGET("avx512f")
+            void Avx512Microkernel(size_t kc, const float* a, const float* b, float* c)
+            {
+                __m512 c0[12];
+                __m512 c1[12];
+                for (size_t j = 0; j < 12; ++j)
+                {
+                    c0[j] = _mm512_setzero_ps();
+                    c1[j] = _mm512_setzero_ps();
+                }
+                for (size_t p = 0; p < kc; ++p)
+                {
+                    __m512 a0 = _mm512_loadu_ps(a);
+                    __m512 a1 = _mm512_loadu_ps(a + 16);
+                    for (size_t j = 0; j < 12; ++j)
+                    {
+                        __m512 bj = _mm512_set1_ps(b[j]);
+                        c0[j] = _mm512_fmadd_ps(a0, bj, c0[j]);
+                        c1[j] = _mm512_fmadd_ps(a1, bj, c1[j]);
+                    }
+                    a += 32;
+                    b += 12;
+                }
+                for (size_t j = 0; j < 12; ++j)
+                {
+                    _mm512_storeu_ps(c + 32 * j, c0[j]);
+                    _mm512_storeu_ps(c + 32 * j + 16, c1[j]);
+                }
+            }
+#endif
+
+            // a microkernel together with the shape of the tile that it computes
+            template <typename ElementType>
+            struct Microkernel
+            {
+                MicrokernelType<ElementType> function;
+                size_t mr;
+                size_t nr;
+            };
+
+            Microkernel<double> GetMicrokernel(InstructionSet instructionSet, double)
+            {
+                switch (instructionSet)
+                {
+#if defined(ELL_SIMD_X86)
+                case InstructionSet::avx512:
+                    return { static_cast<MicrokernelType<double>>(Avx512Microkernel), 16, 12 };
+                case InstructionSet::avx2:
+                    return { static_cast<MicrokernelType<double>>(Avx2Microkernel), 8, 6 };
+                case InstructionSet::sse:
+                    return { static_cast<MicrokernelType<double>>(SseMicrokernel), 4, 4 };
+#endif
+                default:
+                    return { GenericMicrokernel<double, 4, 4>, 4, 4 };
+                }
+            }
+
+            Microkernel<float> GetMicrokernel(InstructionSet instructionSet, float)
+            {
+                switch (instructionSet)
+                {
+#if defined(ELL_SIMD_X86)
+                case InstructionSet::avx512:
+                    return { static_cast<MicrokernelType<float>>(Avx512Microkernel), 32, 12 };
+                case InstructionSet::avx2:
+                    return { static_cast<MicrokernelType<float>>(Avx2Microkernel), 16, 6 };
+                case InstructionSet::sse:
+                    return { static_cast<MicrokernelType<float>>(SseMicrokernel), 8, 4 };
+#endif
+                default:
+                    return { GenericMicrokernel<float, 4, 4>, 4, 4 };
+                }
+            }
+
+            //
+            // Blocking
+            //
+
+            // kc x nr panels of B stay in L1 while a microkernel runs, mc x kc blocks of A stay in L2 and
+            // kc x nc blocks of B stay in L3
+            const size_t kcBlockSize = 256;
+            const size_t mcBlockBytes = 192 * 1024;
+            const size_t ncBlockSize = 4096;
+
+            // products smaller than this (in multiply-adds) are not worth packing
+            const size_t minPackedProductSize = 16 * 16 * 16;
+
+            // a buffer of elements that starts on a cache line
+            template <typename ElementType>
+            class AlignedBuffer
+            {
+            public:
+                ElementType* Get(size_t size)
+                {
+                    const size_t alignment = 64;
+                    _buffer.resize(size + alignment / sizeof(ElementType));
+                    auto address = reinterpret_cast<std::uintptr_t>(_buffer.data());
+                    auto alignedAddress = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+                    return reinterpret_cast<ElementType*>(alignedAddress);
+                }
+
+            private:
+                std::vector<ElementType> _buffer;
+            };
+
+            std::atomic<int> selectedInstructionSet(-1);
+
+            // packs an mc x kc block of A into panels of mr rows, padding the last panel with zeros
+            template <typename ElementType>
+            void PackA(size_t mc, size_t kc, const ElementType* A, size_t rowIncrement, size_t columnIncrement, size_t mr, ElementType* packed)
+            {
+                for (size_t i = 0; i < mc; i += mr)
+                {
+                    size_t rows = std::min(mr, mc - i);
+                    for (size_t p = 0; p < kc; ++p)
+                    {
+                        const ElementType* column = A + i * rowIncrement + p * columnIncrement;
+                        size_t ii = 0;
+                        for (; ii < rows; ++ii)
+                        {
+                            packed[ii] = column[ii * rowIncrement];
+                        }
+                        for (; ii < mr; ++ii)
+                        {
+                            packed[ii] = 0;
+                        }
+                        packed += mr;
+                    }
+                }
+            }
+
+            // packs a kc x nc block of B into panels of nr columns, padding the last panel with zeros
+            template <typename ElementType>
+            void PackB(size_t kc, size_t nc, const ElementType* B, size_t rowIncrement, size_t columnIncrement, size_t nr, ElementType* packed)
+            {
+                for (size_t j = 0; j < nc; j += nr)
+                {
+                    size_t columns = std::min(nr, nc - j);
+                    for (size_t p = 0; p < kc; ++p)
+                    {
+                        const ElementType* row = B + p * rowIncrement + j * columnIncrement;
+                        size_t jj = 0;
+                        for (; jj < columns; ++jj)
+                        {
+                            packed[jj] = row[jj * columnIncrement];
+                        }
+                        for (; jj < nr; ++jj)
+                        {
+                            packed[jj] = 0;
+                        }
+                        packed += nr;
+                    }
+                }
+            }
+
+            template <typename ElementType>
+            void ScaleMatrix(size_t m, size_t n, ElementType beta, ElementType* C, size_t rowIncrement, size_t columnIncrement)
+            {
+                if (beta == 1)
+                {
+                    return;
+                }
+                for (size_t j = 0; j < n; ++j)
+                {
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        auto& element = C[i * rowIncrement + j * columnIncrement];
+                        element = (beta == 0) ? 0 : beta * element;
+                    }
+                }
+            }
+
+            // C += alpha * A * B, without packing
+            template <typename ElementType>
+            void UnpackedGemm(size_t m, size_t n, size_t k, ElementType alpha, const ElementType* A, size_t rowIncrementA, size_t columnIncrementA, const ElementType* B, size_t rowIncrementB, size_t columnIncrementB, ElementType* C, size_t rowIncrementC, size_t columnIncrementC)
+            {
+                for (size_t i = 0; i < m; ++i)
+                {
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        ElementType sum = 0;
+                        for (size_t p = 0; p < k; ++p)
+                        {
+                            sum += A[i * rowIncrementA + p * columnIncrementA] * B[p * rowIncrementB + j * columnIncrementB];
+                        }
+                        C[i * rowIncrementC + j * columnIncrementC] += alpha * sum;
+                    }
+                }
+            }
+
+            // C += alpha * A * B, using packed blocks and a microkernel
+            template <typename ElementType>
+            void PackedGemm(size_t m, size_t n, size_t k, ElementType alpha, const ElementType* A, size_t rowIncrementA, size_t columnIncrementA, const ElementType* B, size_t rowIncrementB, size_t columnIncrementB, ElementType* C, size_t rowIncrementC, size_t columnIncrementC)
+            {
+                auto microkernel = GetMicrokernel(GetInstructionSet(), ElementType{});
+                const size_t mr = microkernel.mr;
+                const size_t nr = microkernel.nr;
+                const size_t kcMax = kcBlockSize;
+                const size_t mcMax = std::max(mr, (mcBlockBytes / (kcMax * sizeof(ElementType))) / mr * mr);
+                const size_t ncMax = ncBlockSize / nr * nr;
+
+                // the buffers are reused by later calls on the same thread
+                thread_local AlignedBuffer<ElementType> packedABuffer;
+                thread_local AlignedBuffer<ElementType> packedBBuffer;
+                auto packedA = packedABuffer.Get(mcMax * kcMax);
+                auto packedB = packedBBuffer.Get(std::min(ncMax, (n + nr - 1) / nr * nr) * kcMax);
+                ElementType tile[32 * 12];
+
+                for (size_t jc = 0; jc < n; jc += ncMax)
+                {
+                    size_t nc = std::min(ncMax, n - jc);
+                    for (size_t pc = 0; pc < k; pc += kcMax)
+                    {
+                        size_t kc = std::min(kcMax, k - pc);
+                        PackB(kc, nc, B + pc * rowIncrementB + jc * columnIncrementB, rowIncrementB, columnIncrementB, nr, packedB);
+
+                        for (size_t ic = 0; ic < m; ic += mcMax)
+                        {
+                            size_t mc = std::min(mcMax, m - ic);
+                            PackA(mc, kc, A + ic * rowIncrementA + pc * columnIncrementA, rowIncrementA, columnIncrementA, mr, packedA);
+
+                            for (size_t jr = 0; jr < nc; jr += nr)
+                            {
+                                size_t columns = std::min(nr, nc - jr);
+                                for (size_t ir = 0; ir < mc; ir += mr)
+                                {
+                                    size_t rows = std::min(mr, mc - ir);
+                                    microkernel.function(kc, packedA + ir * kc, packedB + jr * kc, tile);
+
+                                    ElementType* c = C + (ic + ir) * rowIncrementC + (jc + jr) * columnIncrementC;
+                                    for (size_t jj = 0; jj < columns; ++jj)
+                                    {
+                                        for (size_t ii = 0; ii < rows; ++ii)
+                                        {
+                                            c[ii * rowIncrementC + jj * columnIncrementC] += alpha * tile[jj * mr + ii];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <typename ElementType>
+            void SerialGemm(size_t m, size_t n, size_t k, ElementType alpha, const ElementType* A, size_t rowIncrementA, size_t columnIncrementA, const ElementType* B, size_t rowIncrementB, size_t columnIncrementB, ElementType beta, ElementType* C, size_t rowIncrementC, size_t columnIncrementC)
+            {
+                ScaleMatrix(m, n, beta, C, rowIncrementC, columnIncrementC);
+                if (m == 0 || n == 0 || k == 0 || alpha == 0)
+                {
+                    return;
+                }
+
+                if (m * n * k < minPackedProductSize)
+                {
+                    UnpackedGemm(m, n, k, alpha, A, rowIncrementA, columnIncrementA, B, rowIncrementB, columnIncrementB, C, rowIncrementC, columnIncrementC);
+                }
+                else
+                {
+                    PackedGemm(m, n, k, alpha, A, rowIncrementA, columnIncrementA, B, rowIncrementB, columnIncrementB, C, rowIncrementC, columnIncrementC);
+                }
+            }
+
+            template <typename ElementType>
+            void GemmImplementation(size_t m, size_t n, size_t k, ElementType alpha, const ElementType* A, size_t rowIncrementA, size_t columnIncrementA, const ElementType* B, size_t rowIncrementB, size_t columnIncrementB, ElementType beta, ElementType* C, size_t rowIncrementC, size_t columnIncrementC)
+            {
+                // C is split between threads along its larger dimension, in multiples of the microkernel tile,
+                // and each thread multiplies its own slice of C with its own packing buffers
+                auto microkernel = GetMicrokernel(GetInstructionSet(), ElementType{});
+                if (n >= m)
+                {
+                    ParallelForBlocks(n, m * k, microkernel.nr, [&](size_t begin, size_t end) {
+                        SerialGemm(m, end - begin, k, alpha, A, rowIncrementA, columnIncrementA, B + begin * columnIncrementB, rowIncrementB, columnIncrementB, beta, C + begin * columnIncrementC, rowIncrementC, columnIncrementC);
+                    });
+                }
+                else
+                {
+                    ParallelForBlocks(m, n * k, microkernel.mr, [&](size_t begin, size_t end) {
+                        SerialGemm(end - begin, n, k, alpha, A + begin * rowIncrementA, rowIncrementA, columnIncrementA, B, rowIncrementB, columnIncrementB, beta, C + begin * rowIncrementC, rowIncrementC, columnIncrementC);
+                    });
+                }
+            }
+        }
+
+        InstructionSet GetInstructionSet()
+        {
+            auto instructionSet = selectedInstructionSet.load();
+            if (instructionSet < 0)
+            {
+                return GetBestSupportedInstructionSet();
+            }
+            return static_cast<InstructionSet>(instructionSet);
+        }
+
+        void SetInstructionSet(InstructionSet instructionSet)
+        {
+            if (!IsInstructionSetSupported(instructionSet))
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "instruction set " + GetInstructionSetName(instructionSet) + " is not supported by this processor");
+            }
+            selectedInstructionSet = static_cast<int>(instructionSet);
+        }
+
+        void Gemm(size_t m, size_t n, size_t k, float alpha, const float* A, size_t rowIncrementA, size_t columnIncrementA, const float* B, size_t rowIncrementB, size_t columnIncrementB, float beta, float* C, size_t rowIncrementC, size_t columnIncrementC)
+        {
+            GemmImplementation(m, n, k, alpha, A, rowIncrementA, columnIncrementA, B, rowIncrementB, columnIncrementB, beta, C, rowIncrementC, columnIncrementC);
+        }
+
+        void Gemm(size_t m, size_t n, size_t k, double alpha, const double* A, size_t rowIncrementA, size_t columnIncrementA, const double* B, size_t rowIncrementB, size_t columnIncrementB, double beta, double* C, size_t rowIncrementC, size_t columnIncrementC)
+        {
+            GemmImplementation(m, n, k, alpha, A, rowIncrementA, columnIncrementA, B, rowIncrementB, columnIncrementB, beta, C, rowIncrementC, columnIncrementC);
+        }
+    }
+}
+}
@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Parallel.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Parallel.h"
+
+#ifdef USE_BLAS
+#include "BlasWrapper.h"
+#endif
+
+// utilities
+#include "ThreadPool.h"
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace ell
+{
+namespace math
+{
+    namespace
+    {
+        std::atomic<size_t> parallelThreshold(1 << 16);
+
+        std::mutex threadPoolMutex;
+        std::shared_ptr<utilities::ThreadPool> threadPool;
+
+        std::shared_ptr<utilities::ThreadPool> GetThreadPool()
+        {
+            std::lock_guard<std::mutex> lock(threadPoolMutex);
+            if (!threadPool)
+            {
+                threadPool = std::make_shared<utilities::ThreadPool>();
+            }
+            return threadPool;
+        }
+    }
+
+    void SetNumThreads(size_t numThreads)
+    {
+        auto newThreadPool = std::make_shared<utilities::ThreadPool>(numThreads);
+#ifdef USE_BLAS
+        Blas::SetNumThreads(static_cast<int>(newThreadPool->NumThreads()));
+#endif
+        std::lock_guard<std::mutex> lock(threadPoolMutex);
+        threadPool = newThreadPool;
+    }
+
+    size_t GetNumThreads()
+    {
+        return GetThreadPool()->NumThreads();
+    }
+
+    void SetParallelThreshold(size_t threshold)
+    {
+        parallelThreshold = threshold;
+    }
+
+    size_t GetParallelThreshold()
+    {
+        return parallelThreshold;
+    }
+
+    void ParallelForBlocks(size_t size, size_t workPerIndex, size_t blockSize, const std::function<void(size_t, size_t)>& function)
+    {
+        blockSize = std::max(blockSize, static_cast<size_t>(1));
+        size_t numBlocks = (size + blockSize - 1) / blockSize;
+        if (numBlocks <= 1 || size * workPerIndex < parallelThreshold)
+        {
+            function(0, size);
+            return;
+        }
+
+        // the shared pointer keeps the pool alive if SetNumThreads replaces it
+        auto pool = GetThreadPool();
+        size_t numTasks = std::min(pool->NumThreads(), numBlocks);
+        if (numTasks <= 1)
+        {
+            function(0, size);
+            return;
+        }
+
+        // give each task a contiguous run of blocks, spreading the remainder over the first tasks
+        size_t blocksPerTask = numBlocks / numTasks;
+        size_t remainder = numBlocks % numTasks;
+        pool->ParallelFor(numTasks, [&](size_t task) {
+            size_t firstBlock = task * blocksPerTask + std::min(task, remainder);
+            size_t lastBlock = firstBlock + blocksPerTask + (task < remainder ? 1 : 0);
+            function(firstBlock * blockSize, std::min(lastBlock * blockSize, size));
+        });
+    }
+}
+}
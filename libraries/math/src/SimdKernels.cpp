@@ -0,0 +1,376 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdKernels.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "SimdKernels.h"
+#include "SimdTarget.h"
+#include "SimdUnitStrideKernels.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace ell
+{
+namespace math
+{
+    namespace SimdKernels
+    {
+        namespace
+        {
+            //
+            // Unit-stride kernels. The portable kernels are here, while the vectorized kernels are instantiated for
+            // each instruction set in its own source file, see SimdUnitStrideKernels.h.
+            //
+
+            namespace generic
+            {
+                template <typename ElementType>
+                ElementType Dot(size_t n, const ElementType* x, const ElementType* y)
+                {
+                    ElementType result = 0;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        result += x[i] * y[i];
+                    }
+                    return result;
+                }
+
+                template <typename ElementType>
+                void Axpy(size_t n, ElementType alpha, const ElementType* x, ElementType* y)
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        y[i] += alpha * x[i];
+                    }
+                }
+
+                template <typename ElementType>
+                void Scal(size_t n, ElementType alpha, ElementType* x)
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        x[i] *= alpha;
+                    }
+                }
+
+                template <typename ElementType>
+                ElementType Asum(size_t n, const ElementType* x)
+                {
+                    ElementType result = 0;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        result += std::abs(x[i]);
+                    }
+                    return result;
+                }
+
+                template <typename ElementType>
+                ElementType SumOfSquares(size_t n, const ElementType* x)
+                {
+                    return Dot(n, x, x);
+                }
+
+                template <typename ElementType>
+                void Multiply(size_t n, const ElementType* x, const ElementType* y, ElementType* z)
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        z[i] = x[i] * y[i];
+                    }
+                }
+            }
+
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetKernels(InstructionSet instructionSet)
+            {
+                switch (instructionSet)
+                {
+#if defined(ELL_SIMD_X86)
+                case InstructionSet::avx512:
+                    return avx512::GetUnitStrideKernels<ElementType>();
+                case InstructionSet::avx2:
+                    return avx2::GetUnitStrideKernels<ElementType>();
+                case InstructionSet::sse:
+                    return sse::GetUnitStrideKernels<ElementType>();
+#endif
+                default:
+                    return { generic::Dot<ElementType>, generic::Axpy<ElementType>, generic::Scal<ElementType>, generic::Asum<ElementType>, generic::SumOfSquares<ElementType>, generic::Multiply<ElementType> };
+                }
+            }
+
+            std::atomic<int> selectedInstructionSet(-1);
+
+            // a column-major matrix-vector product updates y once per column, so it is computed in blocks of
+            // rows that keep the corresponding part of y in the L1 cache
+            const size_t gemvRowBlockSize = 1024;
+
+            //
+            // Kernels that handle any increment
+            //
+
+            template <typename ElementType>
+            ElementType DotImplementation(size_t n, const ElementType* x, size_t incx, const ElementType* y, size_t incy)
+            {
+                if (incx == 1 && incy == 1)
+                {
+                    return GetKernels<ElementType>(GetInstructionSet()).dot(n, x, y);
+                }
+                ElementType result = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    result += x[i * incx] * y[i * incy];
+                }
+                return result;
+            }
+
+            template <typename ElementType>
+            void AxpyImplementation(size_t n, ElementType alpha, const ElementType* x, size_t incx, ElementType* y, size_t incy)
+            {
+                if (incx == 1 && incy == 1)
+                {
+                    GetKernels<ElementType>(GetInstructionSet()).axpy(n, alpha, x, y);
+                    return;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    y[i * incy] += alpha * x[i * incx];
+                }
+            }
+
+            template <typename ElementType>
+            void ScalImplementation(size_t n, ElementType alpha, ElementType* x, size_t incx)
+            {
+                if (incx == 1)
+                {
+                    GetKernels<ElementType>(GetInstructionSet()).scal(n, alpha, x);
+                    return;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    x[i * incx] *= alpha;
+                }
+            }
+
+            template <typename ElementType>
+            ElementType AsumImplementation(size_t n, const ElementType* x, size_t incx)
+            {
+                if (incx == 1)
+                {
+                    return GetKernels<ElementType>(GetInstructionSet()).asum(n, x);
+                }
+                ElementType result = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    result += std::abs(x[i * incx]);
+                }
+                return result;
+            }
+
+            template <typename ElementType>
+            ElementType Nrm2Implementation(size_t n, const ElementType* x, size_t incx)
+            {
+                ElementType sumOfSquares = 0;
+                if (incx == 1)
+                {
+                    sumOfSquares = GetKernels<ElementType>(GetInstructionSet()).sumOfSquares(n, x);
+                }
+                else
+                {
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        sumOfSquares += x[i * incx] * x[i * incx];
+                    }
+                }
+
+                // the squares can overflow or underflow, in which case the elements are rescaled by the largest
+                // absolute value, as in the reference BLAS
+                if (std::isfinite(sumOfSquares) && sumOfSquares >= std::numeric_limits<ElementType>::min())
+                {
+                    return std::sqrt(sumOfSquares);
+                }
+
+                ElementType scale = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    scale = std::max(scale, std::abs(x[i * incx]));
+                }
+                if (scale == 0 || !std::isfinite(scale))
+                {
+                    return scale;
+                }
+                ElementType scaledSumOfSquares = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    auto scaled = x[i * incx] / scale;
+                    scaledSumOfSquares += scaled * scaled;
+                }
+                return scale * std::sqrt(scaledSumOfSquares);
+            }
+
+            template <typename ElementType>
+            void ElementWiseMultiplyImplementation(size_t n, const ElementType* x, size_t incx, const ElementType* y, size_t incy, ElementType* z, size_t incz)
+            {
+                if (incx == 1 && incy == 1 && incz == 1)
+                {
+                    GetKernels<ElementType>(GetInstructionSet()).multiply(n, x, y, z);
+                    return;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    z[i * incz] = x[i * incx] * y[i * incy];
+                }
+            }
+
+            template <typename ElementType>
+            void GemvImplementation(size_t m, size_t n, ElementType alpha, const ElementType* A, size_t rowIncrementA, size_t columnIncrementA, const ElementType* x, size_t incx, ElementType beta, ElementType* y, size_t incy)
+            {
+                auto kernels = GetKernels<ElementType>(GetInstructionSet());
+
+                // contiguous rows: each element of y is a dot product
+                if (columnIncrementA == 1 && incx == 1)
+                {
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        auto product = alpha * kernels.dot(n, A + i * rowIncrementA, x);
+                        y[i * incy] = beta == 0 ? product : product + beta * y[i * incy];
+                    }
+                    return;
+                }
+
+                // scale y, without reading it if beta is zero
+                for (size_t i = 0; i < m; ++i)
+                {
+                    y[i * incy] = beta == 0 ? 0 : beta * y[i * incy];
+                }
+                if (alpha == 0)
+                {
+                    return;
+                }
+
+                // contiguous columns: y is a sum of scaled columns
+                if (rowIncrementA == 1 && incy == 1)
+                {
+                    for (size_t rowBegin = 0; rowBegin < m; rowBegin += gemvRowBlockSize)
+                    {
+                        size_t rows = std::min(gemvRowBlockSize, m - rowBegin);
+                        for (size_t j = 0; j < n; ++j)
+                        {
+                            kernels.axpy(rows, alpha * x[j * incx], A + rowBegin + j * columnIncrementA, y + rowBegin);
+                        }
+                    }
+                    return;
+                }
+
+                for (size_t i = 0; i < m; ++i)
+                {
+                    ElementType sum = 0;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        sum += A[i * rowIncrementA + j * columnIncrementA] * x[j * incx];
+                    }
+                    y[i * incy] += alpha * sum;
+                }
+            }
+        }
+
+        InstructionSet GetInstructionSet()
+        {
+            auto instructionSet = selectedInstructionSet.load();
+            if (instructionSet < 0)
+            {
+                return GetBestSupportedInstructionSet();
+            }
+            return static_cast<InstructionSet>(instructionSet);
+        }
+
+        void SetInstructionSet(InstructionSet instructionSet)
+        {
+            if (!IsInstructionSetSupported(instructionSet))
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "instruction set " + GetInstructionSetName(instructionSet) + " is not supported by this processor");
+            }
+            selectedInstructionSet = static_cast<int>(instructionSet);
+        }
+
+        float Dot(size_t n, const float* x, size_t incx, const float* y, size_t incy)
+        {
+            return DotImplementation(n, x, incx, y, incy);
+        }
+
+        double Dot(size_t n, const double* x, size_t incx, const double* y, size_t incy)
+        {
+            return DotImplementation(n, x, incx, y, incy);
+        }
+
+        void Axpy(size_t n, float alpha, const float* x, size_t incx, float* y, size_t incy)
+        {
+            AxpyImplementation(n, alpha, x, incx, y, incy);
+        }
+
+        void Axpy(size_t n, double alpha, const double* x, size_t incx, double* y, size_t incy)
+        {
+            AxpyImplementation(n, alpha, x, incx, y, incy);
+        }
+
+        void Scal(size_t n, float alpha, float* x, size_t incx)
+        {
+            ScalImplementation(n, alpha, x, incx);
+        }
+
+        void Scal(size_t n, double alpha, double* x, size_t incx)
+        {
+            ScalImplementation(n, alpha, x, incx);
+        }
+
+        float Nrm2(size_t n, const float* x, size_t incx)
+        {
+            return Nrm2Implementation(n, x, incx);
+        }
+
+        double Nrm2(size_t n, const double* x, size_t incx)
+        {
+            return Nrm2Implementation(n, x, incx);
+        }
+
+        float Asum(size_t n, const float* x, size_t incx)
+        {
+            return AsumImplementation(n, x, incx);
+        }
+
+        double Asum(size_t n, const double* x, size_t incx)
+        {
+            return AsumImplementation(n, x, incx);
+        }
+
+        void ElementWiseMultiply(size_t n, const float* x, size_t incx, const float* y, size_t incy, float* z, size_t incz)
+        {
+            ElementWiseMultiplyImplementation(n, x, incx, y, incy, z, incz);
+        }
+
+        void ElementWiseMultiply(size_t n, const double* x, size_t incx, const double* y, size_t incy, double* z, size_t incz)
+        {
+            ElementWiseMultiplyImplementation(n, x, incx, y, incy, z, incz);
+        }
+
+        void Gemv(size_t m, size_t n, float alpha, const float* A, size_t rowIncrementA, size_t columnIncrementA, const float* x, size_t incx, float beta, float* y, size_t incy)
+        {
+            GemvImplementation(m, n, alpha, A, rowIncrementA, columnIncrementA, x, incx, beta, y, incy);
+        }
+
+        void Gemv(size_t m, size_t n, double alpha, const double* A, size_t rowIncrementA, size_t columnIncrementA, const double* x, size_t incx, double beta, double* y, size_t incy)
+        {
+            GemvImplementation(m, n, alpha, A, rowIncrementA, columnIncrementA, x, incx, beta, y, incy);
+        }
+    }
+}
+}
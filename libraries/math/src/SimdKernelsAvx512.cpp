@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdKernelsAvx512.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// This file is compiled with the AVX-512 compiler flags, see SimdUnitStrideKernels.h
+
+#include "SimdTarget.h"
+#include "SimdUnitStrideKernels.h"
+
+#if defined(ELL_SIMD_X86)
+#include <immintrin.h>
+
+namespace ell
+{
+namespace math
+{
+    namespace SimdKernels
+    {
+        namespace avx512
+        {
+            namespace
+            {
+                template <typename ElementType>
+                struct InstructionSetWrapper;
+
+                template <>
+                struct InstructionSetWrapper<double>
+                {
+                    using ElementType = double;
+                    using Register = __m512d;
+                    static const size_t registerSize = 8;
+
+                    static Register Load(const double* p) { return _mm512_loadu_pd(p); }
+                    static void Store(double* p, Register a) { _mm512_storeu_pd(p, a); }
+                    static Register Set1(double a) { return _mm512_set1_pd(a); }
+                    static Register Add(Register a, Register b) { return _mm512_add_pd(a, b); }
+                    static Register Mul(Register a, Register b) { return _mm512_mul_pd(a, b); }
+                    static Register MulAdd(Register a, Register b, Register c) { return _mm512_fmadd_pd(a, b, c); }
+                    static Register Abs(Register a) { return _mm512_abs_pd(a); }
+                };
+
+                template <>
+                struct InstructionSetWrapper<float>
+                {
+                    using ElementType = float;
+                    using Register = __m512;
+                    static const size_t registerSize = 16;
+
+                    static Register Load(const float* p) { return _mm512_loadu_ps(p); }
+                    static void Store(float* p, Register a) { _mm512_storeu_ps(p, a); }
+                    static Register Set1(float a) { return _mm512_set1_ps(a); }
+                    static Register Add(Register a, Register b) { return _mm512_add_ps(a, b); }
+                    static Register Mul(Register a, Register b) { return _mm512_mul_ps(a, b); }
+                    static Register MulAdd(Register a, Register b, Register c) { return _mm512_fmadd_ps(a, b, c); }
+                    static Register Abs(Register a) { return _mm512_abs_ps(a); }
+                };
+            }
+
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetUnitStrideKernels()
+            {
+                return MakeUnitStrideKernels<InstructionSetWrapper<ElementType>>();
+            }
+
+            template UnitStrideKernels<float> GetUnitStrideKernels<float>();
+            template UnitStrideKernels<double> GetUnitStrideKernels<double>();
+        }
+    }
+}
+}
+#endif
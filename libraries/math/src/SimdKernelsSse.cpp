@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdKernelsSse.cpp (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// This file is compiled with the SSE2 compiler flags, see SimdUnitStrideKernels.h
+
+#include "SimdTarget.h"
+#include "SimdUnitStrideKernels.h"
+
+#if defined(ELL_SIMD_X86)
+#include <immintrin.h>
+
+namespace ell
+{
+namespace math
+{
+    namespace SimdKernels
+    {
+        namespace sse
+        {
+            namespace
+            {
+                template <typename ElementType>
+                struct InstructionSetWrapper;
+
+                template <>
+                struct InstructionSetWrapper<double>
+                {
+                    using ElementType = double;
+                    using Register = __m128d;
+                    static const size_t registerSize = 2;
+
+                    static Register Load(const double* p) { return _mm_loadu_pd(p); }
+                    static void Store(double* p, Register a) { _mm_storeu_pd(p, a); }
+                    static Register Set1(double a) { return _mm_set1_pd(a); }
+                    static Register Add(Register a, Register b) { return _mm_add_pd(a, b); }
+                    static Register Mul(Register a, Register b) { return _mm_mul_pd(a, b); }
+                    static Register MulAdd(Register a, Register b, Register c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+                    static Register Abs(Register a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+                };
+
+                template <>
+                struct InstructionSetWrapper<float>
+                {
+                    using ElementType = float;
+                    using Register = __m128;
+                    static const size_t registerSize = 4;
+
+                    static Register Load(const float* p) { return _mm_loadu_ps(p); }
+                    static void Store(float* p, Register a) { _mm_storeu_ps(p, a); }
+                    static Register Set1(float a) { return _mm_set1_ps(a); }
+                    static Register Add(Register a, Register b) { return _mm_add_ps(a, b); }
+                    static Register Mul(Register a, Register b) { return _mm_mul_ps(a, b); }
+                    static Register MulAdd(Register a, Register b, Register c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+                    static Register Abs(Register a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+                };
+            }
+
+            template <typename ElementType>
+            UnitStrideKernels<ElementType> GetUnitStrideKernels()
+            {
+                return MakeUnitStrideKernels<InstructionSetWrapper<ElementType>>();
+            }
+
+            template UnitStrideKernels<float> GetUnitStrideKernels<float>();
+            template UnitStrideKernels<double> GetUnitStrideKernels<double>();
+        }
+    }
+}
+}
+#endif
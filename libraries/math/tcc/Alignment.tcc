@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     Alignment.tcc (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, size_t alignment>
+    ElementType* AlignedAllocator<ElementType, alignment>::allocate(size_t size)
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+        if (size > (std::numeric_limits<size_t>::max() - alignment - sizeof(void*)) / sizeof(ElementType))
+        {
+            throw std::bad_alloc();
+        }
+
+        // allocate extra space for the alignment and for a pointer to the start of the allocation, which
+        // is stored just before the aligned block
+        void* allocation = std::malloc(size * sizeof(ElementType) + alignment + sizeof(void*));
+        if (allocation == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        auto address = reinterpret_cast<std::uintptr_t>(allocation) + sizeof(void*);
+        auto alignedAddress = (address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        reinterpret_cast<void**>(alignedAddress)[-1] = allocation;
+        return reinterpret_cast<ElementType*>(alignedAddress);
+    }
+
+    template <typename ElementType, size_t alignment>
+    void AlignedAllocator<ElementType, alignment>::deallocate(ElementType* pointer, size_t)
+    {
+        if (pointer != nullptr)
+        {
+            std::free(reinterpret_cast<void**>(pointer)[-1]);
+        }
+    }
+}
+}
@@ -54,6 +54,24 @@ namespace math
     {
     }
 
+    template <typename ElementType>
+    void MatrixBase<ElementType, MatrixLayout::rowMajor>::Swap(MatrixBase<ElementType, MatrixLayout::rowMajor>& other)
+    {
+        RectangularMatrixBase<ElementType>::Swap(other);
+        std::swap(_numIntervals, other._numIntervals);
+        std::swap(_intervalSize, other._intervalSize);
+        std::swap(_rowIncrement, other._rowIncrement);
+    }
+
+    template <typename ElementType>
+    void MatrixBase<ElementType, MatrixLayout::columnMajor>::Swap(MatrixBase<ElementType, MatrixLayout::columnMajor>& other)
+    {
+        RectangularMatrixBase<ElementType>::Swap(other);
+        std::swap(_numIntervals, other._numIntervals);
+        std::swap(_intervalSize, other._intervalSize);
+        std::swap(_columnIncrement, other._columnIncrement);
+    }
+
     //
     // ConstMatrixReference
     //
@@ -68,13 +86,26 @@ namespace math
     template <typename ElementType, MatrixLayout layout>
     std::vector<ElementType> ConstMatrixReference<ElementType, layout>::ToArray() const
     {
-        return { _pData, _pData + GetDataSize() };
+        if (IsContiguous())
+        {
+            return { _pData, _pData + Size() };
+        }
+
+        // skip the elements between intervals
+        std::vector<ElementType> result;
+        result.reserve(Size());
+        for (size_t i = 0; i < _numIntervals; ++i)
+        {
+            auto intervalBegin = _pData + i * _increment;
+            result.insert(result.end(), intervalBegin, intervalBegin + _intervalSize);
+        }
+        return result;
     }
 
     template <typename ElementType, MatrixLayout layout>
     void ConstMatrixReference<ElementType, layout>::Swap(ConstMatrixReference<ElementType, layout>& other)
     {
-        RectangularMatrixBase<ElementType>::Swap(other);
+        MatrixBase<ElementType, layout>::Swap(other);
     }
 
     template <typename ElementType, MatrixLayout layout>
@@ -221,6 +252,50 @@ namespace math
         return stream;
     }
 
+    //
+    // Matrix expressions
+    //
+
+    template <typename ElementType, MatrixLayout layout, typename OperandType>
+    ScaledMatrixExpression<ElementType, layout, OperandType>::ScaledMatrixExpression(ElementType scalar, OperandType operand)
+        : _scalar(scalar), _operand(std::move(operand))
+    {
+    }
+
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType, typename OperationType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, OperationType>::BinaryMatrixExpression(LeftType left, RightType right, OperationType operation)
+        : _left(std::move(left)), _right(std::move(right)), _operation(std::move(operation))
+    {
+        if (_left.NumRows() != _right.NumRows() || _left.NumColumns() != _right.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "matrix expression operands are not the same size.");
+        }
+    }
+
+    template <typename ElementType, MatrixLayout layout, typename ExpressionType>
+    ScaledMatrixExpression<ElementType, layout, ExpressionType> operator*(double scalar, const MatrixExpression<ElementType, layout, ExpressionType>& expression)
+    {
+        return ScaledMatrixExpression<ElementType, layout, ExpressionType>(static_cast<ElementType>(scalar), expression.GetExpression());
+    }
+
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::plus<ElementType>> operator+(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right)
+    {
+        return BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::plus<ElementType>>(left.GetExpression(), right.GetExpression(), std::plus<ElementType>());
+    }
+
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::minus<ElementType>> operator-(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right)
+    {
+        return BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::minus<ElementType>>(left.GetExpression(), right.GetExpression(), std::minus<ElementType>());
+    }
+
+    template <typename ElementType, MatrixLayout layout, typename LeftType, typename RightType>
+    BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::multiplies<ElementType>> ElementWiseProduct(const MatrixExpression<ElementType, layout, LeftType>& left, const MatrixExpression<ElementType, layout, RightType>& right)
+    {
+        return BinaryMatrixExpression<ElementType, layout, LeftType, RightType, std::multiplies<ElementType>>(left.GetExpression(), right.GetExpression(), std::multiplies<ElementType>());
+    }
+
     //
     // MatrixReference
     //
@@ -342,6 +417,46 @@ namespace math
         return VectorReference<ElementType, VectorOrientation::column>(_pData, _numRows * _numColumns, 1);
     }
 
+    template <typename ElementType, MatrixLayout layout>
+    template <typename ExpressionType>
+    void MatrixReference<ElementType, layout>::CopyFrom(const MatrixExpression<ElementType, layout, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x = y; });
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    template <typename ExpressionType>
+    void MatrixReference<ElementType, layout>::operator+=(const MatrixExpression<ElementType, layout, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x += y; });
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    template <typename ExpressionType>
+    void MatrixReference<ElementType, layout>::operator-=(const MatrixExpression<ElementType, layout, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x -= y; });
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    template <typename ExpressionType, typename AssignmentType>
+    void MatrixReference<ElementType, layout>::EvaluateExpression(const ExpressionType& expression, AssignmentType assignment)
+    {
+        if (_numRows != expression.NumRows() || _numColumns != expression.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "this matrix and the matrix expression are not the same size.");
+        }
+
+        for (size_t i = 0; i < _numIntervals; ++i)
+        {
+            ElementType* pInterval = GetMajorVectorBegin(i);
+            for (size_t j = 0; j < _intervalSize; ++j)
+            {
+                assignment(pInterval[j], expression.GetIntervalElement(i, j));
+            }
+        }
+    }
+
     template <typename ElementType, MatrixLayout layout>
     void MatrixReference<ElementType, layout>::operator+=(ElementType value)
     {
@@ -381,6 +496,14 @@ namespace math
         _pData = _data.data();
     }
 
+    template <typename ElementType, MatrixLayout layout>
+    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, Padding padding)
+        : MatrixReference<ElementType, layout>(numRows, numColumns, GetPaddedIncrement<ElementType>(layout == MatrixLayout::rowMajor ? numColumns : numRows, padding), nullptr)
+    {
+        _data.resize(_increment * this->NumIntervals());
+        _pData = _data.data();
+    }
+
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(std::initializer_list<std::initializer_list<ElementType>> list)
         : MatrixReference<ElementType, layout>(list.size(), list.begin()->size(), nullptr), _data(list.size() * list.begin()->size())
@@ -405,13 +528,13 @@ namespace math
 
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, const std::vector<ElementType>& data)
-        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(data)
+        : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(data.begin(), data.end())
     {
         _pData = _data.data();
     }
 
     template <typename ElementType, MatrixLayout layout>
-    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, std::vector<ElementType>&& data)
+    Matrix<ElementType, layout>::Matrix(size_t numRows, size_t numColumns, AlignedVector<ElementType>&& data)
         : MatrixReference<ElementType, layout>(numRows, numColumns, nullptr), _data(std::move(data))
     {
         _pData = _data.data();
@@ -419,14 +542,14 @@ namespace math
 
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(Matrix<ElementType, layout>&& other)
-        : MatrixReference<ElementType, layout>(other.NumRows(), other.NumColumns(), nullptr), _data(std::move(other._data))
+        : MatrixReference<ElementType, layout>(other.NumRows(), other.NumColumns(), other.GetIncrement(), nullptr), _data(std::move(other._data))
     {
         _pData = _data.data();
     }
 
     template <typename ElementType, MatrixLayout layout>
     Matrix<ElementType, layout>::Matrix(const Matrix<ElementType, layout>& other)
-        : MatrixReference<ElementType, layout>(other.NumRows(), other.NumColumns(), nullptr), _data(other._data)
+        : MatrixReference<ElementType, layout>(other.NumRows(), other.NumColumns(), other.GetIncrement(), nullptr), _data(other._data)
     {
         _pData = _data.data();
     }
@@ -469,7 +592,7 @@ namespace math
     template <typename ElementType, MatrixLayout layout>
     void Matrix<ElementType, layout>::Swap(Matrix<ElementType, layout>& other)
     {
-        RectangularMatrixBase<ElementType>::Swap(other);
+        MatrixBase<ElementType, layout>::Swap(other);
         std::swap(_data, other._data);
     }
 
@@ -492,7 +615,7 @@ namespace math
         archiver[GetColumnsName(name)] >> columns;
         archiver[GetValuesName(name)] >> values;
 
-        Matrix<ElementType, layout> value(rows, columns, std::move(values));
+        Matrix<ElementType, layout> value(rows, columns, values);
 
         matrix = std::move(value);
     }
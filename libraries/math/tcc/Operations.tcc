@@ -6,10 +6,15 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "Parallel.h"
+
 // utilities
 #include "Debug.h"
 #include "Exception.h"
 
+// stl
+#include <algorithm>
+
 namespace ell
 {
 namespace math
@@ -34,6 +39,238 @@ namespace math
         }
     }
 
+    namespace OperationsDetail
+    {
+        // vector operations are split between threads in blocks of this many elements
+        const size_t vectorBlockSize = 1024;
+
+        // the size of each row of a row-major matrix, or of each column of a column-major matrix
+        template <typename ElementType, MatrixLayout layout>
+        size_t GetIntervalSize(ConstMatrixReference<ElementType, layout> M)
+        {
+            return layout == MatrixLayout::rowMajor ? M.NumColumns() : M.NumRows();
+        }
+
+        // the distance between M(i, j) and M(i + 1, j)
+        template <typename MatrixType>
+        size_t GetRowIncrement(const MatrixType& M)
+        {
+            return M.GetLayout() == MatrixLayout::rowMajor ? M.GetIncrement() : 1;
+        }
+
+        // the distance between M(i, j) and M(i, j + 1)
+        template <typename MatrixType>
+        size_t GetColumnIncrement(const MatrixType& M)
+        {
+            return M.GetLayout() == MatrixLayout::rowMajor ? 1 : M.GetIncrement();
+        }
+
+        // y += s * x, for unit-stride data; when both arrays are aligned (as they are in vectors and
+        // matrices that own their memory), the compiler vectorizes the loop with aligned loads and stores
+        template <typename ElementType>
+        void UnitStrideAxpy(ElementType s, const ElementType* x, ElementType* y, size_t size)
+        {
+            if (IsAligned(x) && IsAligned(y))
+            {
+                x = AssumeAligned(x);
+                y = AssumeAligned(y);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    y[i] += s * x[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    y[i] += s * x[i];
+                }
+            }
+        }
+
+        // z = x * y element-wise, for unit-stride data
+        template <typename ElementType>
+        void UnitStrideElementWiseMultiply(const ElementType* x, const ElementType* y, ElementType* z, size_t size)
+        {
+            if (IsAligned(x) && IsAligned(y) && IsAligned(z))
+            {
+                x = AssumeAligned(x);
+                y = AssumeAligned(y);
+                z = AssumeAligned(z);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    z[i] = x[i] * y[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    z[i] = x[i] * y[i];
+                }
+            }
+        }
+
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        bool TryNativeGemm(ElementType, ConstMatrixReference<ElementType, layoutA>, ConstMatrixReference<ElementType, layoutB>, ElementType, MatrixReference<ElementType, layoutA>)
+        {
+            return false;
+        }
+
+        template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+        bool NativeGemmFloatingPoint(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C)
+        {
+            NativeGemm::Gemm(A.NumRows(), B.NumColumns(), A.NumColumns(), s,
+                A.GetDataPointer(), GetRowIncrement(A), GetColumnIncrement(A),
+                B.GetDataPointer(), GetRowIncrement(B), GetColumnIncrement(B), t,
+                C.GetDataPointer(), GetRowIncrement(C), GetColumnIncrement(C));
+            return true;
+        }
+
+        template <MatrixLayout layoutA, MatrixLayout layoutB>
+        bool TryNativeGemm(float s, ConstMatrixReference<float, layoutA> A, ConstMatrixReference<float, layoutB> B, float t, MatrixReference<float, layoutA> C)
+        {
+            return NativeGemmFloatingPoint(s, A, B, t, C);
+        }
+
+        template <MatrixLayout layoutA, MatrixLayout layoutB>
+        bool TryNativeGemm(double s, ConstMatrixReference<double, layoutA> A, ConstMatrixReference<double, layoutB> B, double t, MatrixReference<double, layoutA> C)
+        {
+            return NativeGemmFloatingPoint(s, A, B, t, C);
+        }
+
+        // u = t * u, where t == 0 overwrites u (so that NaNs in u do not propagate)
+        template <typename ElementType, VectorOrientation orientation>
+        void Scale(ElementType t, VectorReference<ElementType, orientation> u)
+        {
+            if (t == 0)
+            {
+                u.Reset();
+            }
+            else if (t != 1)
+            {
+                u *= t;
+            }
+        }
+
+        // u += s * v
+        template <typename ElementType, VectorOrientation orientation>
+        void ScaledAdd(ElementType s, ConstVectorReference<ElementType, orientation> v, VectorReference<ElementType, orientation> u)
+        {
+            if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
+            {
+                UnitStrideAxpy(s, v.GetDataPointer(), u.GetDataPointer(), u.Size());
+                return;
+            }
+            for (size_t i = 0; i < u.Size(); ++i)
+            {
+                u[i] += s * v[i];
+            }
+        }
+    }
+
+    //
+    // Sparse matrix operations
+    //
+
+    template <typename ElementType, MatrixLayout layout>
+    void CommonOperations::Multiply(ElementType s, const SparseMatrix<ElementType, layout>& A, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u)
+    {
+        if (A.NumRows() != u.Size() || A.NumColumns() != v.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
+        }
+
+        const auto& offsets = A.GetIntervalOffsets();
+        const auto& indices = A.GetIndices();
+        const auto& values = A.GetValues();
+        const ElementType* vData = v.GetDataPointer();
+        const size_t vIncrement = v.GetIncrement();
+
+        if (layout == MatrixLayout::rowMajor)
+        {
+            // each row of A is a sparse dot product with v
+            size_t workPerRow = std::max(A.NumNonzeros() / std::max(A.NumRows(), static_cast<size_t>(1)), static_cast<size_t>(1));
+            ParallelForBlocks(A.NumRows(), workPerRow, 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    ElementType sum = 0;
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                    {
+                        sum += values[k] * vData[indices[k] * vIncrement];
+                    }
+                    u[i] = t == 0 ? s * sum : s * sum + t * u[i];
+                }
+            });
+        }
+        else
+        {
+            // each column of A, scaled by an element of v, is scattered into u
+            OperationsDetail::Scale(t, u);
+            for (size_t j = 0; j < A.NumColumns(); ++j)
+            {
+                ElementType scale = s * vData[j * vIncrement];
+                if (scale == 0)
+                {
+                    continue;
+                }
+                for (size_t k = offsets[j]; k < offsets[j + 1]; ++k)
+                {
+                    u[indices[k]] += scale * values[k];
+                }
+            }
+        }
+    }
+
+    template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB, MatrixLayout layoutC>
+    void CommonOperations::Multiply(ElementType s, const SparseMatrix<ElementType, layoutA>& A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutC> C)
+    {
+        if (A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
+        }
+
+        const auto& offsets = A.GetIntervalOffsets();
+        const auto& indices = A.GetIndices();
+        const auto& values = A.GetValues();
+
+        if (layoutA == MatrixLayout::rowMajor)
+        {
+            // row i of C is a combination of the rows of B selected by the non-zeros of row i of A
+            size_t workPerRow = std::max(A.NumNonzeros() / std::max(A.NumRows(), static_cast<size_t>(1)), static_cast<size_t>(1)) * B.NumColumns();
+            ParallelForBlocks(C.NumRows(), workPerRow, 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    auto row = C.GetRow(i);
+                    OperationsDetail::Scale(t, row);
+                    for (size_t k = offsets[i]; k < offsets[i + 1]; ++k)
+                    {
+                        OperationsDetail::ScaledAdd(s * values[k], B.GetRow(indices[k]), row);
+                    }
+                }
+            });
+        }
+        else
+        {
+            // column j of A scatters row j of B into the rows of C; the threads own disjoint column blocks of C
+            const size_t columnBlockSize = 64;
+            ParallelForBlocks(C.NumColumns(), std::max(A.NumNonzeros(), static_cast<size_t>(1)), columnBlockSize, [&](size_t begin, size_t end) {
+                for (size_t i = 0; i < C.NumRows(); ++i)
+                {
+                    OperationsDetail::Scale(t, C.GetRow(i).GetSubVector(begin, end - begin));
+                }
+                for (size_t j = 0; j < A.NumColumns(); ++j)
+                {
+                    auto sourceRow = B.GetRow(j).GetSubVector(begin, end - begin);
+                    for (size_t k = offsets[j]; k < offsets[j + 1]; ++k)
+                    {
+                        OperationsDetail::ScaledAdd(s * values[k], sourceRow, C.GetRow(indices[k]).GetSubVector(begin, end - begin));
+                    }
+                }
+            });
+        }
+    }
+
     //
     // DerivedOperations
     //
@@ -44,21 +281,25 @@ namespace math
     {
         DEBUG_THROW(A.NumRows() != B.NumRows() || A.NumColumns() != B.NumColumns() || B.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns(), utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes."));
 
-        for (size_t i = 0; i < A.NumRows(); ++i)
-        {
-            DerivedClass::Add(s, A.GetRow(i), C.GetRow(i));
-            DerivedClass::Add(t, B.GetRow(i), C.GetRow(i));
-        }
+        ParallelForBlocks(A.NumRows(), 2 * A.NumColumns(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                DerivedClass::Add(s, A.GetRow(i), C.GetRow(i));
+                DerivedClass::Add(t, B.GetRow(i), C.GetRow(i));
+            }
+        });
     }
 
     template <class DerivedClass>
     template <typename ElementType, MatrixLayout layout>
     void DerivedOperations<DerivedClass>::Multiply(ElementType s, MatrixReference<ElementType, layout> M)
     {
-        for (size_t i = 0; i < M.NumIntervals(); ++i)
-        {
-            DerivedClass::Multiply(s, M.GetMajorVector(i));
-        }
+        ParallelForBlocks(M.NumIntervals(), OperationsDetail::GetIntervalSize(M), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                DerivedClass::Multiply(s, M.GetMajorVector(i));
+            }
+        });
     }
 
     template <class DerivedClass>
@@ -78,7 +319,9 @@ namespace math
         }
         else
         {
-            v.Transform([s, b](ElementType x) { return (s*x) + b; });
+            ParallelForBlocks(v.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+                v.GetSubVector(begin, end - begin).Transform([s, b](ElementType x) { return (s * x) + b; });
+            });
         }
     }
 
@@ -92,11 +335,13 @@ namespace math
         }
         else
         {
-            for (size_t i = 0; i < M.NumIntervals(); ++i)
-            {
-                auto interval = M.GetMajorVector(i);
-                MultiplyAdd(s, b, interval);
-            }
+            ParallelForBlocks(M.NumIntervals(), OperationsDetail::GetIntervalSize(M), 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    auto interval = M.GetMajorVector(i);
+                    interval.Transform([s, b](ElementType x) { return (s * x) + b; });
+                }
+            });
         }
     }
 
@@ -106,18 +351,21 @@ namespace math
     {
         DEBUG_THROW(u.Size() != v.Size() || u.Size() != t.Size(), utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible vector sizes."));
 
-        const ElementType* uData = u.GetDataPointer();
-        const ElementType* vData = v.GetDataPointer();
-
-        size_t i = 0;
-        const ElementType* end = u.GetDataPointer() + u.GetIncrement() * u.Size();
-
-        while (uData < end)
-        {
-            t[i++] = (*uData) * (*vData);
-            uData += u.GetIncrement();
-            vData += v.GetIncrement();
-        }
+        ParallelForBlocks(u.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            const ElementType* uData = u.GetDataPointer() + begin * u.GetIncrement();
+            const ElementType* vData = v.GetDataPointer() + begin * v.GetIncrement();
+            if (u.GetIncrement() == 1 && v.GetIncrement() == 1 && t.GetIncrement() == 1)
+            {
+                OperationsDetail::UnitStrideElementWiseMultiply(uData, vData, t.GetDataPointer() + begin, end - begin);
+                return;
+            }
+            for (size_t i = begin; i < end; ++i)
+            {
+                t[i] = (*uData) * (*vData);
+                uData += u.GetIncrement();
+                vData += v.GetIncrement();
+            }
+        });
     }
 
     template <class DerivedClass>
@@ -126,10 +374,12 @@ namespace math
     {
         DEBUG_THROW(A.NumRows() != B.NumRows() || A.NumColumns() != B.NumColumns() || B.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns(), utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes."));
 
-        for (size_t i = 0; i < A.NumRows(); ++i)
-        {
-            ElementWiseMultiply(A.GetRow(i), B.GetRow(i), C.GetRow(i));
-        }
+        ParallelForBlocks(A.NumRows(), A.NumColumns(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                ElementWiseMultiply(A.GetRow(i), B.GetRow(i), C.GetRow(i));
+            }
+        });
     }
 
     //
@@ -158,16 +408,23 @@ namespace math
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "vectors u and v are not the same size.");
         }
 
-        ElementType* uData = u.GetDataPointer();
-        const ElementType* vData = v.GetDataPointer();
-        const ElementType* end = u.GetDataPointer() + u.GetIncrement() * u.Size();
+        ParallelForBlocks(u.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            ElementType* uData = u.GetDataPointer() + begin * u.GetIncrement();
+            const ElementType* vData = v.GetDataPointer() + begin * v.GetIncrement();
+            const ElementType* uEnd = u.GetDataPointer() + end * u.GetIncrement();
+            if (u.GetIncrement() == 1 && v.GetIncrement() == 1)
+            {
+                OperationsDetail::UnitStrideAxpy(s, vData, uData, end - begin);
+                return;
+            }
 
-        while (uData < end)
-        {
-            (*uData) += s * (*vData);
-            uData += u.GetIncrement();
-            vData += v.GetIncrement();
-        }
+            while (uData < uEnd)
+            {
+                (*uData) += s * (*vData);
+                uData += u.GetIncrement();
+                vData += v.GetIncrement();
+            }
+        });
     }
 
     template <typename ElementType>
@@ -193,10 +450,24 @@ namespace math
         return result;
     }
 
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::native>::Norm1(UnorientedConstVectorReference<ElementType> v)
+    {
+        return v.Norm1();
+    }
+
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::native>::Norm2(UnorientedConstVectorReference<ElementType> v)
+    {
+        return v.Norm2();
+    }
+
     template <typename ElementType, VectorOrientation orientation>
     void OperationsImplementation<ImplementationType::native>::Multiply(ElementType s, VectorReference<ElementType, orientation> v)
     {
-        v *= s;
+        ParallelForBlocks(v.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            v.GetSubVector(begin, end - begin) *= s;
+        });
     }
 
     template <typename ElementType>
@@ -213,11 +484,13 @@ namespace math
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
         }
 
-        for (size_t i = 0; i < M.NumRows(); ++i)
-        {
-            auto row = M.GetRow(i);
-            u[i] = s * Dot(row, v) + t * u[i];
-        }
+        ParallelForBlocks(M.NumRows(), M.NumColumns(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto row = M.GetRow(i);
+                u[i] = s * Dot(row, v) + t * u[i];
+            }
+        });
     }
 
     template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
@@ -228,6 +501,12 @@ namespace math
             throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
         }
 
+        // float and double matrices use the blocked GEMM in NativeGemm.h
+        if (OperationsDetail::TryNativeGemm(s, A, B, t, C))
+        {
+            return;
+        }
+
         for (size_t i = 0; i < A.NumRows(); ++i)
         {
             for (size_t j = 0; j < B.NumColumns(); ++j)
@@ -239,6 +518,115 @@ namespace math
         }
     }
 
+    //
+    // SIMD implementations of operations
+    //
+
+    template <typename ElementType, MatrixLayout layout>
+    void OperationsImplementation<ImplementationType::simd>::ColumnWiseSum(ConstMatrixReference<ElementType, layout> M, VectorReference<ElementType, VectorOrientation::row> u)
+    {
+        if (u.Size() != M.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible result size.");
+        }
+
+        math::RowVector<ElementType> ones(M.NumRows());
+        ones.Fill(1.0);
+
+        DerivedOperations::Multiply(static_cast<ElementType>(1), ones, M, static_cast<ElementType>(0), u);
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    void OperationsImplementation<ImplementationType::simd>::Add(ElementType s, ConstVectorReference<ElementType, orientation> v, VectorReference<ElementType, orientation> u)
+    {
+        if (v.Size() != u.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "vectors u and v are not the same size.");
+        }
+
+        ParallelForBlocks(u.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            SimdKernels::Axpy(end - begin, s, v.GetDataPointer() + begin * v.GetIncrement(), v.GetIncrement(), u.GetDataPointer() + begin * u.GetIncrement(), u.GetIncrement());
+        });
+    }
+
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::simd>::Dot(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v)
+    {
+        if (v.Size() != u.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "vectors u and v are not the same size.");
+        }
+
+        return SimdKernels::Dot(u.Size(), u.GetDataPointer(), u.GetIncrement(), v.GetDataPointer(), v.GetIncrement());
+    }
+
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::simd>::Norm1(UnorientedConstVectorReference<ElementType> v)
+    {
+        return SimdKernels::Asum(v.Size(), v.GetDataPointer(), v.GetIncrement());
+    }
+
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::simd>::Norm2(UnorientedConstVectorReference<ElementType> v)
+    {
+        return SimdKernels::Nrm2(v.Size(), v.GetDataPointer(), v.GetIncrement());
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    void OperationsImplementation<ImplementationType::simd>::Multiply(ElementType s, VectorReference<ElementType, orientation> v)
+    {
+        ParallelForBlocks(v.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            SimdKernels::Scal(end - begin, s, v.GetDataPointer() + begin * v.GetIncrement(), v.GetIncrement());
+        });
+    }
+
+    template <typename ElementType>
+    void OperationsImplementation<ImplementationType::simd>::Multiply(ConstVectorReference<ElementType, VectorOrientation::row> u, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType& r)
+    {
+        r = Dot(u, v);
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    void OperationsImplementation<ImplementationType::simd>::Multiply(ElementType s, ConstMatrixReference<ElementType, layout> M, ConstVectorReference<ElementType, VectorOrientation::column> v, ElementType t, VectorReference<ElementType, VectorOrientation::column> u)
+    {
+        if (M.NumRows() != u.Size() || M.NumColumns() != v.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix and vectors sizes.");
+        }
+
+        // each thread computes a block of rows of u; the columns of a column-major matrix are split into long blocks
+        size_t blockSize = layout == MatrixLayout::rowMajor ? 1 : OperationsDetail::vectorBlockSize;
+        ParallelForBlocks(M.NumRows(), M.NumColumns(), blockSize, [&](size_t begin, size_t end) {
+            SimdKernels::Gemv(end - begin, M.NumColumns(), s,
+                M.GetDataPointer() + begin * OperationsDetail::GetRowIncrement(M), OperationsDetail::GetRowIncrement(M), OperationsDetail::GetColumnIncrement(M),
+                v.GetDataPointer(), v.GetIncrement(), t, u.GetDataPointer() + begin * u.GetIncrement(), u.GetIncrement());
+        });
+    }
+
+    template <typename ElementType, MatrixLayout layoutA, MatrixLayout layoutB>
+    void OperationsImplementation<ImplementationType::simd>::Multiply(ElementType s, ConstMatrixReference<ElementType, layoutA> A, ConstMatrixReference<ElementType, layoutB> B, ElementType t, MatrixReference<ElementType, layoutA> C)
+    {
+        if (A.NumColumns() != B.NumRows() || A.NumRows() != C.NumRows() || B.NumColumns() != C.NumColumns())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible matrix sizes.");
+        }
+
+        OperationsDetail::NativeGemmFloatingPoint(s, A, B, t, C);
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    void OperationsImplementation<ImplementationType::simd>::ElementWiseMultiply(UnorientedConstVectorReference<ElementType> u, UnorientedConstVectorReference<ElementType> v, VectorReference<ElementType, orientation> t)
+    {
+        if (u.Size() != v.Size() || u.Size() != t.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "Incompatible vector sizes.");
+        }
+
+        ParallelForBlocks(u.Size(), 1, OperationsDetail::vectorBlockSize, [&](size_t begin, size_t end) {
+            SimdKernels::ElementWiseMultiply(end - begin, u.GetDataPointer() + begin * u.GetIncrement(), u.GetIncrement(), v.GetDataPointer() + begin * v.GetIncrement(), v.GetIncrement(), t.GetDataPointer() + begin * t.GetIncrement(), t.GetIncrement());
+        });
+    }
+
 #ifdef USE_BLAS
     //
     // OpenBLAS wrappers
@@ -280,6 +668,18 @@ namespace math
         return Blas::Dot(static_cast<int>(u.Size()), u.GetDataPointer(), static_cast<int>(u.GetIncrement()), v.GetDataPointer(), static_cast<int>(v.GetIncrement()));
     }
 
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::openBlas>::Norm1(UnorientedConstVectorReference<ElementType> v)
+    {
+        return Blas::Asum(static_cast<int>(v.Size()), v.GetDataPointer(), static_cast<int>(v.GetIncrement()));
+    }
+
+    template <typename ElementType>
+    ElementType OperationsImplementation<ImplementationType::openBlas>::Norm2(UnorientedConstVectorReference<ElementType> v)
+    {
+        return Blas::Nrm2(static_cast<int>(v.Size()), v.GetDataPointer(), static_cast<int>(v.GetIncrement()));
+    }
+
     template <typename ElementType, VectorOrientation orientation>
     void OperationsImplementation<ImplementationType::openBlas>::Multiply(ElementType s, VectorReference<ElementType, orientation> v)
     {
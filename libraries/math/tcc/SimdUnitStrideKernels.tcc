@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SimdUnitStrideKernels.tcc (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ell
+{
+namespace math
+{
+    namespace SimdKernels
+    {
+        //
+        // The kernels process four registers per iteration, with independent accumulators in the reductions,
+        // followed by single registers and then by single elements. They only use the operations of the
+        // instruction set wrapper and built-in arithmetic, see SimdUnitStrideKernels.h.
+        //
+
+        namespace UnitStrideKernelsDetail
+        {
+            template <typename InstructionSetType>
+            typename InstructionSetType::ElementType Sum(typename InstructionSetType::Register a)
+            {
+                using ElementType = typename InstructionSetType::ElementType;
+                ElementType elements[InstructionSetType::registerSize];
+                InstructionSetType::Store(elements, a);
+                ElementType result = 0;
+                for (auto element : elements)
+                {
+                    result += element;
+                }
+                return result;
+            }
+
+            template <typename InstructionSetType>
+            typename InstructionSetType::ElementType Dot(size_t n, const typename InstructionSetType::ElementType* x, const typename InstructionSetType::ElementType* y)
+            {
+                using I = InstructionSetType;
+                const size_t w = I::registerSize;
+                auto s0 = I::Set1(0);
+                auto s1 = s0;
+                auto s2 = s0;
+                auto s3 = s0;
+                size_t i = 0;
+                for (; i + 4 * w <= n; i += 4 * w)
+                {
+                    s0 = I::MulAdd(I::Load(x + i), I::Load(y + i), s0);
+                    s1 = I::MulAdd(I::Load(x + i + w), I::Load(y + i + w), s1);
+                    s2 = I::MulAdd(I::Load(x + i + 2 * w), I::Load(y + i + 2 * w), s2);
+                    s3 = I::MulAdd(I::Load(x + i + 3 * w), I::Load(y + i + 3 * w), s3);
+                }
+                for (; i + w <= n; i += w)
+                {
+                    s0 = I::MulAdd(I::Load(x + i), I::Load(y + i), s0);
+                }
+                auto result = Sum<I>(I::Add(I::Add(s0, s1), I::Add(s2, s3)));
+                for (; i < n; ++i)
+                {
+                    result += x[i] * y[i];
+                }
+                return result;
+            }
+
+            template <typename InstructionSetType>
+            void Axpy(size_t n, typename InstructionSetType::ElementType alpha, const typename InstructionSetType::ElementType* x, typename InstructionSetType::ElementType* y)
+            {
+                using I = InstructionSetType;
+                const size_t w = I::registerSize;
+                auto a = I::Set1(alpha);
+                size_t i = 0;
+                for (; i + 4 * w <= n; i += 4 * w)
+                {
+                    I::Store(y + i, I::MulAdd(a, I::Load(x + i), I::Load(y + i)));
+                    I::Store(y + i + w, I::MulAdd(a, I::Load(x + i + w), I::Load(y + i + w)));
+                    I::Store(y + i + 2 * w, I::MulAdd(a, I::Load(x + i + 2 * w), I::Load(y + i + 2 * w)));
+                    I::Store(y + i + 3 * w, I::MulAdd(a, I::Load(x + i + 3 * w), I::Load(y + i + 3 * w)));
+                }
+                for (; i + w <= n; i += w)
+                {
+                    I::Store(y + i, I::MulAdd(a, I::Load(x + i), I::Load(y + i)));
+                }
+                for (; i < n; ++i)
+                {
+                    y[i] += alpha * x[i];
+                }
+            }
+
+            template <typename InstructionSetType>
+            void Scal(size_t n, typename InstructionSetType::ElementType alpha, typename InstructionSetType::ElementType* x)
+            {
+                using I = InstructionSetType;
+                const size_t w = I::registerSize;
+                auto a = I::Set1(alpha);
+                size_t i = 0;
+                for (; i + w <= n; i += w)
+                {
+                    I::Store(x + i, I::Mul(a, I::Load(x + i)));
+                }
+                for (; i < n; ++i)
+                {
+                    x[i] *= alpha;
+                }
+            }
+
+            template <typename InstructionSetType>
+            typename InstructionSetType::ElementType Asum(size_t n, const typename InstructionSetType::ElementType* x)
+            {
+                using I = InstructionSetType;
+                const size_t w = I::registerSize;
+                auto s0 = I::Set1(0);
+                auto s1 = s0;
+                auto s2 = s0;
+                auto s3 = s0;
+                size_t i = 0;
+                for (; i + 4 * w <= n; i += 4 * w)
+                {
+                    s0 = I::Add(I::Abs(I::Load(x + i)), s0);
+                    s1 = I::Add(I::Abs(I::Load(x + i + w)), s1);
+                    s2 = I::Add(I::Abs(I::Load(x + i + 2 * w)), s2);
+                    s3 = I::Add(I::Abs(I::Load(x + i + 3 * w)), s3);
+                }
+                for (; i + w <= n; i += w)
+                {
+                    s0 = I::Add(I::Abs(I::Load(x + i)), s0);
+                }
+                auto result = Sum<I>(I::Add(I::Add(s0, s1), I::Add(s2, s3)));
+                for (; i < n; ++i)
+                {
+                    result += x[i] < 0 ? -x[i] : x[i];
+                }
+                return result;
+            }
+
+            template <typename InstructionSetType>
+            typename InstructionSetType::ElementType SumOfSquares(size_t n, const typename InstructionSetType::ElementType* x)
+            {
+                return Dot<InstructionSetType>(n, x, x);
+            }
+
+            template <typename InstructionSetType>
+            void Multiply(size_t n, const typename InstructionSetType::ElementType* x, const typename InstructionSetType::ElementType* y, typename InstructionSetType::ElementType* z)
+            {
+                using I = InstructionSetType;
+                const size_t w = I::registerSize;
+                size_t i = 0;
+                for (; i + w <= n; i += w)
+                {
+                    I::Store(z + i, I::Mul(I::Load(x + i), I::Load(y + i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = x[i] * y[i];
+                }
+            }
+        }
+
+        template <typename InstructionSetType>
+        UnitStrideKernels<typename InstructionSetType::ElementType> MakeUnitStrideKernels()
+        {
+            using namespace UnitStrideKernelsDetail;
+            return { Dot<InstructionSetType>, Axpy<InstructionSetType>, Scal<InstructionSetType>, Asum<InstructionSetType>, SumOfSquares<InstructionSetType>, Multiply<InstructionSetType> };
+        }
+    }
+}
+}
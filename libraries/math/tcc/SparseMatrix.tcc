@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix.tcc (math)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Debug.h"
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <utility>
+
+namespace ell
+{
+namespace math
+{
+    template <typename ElementType, MatrixLayout layout>
+    SparseMatrix<ElementType, layout>::SparseMatrix()
+        : SparseMatrix(0, 0)
+    {
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    SparseMatrix<ElementType, layout>::SparseMatrix(size_t numRows, size_t numColumns)
+        : _numRows(numRows), _numColumns(numColumns), _intervalOffsets((layout == MatrixLayout::rowMajor ? numRows : numColumns) + 1, 0)
+    {
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    SparseMatrix<ElementType, layout>::SparseMatrix(size_t numRows, size_t numColumns, std::vector<size_t> intervalOffsets, std::vector<size_t> indices, std::vector<ElementType> values)
+        : _numRows(numRows), _numColumns(numColumns), _intervalOffsets(std::move(intervalOffsets)), _indices(std::move(indices)), _values(std::move(values))
+    {
+        Validate();
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    template <MatrixLayout denseLayout>
+    SparseMatrix<ElementType, layout>::SparseMatrix(ConstMatrixReference<ElementType, denseLayout> M)
+        : _numRows(M.NumRows()), _numColumns(M.NumColumns())
+    {
+        size_t numIntervals = layout == MatrixLayout::rowMajor ? _numRows : _numColumns;
+        size_t intervalSize = GetIntervalSize();
+        _intervalOffsets.reserve(numIntervals + 1);
+        _intervalOffsets.push_back(0);
+        for (size_t i = 0; i < numIntervals; ++i)
+        {
+            for (size_t j = 0; j < intervalSize; ++j)
+            {
+                auto value = layout == MatrixLayout::rowMajor ? M(i, j) : M(j, i);
+                if (value != 0)
+                {
+                    _indices.push_back(j);
+                    _values.push_back(value);
+                }
+            }
+            _intervalOffsets.push_back(_values.size());
+        }
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    ElementType SparseMatrix<ElementType, layout>::operator()(size_t row, size_t column) const
+    {
+        DEBUG_THROW(row >= _numRows || column >= _numColumns, utilities::InputException(utilities::InputExceptionErrors::indexOutOfRange, "index exceeds matrix dimensions."));
+
+        size_t interval = layout == MatrixLayout::rowMajor ? row : column;
+        size_t index = layout == MatrixLayout::rowMajor ? column : row;
+        auto begin = _indices.begin() + _intervalOffsets[interval];
+        auto end = _indices.begin() + _intervalOffsets[interval + 1];
+        auto iter = std::lower_bound(begin, end, index);
+        if (iter == end || *iter != index)
+        {
+            return 0;
+        }
+        return _values[iter - _indices.begin()];
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    SparseMatrix<ElementType, TransposeMatrixLayout<layout>::value> SparseMatrix<ElementType, layout>::Transpose() const
+    {
+        return SparseMatrix<ElementType, TransposeMatrixLayout<layout>::value>(_numColumns, _numRows, _intervalOffsets, _indices, _values);
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    Matrix<ElementType, layout> SparseMatrix<ElementType, layout>::ToDense() const
+    {
+        Matrix<ElementType, layout> result(_numRows, _numColumns);
+        for (size_t i = 0; i < NumIntervals(); ++i)
+        {
+            auto interval = result.GetMajorVector(i);
+            for (size_t k = _intervalOffsets[i]; k < _intervalOffsets[i + 1]; ++k)
+            {
+                interval[_indices[k]] = _values[k];
+            }
+        }
+        return result;
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    bool SparseMatrix<ElementType, layout>::operator==(const SparseMatrix<ElementType, layout>& other) const
+    {
+        return _numRows == other._numRows && _numColumns == other._numColumns && _intervalOffsets == other._intervalOffsets && _indices == other._indices && _values == other._values;
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    void SparseMatrix<ElementType, layout>::Swap(SparseMatrix<ElementType, layout>& other)
+    {
+        std::swap(_numRows, other._numRows);
+        std::swap(_numColumns, other._numColumns);
+        std::swap(_intervalOffsets, other._intervalOffsets);
+        std::swap(_indices, other._indices);
+        std::swap(_values, other._values);
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    void SparseMatrix<ElementType, layout>::Validate() const
+    {
+        size_t numIntervals = layout == MatrixLayout::rowMajor ? _numRows : _numColumns;
+        if (_intervalOffsets.size() != numIntervals + 1 || _intervalOffsets.front() != 0 || _intervalOffsets.back() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "interval offsets do not match the matrix size and the number of values.");
+        }
+        if (_indices.size() != _values.size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "the number of indices and values differ.");
+        }
+
+        size_t intervalSize = GetIntervalSize();
+        for (size_t i = 0; i < numIntervals; ++i)
+        {
+            if (_intervalOffsets[i] > _intervalOffsets[i + 1])
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "interval offsets must be non-decreasing.");
+            }
+            for (size_t k = _intervalOffsets[i]; k < _intervalOffsets[i + 1]; ++k)
+            {
+                if (_indices[k] >= intervalSize || (k > _intervalOffsets[i] && _indices[k] <= _indices[k - 1]))
+                {
+                    throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "indices must be in range and strictly increasing within each interval.");
+                }
+            }
+        }
+    }
+
+    //
+    // SparseMatrixArchiver
+    //
+
+    template <typename ElementType, MatrixLayout layout>
+    void SparseMatrixArchiver::Write(const SparseMatrix<ElementType, layout>& matrix, const std::string& name, utilities::Archiver& archiver)
+    {
+        archiver[GetRowsName(name)] << matrix.NumRows();
+        archiver[GetColumnsName(name)] << matrix.NumColumns();
+        archiver[GetIntervalOffsetsName(name)] << matrix.GetIntervalOffsets();
+        archiver[GetIndicesName(name)] << matrix.GetIndices();
+        archiver[GetValuesName(name)] << matrix.GetValues();
+    }
+
+    template <typename ElementType, MatrixLayout layout>
+    void SparseMatrixArchiver::Read(SparseMatrix<ElementType, layout>& matrix, const std::string& name, utilities::Unarchiver& archiver)
+    {
+        size_t rows = 0;
+        size_t columns = 0;
+        std::vector<size_t> intervalOffsets;
+        std::vector<size_t> indices;
+        std::vector<ElementType> values;
+
+        archiver[GetRowsName(name)] >> rows;
+        archiver[GetColumnsName(name)] >> columns;
+        archiver[GetIntervalOffsetsName(name)] >> intervalOffsets;
+        archiver[GetIndicesName(name)] >> indices;
+        archiver[GetValuesName(name)] >> values;
+
+        SparseMatrix<ElementType, layout> value(rows, columns, std::move(intervalOffsets), std::move(indices), std::move(values));
+        matrix.Swap(value);
+    }
+}
+}
@@ -229,7 +229,23 @@ namespace math
     template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
     std::vector<ElementType> ConstTensorReference<ElementType, dimension0, dimension1, dimension2>::ToArray() const
     {
-        return { _contents.pData, _contents.pData + Size() };
+        if (_contents.layout[0] == _contents.increments[0] && _contents.layout[0] * _contents.layout[1] == _contents.increments[1])
+        {
+            return { _contents.pData, _contents.pData + Size() };
+        }
+
+        // copy in memory order, skipping the padding and the elements outside of a subtensor
+        std::vector<ElementType> result;
+        result.reserve(Size());
+        for (size_t i = 0; i < _contents.layout[2]; ++i)
+        {
+            for (size_t j = 0; j < _contents.layout[1]; ++j)
+            {
+                auto begin = _contents.pData + i * _contents.increments[1] + j * _contents.increments[0];
+                result.insert(result.end(), begin, begin + _contents.layout[0]);
+            }
+        }
+        return result;
     }
 
     template <typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
@@ -498,15 +514,25 @@ namespace math
         _contents.pData = _data.data();
     }
 
+    template<typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
+    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, Padding padding)
+        : TensorRef(Triplet{ numRows, numColumns, numChannels })
+    {
+        _contents.increments[0] = GetPaddedIncrement<ElementType>(_contents.layout[0], padding);
+        _contents.increments[1] = _contents.increments[0] * _contents.layout[1];
+        _data.resize(_contents.increments[1] * _contents.layout[2]);
+        _contents.pData = _data.data();
+    }
+
     template<typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
     Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, const std::vector<ElementType>& data)
-        : TensorRef(Triplet{ numRows, numColumns, numChannels }), _data(data)
+        : TensorRef(Triplet{ numRows, numColumns, numChannels }), _data(data.begin(), data.end())
     {
         _contents.pData = _data.data();
     }
 
     template<typename ElementType, Dimension dimension0, Dimension dimension1, Dimension dimension2>
-    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, std::vector<ElementType>&& data)
+    Tensor<ElementType, dimension0, dimension1, dimension2>::Tensor(size_t numRows, size_t numColumns, size_t numChannels, AlignedVector<ElementType>&& data)
         : TensorRef(Triplet{ numRows, numColumns, numChannels }), _data(std::move(data))
     {
         _contents.pData = _data.data();
@@ -610,7 +636,7 @@ namespace math
         archiver[GetChannelsName(name)] >> channels;
         archiver[GetValuesName(name)] >> values;
 
-        Tensor<ElementType, dimension0, dimension1, dimension2> value(rows, columns, channels, std::move(values));
+        Tensor<ElementType, dimension0, dimension1, dimension2> value(rows, columns, channels, values);
 
         tensor = std::move(value);
     }
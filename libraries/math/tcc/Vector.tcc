@@ -228,6 +228,50 @@ namespace math
         return TransformVector(vector, [](ElementType x) { return std::abs(x); });
     }
 
+    //
+    // Vector expressions
+    //
+
+    template <typename ElementType, VectorOrientation orientation, typename OperandType>
+    ScaledVectorExpression<ElementType, orientation, OperandType>::ScaledVectorExpression(ElementType scalar, OperandType operand)
+        : _scalar(scalar), _operand(std::move(operand))
+    {
+    }
+
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType, typename OperationType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, OperationType>::BinaryVectorExpression(LeftType left, RightType right, OperationType operation)
+        : _left(std::move(left)), _right(std::move(right)), _operation(std::move(operation))
+    {
+        if (_left.Size() != _right.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "vector expression operands are not the same size.");
+        }
+    }
+
+    template <typename ElementType, VectorOrientation orientation, typename ExpressionType, typename>
+    ScaledVectorExpression<ElementType, orientation, ExpressionType> operator*(double scalar, const VectorExpression<ElementType, orientation, ExpressionType>& expression)
+    {
+        return ScaledVectorExpression<ElementType, orientation, ExpressionType>(static_cast<ElementType>(scalar), expression.GetExpression());
+    }
+
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::plus<ElementType>> operator+(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right)
+    {
+        return BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::plus<ElementType>>(left.GetExpression(), right.GetExpression(), std::plus<ElementType>());
+    }
+
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::minus<ElementType>> operator-(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right)
+    {
+        return BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::minus<ElementType>>(left.GetExpression(), right.GetExpression(), std::minus<ElementType>());
+    }
+
+    template <typename ElementType, VectorOrientation orientation, typename LeftType, typename RightType>
+    BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::multiplies<ElementType>> ElementWiseProduct(const VectorExpression<ElementType, orientation, LeftType>& left, const VectorExpression<ElementType, orientation, RightType>& right)
+    {
+        return BinaryVectorExpression<ElementType, orientation, LeftType, RightType, std::multiplies<ElementType>>(left.GetExpression(), right.GetExpression(), std::multiplies<ElementType>());
+    }
+
     //
     // VectorReference
     // 
@@ -436,6 +480,53 @@ namespace math
         }
     }
 
+    template <typename ElementType, VectorOrientation orientation>
+    template <typename ExpressionType>
+    void VectorReference<ElementType, orientation>::CopyFrom(const VectorExpression<ElementType, orientation, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x = y; });
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    template <typename ExpressionType>
+    void VectorReference<ElementType, orientation>::operator+=(const VectorExpression<ElementType, orientation, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x += y; });
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    template <typename ExpressionType>
+    void VectorReference<ElementType, orientation>::operator-=(const VectorExpression<ElementType, orientation, ExpressionType>& expression)
+    {
+        EvaluateExpression(expression.GetExpression(), [](ElementType& x, ElementType y) { x -= y; });
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    template <typename ExpressionType, typename AssignmentType>
+    void VectorReference<ElementType, orientation>::EvaluateExpression(const ExpressionType& expression, AssignmentType assignment)
+    {
+        if (_size != expression.Size())
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "this vector and the vector expression are not the same size.");
+        }
+
+        // when everything is contiguous, the loop has unit strides and the compiler vectorizes it
+        if (_increment == 1 && expression.IsContiguous())
+        {
+            for (size_t i = 0; i < _size; ++i)
+            {
+                assignment(_pData[i], expression.template GetElement<true>(i));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < _size; ++i)
+            {
+                assignment(_pData[i * _increment], expression.template GetElement<false>(i));
+            }
+        }
+    }
+
     template <typename ElementType, VectorOrientation orientation>
     void VectorReference<ElementType, orientation>::operator+=(ElementType value)
     {
@@ -476,7 +567,14 @@ namespace math
     }
 
     template <typename ElementType, VectorOrientation orientation>
-    Vector<ElementType, orientation>::Vector(std::vector<ElementType> data)
+    Vector<ElementType, orientation>::Vector(const std::vector<ElementType>& data)
+        : VectorReference<ElementType, orientation>(nullptr, data.size(), 1), _data(data.begin(), data.end())
+    {
+        _pData = _data.data();
+    }
+
+    template <typename ElementType, VectorOrientation orientation>
+    Vector<ElementType, orientation>::Vector(AlignedVector<ElementType>&& data)
         : VectorReference<ElementType, orientation>(nullptr, data.size(), 1), _data(std::move(data))
     {
         _pData = _data.data();
@@ -538,7 +636,7 @@ namespace math
 
         archiver[name] >> values;
 
-        Vector<ElementType, orientation> value(std::move(values));
+        Vector<ElementType, orientation> value(values);
 
         vector.Swap(value);
     }
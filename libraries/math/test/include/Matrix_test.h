@@ -8,6 +8,9 @@
 #pragma once
 
 #include "Matrix.h"
+#include "NativeGemm.h"
+#include "Operations.h"
+#include "Parallel.h"
 
 using namespace ell;
 
@@ -41,4 +44,22 @@ void TestMatrixMatrixAdd();
 template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB, math::ImplementationType Implementation>
 void TestMatrixMatrixMultiply();
 
+template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB>
+void TestNativeGemm();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSimdKernels();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestParallelOperations();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestPaddedMatrix();
+
+template <typename ElementType>
+void TestMatrixAssignment();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixExpressions();
+
 #include "../tcc/Matrix_test.tcc"
\ No newline at end of file
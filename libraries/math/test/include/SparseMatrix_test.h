@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix_test.h (math_test)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "Operations.h"
+#include "Parallel.h"
+#include "SparseMatrix.h"
+
+using namespace ell;
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSparseMatrix();
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSparseMatrixArchiver();
+
+template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB>
+void TestSparseMatrixOperations();
+
+#include "../tcc/SparseMatrix_test.tcc"
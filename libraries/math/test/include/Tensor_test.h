@@ -42,5 +42,8 @@ void TestTensorVectorMultiplyAdd();
 template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
 void TestTensorArchiver();
 
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestPaddedTensor();
+
 
 #include "../tcc/Tensor_test.tcc"
@@ -33,4 +33,10 @@ void TestTransformedVectors();
 template<typename ElementType>
 void TestVectorArchiver();
 
+template<typename ElementType>
+void TestVectorAlignment();
+
+template <typename ElementType>
+void TestVectorExpressions();
+
 #include "../tcc/Vector_test.tcc"
\ No newline at end of file
@@ -8,6 +8,7 @@
 
 #include "Vector_test.h"
 #include "Matrix_test.h"
+#include "SparseMatrix_test.h"
 #include "Tensor_test.h"
 
 using namespace ell;
@@ -27,6 +28,8 @@ int main()
     TestVectorOperations<double, math::ImplementationType::native>();
     TestVectorOperations<float, math::ImplementationType::openBlas>();
     TestVectorOperations<double, math::ImplementationType::openBlas>();
+    TestVectorOperations<float, math::ImplementationType::simd>();
+    TestVectorOperations<double, math::ImplementationType::simd>();
 
     TestElementWiseOperations<double>();
     TestElementWiseOperations<float>();
@@ -40,6 +43,12 @@ int main()
     TestTransformedVectors<double>();
     TestTransformedVectors<float>();
 
+    TestVectorAlignment<double>();
+    TestVectorAlignment<float>();
+
+    TestVectorExpressions<double>();
+    TestVectorExpressions<float>();
+
     TestElementwiseTransform<double>();
     TestElementwiseTransform<float>();
 
@@ -89,6 +98,10 @@ int main()
     TestMatrixOperations<float, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
     TestMatrixOperations<double, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
     TestMatrixOperations<double, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
+    TestMatrixOperations<float, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestMatrixOperations<float, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
+    TestMatrixOperations<double, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestMatrixOperations<double, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
 
     TestContiguousMatrixOperations<float, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
     TestContiguousMatrixOperations<float, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
@@ -98,6 +111,10 @@ int main()
     TestContiguousMatrixOperations<float, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
     TestContiguousMatrixOperations<double, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
     TestContiguousMatrixOperations<double, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
+    TestContiguousMatrixOperations<float, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestContiguousMatrixOperations<float, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
+    TestContiguousMatrixOperations<double, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestContiguousMatrixOperations<double, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
 
     TestConstMatrixReference<float, math::MatrixLayout::rowMajor>();
     TestConstMatrixReference<float, math::MatrixLayout::rowMajor>();
@@ -108,6 +125,8 @@ int main()
     TestMatrixMatrixAdd<float, math::ImplementationType::openBlas>();
     TestMatrixMatrixAdd<double, math::ImplementationType::native>();
     TestMatrixMatrixAdd<double, math::ImplementationType::openBlas>();
+    TestMatrixMatrixAdd<float, math::ImplementationType::simd>();
+    TestMatrixMatrixAdd<double, math::ImplementationType::simd>();
 
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::native>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::native>();
@@ -117,6 +136,47 @@ int main()
     TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::openBlas>();
     TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::openBlas>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor, math::ImplementationType::simd>();
+    TestMatrixMatrixMultiply<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor, math::ImplementationType::simd>();
+
+    TestNativeGemm<float, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor>();
+    TestNativeGemm<float, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor>();
+    TestNativeGemm<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor>();
+    TestNativeGemm<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor>();
+
+    TestSimdKernels<float, math::MatrixLayout::rowMajor>();
+    TestSimdKernels<float, math::MatrixLayout::columnMajor>();
+    TestSimdKernels<double, math::MatrixLayout::rowMajor>();
+    TestSimdKernels<double, math::MatrixLayout::columnMajor>();
+
+    TestParallelOperations<float, math::MatrixLayout::rowMajor>();
+    TestParallelOperations<double, math::MatrixLayout::columnMajor>();
+
+    TestPaddedMatrix<float, math::MatrixLayout::rowMajor>();
+    TestPaddedMatrix<double, math::MatrixLayout::columnMajor>();
+
+    TestMatrixAssignment<float>();
+    TestMatrixAssignment<double>();
+
+    TestMatrixExpressions<float, math::MatrixLayout::rowMajor>();
+    TestMatrixExpressions<double, math::MatrixLayout::columnMajor>();
+
+    //
+    // SparseMatrix tests
+    //
+
+    TestSparseMatrix<float, math::MatrixLayout::rowMajor>();
+    TestSparseMatrix<double, math::MatrixLayout::columnMajor>();
+
+    TestSparseMatrixArchiver<float, math::MatrixLayout::columnMajor>();
+    TestSparseMatrixArchiver<double, math::MatrixLayout::rowMajor>();
+
+    TestSparseMatrixOperations<float, math::MatrixLayout::rowMajor, math::MatrixLayout::rowMajor>();
+    TestSparseMatrixOperations<float, math::MatrixLayout::columnMajor, math::MatrixLayout::rowMajor>();
+    TestSparseMatrixOperations<double, math::MatrixLayout::rowMajor, math::MatrixLayout::columnMajor>();
+    TestSparseMatrixOperations<double, math::MatrixLayout::columnMajor, math::MatrixLayout::columnMajor>();
 
     //
     // Tensor tests
@@ -169,6 +229,9 @@ int main()
     TestTensorArchiver<float, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
     TestTensorArchiver<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
 
+    TestPaddedTensor<double, math::Dimension::column, math::Dimension::row, math::Dimension::channel>();
+    TestPaddedTensor<float, math::Dimension::channel, math::Dimension::column, math::Dimension::row>();
+
     if (testing::DidTestFail())
     {
         return 1;
@@ -8,6 +8,12 @@
 
 #include "Matrix.h"
 
+// stl
+#include <cmath>
+#include <limits>
+#include <random>
+#include <tuple>
+
 template <typename ElementType, math::MatrixLayout layout>
 void TestMatrix1()
 {
@@ -480,3 +486,309 @@ void TestMatrixMatrixMultiply()
 
     testing::ProcessTest(implementationName + "Operations::Multiply(Matrix, Matrix)", C == R);
 }
+
+template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB>
+void TestNativeGemm()
+{
+    std::default_random_engine rng(1234);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    auto fill = [&](auto& M) { M.Generate([&]() { return static_cast<ElementType>(distribution(rng)); }); };
+
+    // sizes that exercise the unpacked path, partial tiles, and several blocks along each dimension
+    const std::vector<std::vector<size_t>> sizes = { { 1, 1, 1 }, { 7, 5, 3 }, { 17, 13, 29 }, { 65, 33, 300 }, { 250, 130, 520 } };
+    const ElementType alpha = static_cast<ElementType>(1.5);
+    const ElementType beta = static_cast<ElementType>(-0.5);
+    const ElementType tolerance = static_cast<ElementType>(std::is_same<ElementType, float>::value ? 1.0e-3 : 1.0e-10);
+
+    auto originalInstructionSet = math::NativeGemm::GetInstructionSet();
+    for (auto instructionSet : { math::InstructionSet::generic, math::InstructionSet::sse, math::InstructionSet::avx2, math::InstructionSet::avx512 })
+    {
+        if (!math::IsInstructionSetSupported(instructionSet))
+        {
+            continue;
+        }
+        math::NativeGemm::SetInstructionSet(instructionSet);
+
+        bool success = true;
+        for (const auto& size : sizes)
+        {
+            size_t m = size[0];
+            size_t n = size[1];
+            size_t k = size[2];
+            math::Matrix<ElementType, layoutA> A(m, k);
+            math::Matrix<ElementType, layoutB> B(k, n);
+            fill(A);
+            fill(B);
+
+            // C is a submatrix, so its increment differs from its size
+            math::Matrix<ElementType, layoutA> D(m + 3, n + 3);
+            fill(D);
+            auto C = D.GetSubMatrix(1, 2, m, n);
+
+            math::Matrix<ElementType, layoutA> R(m, n);
+            for (size_t i = 0; i < m; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    double sum = 0;
+                    for (size_t p = 0; p < k; ++p)
+                    {
+                        sum += static_cast<double>(A(i, p)) * static_cast<double>(B(p, j));
+                    }
+                    R(i, j) = static_cast<ElementType>(alpha * sum + beta * static_cast<double>(C(i, j)));
+                }
+            }
+
+            math::OperationsImplementation<math::ImplementationType::native>::Multiply(alpha, A, B, beta, C);
+            success = success && C.IsEqual(R, tolerance);
+        }
+        testing::ProcessTest("NativeGemm::Gemm with " + math::GetInstructionSetName(instructionSet) + " microkernel", success);
+    }
+    math::NativeGemm::SetInstructionSet(originalInstructionSet);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSimdKernels()
+{
+    using Ops = math::OperationsImplementation<math::ImplementationType::simd>;
+
+    std::default_random_engine rng(1234);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    auto fill = [&](auto& M) { M.Generate([&]() { return static_cast<ElementType>(distribution(rng)); }); };
+    auto isClose = [](double a, double b) { return std::abs(a - b) <= (std::is_same<ElementType, float>::value ? 1.0e-4 : 1.0e-12) * (1 + std::abs(b)); };
+
+    // sizes that exercise the unrolled loop, the single-register loop and the scalar tail
+    const std::vector<size_t> sizes = { 0, 1, 3, 17, 64, 1000, 4099 };
+
+    auto originalInstructionSet = math::SimdKernels::GetInstructionSet();
+    for (auto instructionSet : { math::InstructionSet::generic, math::InstructionSet::sse, math::InstructionSet::avx2, math::InstructionSet::avx512 })
+    {
+        if (!math::IsInstructionSetSupported(instructionSet))
+        {
+            continue;
+        }
+        math::SimdKernels::SetInstructionSet(instructionSet);
+
+        bool success = true;
+        for (auto size : sizes)
+        {
+            // the vectors are rows of a matrix: unit stride in the row-major layout, strided in the column-major layout
+            math::Matrix<ElementType, layout> X(3, size);
+            fill(X);
+            auto x = X.GetRow(0);
+            auto y = X.GetRow(1);
+
+            double dot = 0;
+            double norm1 = 0;
+            double norm2 = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                dot += static_cast<double>(x[i]) * y[i];
+                norm1 += std::abs(static_cast<double>(x[i]));
+                norm2 += static_cast<double>(x[i]) * x[i];
+            }
+            success = success && isClose(Ops::Dot(x, y), dot) && isClose(Ops::Norm1(x), norm1) && isClose(Ops::Norm2(x), std::sqrt(norm2));
+
+            math::RowVector<ElementType> expected(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                expected[i] = y[i] + static_cast<ElementType>(0.5) * x[i];
+            }
+            Ops::Add(static_cast<ElementType>(0.5), x, y);
+            success = success && y.IsEqual(expected, static_cast<ElementType>(1.0e-6));
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                expected[i] = x[i] * y[i];
+            }
+            Ops::ElementWiseMultiply(x, y, X.GetRow(2));
+            success = success && X.GetRow(2) == expected;
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                expected[i] = 3 * x[i];
+            }
+            Ops::Multiply(static_cast<ElementType>(3), x);
+            success = success && x.IsEqual(expected, static_cast<ElementType>(1.0e-6));
+
+            // matrix-vector products with a submatrix, so the increment differs from the size
+            math::Matrix<ElementType, layout> P(size + 2, 37);
+            fill(P);
+            auto M = P.GetSubMatrix(1, 2, size, 33);
+            math::ColumnVector<ElementType> v(33);
+            fill(v);
+            math::ColumnVector<ElementType> u(size);
+            u.Fill(std::numeric_limits<ElementType>::quiet_NaN());
+            Ops::Multiply(static_cast<ElementType>(2), M, v, static_cast<ElementType>(0), u);
+            bool gemvSuccess = true;
+            for (size_t i = 0; i < size; ++i)
+            {
+                double sum = 0;
+                for (size_t j = 0; j < 33; ++j)
+                {
+                    sum += static_cast<double>(M(i, j)) * v[j];
+                }
+                gemvSuccess = gemvSuccess && isClose(u[i], 2 * sum);
+            }
+            success = success && gemvSuccess;
+        }
+
+        // the 2-norm does not overflow or underflow when the squares of the elements do
+        math::ColumnVector<ElementType> large{ std::numeric_limits<ElementType>::max() / 2, std::numeric_limits<ElementType>::max() / 2 };
+        math::ColumnVector<ElementType> small{ std::numeric_limits<ElementType>::min(), std::numeric_limits<ElementType>::min() };
+        success = success && isClose(Ops::Norm2(large) / std::numeric_limits<ElementType>::max(), std::sqrt(0.5)) && isClose(Ops::Norm2(small) / std::numeric_limits<ElementType>::min(), std::sqrt(2.0));
+
+        testing::ProcessTest("SimdKernels with " + math::GetInstructionSetName(instructionSet) + " kernels, " + (layout == math::MatrixLayout::rowMajor ? "unit stride" : "strided"), success);
+    }
+    math::SimdKernels::SetInstructionSet(originalInstructionSet);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestParallelOperations()
+{
+    using Ops = math::OperationsImplementation<math::ImplementationType::native>;
+    std::default_random_engine rng(4321);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    auto generator = [&]() { return static_cast<ElementType>(distribution(rng)); };
+
+    math::Matrix<ElementType, layout> A(97, 61);
+    math::Matrix<ElementType, layout> B(61, 83);
+    math::ColumnVector<ElementType> x(61);
+    math::ColumnVector<ElementType> y(5000);
+    A.Generate(generator);
+    B.Generate(generator);
+    x.Generate(generator);
+    y.Generate(generator);
+
+    // computes a set of operations and returns their results
+    auto compute = [&]() {
+        math::Matrix<ElementType, layout> C(97, 83);
+        Ops::Multiply(static_cast<ElementType>(2), A, B, static_cast<ElementType>(0), C);
+        Ops::Multiply(static_cast<ElementType>(0.5), C);
+
+        math::ColumnVector<ElementType> u(97);
+        Ops::Multiply(static_cast<ElementType>(1), A, x, static_cast<ElementType>(0), u);
+
+        math::ColumnVector<ElementType> v(y.Size());
+        v.Fill(1);
+        Ops::Add(static_cast<ElementType>(3), y, v);
+        math::ColumnVector<ElementType> w(y.Size());
+        Ops::ElementWiseMultiply(v, y, w);
+        return std::make_tuple(C, u, w);
+    };
+
+    auto originalNumThreads = math::GetNumThreads();
+    auto originalThreshold = math::GetParallelThreshold();
+
+    math::SetNumThreads(1);
+    auto serialResult = compute();
+
+    // with a threshold of zero, every operation is split between the threads
+    math::SetNumThreads(4);
+    math::SetParallelThreshold(0);
+    auto parallelResult = compute();
+
+    math::SetNumThreads(originalNumThreads);
+    math::SetParallelThreshold(originalThreshold);
+
+    // each thread computes a disjoint part of the result in the same order, so the results are identical
+    testing::ProcessTest("Parallel matrix-matrix multiply", std::get<0>(serialResult) == std::get<0>(parallelResult));
+    testing::ProcessTest("Parallel matrix-vector multiply", std::get<1>(serialResult) == std::get<1>(parallelResult));
+    testing::ProcessTest("Parallel vector operations", std::get<2>(serialResult) == std::get<2>(parallelResult));
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestPaddedMatrix()
+{
+    math::Matrix<ElementType, layout> M{
+        { 1, 2, 3, 4, 5 },
+        { 6, 7, 8, 9, 10 },
+        { 11, 12, 13, 14, 15 }
+    };
+    math::Matrix<ElementType, layout> P(3, 5, math::Padding::aligned);
+    P.CopyFrom(M);
+
+    bool aligned = true;
+    for (size_t i = 0; i < P.NumIntervals(); ++i)
+    {
+        aligned = aligned && math::IsAligned(P.GetMajorVector(i).GetDataPointer());
+    }
+    testing::ProcessTest("Padded matrix intervals are aligned", aligned && !P.IsContiguous());
+    testing::ProcessTest("Padded matrix equals dense matrix", P == M && P.ToArray() == M.ToArray());
+
+    math::Matrix<ElementType, layout> C(3, 3);
+    math::Matrix<ElementType, layout> R(3, 3);
+    math::OperationsImplementation<math::ImplementationType::native>::Multiply(static_cast<ElementType>(1), P, P.Transpose(), static_cast<ElementType>(0), C);
+    math::OperationsImplementation<math::ImplementationType::native>::Multiply(static_cast<ElementType>(1), M, M.Transpose(), static_cast<ElementType>(0), R);
+    testing::ProcessTest("Padded matrix multiply", C == R);
+
+    // the archive holds the elements without the padding
+    utilities::SerializationContext context;
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+    math::MatrixArchiver::Write(P, "test", archiver);
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+    math::Matrix<ElementType, layout> Pa(0, 0);
+    math::MatrixArchiver::Read(Pa, "test", unarchiver);
+    testing::ProcessTest("MatrixArchiver, write padded matrix and read dense matrix", Pa == M && Pa.IsContiguous());
+
+    auto Q = P;
+    Q(2, 4) = 0;
+    testing::ProcessTest("Padded matrix copy", Q.GetIncrement() == P.GetIncrement() && Q(1, 3) == 9 && P(2, 4) == 15);
+
+    auto values = M.ToArray();
+    math::AlignedVector<ElementType> data(values.begin(), values.end());
+    auto pData = data.data();
+    math::Matrix<ElementType, layout> N(3, 5, std::move(data));
+    testing::ProcessTest("Matrix moves an aligned vector", N.GetDataPointer() == pData && N == M);
+}
+
+template <typename ElementType>
+void TestMatrixAssignment()
+{
+    math::RowMatrix<ElementType> A(0, 0);
+    math::RowMatrix<ElementType> B{ { 1, 2, 3 }, { 4, 5, 6 } };
+    A = B;
+    testing::ProcessTest("Matrix assignment from a different size", A.NumIntervals() == 2 && A.GetIncrement() == 3 && A(1, 2) == 6 && A == B);
+
+    math::ColumnMatrix<ElementType> C(4, 1);
+    math::ColumnMatrix<ElementType> D{ { 1, 2 }, { 3, 4 } };
+    C = D;
+    testing::ProcessTest("Matrix assignment from a different size (column major)", C.NumIntervals() == 2 && C(1, 0) == 3 && C == D);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestMatrixExpressions()
+{
+    math::Matrix<ElementType, layout> A{ { 1, 2, 3 }, { 4, 5, 6 } };
+    math::Matrix<ElementType, layout> B{ { 2, 0, -1 }, { 1, 3, 2 } };
+    math::Matrix<ElementType, layout> C(2, 3);
+
+    C.CopyFrom(2 * A - B);
+    math::Matrix<ElementType, layout> R1{ { 0, 4, 7 }, { 7, 7, 10 } };
+    testing::ProcessTest("Matrix expression: scaled difference", C == R1);
+
+    C += ElementWiseProduct(A, B) + 0.5 * B;
+    math::Matrix<ElementType, layout> R2{ { 3, 4, 3.5 }, { 11.5, 23.5, 23 } };
+    testing::ProcessTest("Matrix expression: add element-wise product", C == R2);
+
+    // submatrices are not contiguous, and transposed matrices of the opposite layout share this layout
+    math::Matrix<ElementType, layout> P(4, 5, math::Padding::aligned);
+    auto S = P.GetSubMatrix(1, 1, 2, 3);
+    S.CopyFrom(A + B);
+    S -= A;
+    math::Matrix<ElementType, math::TransposeMatrixLayout<layout>::value> T{ { 1, 4 }, { 2, 5 }, { 3, 6 } };
+    C.CopyFrom(A - T.Transpose());
+    testing::ProcessTest("Matrix expression with submatrix and transposed operands", S == B && P(0, 0) == 0 && P(3, 4) == 0 && C == math::Matrix<ElementType, layout>(2, 3));
+
+    bool thrown = false;
+    try
+    {
+        C.CopyFrom(A + A.GetSubMatrix(0, 0, 2, 2));
+    }
+    catch (const utilities::InputException&)
+    {
+        thrown = true;
+    }
+    testing::ProcessTest("Matrix expression size mismatch", thrown);
+}
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     SparseMatrix_test.tcc (math_test)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "Exception.h"
+#include "JsonArchiver.h"
+#include "testing.h"
+
+// stl
+#include <limits>
+#include <random>
+#include <sstream>
+#include <tuple>
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSparseMatrix()
+{
+    math::RowMatrix<ElementType> D{
+        { 1, 0, 0, 2 },
+        { 0, 0, 0, 0 },
+        { 0, 3, 0, 4 }
+    };
+    math::SparseMatrix<ElementType, layout> S(D);
+    testing::ProcessTest("SparseMatrix size", S.NumRows() == 3 && S.NumColumns() == 4 && S.NumNonzeros() == 4);
+    testing::ProcessTest("SparseMatrix::operator()", S(0, 0) == 1 && S(0, 3) == 2 && S(2, 1) == 3 && S(2, 3) == 4 && S(1, 2) == 0 && S(2, 2) == 0);
+    testing::ProcessTest("SparseMatrix::ToDense", S.ToDense() == D);
+    testing::ProcessTest("SparseMatrix::Transpose", S.Transpose().ToDense() == D.Transpose() && S.Transpose().Transpose() == S);
+
+    math::RowSparseMatrix<ElementType> R(3, 4, { 0, 2, 2, 4 }, { 0, 3, 1, 3 }, { 1, 2, 3, 4 });
+    testing::ProcessTest("SparseMatrix from compressed arrays", R.ToDense() == D);
+
+    // indices that are out of order are rejected
+    bool threw = false;
+    try
+    {
+        math::RowSparseMatrix<ElementType> invalid(3, 4, { 0, 2, 2, 4 }, { 3, 0, 1, 3 }, { 1, 2, 3, 4 });
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("SparseMatrix rejects invalid compressed arrays", threw);
+}
+
+template <typename ElementType, math::MatrixLayout layout>
+void TestSparseMatrixArchiver()
+{
+    math::ColumnMatrix<ElementType> D{
+        { 0, 5, 0 },
+        { 7, 0, 0 },
+        { 0, 0, 0 },
+        { 0, 8, 9 }
+    };
+    math::SparseMatrix<ElementType, layout> S(D);
+
+    utilities::SerializationContext context;
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+
+    math::SparseMatrixArchiver::Write(S, "test", archiver);
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+
+    math::SparseMatrix<ElementType, layout> Sa;
+    math::SparseMatrixArchiver::Read(Sa, "test", unarchiver);
+    testing::ProcessTest("SparseMatrixArchiver, write and read sparse matrix", Sa == S && Sa.ToDense() == D);
+}
+
+template <typename ElementType, math::MatrixLayout layoutA, math::MatrixLayout layoutB>
+void TestSparseMatrixOperations()
+{
+    std::default_random_engine rng(1234);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::bernoulli_distribution isNonzero(0.1);
+
+    math::Matrix<ElementType, layoutA> D(53, 41);
+    D.Generate([&]() { return isNonzero(rng) ? static_cast<ElementType>(distribution(rng)) : 0; });
+    math::SparseMatrix<ElementType, layoutA> A(D);
+
+    math::Matrix<ElementType, layoutB> B(41, 150);
+    B.Generate([&]() { return static_cast<ElementType>(distribution(rng)); });
+    math::ColumnVector<ElementType> v(41);
+    v.Generate([&]() { return static_cast<ElementType>(distribution(rng)); });
+
+    using Ops = math::OperationsImplementation<math::ImplementationType::native>;
+    const ElementType s = 2;
+    const ElementType t = static_cast<ElementType>(0.5);
+    const ElementType tolerance = static_cast<ElementType>(1.0e-5);
+
+    // the dense results
+    math::ColumnVector<ElementType> r(53);
+    r.Fill(1);
+    Ops::Multiply(s, D, v, t, r);
+    math::Matrix<ElementType, layoutA> R(53, 150);
+    R.Fill(1);
+    Ops::Multiply(s, D, B, t, R);
+
+    // computes the sparse results
+    auto compute = [&]() {
+        math::ColumnVector<ElementType> u(53);
+        u.Fill(1);
+        Ops::Multiply(s, A, v, t, u);
+        math::RowMatrix<ElementType> C(53, 150);
+        C.Fill(1);
+        Ops::Multiply(s, A, B, t, C);
+        math::ColumnMatrix<ElementType> E(53, 150);
+        E.Fill(std::numeric_limits<ElementType>::quiet_NaN());
+        math::Operations::Multiply(s, A, B, static_cast<ElementType>(0), E);
+        return std::make_tuple(u, C, E);
+    };
+
+    auto originalNumThreads = math::GetNumThreads();
+    auto originalThreshold = math::GetParallelThreshold();
+    math::SetNumThreads(1);
+    auto serialResult = compute();
+    math::SetNumThreads(4);
+    math::SetParallelThreshold(0);
+    auto parallelResult = compute();
+    math::SetNumThreads(originalNumThreads);
+    math::SetParallelThreshold(originalThreshold);
+
+    math::Matrix<ElementType, layoutA> E(53, 150);
+    Ops::Multiply(s, D, B, static_cast<ElementType>(0), E);
+
+    testing::ProcessTest("Sparse matrix vector multiply", std::get<0>(serialResult).IsEqual(r, tolerance));
+    testing::ProcessTest("Sparse matrix dense matrix multiply", std::get<1>(serialResult).IsEqual(R, tolerance) && std::get<2>(serialResult).IsEqual(E, tolerance));
+    testing::ProcessTest("Parallel sparse matrix operations", std::get<0>(serialResult) == std::get<0>(parallelResult) && std::get<1>(serialResult) == std::get<1>(parallelResult) && std::get<2>(serialResult) == std::get<2>(parallelResult));
+}
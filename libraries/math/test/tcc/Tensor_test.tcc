@@ -450,3 +450,45 @@ void TestTensorArchiver()
     math::TensorArchiver::Read(Ta, "test", unarchiver);
     testing::ProcessTest("void TestTensorArchiver(), write and read tensor", Ta == T);
 }
+
+template<typename ElementType, math::Dimension dimension0, math::Dimension dimension1, math::Dimension dimension2>
+void TestPaddedTensor()
+{
+    math::Tensor<ElementType, dimension0, dimension1, dimension2> T(3, 5, 7);
+    T.Generate([]() { return static_cast<ElementType>(std::rand() % 100); });
+    math::Tensor<ElementType, dimension0, dimension1, dimension2> P(3, 5, 7, math::Padding::aligned);
+    P.CopyFrom(T);
+
+    // each interval of the first layout dimension starts on an aligned address
+    bool aligned = true;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        for (size_t j = 0; j < 5; ++j)
+        {
+            for (size_t k = 0; k < 7; ++k)
+            {
+                math::Triplet coordinate{ i, j, k };
+                if (coordinate[static_cast<size_t>(dimension0)] == 0)
+                {
+                    aligned = aligned && math::IsAligned(&P(coordinate));
+                }
+            }
+        }
+    }
+    testing::ProcessTest("Padded tensor is aligned", aligned && math::IsAligned(T.GetDataPointer()));
+    testing::ProcessTest("Padded tensor equals dense tensor", P == T && P.ToArray() == T.ToArray());
+
+    utilities::SerializationContext context;
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+    math::TensorArchiver::Write(P, "test", archiver);
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+    math::Tensor<ElementType, dimension0, dimension1, dimension2> Pa;
+    math::TensorArchiver::Read(Pa, "test", unarchiver);
+    testing::ProcessTest("TensorArchiver, write padded tensor and read dense tensor", Pa == T);
+
+    math::AlignedVector<ElementType> data(2 * 3 * 4, 1);
+    auto pData = data.data();
+    math::Tensor<ElementType, dimension0, dimension1, dimension2> M(2, 3, 4, std::move(data));
+    testing::ProcessTest("Tensor moves an aligned vector", M.GetDataPointer() == pData && M(1, 2, 3) == 1);
+}
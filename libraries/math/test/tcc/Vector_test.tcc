@@ -125,6 +125,10 @@ void TestVectorOperations()
 
     testing::ProcessTest(implementationName + "Operations::Norm2(VectorReference)", testing::IsEqual(M.GetColumn(1).Norm2(), static_cast<ElementType>(std::sqrt(2 * 2 + 9 * 9 + 16 * 16))));
 
+    testing::ProcessTest(implementationName + "Operations::Norm1(VectorReference)", Ops::Norm1(M.GetRow(2)) == 0 + 16 + 10 + 6);
+
+    testing::ProcessTest(implementationName + "Operations::Norm2(VectorReference)", testing::IsEqual(Ops::Norm2(M.GetRow(2)), static_cast<ElementType>(std::sqrt(16 * 16 + 10 * 10 + 6 * 6))));
+
     M.GetRow(1).CopyFrom(math::RowVector<ElementType>{ 1, 1, 1, 1 });
     M.GetColumn(2).CopyFrom(math::ColumnVector<ElementType>{ 1, 1, 1 });
     math::ColumnMatrix<ElementType> R3{
@@ -272,3 +276,88 @@ void TestVectorArchiver()
     math::VectorArchiver::Read(Va, "test", unarchiver);
     testing::ProcessTest("void TestVectorArchiver(), write and read vector", Va == V);
 }
+
+template <typename ElementType>
+void TestVectorAlignment()
+{
+    bool aligned = true;
+    for (size_t size = 1; size < 20; ++size)
+    {
+        math::ColumnVector<ElementType> v(size);
+        aligned = aligned && math::IsAligned(v.GetDataPointer());
+    }
+    math::RowVector<ElementType> u(std::vector<ElementType>{ 1, 2, 3 });
+    testing::ProcessTest("Vector data is aligned", aligned && math::IsAligned(u.GetDataPointer()));
+
+    math::AlignedVector<ElementType> data{ 1, 2, 3 };
+    auto pData = data.data();
+    math::RowVector<ElementType> w(std::move(data));
+    testing::ProcessTest("Vector moves an aligned vector", w.GetDataPointer() == pData && w == u);
+
+    // the unit-stride kernels must also handle unaligned vectors
+    math::ColumnVector<ElementType> x(37);
+    math::ColumnVector<ElementType> y(37);
+    x.Generate([]() { return static_cast<ElementType>(std::rand() % 10); });
+    y.Fill(1);
+    auto xUnaligned = x.GetSubVector(1, 35);
+    auto yUnaligned = y.GetSubVector(2, 35);
+    math::OperationsImplementation<math::ImplementationType::native>::Add(static_cast<ElementType>(2), xUnaligned, yUnaligned);
+    math::ColumnVector<ElementType> z(35);
+    math::OperationsImplementation<math::ImplementationType::native>::ElementWiseMultiply(xUnaligned, yUnaligned, z);
+
+    bool success = y[0] == 1 && y[1] == 1;
+    for (size_t i = 0; i < 35; ++i)
+    {
+        success = success && yUnaligned[i] == 1 + 2 * xUnaligned[i] && z[i] == xUnaligned[i] * yUnaligned[i];
+    }
+    testing::ProcessTest("Native vector operations on unaligned subvectors", success);
+}
+
+template <typename ElementType>
+void TestVectorExpressions()
+{
+    math::ColumnVector<ElementType> u{ 1, 2, 3, 4, 5, 6 };
+    math::ColumnVector<ElementType> v{ 2, -1, 0, 3, 1, 2 };
+    math::RowMatrix<ElementType> M{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+    auto w = M.Transpose().GetRow(1); // strided: { 2, 4, 6 }
+
+    math::ColumnVector<ElementType> r(6);
+    r.CopyFrom(2 * u - 3 * v);
+    math::ColumnVector<ElementType> r1{ -4, 7, 6, -1, 7, 6 };
+    testing::ProcessTest("Vector expression: scaled difference", r == r1);
+
+    r += ElementWiseProduct(u, v) + 0.5 * u;
+    math::ColumnVector<ElementType> r2{ -1.5, 6, 7.5, 13, 14.5, 21 };
+    testing::ProcessTest("Vector expression: add element-wise product", r == r2);
+
+    // the same computation with separate operations
+    math::ColumnVector<ElementType> s(6);
+    math::ColumnVector<ElementType> t(6);
+    s.CopyFrom(u);
+    s *= 2;
+    math::Operations::Add(static_cast<ElementType>(-3), v, s);
+    math::Operations::ElementWiseMultiply(u, v, t);
+    s += t;
+    math::Operations::Add(static_cast<ElementType>(0.5), u, s);
+    testing::ProcessTest("Vector expression equals separate operations", r == s);
+
+    // strided operands and target
+    math::RowMatrix<ElementType> N(2, 3);
+    auto row = N.GetRow(0);
+    math::RowVector<ElementType> x{ 1, 1, 1 };
+    row.CopyFrom(x - w);
+    row -= ElementWiseProduct(w, w);
+    math::RowVector<ElementType> r3{ -5, -19, -41 };
+    testing::ProcessTest("Vector expression with strided operands", row == r3 && N(1, 0) == 0);
+
+    bool thrown = false;
+    try
+    {
+        r.CopyFrom(u + math::ColumnVector<ElementType>(3));
+    }
+    catch (const utilities::InputException&)
+    {
+        thrown = true;
+    }
+    testing::ProcessTest("Vector expression size mismatch", thrown);
+}
@@ -39,8 +39,9 @@ void TestFloatNode();
 //
 void TestNeuralNetworkPredictorNode();
 void TestNeuralNetworkPredictorNode2();
+void TestFoldedNeuralNetworkPredictorNode();
 
-enum class ConvolutionType { GEMM, Diagonal};
+enum class ConvolutionType { GEMM, Diagonal, Winograd };
 
 void TestReLUActivationLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
 void TestLeakyReLUActivationLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
@@ -50,6 +51,7 @@ void TestBiasLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
 void TestBinaryConvolutionalLayerNode(size_t inputPadding = 1, size_t outputPadding = 0);
 void TestConvolutionalLayerNode(ConvolutionType convolutionType, size_t inputPadding = 1, size_t outputPadding = 0);
 void TestFullyConnectedLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
+void TestGroupedConvolutionalLayerNode(size_t numGroups, size_t inputPadding = 1, size_t outputPadding = 0);
 void TestMaxPoolingLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
 void TestMeanPoolingLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
 void TestScalingLayerNode(size_t inputPadding = 0, size_t outputPadding = 0);
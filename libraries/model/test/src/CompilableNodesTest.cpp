@@ -35,10 +35,12 @@
 #include "DotProductNode.h"
 #include "ExtremalValueNode.h"
 #include "FullyConnectedLayerNode.h"
+#include "GroupedConvolutionalLayerNode.h"
 #include "IRNode.h"
 #include "MultiplexerNode.h"
 #include "NeuralNetworkPredictorNode.h"
 #include "PoolingLayerNode.h"
+#include "ScalingLayerNode.h"
 #include "SinkNode.h"
 #include "SoftmaxLayerNode.h"
 #include "SourceNode.h"
@@ -56,6 +58,7 @@
 #include "BinaryConvolutionalLayer.h"
 #include "ConvolutionalLayer.h"
 #include "FullyConnectedLayer.h"
+#include "GroupedConvolutionalLayer.h"
 #include "InputLayer.h"
 #include "LeakyReLUActivation.h"
 #include "MaxPoolingFunction.h"
@@ -812,6 +815,79 @@ void TestNeuralNetworkPredictorNode2()
     VerifyCompiledOutput(map, compiledMap, signal, predictorNode->GetRuntimeTypeName());
 }
 
+void TestFoldedNeuralNetworkPredictorNode()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+
+    using ElementType = double;
+    using InputParameters = typename InputLayer<ElementType>::InputParameters;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using VectorType = typename Layer<ElementType>::VectorType;
+    using MatrixType = typename Layer<ElementType>::MatrixType;
+    using DataVectorType = typename NeuralNetworkPredictor<ElementType>::DataVectorType;
+
+    // FC -> BatchNorm -> Scaling -> Bias -> ReLU -> FC, which the node folds into FC -> Bias -> ReLU -> FC
+    typename NeuralNetworkPredictor<ElementType>::InputLayerReference inputLayer;
+    typename NeuralNetworkPredictor<ElementType>::Layers layers;
+
+    InputParameters inputParams = { { 1, 1, 2 }, { PaddingScheme::zeros, 0 }, { 1, 1, 2 }, { PaddingScheme::zeros, 0 }, 1 };
+    inputLayer = std::make_unique<InputLayer<ElementType>>(inputParams);
+
+    MatrixType weights1(3, 2);
+    weights1.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2) / 4; });
+    layers.push_back(std::make_shared<FullyConnectedLayer<ElementType>>(LayerParameters{ inputLayer->GetOutput(), NoPadding(), { 1, 1, 3 }, NoPadding() }, weights1));
+    layers.push_back(std::make_shared<BatchNormalizationLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 3 }, NoPadding() }, VectorType({ 0.5, -1, 0 }), VectorType({ 4, 1, 0.25 })));
+    layers.push_back(std::make_shared<ScalingLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 3 }, NoPadding() }, VectorType({ 2, -0.5, 1 })));
+    layers.push_back(std::make_shared<BiasLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 3 }, NoPadding() }, VectorType({ 0.25, 1, -1 })));
+    layers.push_back(std::make_shared<ActivationLayer<ElementType, ReLUActivation>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 3 }, NoPadding() }));
+
+    MatrixType weights2(1, 3);
+    weights2(0, 0) = 1;
+    weights2(0, 1) = -0.5;
+    weights2(0, 2) = 2;
+    layers.push_back(std::make_shared<FullyConnectedLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 1 }, NoPadding() }, weights2));
+
+    NeuralNetworkPredictor<ElementType> neuralNetwork(std::move(inputLayer), std::move(layers));
+    std::vector<std::vector<ElementType>> signal = { { 0, 1 }, { 1, -2 }, { 3, 0.5 } };
+    std::vector<std::vector<ElementType>> expectedOutputs;
+    for (const auto& input : signal)
+    {
+        expectedOutputs.push_back(neuralNetwork.Predict(DataVectorType(input)));
+    }
+
+    // Create model
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(GetShapeSize(neuralNetwork.GetInputShape()));
+    auto predictorNode = model.AddNode<nodes::NeuralNetworkPredictorNode<double>>(inputNode->output, neuralNetwork);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", predictorNode->output } });
+
+    // The node predicts the same outputs as the unfolded network, which keeps its layers
+    bool ok = neuralNetwork.GetLayers().size() == 6;
+    for (size_t index = 0; index < signal.size(); index++)
+    {
+        map.SetInputValue(0, signal[index]);
+        ok = ok && testing::IsEqual(map.ComputeOutput<double>(0), expectedOutputs[index], 1e-12);
+    }
+    testing::ProcessTest("Testing folded NeuralNetworkPredictorNode compute", ok);
+
+    // Refining the node once gives the folded layers, without batch normalization or scaling layers
+    auto refinedMap = map;
+    model::TransformContext context;
+    refinedMap.Refine(context, 1);
+    const auto& refinedModel = refinedMap.GetModel();
+    testing::ProcessTest("Testing folded NeuralNetworkPredictorNode refine", refinedModel.GetNodesByType<nodes::BatchNormalizationLayerNode<double>>().size() == 0 && refinedModel.GetNodesByType<nodes::ScalingLayerNode<double>>().size() == 0 && refinedModel.GetNodesByType<nodes::BiasLayerNode<double>>().size() == 1);
+
+    model::MapCompilerParameters settings;
+    settings.compilerSettings.optimize = true;
+    model::IRMapCompiler compiler(settings);
+    auto compiledMap = compiler.Compile(map);
+    PrintIR(compiledMap);
+
+    // compare output
+    VerifyCompiledOutput(map, compiledMap, signal, "folded " + predictorNode->GetRuntimeTypeName());
+}
+
 template<template<typename> class ActivationFunction>
 void TestActivationLayerNode(size_t inputPaddingSize, size_t outputPaddingSize)
 {
@@ -1021,7 +1097,15 @@ void TestConvolutionalLayerNode(ConvolutionType convolutionType, size_t inputPad
     std::cout << "output shape: " << outputShape[0] << ", " << outputShape[1] << ", " << outputShape[2] << std::endl;
 
     LayerParameters parameters{ input, ZeroPadding(inputPaddingSize), outputShape, ZeroPadding(outputPaddingSize) };
-    auto convolutionMethod = (convolutionType == ConvolutionType::Diagonal) ? ConvolutionMethod::diagonal : ConvolutionMethod::columnwise;
+    auto convolutionMethod = ConvolutionMethod::columnwise;
+    if (convolutionType == ConvolutionType::Diagonal)
+    {
+        convolutionMethod = ConvolutionMethod::diagonal;
+    }
+    else if (convolutionType == ConvolutionType::Winograd)
+    {
+        convolutionMethod = ConvolutionMethod::winograd;
+    }
     ConvolutionalParameters convolutionalParams{ 3, 1, convolutionMethod, 2 }; // 2 == batch size
     TensorType weights(convolutionalParams.receptiveField * outputShape[2], convolutionalParams.receptiveField, input.NumChannels());
     // clang-format off
@@ -1072,6 +1156,51 @@ void TestConvolutionalLayerNode(ConvolutionType convolutionType, size_t inputPad
     VerifyLayerMap<ElementType>(map, computeNode, inputWithPadding, output);
 }
 
+void TestGroupedConvolutionalLayerNode(size_t numGroups, size_t inputPaddingSize, size_t outputPaddingSize)
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using ElementType = double;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using TensorReferenceType = typename Layer<ElementType>::TensorReferenceType;
+    using Shape = typename Layer<ElementType>::Shape;
+
+    const size_t numChannels = 4;
+    const size_t numFilters = 4;
+    TensorType inputWithPadding(4 + 2 * inputPaddingSize, 3 + 2 * inputPaddingSize, numChannels);
+    TensorReferenceType input = inputWithPadding.GetReference(); // For convolutional nodes, input includes padding
+    inputWithPadding.Fill(0);
+    for (size_t i = 0; i < 4; i++)
+    {
+        for (size_t j = 0; j < 3; j++)
+        {
+            for (size_t k = 0; k < numChannels; k++)
+            {
+                input(i + inputPaddingSize, j + inputPaddingSize, k) = static_cast<ElementType>((i * 3 + j * 5 + k) % 7) - 3;
+            }
+        }
+    }
+    Shape outputShape = { 4 + 2 * outputPaddingSize, 3 + 2 * outputPaddingSize, numFilters };
+
+    LayerParameters parameters{ input, ZeroPadding(inputPaddingSize), outputShape, ZeroPadding(outputPaddingSize) };
+    GroupedConvolutionalParameters convolutionalParams{ 3, 1, numGroups };
+    TensorType weights(convolutionalParams.receptiveField * numFilters, convolutionalParams.receptiveField, numChannels / numGroups);
+    weights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2); });
+
+    GroupedConvolutionalLayer<ElementType> layer(parameters, convolutionalParams, weights);
+    layer.Compute();
+    auto output = layer.GetOutput();
+
+    // Create model
+    model::Model model;
+    auto inputNode = model.AddNode<model::InputNode<double>>(inputWithPadding.Size());
+    auto computeNode = model.AddNode<nodes::GroupedConvolutionalLayerNode<double>>(inputNode->output, layer);
+    auto map = model::DynamicMap(model, { { "input", inputNode } }, { { "output", computeNode->output } });
+
+    VerifyLayerMap<ElementType>(map, computeNode, inputWithPadding, output);
+}
+
 void TestFullyConnectedLayerNode(size_t inputPaddingSize, size_t outputPaddingSize)
 {
     using ElementType = double;
@@ -80,6 +80,7 @@ void TestIRCompiler()
     //
     TestNeuralNetworkPredictorNode();
     TestNeuralNetworkPredictorNode2();
+    TestFoldedNeuralNetworkPredictorNode();
 
     TestReLUActivationLayerNode();
     TestReLUActivationLayerNode(0, 1);
@@ -111,6 +112,11 @@ void TestIRCompiler()
     // TestConvolutionalLayerNode(ConvolutionType::GEMM, 1, 1); // Convolutional layer output padding not supported
 
     TestConvolutionalLayerNode(ConvolutionType::Diagonal); // Input padding must be set correctly (to floor(filterWidth/2))
+    TestConvolutionalLayerNode(ConvolutionType::Winograd); // Input padding must be 1
+
+    TestGroupedConvolutionalLayerNode(2);
+    TestGroupedConvolutionalLayerNode(4); // depthwise
+    TestGroupedConvolutionalLayerNode(4, 1, 1);
 
     TestFullyConnectedLayerNode();
     // TestFullyConnectedLayerNode(0, 1); // Fully-connected layer nodes can't have padding (yet)
@@ -160,5 +160,101 @@ namespace nodes
 
         predictors::neural::ConvolutionalParameters _convolutionalParameters;
     };
+
+    /// <summary>
+    /// If Winograd convolution is specified, a ConvolutionalLayerNode with a 3x3 receptive field, a stride of 1
+    /// and an input padding of 1 will refine itself into a WinogradConvolutionNode, which computes the output
+    /// in 2x2 tiles with the F(2x2, 3x3) Winograd algorithm.
+    /// </summary>
+    template <typename ValueType>
+    class WinogradConvolutionNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* filterWeightsPortName = "filterWeights";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::InputPort<ValueType>& filterWeights = _filterWeights;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default constructor. </summary>
+        WinogradConvolutionNode();
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="input"> The ports to get input data from. </param>
+        /// <param name="inputMemoryLayout"> The layout of the input data. </param>
+        /// <param name="filterWeights"> The transformed weights for the convolutional filters, as 16 consecutive row-major
+        /// numFilters x numChannels matrices, one per element of the 4x4 transformed tile. </param>
+        /// <param name="outputMemoryLayout"> The layout of the output data. </param>
+        /// <param name="convolutionalParameters"> The convolutional parameters. </param>
+        WinogradConvolutionNode(const model::PortElements<ValueType>& input,
+                                const PortMemoryLayout& inputMemoryLayout,
+                                const model::PortElements<ValueType>& filterWeights,
+                                const PortMemoryLayout& outputMemoryLayout,
+                                const predictors::neural::ConvolutionalParameters& convolutionalParameters);
+
+        /// <summary> Gets information about the input memory layout </summary>
+        const PortMemoryLayout& GetInputMemoryLayout() const { return _inputMemoryLayout; }
+
+        /// <summary> Gets information about the input memory layout </summary>
+        const PortMemoryLayout& GetOutputMemoryLayout() const { return _outputMemoryLayout; }
+
+        /// <summary> Get the parameters used to control convolution. </summary>
+        ///
+        /// <returns> A ConvolutionalParameters struct. </returns>
+        const predictors::neural::ConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("WinogradConvolutionNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+
+        /// <summary> Makes a copy of this node into the model being constructed by the transformer </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` object currently creating a new model </param>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+
+    private:
+        // Input
+        model::InputPort<ValueType> _input;
+        model::InputPort<ValueType> _filterWeights;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        PortMemoryLayout _inputMemoryLayout;
+        PortMemoryLayout _outputMemoryLayout;
+
+        predictors::neural::ConvolutionalParameters _convolutionalParameters;
+    };
 }
 }
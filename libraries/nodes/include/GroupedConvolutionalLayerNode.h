@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GroupedConvolutionalLayerNode.h (nodes)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "NeuralNetworkLayerNode.h"
+
+// model
+#include "IRMapCompiler.h"
+#include "ModelTransformer.h"
+#include "PortElements.h"
+
+// predictors
+#include "GroupedConvolutionalLayer.h"
+
+// stl
+#include <string>
+#include <type_traits>
+
+namespace ell
+{
+namespace nodes
+{
+    /// <summary> A node that wraps a neural net GroupedConvolutionalLayer. </summary>
+    template <typename ValueType>
+    class GroupedConvolutionalLayerNode : public NeuralNetworkLayerNode<GroupedConvolutionalLayerNode<ValueType>, predictors::neural::GroupedConvolutionalLayer<ValueType>, ValueType>
+    {
+    public:
+        using LayerType = predictors::neural::GroupedConvolutionalLayer<ValueType>;
+        using BaseType = NeuralNetworkLayerNode<GroupedConvolutionalLayerNode<ValueType>, predictors::neural::GroupedConvolutionalLayer<ValueType>, ValueType>;
+
+        /// @name Input and Output Ports
+        /// @{
+        using BaseType::inputPortName; // "input"
+        using BaseType::outputPortName; // "output"
+        using BaseType::input;
+        using BaseType::output;
+        /// @}
+
+        GroupedConvolutionalLayerNode() = default;
+
+        /// <summary> Constructor from a layer. </summary>
+        ///
+        /// <param name="input"> The input to the layer. </param>
+        /// <param name="layer"> The grouped convolutional layer to wrap. </param>
+        GroupedConvolutionalLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::GroupedConvolutionalLayer<ValueType>& layer);
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("GroupedConvolutionalLayerNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Indicates if this node is able to compile itself to code. </summary>
+        virtual bool IsCompilable() const override { return false; }
+
+    protected:
+        virtual bool Refine(model::ModelTransformer& transformer) const override;
+    };
+
+    /// <summary>
+    /// A GroupedConvolutionalLayerNode refines itself into a GroupedConvolutionNode, which computes each output element
+    /// directly from the input channels of its filter's group.
+    /// </summary>
+    template <typename ValueType>
+    class GroupedConvolutionNode : public model::CompilableNode
+    {
+    public:
+        /// @name Input and Output Ports
+        /// @{
+        static constexpr const char* inputPortName = "input";
+        static constexpr const char* filterWeightsPortName = "filterWeights";
+        static constexpr const char* outputPortName = "output";
+        const model::InputPort<ValueType>& input = _input;
+        const model::InputPort<ValueType>& filterWeights = _filterWeights;
+        const model::OutputPort<ValueType>& output = _output;
+        /// @}
+
+        /// <summary> Default constructor. </summary>
+        GroupedConvolutionNode();
+
+        /// <summary> Constructor. </summary>
+        ///
+        /// <param name="input"> The ports to get input data from. </param>
+        /// <param name="inputMemoryLayout"> The layout of the input data. </param>
+        /// <param name="filterWeights"> The weights for the convolutional filters, as a row-major matrix with one column per filter and
+        /// one row per element of a filter's receptive field volume, in row, column, channel order. </param>
+        /// <param name="outputMemoryLayout"> The layout of the output data. </param>
+        /// <param name="convolutionalParameters"> The convolutional parameters. </param>
+        GroupedConvolutionNode(const model::PortElements<ValueType>& input,
+                               const PortMemoryLayout& inputMemoryLayout,
+                               const model::PortElements<ValueType>& filterWeights,
+                               const PortMemoryLayout& outputMemoryLayout,
+                               const predictors::neural::GroupedConvolutionalParameters& convolutionalParameters);
+
+        /// <summary> Gets information about the input memory layout </summary>
+        const PortMemoryLayout& GetInputMemoryLayout() const { return _inputMemoryLayout; }
+
+        /// <summary> Gets information about the output memory layout </summary>
+        const PortMemoryLayout& GetOutputMemoryLayout() const { return _outputMemoryLayout; }
+
+        /// <summary> Get the parameters used to control convolution. </summary>
+        ///
+        /// <returns> A GroupedConvolutionalParameters struct. </returns>
+        const predictors::neural::GroupedConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ValueType>("GroupedConvolutionNode"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::notImplemented);
+        }
+
+        /// <summary> Makes a copy of this node into the model being constructed by the transformer </summary>
+        ///
+        /// <param name="transformer"> The `ModelTransformer` object currently creating a new model </param>
+        virtual void Copy(model::ModelTransformer& transformer) const override;
+
+    protected:
+        virtual void Compute() const override;
+        virtual void Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function) override;
+
+    private:
+        // Input
+        model::InputPort<ValueType> _input;
+        model::InputPort<ValueType> _filterWeights;
+
+        // Output
+        model::OutputPort<ValueType> _output;
+
+        PortMemoryLayout _inputMemoryLayout;
+        PortMemoryLayout _outputMemoryLayout;
+
+        predictors::neural::GroupedConvolutionalParameters _convolutionalParameters;
+    };
+}
+}
@@ -20,6 +20,7 @@
 #include "BinaryConvolutionalLayerNode.h"
 #include "ConvolutionalLayerNode.h"
 #include "FullyConnectedLayerNode.h"
+#include "GroupedConvolutionalLayerNode.h"
 #include "PoolingLayerNode.h"
 #include "ScalingLayerNode.h"
 #include "SoftmaxLayerNode.h"
@@ -64,7 +65,8 @@ namespace nodes
         /// <summary> Default Constructor </summary>
         NeuralNetworkPredictorNode();
 
-        /// <summary> Constructor </summary>
+        /// <summary> Constructor. The node uses a folded copy of the predictor, see NeuralNetworkPredictor::FoldLayers,
+        /// so both the computed and the compiled model skip the folded layers. </summary>
         ///
         /// <param name="input"> The signal to predict from </param>
         /// <param name="predictor"> The predictor to use when making the prediction. </param>
@@ -85,7 +87,8 @@ namespace nodes
         /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
         virtual void WriteToArchive(utilities::Archiver& archiver) const override;
 
-        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        /// <summary> Sets the internal state of the object according to the archiver passed in. The unarchived predictor's
+        /// layers are folded. </summary>
         ///
         /// <param name="archiver"> The `Archiver` to get state from </param>
         virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
@@ -142,8 +142,18 @@ namespace nodes
 
         auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
 
-        bool useDiagonalConvolution = convParams.method == predictors::neural::ConvolutionMethod::diagonal;
-        if (!useDiagonalConvolution || stride != 1 || filterWidth % 2 == 0) // do we also need to require padding be set correctly?
+        bool useDiagonalConvolution = convParams.method == predictors::neural::ConvolutionMethod::diagonal && stride == 1 && filterWidth % 2 == 1; // do we also need to require padding be set correctly?
+        bool useWinogradConvolution = convParams.method == predictors::neural::ConvolutionMethod::winograd && stride == 1 && filterWidth == 3 && padding == 1 && outputPadding == 0;
+        if (useWinogradConvolution)
+        {
+            // The transformed weights, as 16 row-major numFilters x inputDepth matrices
+            math::RowMatrix<ValueType> weightsMatrix(this->GetLayer().GetWinogradWeightsMatrix());
+            auto weightsValues = weightsMatrix.ToArray();
+            auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
+            auto convNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(newInput, inputLayout, weightsNode->output, outputLayout, convParams);
+            transformer.MapNodeOutput(this->output, convNode->output);
+        }
+        else if (!useDiagonalConvolution)
         {
             // GEMM method
             const auto& weights = this->GetLayer().GetWeightsMatrix();
@@ -493,6 +503,346 @@ namespace nodes
         convLoop.End();
     }
 
+    //
+    // WinogradConvolutionNode
+    //
+
+    namespace
+    {
+        // The number of 2x2 output tiles along a dimension of the output image
+        size_t GetNumWinogradTiles(size_t outputSize)
+        {
+            return (outputSize + 1) / 2;
+        }
+    }
+
+    template <typename ValueType>
+    WinogradConvolutionNode<ValueType>::WinogradConvolutionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _filterWeights(this, {}, filterWeightsPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    WinogradConvolutionNode<ValueType>::WinogradConvolutionNode(const model::PortElements<ValueType>& input, const PortMemoryLayout& inputMemoryLayout, const model::PortElements<ValueType>& filterWeights, const PortMemoryLayout& outputMemoryLayout, const predictors::neural::ConvolutionalParameters& convolutionalParameters)
+        : CompilableNode({ &_input, &_filterWeights }, { &_output }), _input(this, input, inputPortName), _filterWeights(this, filterWeights, filterWeightsPortName), _output(this, outputPortName, GetDiagonalConvolutionOutputSize(outputMemoryLayout)), _inputMemoryLayout(inputMemoryLayout), _outputMemoryLayout(outputMemoryLayout), _convolutionalParameters(convolutionalParameters)
+    {
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newFilterWeights = transformer.TransformPortElements(_filterWeights.GetPortElements());
+        auto newNode = transformer.AddNode<WinogradConvolutionNode<ValueType>>(newInput, _inputMemoryLayout, newFilterWeights, _outputMemoryLayout, _convolutionalParameters);
+        transformer.MapNodeOutput(this->output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Compute() const
+    {
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        const size_t paddedWidth = inputLayout.stride[1];
+        const size_t paddedHeight = inputLayout.stride[0];
+        const size_t inputDepth = inputLayout.size[2];
+
+        const size_t outputWidth = outputLayout.size[1];
+        const size_t outputHeight = outputLayout.size[0];
+        const size_t numFilters = outputLayout.size[2];
+
+        const size_t numTileRows = GetNumWinogradTiles(outputHeight);
+        const size_t numTileColumns = GetNumWinogradTiles(outputWidth);
+        const size_t numTiles = numTileRows * numTileColumns;
+
+        auto inputData = _input.GetValue();
+        auto filterWeightsData = _filterWeights.GetValue();
+        assert(inputData.size() == paddedWidth * paddedHeight * inputDepth);
+        assert(filterWeightsData.size() == 16 * numFilters * inputDepth);
+
+        // V = B^T d B for each 4x4 input tile d, stored as 16 inputDepth x numTiles matrices
+        std::vector<ValueType> transformedInput(16 * inputDepth * numTiles);
+        for (size_t tileRow = 0; tileRow < numTileRows; tileRow++)
+        {
+            for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+            {
+                size_t tile = tileRow * numTileColumns + tileColumn;
+                for (size_t c = 0; c < inputDepth; c++)
+                {
+                    ValueType d[4][4];
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            size_t row = 2 * tileRow + i;
+                            size_t column = 2 * tileColumn + j;
+                            d[i][j] = (row < paddedHeight && column < paddedWidth) ? inputData[(row * paddedWidth + column) * inputDepth + c] : 0;
+                        }
+                    }
+
+                    ValueType BTd[4][4];
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        BTd[0][j] = d[0][j] - d[2][j];
+                        BTd[1][j] = d[1][j] + d[2][j];
+                        BTd[2][j] = d[2][j] - d[1][j];
+                        BTd[3][j] = d[1][j] - d[3][j];
+                    }
+
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        ValueType V[4] = { BTd[i][0] - BTd[i][2], BTd[i][1] + BTd[i][2], BTd[i][2] - BTd[i][1], BTd[i][1] - BTd[i][3] };
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            transformedInput[((i * 4 + j) * inputDepth + c) * numTiles + tile] = V[j];
+                        }
+                    }
+                }
+            }
+        }
+
+        // M = U V for each of the 16 tile elements, where U is the numFilters x inputDepth matrix of transformed weights
+        std::vector<ValueType> transformedOutput(16 * numFilters * numTiles);
+        for (size_t element = 0; element < 16; element++)
+        {
+            math::RowMatrixReference<ValueType> U(numFilters, inputDepth, filterWeightsData.data() + element * numFilters * inputDepth);
+            math::RowMatrixReference<ValueType> V(inputDepth, numTiles, transformedInput.data() + element * inputDepth * numTiles);
+            math::RowMatrixReference<ValueType> M(numFilters, numTiles, transformedOutput.data() + element * numFilters * numTiles);
+            math::Operations::Multiply(static_cast<ValueType>(1.0), U, V, static_cast<ValueType>(0.0), M);
+        }
+
+        // Y = A^T M A for each tile, dropping the parts of the last tiles that fall outside of the output
+        std::vector<ValueType> output(outputHeight * outputWidth * numFilters);
+        for (size_t tileRow = 0; tileRow < numTileRows; tileRow++)
+        {
+            for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+            {
+                size_t tile = tileRow * numTileColumns + tileColumn;
+                for (size_t f = 0; f < numFilters; f++)
+                {
+                    ValueType ATm[2][4];
+                    for (size_t j = 0; j < 4; j++)
+                    {
+                        auto m = [&](size_t i) { return transformedOutput[((i * 4 + j) * numFilters + f) * numTiles + tile]; };
+                        ATm[0][j] = m(0) + m(1) + m(2);
+                        ATm[1][j] = m(1) - m(2) - m(3);
+                    }
+
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        ValueType Y[2] = { ATm[i][0] + ATm[i][1] + ATm[i][2], ATm[i][1] - ATm[i][2] - ATm[i][3] };
+                        for (size_t j = 0; j < 2; j++)
+                        {
+                            size_t row = 2 * tileRow + i;
+                            size_t column = 2 * tileColumn + j;
+                            if (row < outputHeight && column < outputWidth)
+                            {
+                                output[(row * outputWidth + column) * numFilters + f] = Y[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void WinogradConvolutionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // input is a (h+2) x (w+2) x d array, including the padding
+        llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
+
+        // weights are 16 f x d matrices
+        llvm::Value* pWeights = compiler.EnsurePortEmitted(this->filterWeights);
+
+        // output is a h x w x f array
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
+
+        const bool useBlas = compiler.GetMapCompilerParameters().compilerSettings.useBlas;
+
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        const int paddedWidth = inputLayout.stride[1];
+        const int paddedHeight = inputLayout.stride[0];
+        const int inputDepth = inputLayout.size[2];
+        assert(inputLayout.offset[0] == 1 && "Padding must be 1");
+
+        const int outputWidth = outputLayout.size[1];
+        const int outputHeight = outputLayout.size[0];
+        const int numFilters = outputLayout.size[2];
+
+        const int numTileRows = GetNumWinogradTiles(outputHeight);
+        const int numTileColumns = GetNumWinogradTiles(outputWidth);
+        const int numTiles = numTileRows * numTileColumns;
+
+        // If the output has an odd number of rows or columns, the last tiles extend one element past the input and
+        // the output, so the input is copied into a buffer with an extra row and column of zeros, and the output is
+        // computed into a buffer that holds whole tiles
+        const bool hasPartialTiles = (outputHeight % 2 != 0) || (outputWidth % 2 != 0);
+        const int tiledInputWidth = 2 * numTileColumns + 2;
+        const int tiledOutputWidth = 2 * numTileColumns;
+        const int inputStride = paddedWidth * inputDepth;
+        const int tiledInputStride = hasPartialTiles ? tiledInputWidth * inputDepth : inputStride;
+        const int outputStride = outputWidth * numFilters;
+        const int tiledOutputStride = hasPartialTiles ? tiledOutputWidth * numFilters : outputStride;
+
+        llvm::Value* pTiledInput = pInput;
+        llvm::Value* pTiledOutput = pOutput;
+        if (hasPartialTiles)
+        {
+            llvm::GlobalVariable* tiledInput = function.GetModule().GlobalArray(emitters::GetVariableType<ValueType>(), "tiledInput", (2 * numTileRows + 2) * tiledInputStride);
+            pTiledInput = function.PointerOffset(tiledInput, 0); // convert "global variable" to a pointer
+            llvm::GlobalVariable* tiledOutput = function.GetModule().GlobalArray(emitters::GetVariableType<ValueType>(), "tiledOutput", 2 * numTileRows * tiledOutputStride);
+            pTiledOutput = function.PointerOffset(tiledOutput, 0);
+
+            // The extra row and column are never written, so they stay zero
+            auto copyLoop = function.ForLoop();
+            copyLoop.Begin(paddedHeight);
+            {
+                auto rowIndex = copyLoop.LoadIterationVariable();
+                auto inputOffset = function.Operator(times, rowIndex, function.Literal<int>(inputStride));
+                auto tiledInputOffset = function.Operator(times, rowIndex, function.Literal<int>(tiledInputStride));
+                function.MemoryCopy<ValueType>(pInput, inputOffset, pTiledInput, tiledInputOffset, function.Literal<int>(inputStride));
+            }
+            copyLoop.End();
+        }
+
+        llvm::GlobalVariable* transformedInput = function.GetModule().GlobalArray(emitters::GetVariableType<ValueType>(), "transformedInput", 16 * inputDepth * numTiles);
+        auto pTransformedInput = function.PointerOffset(transformedInput, 0);
+        llvm::GlobalVariable* transformedOutput = function.GetModule().GlobalArray(emitters::GetVariableType<ValueType>(), "transformedOutput", 16 * numFilters * numTiles);
+        auto pTransformedOutput = function.PointerOffset(transformedOutput, 0);
+
+        auto add = [&function](llvm::Value* a, llvm::Value* b) { return function.Operator(plusFloat, a, b); };
+        auto subtract = [&function](llvm::Value* a, llvm::Value* b) { return function.Operator(minusFloat, a, b); };
+
+        // V = B^T d B for each 4x4 input tile d, stored as 16 inputDepth x numTiles matrices
+        auto inputTileRowLoop = function.ForLoop();
+        inputTileRowLoop.Begin(numTileRows);
+        {
+            auto tileRow = inputTileRowLoop.LoadIterationVariable();
+            auto tileColumnLoop = function.ForLoop();
+            tileColumnLoop.Begin(numTileColumns);
+            {
+                auto tileColumn = tileColumnLoop.LoadIterationVariable();
+                auto tile = function.Operator(plus, function.Operator(times, tileRow, function.Literal<int>(numTileColumns)), tileColumn);
+                auto tileRowOffset = function.Operator(times, tileRow, function.Literal<int>(2 * tiledInputStride));
+                auto tileOffset = function.Operator(plus, tileRowOffset, function.Operator(times, tileColumn, function.Literal<int>(2 * inputDepth)));
+
+                auto channelLoop = function.ForLoop();
+                channelLoop.Begin(inputDepth);
+                {
+                    auto c = channelLoop.LoadIterationVariable();
+                    auto inputOffset = function.Operator(plus, tileOffset, c);
+                    auto transformedOffset = function.Operator(plus, function.Operator(times, c, function.Literal<int>(numTiles)), tile);
+
+                    llvm::Value* d[4][4];
+                    for (int i = 0; i < 4; i++)
+                    {
+                        for (int j = 0; j < 4; j++)
+                        {
+                            d[i][j] = function.ValueAt(pTiledInput, function.Operator(plus, inputOffset, function.Literal<int>(i * tiledInputStride + j * inputDepth)));
+                        }
+                    }
+
+                    llvm::Value* BTd[4][4];
+                    for (int j = 0; j < 4; j++)
+                    {
+                        BTd[0][j] = subtract(d[0][j], d[2][j]);
+                        BTd[1][j] = add(d[1][j], d[2][j]);
+                        BTd[2][j] = subtract(d[2][j], d[1][j]);
+                        BTd[3][j] = subtract(d[1][j], d[3][j]);
+                    }
+
+                    for (int i = 0; i < 4; i++)
+                    {
+                        llvm::Value* V[4] = { subtract(BTd[i][0], BTd[i][2]), add(BTd[i][1], BTd[i][2]), subtract(BTd[i][2], BTd[i][1]), subtract(BTd[i][1], BTd[i][3]) };
+                        for (int j = 0; j < 4; j++)
+                        {
+                            auto index = function.Operator(plus, transformedOffset, function.Literal<int>((i * 4 + j) * inputDepth * numTiles));
+                            function.SetValueAt(pTransformedInput, index, V[j]);
+                        }
+                    }
+                }
+                channelLoop.End();
+            }
+            tileColumnLoop.End();
+        }
+        inputTileRowLoop.End();
+
+        // M = U V for each of the 16 tile elements, where U is the numFilters x inputDepth matrix of transformed weights
+        for (int element = 0; element < 16; element++)
+        {
+            llvm::Value* U = function.PointerOffset(pWeights, element * numFilters * inputDepth);
+            llvm::Value* V = function.PointerOffset(pTransformedInput, element * inputDepth * numTiles);
+            llvm::Value* M = function.PointerOffset(pTransformedOutput, element * numFilters * numTiles);
+            EmitMatrixMatrixMultiply<ValueType>(function, useBlas, false, false, numFilters, numTiles, inputDepth, U, inputDepth, V, numTiles, M, numTiles);
+        }
+
+        // Y = A^T M A for each tile
+        auto outputTileRowLoop = function.ForLoop();
+        outputTileRowLoop.Begin(numTileRows);
+        {
+            auto tileRow = outputTileRowLoop.LoadIterationVariable();
+            auto tileColumnLoop = function.ForLoop();
+            tileColumnLoop.Begin(numTileColumns);
+            {
+                auto tileColumn = tileColumnLoop.LoadIterationVariable();
+                auto tile = function.Operator(plus, function.Operator(times, tileRow, function.Literal<int>(numTileColumns)), tileColumn);
+                auto tileRowOffset = function.Operator(times, tileRow, function.Literal<int>(2 * tiledOutputStride));
+                auto tileOffset = function.Operator(plus, tileRowOffset, function.Operator(times, tileColumn, function.Literal<int>(2 * numFilters)));
+
+                auto filterLoop = function.ForLoop();
+                filterLoop.Begin(numFilters);
+                {
+                    auto f = filterLoop.LoadIterationVariable();
+                    auto transformedOffset = function.Operator(plus, function.Operator(times, f, function.Literal<int>(numTiles)), tile);
+                    auto outputOffset = function.Operator(plus, tileOffset, f);
+
+                    llvm::Value* ATm[2][4];
+                    for (int j = 0; j < 4; j++)
+                    {
+                        llvm::Value* m[4];
+                        for (int i = 0; i < 4; i++)
+                        {
+                            m[i] = function.ValueAt(pTransformedOutput, function.Operator(plus, transformedOffset, function.Literal<int>((i * 4 + j) * numFilters * numTiles)));
+                        }
+                        ATm[0][j] = add(add(m[0], m[1]), m[2]);
+                        ATm[1][j] = subtract(subtract(m[1], m[2]), m[3]);
+                    }
+
+                    for (int i = 0; i < 2; i++)
+                    {
+                        llvm::Value* Y[2] = { add(add(ATm[i][0], ATm[i][1]), ATm[i][2]), subtract(subtract(ATm[i][1], ATm[i][2]), ATm[i][3]) };
+                        for (int j = 0; j < 2; j++)
+                        {
+                            auto index = function.Operator(plus, outputOffset, function.Literal<int>(i * tiledOutputStride + j * numFilters));
+                            function.SetValueAt(pTiledOutput, index, Y[j]);
+                        }
+                    }
+                }
+                filterLoop.End();
+            }
+            tileColumnLoop.End();
+        }
+        outputTileRowLoop.End();
+
+        if (hasPartialTiles)
+        {
+            auto copyLoop = function.ForLoop();
+            copyLoop.Begin(outputHeight);
+            {
+                auto rowIndex = copyLoop.LoadIterationVariable();
+                auto tiledOutputOffset = function.Operator(times, rowIndex, function.Literal<int>(tiledOutputStride));
+                auto outputOffset = function.Operator(times, rowIndex, function.Literal<int>(outputStride));
+                function.MemoryCopy<ValueType>(pTiledOutput, tiledOutputOffset, pOutput, outputOffset, function.Literal<int>(outputStride));
+            }
+            copyLoop.End();
+        }
+    }
+
     // Explicit specializations
     template class ConvolutionalLayerNode<float>;
     template class ConvolutionalLayerNode<double>;
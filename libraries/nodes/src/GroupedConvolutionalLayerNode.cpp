@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GroupedConvolutionalLayerNode.cpp (nodes)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GroupedConvolutionalLayerNode.h"
+#include "ConstantNode.h"
+
+// stl
+#include <cassert>
+#include <vector>
+
+namespace ell
+{
+namespace nodes
+{
+    namespace
+    {
+        size_t GetGroupedConvolutionOutputSize(const PortMemoryLayout& outputLayout)
+        {
+            return outputLayout.stride[0] * outputLayout.stride[1] * outputLayout.stride[2];
+        }
+    }
+
+    //
+    // GroupedConvolutionalLayerNode
+    //
+
+    template <typename ValueType>
+    GroupedConvolutionalLayerNode<ValueType>::GroupedConvolutionalLayerNode(const model::PortElements<ValueType>& input, const predictors::neural::GroupedConvolutionalLayer<ValueType>& layer)
+        : NeuralNetworkLayerNode<GroupedConvolutionalLayerNode<ValueType>, predictors::neural::GroupedConvolutionalLayer<ValueType>, ValueType>(input, layer)
+    {
+        // As for convolutional layers, the input size includes padding, so we undo the padding added by the base class
+        auto& inputLayout = this->GetInputMemoryLayout();
+        auto numDimensions = this->NumInputDimensions();
+        for (int index = 0; index < numDimensions; ++index)
+        {
+            inputLayout.size[index] -= 2 * inputLayout.offset[index];
+            inputLayout.stride[index] -= 2 * inputLayout.offset[index];
+        }
+    }
+
+    template <typename ValueType>
+    bool GroupedConvolutionalLayerNode<ValueType>::Refine(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(this->input.GetPortElements());
+
+        // One row per element of the receptive field volume of a group, one column per filter
+        auto weightsValues = this->GetLayer().GetShapedWeightsMatrix().ToArray();
+        auto weightsNode = transformer.AddNode<ConstantNode<ValueType>>(weightsValues);
+        auto convNode = transformer.AddNode<GroupedConvolutionNode<ValueType>>(newInput, this->GetInputMemoryLayout(), weightsNode->output, this->GetOutputMemoryLayout(), this->GetLayer().GetConvolutionalParameters());
+        transformer.MapNodeOutput(this->output, convNode->output);
+        return true;
+    }
+
+    //
+    // GroupedConvolutionNode
+    //
+
+    template <typename ValueType>
+    GroupedConvolutionNode<ValueType>::GroupedConvolutionNode()
+        : CompilableNode({ &_input }, { &_output }), _input(this, {}, inputPortName), _filterWeights(this, {}, filterWeightsPortName), _output(this, outputPortName, 0)
+    {
+    }
+
+    template <typename ValueType>
+    GroupedConvolutionNode<ValueType>::GroupedConvolutionNode(const model::PortElements<ValueType>& input, const PortMemoryLayout& inputMemoryLayout, const model::PortElements<ValueType>& filterWeights, const PortMemoryLayout& outputMemoryLayout, const predictors::neural::GroupedConvolutionalParameters& convolutionalParameters)
+        : CompilableNode({ &_input, &_filterWeights }, { &_output }), _input(this, input, inputPortName), _filterWeights(this, filterWeights, filterWeightsPortName), _output(this, outputPortName, GetGroupedConvolutionOutputSize(outputMemoryLayout)), _inputMemoryLayout(inputMemoryLayout), _outputMemoryLayout(outputMemoryLayout), _convolutionalParameters(convolutionalParameters)
+    {
+    }
+
+    template <typename ValueType>
+    void GroupedConvolutionNode<ValueType>::Copy(model::ModelTransformer& transformer) const
+    {
+        auto newInput = transformer.TransformPortElements(_input.GetPortElements());
+        auto newFilterWeights = transformer.TransformPortElements(_filterWeights.GetPortElements());
+        auto newNode = transformer.AddNode<GroupedConvolutionNode<ValueType>>(newInput, _inputMemoryLayout, newFilterWeights, _outputMemoryLayout, _convolutionalParameters);
+        transformer.MapNodeOutput(this->output, newNode->output);
+    }
+
+    template <typename ValueType>
+    void GroupedConvolutionNode<ValueType>::Compute() const
+    {
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const size_t paddedWidth = inputLayout.stride[1];
+        const size_t inputDepth = inputLayout.size[2];
+        const size_t filterWidth = convParams.receptiveField;
+        const size_t stride = convParams.stride;
+
+        const size_t outputHeight = outputLayout.size[0];
+        const size_t outputWidth = outputLayout.size[1];
+        const size_t numFilters = outputLayout.size[2];
+
+        const size_t numGroupChannels = inputDepth / convParams.numGroups;
+        const size_t numGroupFilters = numFilters / convParams.numGroups;
+
+        auto inputData = _input.GetValue();
+        auto filterWeightsData = _filterWeights.GetValue();
+        assert(filterWeightsData.size() == filterWidth * filterWidth * numGroupChannels * numFilters);
+
+        std::vector<ValueType> output(GetGroupedConvolutionOutputSize(outputLayout));
+        for (size_t row = 0; row < outputHeight; row++)
+        {
+            for (size_t column = 0; column < outputWidth; column++)
+            {
+                const size_t outputOffset = ((row + outputLayout.offset[0]) * outputLayout.stride[1] + column + outputLayout.offset[1]) * outputLayout.stride[2] + outputLayout.offset[2];
+                for (size_t f = 0; f < numFilters; f++)
+                {
+                    const size_t firstChannel = (f / numGroupFilters) * numGroupChannels;
+                    ValueType sum = 0;
+                    for (size_t i = 0; i < filterWidth; i++)
+                    {
+                        for (size_t j = 0; j < filterWidth; j++)
+                        {
+                            const size_t inputOffset = ((row * stride + i) * paddedWidth + column * stride + j) * inputDepth + firstChannel;
+                            const size_t weightsOffset = (i * filterWidth + j) * numGroupChannels * numFilters + f;
+                            for (size_t c = 0; c < numGroupChannels; c++)
+                            {
+                                sum += filterWeightsData[weightsOffset + c * numFilters] * inputData[inputOffset + c];
+                            }
+                        }
+                    }
+                    output[outputOffset + f] = sum;
+                }
+            }
+        }
+
+        _output.SetOutput(output);
+    }
+
+    template <typename ValueType>
+    void GroupedConvolutionNode<ValueType>::Compile(model::IRMapCompiler& compiler, emitters::IRFunctionEmitter& function)
+    {
+        // convenience operator names
+        const auto plus = emitters::TypedOperator::add;
+        const auto times = emitters::TypedOperator::multiply;
+        const auto divide = emitters::TypedOperator::divideSigned;
+        const auto plusFloat = emitters::TypedOperator::addFloat;
+        const auto timesFloat = emitters::TypedOperator::multiplyFloat;
+
+        // input is a (h+2p) x (w+2p) x d array, including the padding
+        llvm::Value* pInput = compiler.EnsurePortEmitted(this->input);
+
+        // weights are a (k*k*d/g) x f matrix
+        llvm::Value* pWeights = compiler.EnsurePortEmitted(this->filterWeights);
+
+        llvm::Value* pOutput = compiler.EnsurePortEmitted(this->output);
+
+        // Model parameters
+        auto&& inputLayout = this->GetInputMemoryLayout();
+        auto&& outputLayout = this->GetOutputMemoryLayout();
+        auto&& convParams = this->GetConvolutionalParameters();
+        const int paddedWidth = inputLayout.stride[1];
+        const int inputDepth = inputLayout.size[2];
+        const int filterWidth = convParams.receptiveField;
+        const int stride = convParams.stride;
+
+        const int outputHeight = outputLayout.size[0];
+        const int outputWidth = outputLayout.size[1];
+        const int numFilters = outputLayout.size[2];
+        const int outputRowStride = outputLayout.stride[1] * outputLayout.stride[2];
+        const int outputColumnStride = outputLayout.stride[2];
+        const int outputOffset = outputLayout.offset[0] * outputRowStride + outputLayout.offset[1] * outputColumnStride + outputLayout.offset[2];
+
+        const int numGroupChannels = inputDepth / convParams.numGroups;
+        const int numGroupFilters = numFilters / convParams.numGroups;
+
+        llvm::Value* accum = function.Variable(emitters::GetVariableType<ValueType>(), "accum");
+
+        auto rowLoop = function.ForLoop();
+        rowLoop.Begin(outputHeight);
+        {
+            auto row = rowLoop.LoadIterationVariable();
+            auto inputRowOffset = function.Operator(times, row, function.Literal<int>(stride * paddedWidth * inputDepth));
+            auto outputRowOffset = function.Operator(plus, function.Operator(times, row, function.Literal<int>(outputRowStride)), function.Literal<int>(outputOffset));
+
+            auto columnLoop = function.ForLoop();
+            columnLoop.Begin(outputWidth);
+            {
+                auto column = columnLoop.LoadIterationVariable();
+                auto inputColumnOffset = function.Operator(plus, inputRowOffset, function.Operator(times, column, function.Literal<int>(stride * inputDepth)));
+                auto outputColumnOffset = function.Operator(plus, outputRowOffset, function.Operator(times, column, function.Literal<int>(outputColumnStride)));
+
+                auto filterLoop = function.ForLoop();
+                filterLoop.Begin(numFilters);
+                {
+                    auto f = filterLoop.LoadIterationVariable();
+
+                    // The first input channel of the filter's group
+                    llvm::Value* firstChannel = f;
+                    if (numGroupFilters != 1 || numGroupChannels != 1)
+                    {
+                        auto group = function.Operator(divide, f, function.Literal<int>(numGroupFilters));
+                        firstChannel = function.Operator(times, group, function.Literal<int>(numGroupChannels));
+                    }
+                    auto inputOffset = function.Operator(plus, inputColumnOffset, firstChannel);
+
+                    function.Store(accum, function.Literal(static_cast<ValueType>(0.0)));
+                    for (int i = 0; i < filterWidth; i++)
+                    {
+                        for (int j = 0; j < filterWidth; j++)
+                        {
+                            auto fieldInputOffset = function.Operator(plus, inputOffset, function.Literal<int>((i * paddedWidth + j) * inputDepth));
+                            auto fieldWeightsOffset = function.Operator(plus, f, function.Literal<int>((i * filterWidth + j) * numGroupChannels * numFilters));
+                            if (numGroupChannels == 1)
+                            {
+                                // Depthwise convolution: one input channel per filter
+                                auto value = function.Operator(timesFloat, function.ValueAt(pWeights, fieldWeightsOffset), function.ValueAt(pInput, fieldInputOffset));
+                                function.OperationAndUpdate(accum, plusFloat, value);
+                            }
+                            else
+                            {
+                                auto channelLoop = function.ForLoop();
+                                channelLoop.Begin(numGroupChannels);
+                                {
+                                    auto c = channelLoop.LoadIterationVariable();
+                                    auto inputIndex = function.Operator(plus, fieldInputOffset, c);
+                                    auto weightsIndex = function.Operator(plus, fieldWeightsOffset, function.Operator(times, c, function.Literal<int>(numFilters)));
+                                    auto value = function.Operator(timesFloat, function.ValueAt(pWeights, weightsIndex), function.ValueAt(pInput, inputIndex));
+                                    function.OperationAndUpdate(accum, plusFloat, value);
+                                }
+                                channelLoop.End();
+                            }
+                        }
+                    }
+
+                    auto outputIndex = function.Operator(plus, outputColumnOffset, f);
+                    function.SetValueAt(pOutput, outputIndex, function.Load(accum));
+                }
+                filterLoop.End();
+            }
+            columnLoop.End();
+        }
+        rowLoop.End();
+    }
+
+    // Explicit specializations
+    template class GroupedConvolutionalLayerNode<float>;
+    template class GroupedConvolutionalLayerNode<double>;
+    template class GroupedConvolutionNode<float>;
+    template class GroupedConvolutionNode<double>;
+} // nodes
+} // ell
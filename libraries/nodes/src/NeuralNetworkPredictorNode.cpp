@@ -41,7 +41,7 @@ namespace nodes
 
     template <typename ValueType>
     NeuralNetworkPredictorNode<ValueType>::NeuralNetworkPredictorNode(const model::PortElements<ValueType>& input, const PredictorType& predictor)
-        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, GetShapeSize(predictor.GetOutputShape())), _predictor(predictor)
+        : Node({ &_input }, { &_output }), _input(this, input, inputPortName), _output(this, outputPortName, GetShapeSize(predictor.GetOutputShape())), _predictor(predictor.GetFoldedCopy())
     {
         assert(input.Size() == GetShapeSize(_predictor.GetInputShape()));
     }
@@ -61,6 +61,7 @@ namespace nodes
         Node::ReadFromArchive(archiver);
         archiver[inputPortName] >> _input;
         archiver["predictor"] >> _predictor;
+        _predictor.FoldLayers();
     }
 
     template <typename ValueType>
@@ -56,6 +56,9 @@ namespace nodes
         node = TryAddLayerNode<predictors::neural::FullyConnectedLayer<ValueType>, FullyConnectedLayerNode<ValueType>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
+        node = TryAddLayerNode<predictors::neural::GroupedConvolutionalLayer<ValueType>, GroupedConvolutionalLayerNode<ValueType>>(transformer, layer, layerInputs);
+        if (node != nullptr) return node;
+
         node = TryAddLayerNode<predictors::neural::PoolingLayer<ValueType, predictors::neural::MaxPoolingFunction>, PoolingLayerNode<ValueType, predictors::neural::MaxPoolingFunction>>(transformer, layer, layerInputs);
         if (node != nullptr) return node;
 
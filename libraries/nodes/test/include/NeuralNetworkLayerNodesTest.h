@@ -24,6 +24,7 @@ void TestBiasLayerNode();
 void TestBinaryConvolutionalLayerNode();
 void TestConvolutionalLayerNode();
 void TestFullyConnectedLayerNode();
+void TestGroupedConvolutionalLayerNode();
 void TestPoolingLayerNode();
 void TestScalingLayerNode();
 void TestSoftmaxLayerNode();
@@ -15,6 +15,7 @@
 #include "BinaryConvolutionalLayerNode.h"
 #include "ConvolutionalLayerNode.h"
 #include "FullyConnectedLayerNode.h"
+#include "GroupedConvolutionalLayerNode.h"
 #include "NeuralNetworkPredictorNode.h"
 #include "PoolingLayerNode.h"
 #include "ScalingLayerNode.h"
@@ -35,6 +36,7 @@
 #include "BinaryConvolutionalLayer.h"
 #include "ConvolutionalLayer.h"
 #include "FullyConnectedLayer.h"
+#include "GroupedConvolutionalLayer.h"
 #include "InputLayer.h"
 #include "PoolingLayer.h"
 #include "ReLUActivation.h"
@@ -433,6 +435,88 @@ void TestConvolutionalLayerNode()
     inputNode2->SetInput(input.ToArray());
     auto modelOutput2 = model2.ComputeOutput(computeNode2->output);
     testing::ProcessTest("Testing ConvolutionalLayer (regular) compute", testing::IsEqual(modelOutput2, output2.ToArray()));
+
+    //
+    // Verify ConvolutionalLayer with Winograd method
+    //
+    convolutionalParams.method = ConvolutionMethod::winograd;
+    ConvolutionalLayer<ElementType> layer3(parameters, convolutionalParams, weights);
+    layer3.Compute();
+    auto output3 = layer3.GetOutput();
+
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd), values",
+                         testing::IsEqual(output3(0, 0, 0), v1, eps) &&
+                             testing::IsEqual(output3(0, 0, 1), v2, eps) &&
+                             testing::IsEqual(output3(0, 1, 0), v3, eps) &&
+                             testing::IsEqual(output3(0, 1, 1), v4, eps));
+    // Create model
+    model::Model model3;
+    auto inputNode3 = model3.AddNode<model::InputNode<double>>(input.Size());
+    auto computeNode3 = model3.AddNode<nodes::ConvolutionalLayerNode<double>>(inputNode3->output, layer3);
+
+    // Refine the model, to compute with a WinogradConvolutionNode
+    model::TransformContext context;
+    model::ModelTransformer transformer;
+    auto refinedModel = transformer.RefineModel(model3, context);
+    auto refinedInputNode = transformer.GetCorrespondingInputNode(inputNode3);
+    auto refinedOutputElements = transformer.GetCorrespondingOutputs(model::PortElements<double>{ computeNode3->output });
+
+    refinedInputNode->SetInput(input.ToArray());
+    auto modelOutput3 = refinedModel.ComputeOutput(refinedOutputElements);
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd) compute", testing::IsEqual(modelOutput3, output3.ToArray(), eps));
+}
+
+void TestGroupedConvolutionalLayerNode()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using ElementType = double;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+
+    TensorType input(6, 6, 4); // Input includes padding
+    input.Fill(0);
+    for (size_t i = 1; i < 5; i++)
+    {
+        for (size_t j = 1; j < 5; j++)
+        {
+            for (size_t k = 0; k < 4; k++)
+            {
+                input(i, j, k) = static_cast<ElementType>((i * 3 + j * 5 + k) % 7) - 3;
+            }
+        }
+    }
+
+    for (size_t numGroups : { 2, 4 })
+    {
+        const std::string name = numGroups == 4 ? "depthwise" : "2 groups";
+        TensorType weights(3 * 4, 3, 4 / numGroups);
+        weights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2); });
+        LayerParameters parameters{ input, ZeroPadding(1), { 4, 4, 4 }, NoPadding() };
+        GroupedConvolutionalLayer<ElementType> layer(parameters, GroupedConvolutionalParameters{ 3, 1, numGroups }, weights);
+        layer.Compute();
+        auto output = layer.GetOutput();
+
+        // Create model
+        model::Model model;
+        auto inputNode = model.AddNode<model::InputNode<double>>(input.Size());
+        auto computeNode = model.AddNode<nodes::GroupedConvolutionalLayerNode<double>>(inputNode->output, layer);
+
+        inputNode->SetInput(input.ToArray());
+        auto modelOutput = model.ComputeOutput(computeNode->output);
+        testing::ProcessTest("Testing GroupedConvolutionalLayerNode (" + name + ") compute", testing::IsEqual(modelOutput, output.ToArray()));
+
+        // Refine the model, to compute with a GroupedConvolutionNode
+        model::TransformContext context;
+        model::ModelTransformer transformer;
+        auto refinedModel = transformer.RefineModel(model, context);
+        auto refinedInputNode = transformer.GetCorrespondingInputNode(inputNode);
+        auto refinedOutputElements = transformer.GetCorrespondingOutputs(model::PortElements<double>{ computeNode->output });
+
+        refinedInputNode->SetInput(input.ToArray());
+        auto refinedOutput = refinedModel.ComputeOutput(refinedOutputElements);
+        testing::ProcessTest("Testing GroupedConvolutionalLayerNode (" + name + ") refined compute", testing::IsEqual(refinedOutput, output.ToArray()));
+    }
 }
 
 void TestBinaryConvolutionalLayerNode()
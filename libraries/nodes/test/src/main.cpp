@@ -55,6 +55,7 @@ int main()
         TestBinaryConvolutionalLayerNode();
         TestConvolutionalLayerNode();
         TestFullyConnectedLayerNode();
+        TestGroupedConvolutionalLayerNode();
         TestPoolingLayerNode();
         TestScalingLayerNode();
         TestSoftmaxLayerNode();
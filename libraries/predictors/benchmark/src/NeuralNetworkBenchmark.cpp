@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     NeuralNetworkBenchmark.cpp (predictors_neural_network_benchmark)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "NeuralNetworkPredictor.h"
+
+// math
+#include "Parallel.h"
+
+// utilities
+#include "MillisecondTimer.h"
+#include "ThreadPool.h"
+
+// stl
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace ell;
+using namespace ell::predictors::neural;
+
+// Measures how NeuralNetworkPredictor::Predict scales with the number of threads, on a network with the
+// structure of the darknet and CNTK image classifiers imported by the tools in tools/importers: blocks of
+// 3x3 convolution, batch normalization, scaling, bias, leaky ReLU and 2x2 max pooling, followed by a fully
+// connected classifier. The optional command line arguments are the width of the (square) input image,
+// the number of predictions per measurement and the largest number of threads.
+
+namespace
+{
+using ElementType = float;
+using PredictorType = predictors::NeuralNetworkPredictor<ElementType>;
+using LayerParameters = Layer<ElementType>::LayerParameters;
+using TensorType = Layer<ElementType>::TensorType;
+using MatrixType = Layer<ElementType>::MatrixType;
+using VectorType = Layer<ElementType>::VectorType;
+
+template <typename GeneratorType>
+VectorType GenerateVector(size_t size, GeneratorType& generator)
+{
+    VectorType vector(size);
+    vector.Generate(generator);
+    return vector;
+}
+
+PredictorType CreateNetwork(size_t imageSize, const std::vector<size_t>& numFilters, size_t numClasses)
+{
+    std::default_random_engine engine(1234);
+    std::normal_distribution<ElementType> normal(0, 0.1f);
+    std::uniform_real_distribution<ElementType> uniform(0.5f, 1.5f);
+    auto weightGenerator = [&]() { return normal(engine); };
+    auto positiveGenerator = [&]() { return uniform(engine); };
+
+    // The input layer pads its output for the first convolution
+    size_t size = imageSize;
+    size_t numChannels = 3;
+    typename Layer<ElementType>::Shape paddedShape = { size + 2, size + 2, numChannels };
+    InputLayer<ElementType>::InputParameters inputParameters = { { size, size, numChannels }, NoPadding(), paddedShape, ZeroPadding(1), 1 };
+    auto inputLayer = std::make_shared<InputLayer<ElementType>>(inputParameters);
+
+    PredictorType::Layers layers;
+    auto previousOutput = [&]() { return layers.empty() ? inputLayer->GetOutput() : layers.back()->GetOutput(); };
+    for (size_t blockIndex = 0; blockIndex < numFilters.size(); blockIndex++)
+    {
+        size_t filters = numFilters[blockIndex];
+        TensorType weights(3 * filters, 3, numChannels);
+        weights.Generate(weightGenerator);
+        ConvolutionalParameters convolutionalParameters{ 3, 1, ConvolutionMethod::columnwise, 1 };
+        layers.push_back(std::make_shared<ConvolutionalLayer<ElementType>>(LayerParameters{ previousOutput(), ZeroPadding(1), { size, size, filters }, NoPadding() }, convolutionalParameters, weights));
+        numChannels = filters;
+
+        layers.push_back(std::make_shared<BatchNormalizationLayer<ElementType>>(LayerParameters{ previousOutput(), NoPadding(), { size, size, numChannels }, NoPadding() }, GenerateVector(numChannels, weightGenerator), GenerateVector(numChannels, positiveGenerator)));
+        layers.push_back(std::make_shared<ScalingLayer<ElementType>>(LayerParameters{ previousOutput(), NoPadding(), { size, size, numChannels }, NoPadding() }, GenerateVector(numChannels, positiveGenerator)));
+        layers.push_back(std::make_shared<BiasLayer<ElementType>>(LayerParameters{ previousOutput(), NoPadding(), { size, size, numChannels }, NoPadding() }, GenerateVector(numChannels, weightGenerator)));
+        layers.push_back(std::make_shared<ActivationLayer<ElementType, LeakyReLUActivation>>(LayerParameters{ previousOutput(), NoPadding(), { size, size, numChannels }, NoPadding() }));
+
+        // Pool, padding the output if another convolution follows
+        size /= 2;
+        bool isLastBlock = blockIndex + 1 == numFilters.size();
+        auto outputPadding = isLastBlock ? NoPadding() : ZeroPadding(1);
+        size_t paddedSize = size + 2 * outputPadding.paddingSize;
+        layers.push_back(std::make_shared<PoolingLayer<ElementType, MaxPoolingFunction>>(LayerParameters{ previousOutput(), NoPadding(), { paddedSize, paddedSize, numChannels }, outputPadding }, PoolingParameters{ 2, 2 }));
+    }
+
+    MatrixType classifierWeights(numClasses, size * size * numChannels);
+    classifierWeights.Generate(weightGenerator);
+    layers.push_back(std::make_shared<FullyConnectedLayer<ElementType>>(LayerParameters{ previousOutput(), NoPadding(), { 1, 1, numClasses }, NoPadding() }, classifierWeights));
+    layers.push_back(std::make_shared<SoftmaxLayer<ElementType>>(LayerParameters{ previousOutput(), NoPadding(), { 1, 1, numClasses }, NoPadding() }));
+
+    return PredictorType(std::move(inputLayer), std::move(layers));
+}
+
+double MillisecondsPerPrediction(const PredictorType& predictor, const PredictorType::DataVectorType& input, size_t numPredictions)
+{
+    predictor.Predict(input);
+    utilities::MillisecondTimer timer;
+    for (size_t i = 0; i < numPredictions; ++i)
+    {
+        predictor.Predict(input);
+    }
+    return static_cast<double>(timer.Elapsed()) / numPredictions;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    size_t imageSize = 128;
+    size_t numPredictions = 10;
+    size_t maxThreads = std::thread::hardware_concurrency();
+    if (argc > 1)
+    {
+        imageSize = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2)
+    {
+        numPredictions = std::strtoul(argv[2], nullptr, 10);
+    }
+    if (argc > 3)
+    {
+        maxThreads = std::strtoul(argv[3], nullptr, 10);
+    }
+    maxThreads = std::max(maxThreads, static_cast<size_t>(1));
+
+    auto predictor = CreateNetwork(imageSize, { 16, 32, 64, 128, 256 }, 1000);
+
+    std::default_random_engine engine(5678);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<double> values(imageSize * imageSize * 3);
+    for (auto& value : values)
+    {
+        value = uniform(engine);
+    }
+    PredictorType::DataVectorType input(std::move(values));
+
+#if !defined(NDEBUG)
+    std::cout << "warning: debug build, the timings and speedups are only meaningful in a release build" << std::endl;
+#endif
+    std::cout << "darknet-style network, " << imageSize << "x" << imageSize << "x3 input, " << predictor.GetLayers().size() << " layers, " << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+    double serialMilliseconds = 0;
+    for (size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        // The layers split their own loops on the predictor's pool, and the matrix products run on the math pool
+        math::SetNumThreads(numThreads);
+        predictor.SetThreadPool(numThreads > 1 ? std::make_shared<utilities::ThreadPool>(numThreads) : nullptr);
+
+        auto milliseconds = MillisecondsPerPrediction(predictor, input, numPredictions);
+        if (numThreads == 1)
+        {
+            serialMilliseconds = milliseconds;
+        }
+        auto speedup = milliseconds > 0 ? serialMilliseconds / milliseconds : 0;
+        std::cout << "  " << numThreads << " threads\t" << milliseconds << " ms/prediction\t" << speedup << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -25,6 +25,7 @@
 #include "BinaryConvolutionalLayer.h"
 #include "ConvolutionalLayer.h"
 #include "FullyConnectedLayer.h"
+#include "GroupedConvolutionalLayer.h"
 #include "InputLayer.h"
 #include "LeakyReLUActivation.h"
 #include "MaxPoolingFunction.h"
@@ -37,10 +38,12 @@
 
 // utilities
 #include "IArchivable.h"
+#include "ThreadPool.h"
 
 // stl
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 
 namespace ell
@@ -64,6 +67,9 @@ namespace predictors
         /// <summary> A vector of layers. </summary>
         using Layers = std::vector<std::shared_ptr<neural::Layer<ElementType>>>;
 
+        /// <summary> Type of the tensors passed between layers. </summary>
+        using TensorType = typename neural::Layer<ElementType>::TensorType;
+
         NeuralNetworkPredictor() = default;
         NeuralNetworkPredictor(const NeuralNetworkPredictor&) = default;
 
@@ -82,7 +88,33 @@ namespace predictors
         /// <summary> Sets the underlying layers. </summary>
         ///
         /// <returns> The underlying vector of layers. </returns>
-        void SetLayers(Layers&& layers) { _layers = std::move(layers); }
+        void SetLayers(Layers&& layers);
+
+        /// <summary> Optimizes the layers for inference. Each run of batch normalization, scaling and bias layers that follows
+        /// a convolutional, grouped convolutional or fully connected layer is folded into the weights of that layer, and a
+        /// single bias layer when the run adds an offset. Activation layers are then marked to compute in place where the
+        /// previous layer's output has no padding. A predictor read from an archive keeps the archived layers, while
+        /// NeuralNetworkPredictorNode and the API predictor fold theirs. The layers are modified, so they should not be shared
+        /// with another predictor; use GetFoldedCopy otherwise. </summary>
+        void FoldLayers();
+
+        /// <summary> Returns a copy of this predictor with its layers folded, see FoldLayers. The copy gets its own layers by
+        /// archiving and unarchiving this predictor, so this predictor and its layers are not modified. </summary>
+        ///
+        /// <returns> The folded copy. </returns>
+        NeuralNetworkPredictor GetFoldedCopy() const;
+
+        /// <summary> Sets the thread pool used by the layers to split their work across threads. Without a thread
+        /// pool, which is the default, each layer computes on the calling thread. A predictor with a thread pool
+        /// should still be used by one thread at a time. </summary>
+        ///
+        /// <param name="threadPool"> The thread pool, or nullptr to compute on the calling thread. </param>
+        void SetThreadPool(std::shared_ptr<utilities::ThreadPool> threadPool);
+
+        /// <summary> Gets the thread pool used by the layers. </summary>
+        ///
+        /// <returns> The thread pool, or nullptr if the layers compute on the calling thread. </returns>
+        const std::shared_ptr<utilities::ThreadPool>& GetThreadPool() const { return _threadPool; }
 
         /// <summary> Gets the dimension of the input layer. </summary>
         ///
@@ -101,6 +133,15 @@ namespace predictors
         /// <returns> The prediction. </returns>
         const std::vector<ElementType>& Predict(const DataVectorType& dataVector) const;
 
+        /// <summary> Returns the outputs of the network for a batch of inputs. The whole batch is fed through each
+        /// layer before moving to the next one, which lets the convolutional and fully connected layers process it
+        /// with a single matrix-matrix multiplication. The outputs are the same as calling Predict on each input. </summary>
+        ///
+        /// <param name="dataVectors"> The data vectors. </param>
+        ///
+        /// <returns> The predictions, in the same order as the data vectors. </returns>
+        std::vector<std::vector<ElementType>> PredictBatch(const std::vector<DataVectorType>& dataVectors) const;
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -127,9 +168,17 @@ namespace predictors
         static void RegisterNeuralNetworkPredictorTypes(utilities::SerializationContext& context);
 
     private:
+        void CopyOutput(typename neural::Layer<ElementType>::ConstTensorReferenceType output, std::vector<ElementType>& result) const;
+        void ApplyThreadPool();
+        static bool CanFoldInto(const neural::Layer<ElementType>& layer);
+        static bool CanFold(const neural::Layer<ElementType>& layer);
+        static std::shared_ptr<neural::Layer<ElementType>> CreateScaledLayer(neural::Layer<ElementType>& layer, const typename neural::Layer<ElementType>::LayerParameters& layerParameters, const typename neural::Layer<ElementType>::VectorType& scale);
+        static void RedirectInput(neural::Layer<ElementType>& layer, const neural::Layer<ElementType>& previousLayer, const neural::Layer<ElementType>& newPreviousLayer);
+
         InputLayerReference _inputLayer;
         Layers _layers;
         mutable std::vector<ElementType> _output;
+        std::shared_ptr<utilities::ThreadPool> _threadPool;
     };
 }
 }
@@ -22,7 +22,10 @@ namespace neural
     public:
         using ActivationFunction = ActivationFunctionType<ElementType>;
         using LayerParameters = typename Layer<ElementType>::LayerParameters;
+        using TensorReferenceType = typename Layer<ElementType>::TensorReferenceType;
         using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::IsComputedInPlace;
+        using Layer<ElementType>::ParallelForBlocks;
 
         /// <summary> Instantiates an instance of an activation layer. </summary>
         ///
@@ -40,6 +43,11 @@ namespace neural
         /// <returns> An enum indicating the layer type. </returns>
         LayerType GetLayerType() const override { return LayerType::activation; }
 
+        /// <summary> Indicates if the layer can compute its output in place. Activations are applied element by element, so they can. </summary>
+        ///
+        /// <returns> `true`. </returns>
+        bool CanComputeInPlace() const override { return true; }
+
         /// <summary> Gets the activation function. </summary>
         ///
         /// <returns> A const reference to the activation function. </returns>
@@ -23,6 +23,7 @@ namespace neural
         using LayerParameters = typename Layer<ElementType>::LayerParameters;
         using VectorType = typename Layer<ElementType>::VectorType;
         using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::ParallelForBlocks;
         using Layer<ElementType>::NumOutputRowsMinusPadding;
         using Layer<ElementType>::NumOutputColumnsMinusPadding;
         using Layer<ElementType>::NumOutputChannels;
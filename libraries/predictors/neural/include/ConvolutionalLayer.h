@@ -24,7 +24,10 @@ namespace neural
         /// <summary> Normal method of doing convolution via reshaping input into columns and performing a gemm operation. </summary>
         columnwise = 0,
         /// <summary> A different method of doing convolution which avoids reshaping the input, and uses gemm on smaller matrices with diagonal sums to create output. </summary>
-        diagonal = 1
+        diagonal = 1,
+        /// <summary> Winograd's minimal filtering algorithm F(2x2, 3x3), which computes each 2x2 tile of the output with 16 multiplications
+        /// per channel instead of 36, as 16 gemm operations on transformed inputs and weights. Only applies to 3x3 filters with stride 1. </summary>
+        winograd = 2
     };
 
     /// <summary> Specifies the hyper parameters of the convolutional layer. </summary>
@@ -51,9 +54,13 @@ namespace neural
     public:
         using LayerParameters = typename Layer<ElementType>::LayerParameters;
         using MatrixType = typename Layer<ElementType>::MatrixType;
+        using MatrixReferenceType = typename Layer<ElementType>::MatrixReferenceType;
+        using WinogradMatrixType = math::ColumnMatrix<ElementType>;
         using TensorType = typename Layer<ElementType>::TensorType;
+        using TensorReferenceType = typename Layer<ElementType>::TensorReferenceType;
         using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
         using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::ParallelForBlocks;
         using Layer<ElementType>::NumOutputRowsMinusPadding;
         using Layer<ElementType>::NumOutputColumnsMinusPadding;
         using Layer<ElementType>::NumOutputChannels;
@@ -66,11 +73,31 @@ namespace neural
         ConvolutionalLayer(const LayerParameters& layerParameters, const ConvolutionalParameters& convolutionalParameters, TensorType weights);
 
         /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
-        ConvolutionalLayer() : _weights(math::Triplet{0, 0, 0}), _shapedInput(0, 0), _weightsMatrix(0, 0), _outputMatrix(0 ,0){}
+        ConvolutionalLayer() : _weights(math::Triplet{0, 0, 0}), _shapedInput(0, 0), _weightsMatrix(0, 0), _outputMatrix(0 ,0), _winogradWeights(0, 0), _winogradInput(0, 0), _winogradOutput(0, 0), _batchMemoryBudget(defaultBatchMemoryBudget) {}
 
         /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
         void Compute() override;
 
+        /// <summary> Computes the outputs of the layer for a batch of inputs. With the columnwise method, the receptive
+        /// fields of the inputs are reshaped side by side into one matrix, so that they are convolved by a single
+        /// matrix-matrix multiplication. The batch is split into sub-batches whose reshaped inputs and outputs fit in
+        /// the batch memory budget. </summary>
+        ///
+        /// <param name="inputs"> The batch of input tensors. </param>
+        /// <param name="outputs"> [out] The batch of output tensors, in the same order as the inputs. </param>
+        void ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs) override;
+
+        /// <summary> Gets the maximum size of the temporary matrices of ComputeBatch. </summary>
+        ///
+        /// <returns> The budget, in bytes. </returns>
+        size_t GetBatchMemoryBudget() const { return _batchMemoryBudget; }
+
+        /// <summary> Sets the maximum size of the temporary matrices of ComputeBatch, which is 64MB by default. A
+        /// sub-batch always holds at least one input, so a single input may exceed the budget. </summary>
+        ///
+        /// <param name="batchMemoryBudget"> The budget, in bytes. </param>
+        void SetBatchMemoryBudget(size_t batchMemoryBudget) { _batchMemoryBudget = batchMemoryBudget; }
+
         /// <summary> Indicates the kind of layer. </summary>
         ///
         /// <returns> An enum indicating the layer type. </returns>
@@ -91,6 +118,13 @@ namespace neural
         /// <returns> The weights, packed into a Matrix. </returns>
         const MatrixType& GetWeightsMatrix() const { return _weightsMatrix; }
 
+        /// <summary> Get the weights for the convolution filters, transformed for the Winograd method. Row (i * 4 + j) * numFilters + f
+        /// and column c hold element (i, j) of the 4x4 transform of the filter f for input channel c. The matrix is empty unless the
+        /// method is winograd. </summary>
+        ///
+        /// <returns> The transformed weights, packed into a column-major Matrix. </returns>
+        const WinogradMatrixType& GetWinogradWeightsMatrix() const { return _winogradWeights; }
+
         /// <summary> Gets the name of this type (for serialization). </summary>
         ///
         /// <returns> The name of this type. </returns>
@@ -114,7 +148,11 @@ namespace neural
     private:
         // Fills a matrix (backed by the array outputMatrix) where the columns the set of input values corresponding to a filter, stretched into a vector.
         // The number of columns is equal to the number of locations that a filter is slide over the input tensor.
-        void ReceptiveFieldToColumns(ConstTensorReferenceType input, MatrixType& shapedInput);
+        void ReceptiveFieldToColumns(ConstTensorReferenceType input, math::MatrixReference<ElementType, math::MatrixLayout::rowMajor> shapedInput);
+        void ColumnsToOutput(MatrixReferenceType outputMatrix, size_t firstColumn, TensorReferenceType output);
+        void ComputeWinograd(ConstTensorReferenceType input, TensorReferenceType output);
+        void TransformWinogradWeights();
+        void SelectConvolutionMethod();
 
         using Layer<ElementType>::_layerParameters;
         using Layer<ElementType>::_output;
@@ -125,6 +163,14 @@ namespace neural
         MatrixType _shapedInput;
         MatrixType _weightsMatrix;
         MatrixType _outputMatrix;
+
+        // Used by the Winograd method. These are column-major, so that the 16 transformed elements of a tile are contiguous.
+        WinogradMatrixType _winogradWeights;
+        WinogradMatrixType _winogradInput;
+        WinogradMatrixType _winogradOutput;
+
+        static constexpr size_t defaultBatchMemoryBudget = 64 * 1024 * 1024;
+        size_t _batchMemoryBudget;
     };
 
 }
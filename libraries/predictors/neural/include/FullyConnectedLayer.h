@@ -28,8 +28,10 @@ namespace neural
         using VectorType = typename Layer<ElementType>::VectorType;
         using MatrixType = typename Layer<ElementType>::MatrixType;
         using MatrixReferenceType = typename Layer<ElementType>::MatrixReferenceType;
+        using TensorType = typename Layer<ElementType>::TensorType;
         using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
         using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::ParallelForBlocks;
         using Layer<ElementType>::NumOutputRowsMinusPadding;
         using Layer<ElementType>::NumOutputColumnsMinusPadding;
         using Layer<ElementType>::NumOutputChannels;
@@ -54,6 +56,13 @@ namespace neural
         /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
         void Compute() override;
 
+        /// <summary> Computes the outputs of the layer for a batch of inputs. The flattened inputs are stacked as the
+        /// columns of a matrix, so that the whole batch is computed by a single matrix-matrix multiplication. </summary>
+        ///
+        /// <param name="inputs"> The batch of input tensors. </param>
+        /// <param name="outputs"> [out] The batch of output tensors, in the same order as the inputs. </param>
+        void ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs) override;
+
         /// <summary> Indicates the kind of layer. </summary>
         ///
         /// <returns> An enum indicating the layer type. </returns>
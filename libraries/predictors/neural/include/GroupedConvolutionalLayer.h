@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GroupedConvolutionalLayer.h (neural)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Layer.h"
+
+// math
+#include "Matrix.h"
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    /// <summary> Specifies the hyper parameters of the grouped convolutional layer. </summary>
+    struct GroupedConvolutionalParameters
+    {
+        /// <summary> Width and height of the receptive field that is slid over the input. </summary>
+        size_t receptiveField;
+
+        /// <summary> Number of elements to move/jump when sliding over the input. Typically this is 1 to 3. </summary>
+        size_t stride;
+
+        /// <summary> Number of groups that the input channels and the filters are divided into. Each filter only sees the
+        /// input channels of its own group. A layer with one group per input channel is a depthwise convolution. </summary>
+        size_t numGroups;
+    };
+
+    /// <summary> A layer in a neural network that implements a grouped convolution, where the input channels and the filters are
+    /// divided into groups, and each filter is only applied to the input channels of its group. This includes depthwise
+    /// convolution, where every input channel is its own group. The output is computed directly from the input, instead of
+    /// with a gemm operation on the reshaped input, since each filter only covers a small part of the input volume. </summary>
+    template <typename ElementType>
+    class GroupedConvolutionalLayer : public Layer<ElementType>
+    {
+    public:
+        using LayerParameters = typename Layer<ElementType>::LayerParameters;
+        using MatrixType = typename Layer<ElementType>::MatrixType;
+        using TensorType = typename Layer<ElementType>::TensorType;
+        using ConstTensorReferenceType = typename Layer<ElementType>::ConstTensorReferenceType;
+        using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::ParallelForBlocks;
+        using Layer<ElementType>::NumOutputRowsMinusPadding;
+        using Layer<ElementType>::NumOutputColumnsMinusPadding;
+        using Layer<ElementType>::NumOutputChannels;
+
+        /// <summary> Instantiates an instance of a grouped convolutional layer. </summary>
+        ///
+        /// <param name="layerParameters"> The parameters common to every layer. </param>
+        /// <param name="convolutionalParameters"> The hyperparameters for this convolutional layer. </param>
+        /// <param name="weights"> The set of weights to apply. Filter f occupies rows f * receptiveField to (f + 1) * receptiveField - 1,
+        /// and has one channel for each input channel in its group. </param>
+        GroupedConvolutionalLayer(const LayerParameters& layerParameters, const GroupedConvolutionalParameters& convolutionalParameters, TensorType weights);
+
+        /// <summary> Instantiates a blank instance. Used for unarchiving purposes only. </summary>
+        GroupedConvolutionalLayer() : _weights(math::Triplet{ 0, 0, 0 }), _shapedWeights(0, 0) {}
+
+        /// <summary> Feeds the input forward through the layer and returns a reference to the output. </summary>
+        void Compute() override;
+
+        /// <summary> Indicates the kind of layer. </summary>
+        ///
+        /// <returns> An enum indicating the layer type. </returns>
+        LayerType GetLayerType() const override { return LayerType::groupedConvolution; }
+
+        /// <summary> Get the parameters used to control convolution. </summary>
+        ///
+        /// <returns> A GroupedConvolutionalParameters struct. </returns>
+        const GroupedConvolutionalParameters& GetConvolutionalParameters() const { return _convolutionalParameters; }
+
+        /// <summary> Get the weights for the convolution filters. </summary>
+        ///
+        /// <returns> The weights, packed into a Tensor. </returns>
+        const TensorType& GetWeights() const { return _weights; }
+
+        /// <summary> Get the weights for the convolution filters, reshaped so that the weights that apply to the same input element
+        /// are contiguous. Row (i * receptiveField + j) * numGroupChannels + c and column f hold the weight of filter f at row i,
+        /// column j of the receptive field, for channel c of its group. </summary>
+        ///
+        /// <returns> The reshaped weights, packed into a Matrix. </returns>
+        const MatrixType& GetShapedWeightsMatrix() const { return _shapedWeights; }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        static std::string GetTypeName() { return utilities::GetCompositeTypeName<ElementType>("GroupedConvolutionalLayer"); }
+
+        /// <summary> Gets the name of this type (for serialization). </summary>
+        ///
+        /// <returns> The name of this type. </returns>
+        virtual std::string GetRuntimeTypeName() const override { return GetTypeName(); }
+
+        /// <summary> Adds an object's properties to an `Archiver` </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to add the values from the object to </param>
+        virtual void WriteToArchive(utilities::Archiver& archiver) const override;
+
+        /// <summary> Sets the internal state of the object according to the archiver passed in </summary>
+        ///
+        /// <param name="archiver"> The `Archiver` to get state from </param>
+        virtual void ReadFromArchive(utilities::Unarchiver& archiver) override;
+
+    private:
+        // Fills the reshaped weights from the weights tensor
+        void ShapeWeights();
+
+        using Layer<ElementType>::_layerParameters;
+        using Layer<ElementType>::_output;
+
+        GroupedConvolutionalParameters _convolutionalParameters;
+        TensorType _weights;
+        MatrixType _shapedWeights;
+    };
+}
+}
+}
+
+#include "../tcc/GroupedConvolutionalLayer.tcc"
@@ -18,11 +18,14 @@
 
 // utilities
 #include "IArchivable.h"
+#include "ThreadPool.h"
 
 // stl
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 namespace ell
 {
@@ -40,12 +43,13 @@ namespace neural
         binaryConvolution,
         convolution,
         fullyConnected,
+        groupedConvolution,
         input,
         pooling,
         scaling,
         softmax,
     };
-    static const std::string LayerNames[] = { "Base", "Activation", "BatchNormalization", "Bias", "BinaryConvolution", "Convolution", "FullyConnected", "Input", "Pooling", "Scaling", "Softmax" };
+    static const std::string LayerNames[] = { "Base", "Activation", "BatchNormalization", "Bias", "BinaryConvolution", "Convolution", "FullyConnected", "GroupedConvolution", "Input", "Pooling", "Scaling", "Softmax" };
 
     /// <summary> Enum that represents the type of padding values in a neural network layer. </summary>
     enum class PaddingScheme : int
@@ -171,6 +175,46 @@ namespace neural
         ///           This is a no-op for this layer type. </summary>
         virtual void Compute(){};
 
+        /// <summary> Computes the outputs of the layer for a batch of inputs. Each input tensor has the shape of the
+        /// configured input, including its padding, and each output tensor receives the shape of the output tensor,
+        /// including its padding. The default implementation computes the inputs one at a time; layers that can share
+        /// work across the batch, such as the convolutional and fully connected layers, override it. The contents
+        /// of the layer's own output tensor are unspecified afterwards. </summary>
+        ///
+        /// <param name="inputs"> The batch of input tensors. </param>
+        /// <param name="outputs"> [out] The batch of output tensors, in the same order as the inputs. </param>
+        virtual void ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs);
+
+        /// <summary> Sets the thread pool that Compute uses to split the work of the layer, by bands of rows or by
+        /// output channels. Without a thread pool, which is the default, the layer computes on the calling thread.
+        /// The matrix products inside the layers run on the math thread pool either way. </summary>
+        ///
+        /// <param name="threadPool"> The thread pool, or nullptr to compute on the calling thread. </param>
+        void SetThreadPool(std::shared_ptr<utilities::ThreadPool> threadPool) { _threadPool = std::move(threadPool); }
+
+        /// <summary> Gets the thread pool that Compute uses to split the work of the layer. </summary>
+        ///
+        /// <returns> The thread pool, or nullptr if the layer computes on the calling thread. </returns>
+        const std::shared_ptr<utilities::ThreadPool>& GetThreadPool() const { return _threadPool; }
+
+        /// <summary> Indicates if the layer can compute its output in place, in the tensor that holds its input,
+        /// because each output element only depends on the input element at the same position. </summary>
+        ///
+        /// <returns> `true` if the layer can compute its output in place. </returns>
+        virtual bool CanComputeInPlace() const { return false; }
+
+        /// <summary> Sets whether Compute overwrites the input tensor with the output, instead of writing the layer's own
+        /// output tensor. The input must then be the whole, unpadded, output of the previous layer, and the layers that
+        /// follow must read that tensor instead of this layer's output. ComputeBatch always writes separate outputs. </summary>
+        ///
+        /// <param name="computeInPlace"> Whether to compute in place. Ignored if the layer cannot compute in place. </param>
+        void SetComputeInPlace(bool computeInPlace) { _computeInPlace = computeInPlace && CanComputeInPlace(); }
+
+        /// <summary> Indicates if Compute overwrites the input tensor with the output. </summary>
+        ///
+        /// <returns> `true` if the layer computes its output in place. </returns>
+        bool IsComputedInPlace() const { return _computeInPlace; }
+
         /// <summary> Indicates the kind of layer. </summary>
         ///
         /// <returns> An enum indicating the layer type. </returns>
@@ -218,6 +262,13 @@ namespace neural
         /// <returns> Read/write reference to the output tensor. </returns>
         TensorReferenceType GetOutputMinusPadding();
 
+        /// <summary> Returns a read/write reference to the sub tensor of an output tensor of a batch that does not contain padding. </summary>
+        ///
+        /// <param name="output"> An output tensor with the shape of the layer's output tensor. </param>
+        ///
+        /// <returns> Read/write reference to the output tensor. </returns>
+        TensorReferenceType GetOutputMinusPadding(TensorType& output);
+
         /// <summary> Returns number of output rows minus padding. </summary>
         size_t NumOutputRowsMinusPadding() const { return _output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize; }
         /// <summary> Returns number of output columns minus padding. </summary>
@@ -225,6 +276,14 @@ namespace neural
         /// <summary> Returns number of output channels. </summary>
         size_t NumOutputChannels() const { return _output.NumChannels(); };
 
+        /// <summary> Splits the range [0, size) into contiguous blocks, one for each thread of the thread pool, and
+        /// calls a function on each block in parallel. Without a thread pool, the function is called once on the
+        /// whole range. The blocks must write to disjoint parts of the output. </summary>
+        ///
+        /// <param name="size"> The size of the range, typically a number of rows or channels. </param>
+        /// <param name="function"> The function, which takes the beginning and end of a block. </param>
+        void ParallelForBlocks(size_t size, const std::function<void(size_t, size_t)>& function) const;
+
         /// <summary> Sets the initial output values according to the padding scheme. </summary>
         void InitializeOutputValues(TensorType& output, PaddingParameters outputPaddingParameters);
 
@@ -234,6 +293,8 @@ namespace neural
 
         LayerParameters _layerParameters;
         TensorType _output;
+        std::shared_ptr<utilities::ThreadPool> _threadPool;
+        bool _computeInPlace = false;
     };
 
     /// <summary> A serialization context used during layer deserialization. Wraps an existing `SerializationContext`
@@ -39,6 +39,7 @@ namespace neural
         using PoolingFunction = PoolingFunctionType<ElementType>;
         using LayerParameters = typename Layer<ElementType>::LayerParameters;
         using Layer<ElementType>::GetOutputMinusPadding;
+        using Layer<ElementType>::ParallelForBlocks;
         
         /// <summary> Instantiates an instance of a pooling layer. </summary>
         ///
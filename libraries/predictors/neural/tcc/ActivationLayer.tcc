@@ -30,21 +30,25 @@ namespace neural
     template <typename ElementType, template <typename> class ActivationFunctionType>
     void ActivationLayer<ElementType, ActivationFunctionType>::Compute()
     {
-        auto output = GetOutputMinusPadding();
         auto input = _layerParameters.input;
 
+        // In place, the input is the unpadded output tensor of the previous layer, which is overwritten
+        auto output = IsComputedInPlace() ? TensorReferenceType(input.NumRows(), input.NumColumns(), input.NumChannels(), const_cast<ElementType*>(input.GetDataPointer())) : GetOutputMinusPadding();
+
         auto flattenedInput = input.ReferenceAsMatrix();
         auto flattenedOutput = output.ReferenceAsMatrix();
 
-        for (size_t i = 0; i < flattenedInput.NumRows(); i++)
-        {
-            auto rowVector = flattenedInput.GetMajorVector(i);
-            for (size_t j = 0; j < rowVector.Size(); j++)
+        ParallelForBlocks(flattenedInput.NumRows(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
             {
-                ElementType value = flattenedInput(i, j);
-                flattenedOutput(i, j) = _activation.Apply(value);
+                auto rowVector = flattenedInput.GetMajorVector(i);
+                for (size_t j = 0; j < rowVector.Size(); j++)
+                {
+                    ElementType value = flattenedInput(i, j);
+                    flattenedOutput(i, j) = _activation.Apply(value);
+                }
             }
-        }
+        });
     }
 
 }
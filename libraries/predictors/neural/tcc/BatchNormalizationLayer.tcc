@@ -53,8 +53,13 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto input = _layerParameters.input;
 
-        AssignValues(input, output);
-        math::TensorOperations::MultiplyAdd<math::Dimension::channel>(_multiplicationValues, _additionValues, output);
+        // Each band of rows is normalized independently
+        ParallelForBlocks(input.NumRows(), [&](size_t begin, size_t end) {
+            auto inputBand = input.GetSubTensor(begin, 0, 0, end - begin, input.NumColumns(), input.NumChannels());
+            auto outputBand = output.GetSubTensor(begin, 0, 0, end - begin, output.NumColumns(), output.NumChannels());
+            AssignValues(inputBand, outputBand);
+            math::TensorOperations::MultiplyAdd<math::Dimension::channel>(_multiplicationValues, _additionValues, outputBand);
+        });
     }
 
     template <typename ElementType>
@@ -6,6 +6,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iostream>
 
 namespace ell
@@ -22,7 +23,11 @@ namespace neural
         _weights(std::move(weights)),
         _shapedInput(convolutionalParameters.receptiveField * convolutionalParameters.receptiveField * _layerParameters.input.NumChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding()),
         _weightsMatrix(_layerParameters.outputShape[2], convolutionalParameters.receptiveField * convolutionalParameters.receptiveField * _layerParameters.input.NumChannels()),
-        _outputMatrix(NumOutputChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding())
+        _outputMatrix(NumOutputChannels(), NumOutputRowsMinusPadding() * NumOutputColumnsMinusPadding()),
+        _winogradWeights(0, 0),
+        _winogradInput(0, 0),
+        _winogradOutput(0, 0),
+        _batchMemoryBudget(defaultBatchMemoryBudget)
     {
         if(_weights.GetDataPointer() == nullptr)
         {
@@ -34,6 +39,28 @@ namespace neural
             throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "weights dimensions for a convolutional layer should be the size of the receptive field volume * number of filters");
         }
 
+        SelectConvolutionMethod();
+
+        // The reshaped weights are kept for every method: code generators that fall back to the normal method use them,
+        // and they are what gets archived
+        auto flattened = _weights.ReferenceAsMatrix();
+        for (size_t startRow = 0; startRow < flattened.NumRows() / convolutionalParameters.receptiveField; startRow++)
+        {
+            for (size_t row = 0; row < convolutionalParameters.receptiveField; row++)
+            {
+                auto weightsVector = flattened.GetMajorVector(startRow * convolutionalParameters.receptiveField + row);
+                for (size_t i = 0; i < weightsVector.Size(); i++)
+                {
+                    const size_t columnOffset = row * weightsVector.Size();
+                    _weightsMatrix(startRow, columnOffset + i) = weightsVector[i];
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::SelectConvolutionMethod()
+    {
         if (_convolutionalParameters.method == ConvolutionMethod::diagonal)
         {
             // Verify that we meet the criteria for doing Diagonal method. If not,
@@ -43,25 +70,23 @@ namespace neural
                 _convolutionalParameters.method = ConvolutionMethod::columnwise;
             }
         }
-
-        if (_convolutionalParameters.method == ConvolutionMethod::columnwise)
+        else if (_convolutionalParameters.method == ConvolutionMethod::winograd)
         {
-            // Use the columnwise method
-            // Reshape the weights
-            auto flattened = _weights.ReferenceAsMatrix();
-            for (size_t startRow = 0; startRow < flattened.NumRows() / convolutionalParameters.receptiveField; startRow++)
+            // The Winograd transforms are specific to 3x3 filters with stride 1. Otherwise,
+            // choose the normal method.
+            if (_convolutionalParameters.receptiveField != 3 || _convolutionalParameters.stride != 1)
             {
-                for (size_t row = 0; row < convolutionalParameters.receptiveField; row++)
-                {
-                    auto weightsVector = flattened.GetMajorVector(startRow * convolutionalParameters.receptiveField + row);
-                    for (size_t i = 0; i < weightsVector.Size(); i++)
-                    {
-                        const size_t columnOffset = row * weightsVector.Size();
-                        _weightsMatrix(startRow, columnOffset + i) = weightsVector[i];
-                    }
-                }
+                _convolutionalParameters.method = ConvolutionMethod::columnwise;
+            }
+            else
+            {
+                TransformWinogradWeights();
             }
         }
+        else
+        {
+            _convolutionalParameters.method = ConvolutionMethod::columnwise;
+        }
     }
 
     template <typename ElementType>
@@ -79,18 +104,11 @@ namespace neural
             math::Operations::Multiply(static_cast<ElementType>(1.0), _weightsMatrix, _shapedInput, static_cast<ElementType>(0.0), _outputMatrix);
 
             // Re-shape the output into the output tensor
-            for (size_t i = 0; i < output.NumRows(); i++)
-            {
-                for (size_t j = 0; j < output.NumColumns(); j++)
-                {
-                    for (size_t k = 0; k < output.NumChannels(); k++)
-                    {
-                        size_t row = k;
-                        size_t column = (i * output.NumColumns()) + j;
-                        output(i, j, k) = _outputMatrix(row, column);
-                    }
-                }
-            }
+            ColumnsToOutput(_outputMatrix, 0, output);
+        }
+        else if (_convolutionalParameters.method == ConvolutionMethod::winograd)
+        {
+            ComputeWinograd(input, output);
         }
         else
         {
@@ -108,67 +126,271 @@ namespace neural
             const size_t numFilters = _layerParameters.outputShape[2];
             auto weightsMatrix = _weights.ReferenceAsMatrix().Transpose();
 
-            for (size_t j = 0; j < numConvolutions; j++)
-            {
-                // Get the sub matrix for Vj
-                auto Vj = inputMatrix.GetSubMatrix(0, j * depth, inputMatrix.NumRows(), kt);
-
-                for (size_t filterStart = 0; filterStart < numFilters; filterStart += numFiltersAtAtime)
+            // Each convolution writes its own output column, so the convolutions are split across threads
+            ParallelForBlocks(numConvolutions, [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; j++)
                 {
-                    size_t numFiltersToUse = std::min(numFiltersAtAtime, numFilters - filterStart);
+                    // Get the sub matrix for Vj
+                    auto Vj = inputMatrix.GetSubMatrix(0, j * depth, inputMatrix.NumRows(), kt);
 
-                    auto Wl = weightsMatrix.GetSubMatrix(0, filterStart * _convolutionalParameters.receptiveField, weightsMatrix.NumRows(), numFiltersToUse * _convolutionalParameters.receptiveField);
+                    for (size_t filterStart = 0; filterStart < numFilters; filterStart += numFiltersAtAtime)
+                    {
+                        size_t numFiltersToUse = std::min(numFiltersAtAtime, numFilters - filterStart);
 
-                    MatrixType A(Vj.NumRows(), _convolutionalParameters.receptiveField * numFiltersToUse);
+                        auto Wl = weightsMatrix.GetSubMatrix(0, filterStart * _convolutionalParameters.receptiveField, weightsMatrix.NumRows(), numFiltersToUse * _convolutionalParameters.receptiveField);
 
-                    math::Operations::Multiply(static_cast<ElementType>(1.0), Vj, Wl, static_cast<ElementType>(0.0), A);
+                        MatrixType A(Vj.NumRows(), _convolutionalParameters.receptiveField * numFiltersToUse);
 
-                    for (size_t l = 0; l < numFiltersToUse; l++)
-                    {
-                        for (size_t row = 0; row < (A.NumRows() - 2 * paddingSize); row++)
+                        math::Operations::Multiply(static_cast<ElementType>(1.0), Vj, Wl, static_cast<ElementType>(0.0), A);
+
+                        for (size_t l = 0; l < numFiltersToUse; l++)
                         {
-                            ElementType sum = 0.0;
-                            for (size_t diagonal = 0; diagonal < _convolutionalParameters.receptiveField; diagonal++)
+                            for (size_t row = 0; row < (A.NumRows() - 2 * paddingSize); row++)
                             {
-                                sum += A(row + diagonal, l * _convolutionalParameters.receptiveField + diagonal);
+                                ElementType sum = 0.0;
+                                for (size_t diagonal = 0; diagonal < _convolutionalParameters.receptiveField; diagonal++)
+                                {
+                                    sum += A(row + diagonal, l * _convolutionalParameters.receptiveField + diagonal);
+                                }
+                                output(row, j, filterStart + l) = sum;
                             }
-                            output(row, j, filterStart + l) = sum;
                         }
                     }
                 }
+            });
+        }
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs)
+    {
+        if (_convolutionalParameters.method != ConvolutionMethod::columnwise)
+        {
+            Layer<ElementType>::ComputeBatch(inputs, outputs);
+            return;
+        }
+
+        // Each input of a sub-batch takes a block of columns of the reshaped input and output matrices, which are
+        // sized for the largest sub-batch that fits in the memory budget
+        const size_t numOutputPixels = _shapedInput.NumColumns();
+        const size_t bytesPerInput = (_shapedInput.NumRows() + _outputMatrix.NumRows()) * numOutputPixels * sizeof(ElementType);
+        const size_t subBatchSize = std::max(std::min(_batchMemoryBudget / std::max(bytesPerInput, size_t{ 1 }), inputs.size()), size_t{ 1 });
+        MatrixType shapedInput(_shapedInput.NumRows(), numOutputPixels * subBatchSize);
+        MatrixType outputMatrix(_outputMatrix.NumRows(), numOutputPixels * subBatchSize);
+
+        // Each output tensor starts as a copy of the padded output
+        outputs.assign(inputs.size(), _output);
+        for (size_t begin = 0; begin < inputs.size(); begin += subBatchSize)
+        {
+            const size_t size = std::min(subBatchSize, inputs.size() - begin);
+            auto subBatchInput = shapedInput.GetSubMatrix(0, 0, shapedInput.NumRows(), numOutputPixels * size);
+            auto subBatchOutput = outputMatrix.GetSubMatrix(0, 0, outputMatrix.NumRows(), numOutputPixels * size);
+
+            // Re-shape each input into its own block of columns
+            for (size_t index = 0; index < size; index++)
+            {
+                ReceptiveFieldToColumns(inputs[begin + index], subBatchInput.GetSubMatrix(0, index * numOutputPixels, subBatchInput.NumRows(), numOutputPixels));
+            }
+
+            // Multiply the reshaped sub-batch and weights.
+            math::Operations::Multiply(static_cast<ElementType>(1.0), _weightsMatrix, subBatchInput, static_cast<ElementType>(0.0), subBatchOutput);
+
+            // Re-shape each block of columns into an output tensor
+            for (size_t index = 0; index < size; index++)
+            {
+                ColumnsToOutput(subBatchOutput, index * numOutputPixels, GetOutputMinusPadding(outputs[begin + index]));
             }
         }
     }
 
     template <typename ElementType>
-    void ConvolutionalLayer<ElementType>::ReceptiveFieldToColumns(ConstTensorReferenceType input, MatrixType& shapedInput)
+    void ConvolutionalLayer<ElementType>::ColumnsToOutput(MatrixReferenceType outputMatrix, size_t firstColumn, TensorReferenceType output)
+    {
+        ParallelForBlocks(output.NumRows(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                for (size_t j = 0; j < output.NumColumns(); j++)
+                {
+                    for (size_t k = 0; k < output.NumChannels(); k++)
+                    {
+                        size_t row = k;
+                        size_t column = firstColumn + (i * output.NumColumns()) + j;
+                        output(i, j, k) = outputMatrix(row, column);
+                    }
+                }
+            }
+        });
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ReceptiveFieldToColumns(ConstTensorReferenceType input, math::MatrixReference<ElementType, math::MatrixLayout::rowMajor> shapedInput)
     {
         size_t fieldVolumeSize = _convolutionalParameters.receptiveField * _convolutionalParameters.receptiveField * _layerParameters.input.NumChannels();
         size_t outIndex = 0;
         size_t convolutionalHeight = NumOutputRowsMinusPadding();
         size_t convolutionalWidth = NumOutputColumnsMinusPadding();
 
-        for (size_t f = 0; f < fieldVolumeSize; f++)
+        // Each element of the receptive field fills its own row of the shaped input
+        ParallelForBlocks(fieldVolumeSize, [&](size_t begin, size_t end) {
+            for (size_t f = begin; f < end; f++)
+            {
+                size_t fieldDepth = f % _layerParameters.input.NumChannels();
+                size_t fieldColumn = (f / _layerParameters.input.NumChannels()) % _convolutionalParameters.receptiveField;
+                size_t fieldRow = (f / _layerParameters.input.NumChannels()) / _convolutionalParameters.receptiveField;
+
+                size_t rowOffset = 0;
+                for (size_t h = 0; h < convolutionalHeight; h++)
+                {
+                    size_t colOffset = 0;
+                    for (size_t w = 0; w < convolutionalWidth; w++)
+                    {
+                        size_t input_row = rowOffset + fieldRow;
+                        size_t input_col = colOffset + fieldColumn;
+
+                        shapedInput(f, h * convolutionalWidth + w) = input(input_row, input_col, fieldDepth);
+                        colOffset += _convolutionalParameters.stride;
+                    }
+                    rowOffset += _convolutionalParameters.stride;
+                }
+            }
+        });
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::TransformWinogradWeights()
+    {
+        // U = G g G^T for each 3x3 filter g, where G = [1 0 0; 1/2 1/2 1/2; 1/2 -1/2 1/2; 0 0 1]
+        const size_t numFilters = _layerParameters.outputShape[2];
+        const size_t numChannels = _layerParameters.input.NumChannels();
+        _winogradWeights = WinogradMatrixType(16 * numFilters, numChannels);
+        for (size_t f = 0; f < numFilters; f++)
+        {
+            for (size_t c = 0; c < numChannels; c++)
+            {
+                ElementType Gg[4][3];
+                for (size_t j = 0; j < 3; j++)
+                {
+                    ElementType g0 = _weights(f * 3, j, c);
+                    ElementType g1 = _weights(f * 3 + 1, j, c);
+                    ElementType g2 = _weights(f * 3 + 2, j, c);
+                    Gg[0][j] = g0;
+                    Gg[1][j] = (g0 + g1 + g2) / 2;
+                    Gg[2][j] = (g0 - g1 + g2) / 2;
+                    Gg[3][j] = g2;
+                }
+                for (size_t i = 0; i < 4; i++)
+                {
+                    _winogradWeights((i * 4) * numFilters + f, c) = Gg[i][0];
+                    _winogradWeights((i * 4 + 1) * numFilters + f, c) = (Gg[i][0] + Gg[i][1] + Gg[i][2]) / 2;
+                    _winogradWeights((i * 4 + 2) * numFilters + f, c) = (Gg[i][0] - Gg[i][1] + Gg[i][2]) / 2;
+                    _winogradWeights((i * 4 + 3) * numFilters + f, c) = Gg[i][2];
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void ConvolutionalLayer<ElementType>::ComputeWinograd(ConstTensorReferenceType input, TensorReferenceType output)
+    {
+        const size_t numFilters = output.NumChannels();
+        const size_t numChannels = input.NumChannels();
+        const size_t numTileRows = (output.NumRows() + 1) / 2;
+        const size_t numTileColumns = (output.NumColumns() + 1) / 2;
+        const size_t numTiles = numTileRows * numTileColumns;
+        if (_winogradInput.NumRows() != 16 * numChannels || _winogradInput.NumColumns() != numTiles)
         {
-            size_t fieldDepth = f % _layerParameters.input.NumChannels();
-            size_t fieldColumn = (f / _layerParameters.input.NumChannels()) % _convolutionalParameters.receptiveField;
-            size_t fieldRow = (f / _layerParameters.input.NumChannels()) / _convolutionalParameters.receptiveField;
+            _winogradInput = WinogradMatrixType(16 * numChannels, numTiles);
+            _winogradOutput = WinogradMatrixType(16 * numFilters, numTiles);
+        }
 
-            size_t rowOffset = 0;
-            for (size_t h = 0; h < convolutionalHeight; h++)
+        // V = B^T d B for each overlapping 4x4 input tile d, where B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1].
+        // Tiles that extend past the input are completed with zeros.
+        ParallelForBlocks(numTileRows, [&](size_t begin, size_t end) {
+            for (size_t tileRow = begin; tileRow < end; tileRow++)
             {
-                size_t colOffset = 0;
-                for (size_t w = 0; w < convolutionalWidth; w++)
+                for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
                 {
-                    size_t input_row = rowOffset + fieldRow;
-                    size_t input_col = colOffset + fieldColumn;
+                    size_t tile = tileRow * numTileColumns + tileColumn;
+                    for (size_t c = 0; c < numChannels; c++)
+                    {
+                        ElementType d[4][4];
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            for (size_t j = 0; j < 4; j++)
+                            {
+                                size_t row = 2 * tileRow + i;
+                                size_t column = 2 * tileColumn + j;
+                                d[i][j] = (row < input.NumRows() && column < input.NumColumns()) ? input(row, column, c) : 0;
+                            }
+                        }
+
+                        ElementType BTd[4][4];
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            BTd[0][j] = d[0][j] - d[2][j];
+                            BTd[1][j] = d[1][j] + d[2][j];
+                            BTd[2][j] = d[2][j] - d[1][j];
+                            BTd[3][j] = d[1][j] - d[3][j];
+                        }
 
-                    shapedInput(f, h * convolutionalWidth + w) = input(input_row, input_col, fieldDepth);
-                    colOffset += _convolutionalParameters.stride;
+                        for (size_t i = 0; i < 4; i++)
+                        {
+                            _winogradInput((i * 4) * numChannels + c, tile) = BTd[i][0] - BTd[i][2];
+                            _winogradInput((i * 4 + 1) * numChannels + c, tile) = BTd[i][1] + BTd[i][2];
+                            _winogradInput((i * 4 + 2) * numChannels + c, tile) = BTd[i][2] - BTd[i][1];
+                            _winogradInput((i * 4 + 3) * numChannels + c, tile) = BTd[i][1] - BTd[i][3];
+                        }
+                    }
                 }
-                rowOffset += _convolutionalParameters.stride;
             }
+        });
+
+        // M = U .* V summed over the channels, as one matrix product for each of the 16 elements of the tiles
+        for (size_t element = 0; element < 16; element++)
+        {
+            auto U = _winogradWeights.GetSubMatrix(element * numFilters, 0, numFilters, numChannels);
+            auto V = _winogradInput.GetSubMatrix(element * numChannels, 0, numChannels, numTiles);
+            auto M = _winogradOutput.GetSubMatrix(element * numFilters, 0, numFilters, numTiles);
+            math::Operations::Multiply(static_cast<ElementType>(1.0), U, V, static_cast<ElementType>(0.0), M);
         }
+
+        // Y = A^T M A for each tile, where A^T = [1 1 1 0; 0 1 -1 -1]
+        ParallelForBlocks(numTileRows, [&](size_t begin, size_t end) {
+            for (size_t tileRow = begin; tileRow < end; tileRow++)
+            {
+                for (size_t tileColumn = 0; tileColumn < numTileColumns; tileColumn++)
+                {
+                    size_t tile = tileRow * numTileColumns + tileColumn;
+                    for (size_t f = 0; f < numFilters; f++)
+                    {
+                        ElementType ATm[2][4];
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            ElementType m0 = _winogradOutput(j * numFilters + f, tile);
+                            ElementType m1 = _winogradOutput((4 + j) * numFilters + f, tile);
+                            ElementType m2 = _winogradOutput((8 + j) * numFilters + f, tile);
+                            ElementType m3 = _winogradOutput((12 + j) * numFilters + f, tile);
+                            ATm[0][j] = m0 + m1 + m2;
+                            ATm[1][j] = m1 - m2 - m3;
+                        }
+
+                        for (size_t i = 0; i < 2; i++)
+                        {
+                            size_t row = 2 * tileRow + i;
+                            if (row >= output.NumRows())
+                            {
+                                break;
+                            }
+                            output(row, 2 * tileColumn, f) = ATm[i][0] + ATm[i][1] + ATm[i][2];
+                            if (2 * tileColumn + 1 < output.NumColumns())
+                            {
+                                output(row, 2 * tileColumn + 1, f) = ATm[i][1] - ATm[i][2] - ATm[i][3];
+                            }
+                        }
+                    }
+                }
+            }
+        });
     }
 
     template <typename ElementType>
@@ -178,7 +400,9 @@ namespace neural
 
         archiver["receptiveField"] << _convolutionalParameters.receptiveField;
         archiver["stride"] << _convolutionalParameters.stride;
+        // Older versions read and wrote the receptive field under "method", which is kept so that they can read this archive
         archiver["method"] << static_cast<int>(_convolutionalParameters.receptiveField);
+        archiver["convolutionMethod"] << static_cast<int>(_convolutionalParameters.method);
         archiver["numFiltersAtATime"] << static_cast<int>(_convolutionalParameters.numFiltersAtATime);
         
         math::MatrixArchiver::Write(_shapedInput, "shapedInput", archiver);
@@ -193,12 +417,42 @@ namespace neural
 
         archiver["receptiveField"] >> _convolutionalParameters.receptiveField;
         archiver["stride"] >> _convolutionalParameters.stride;
-        archiver["method"] >> static_cast<int>(_convolutionalParameters.receptiveField);
-        archiver["numFiltersAtATime"] >> static_cast<int>(_convolutionalParameters.numFiltersAtATime);
+        int legacyMethod = 0;
+        archiver["method"] >> legacyMethod;
+        int method = static_cast<int>(ConvolutionMethod::columnwise);
+        if (archiver.HasNextPropertyName("convolutionMethod"))
+        {
+            archiver["convolutionMethod"] >> method;
+        }
+        _convolutionalParameters.method = static_cast<ConvolutionMethod>(method);
+        int numFiltersAtATime = 0;
+        archiver["numFiltersAtATime"] >> numFiltersAtATime;
+        _convolutionalParameters.numFiltersAtATime = static_cast<size_t>(numFiltersAtATime);
 
         math::MatrixArchiver::Read(_shapedInput, "shapedInput", archiver);
         math::MatrixArchiver::Read(_weightsMatrix, "weightsMatrix", archiver);
         math::MatrixArchiver::Read(_outputMatrix, "outputMatrix", archiver);
+
+        // The weights tensor is not archived, so it is recovered from the reshaped weights
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t numChannels = _layerParameters.input.NumChannels();
+        _weights = TensorType(_weightsMatrix.NumRows() * receptiveField, receptiveField, numChannels);
+        for (size_t filter = 0; filter < _weightsMatrix.NumRows(); filter++)
+        {
+            for (size_t row = 0; row < receptiveField; row++)
+            {
+                for (size_t column = 0; column < receptiveField; column++)
+                {
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        _weights(filter * receptiveField + row, column, channel) = _weightsMatrix(filter, (row * receptiveField + column) * numChannels + channel);
+                    }
+                }
+            }
+        }
+
+        // Archives without a convolution method use the columnwise method, and a method that does not apply to the layer falls back to it
+        SelectConvolutionMethod();
     }
 
 }
@@ -60,30 +60,77 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto& input = _layerParameters.input;
 
-        // Reshape the input into a vector
-        size_t columnIndex = 0;
-        for (size_t i = 0; i < input.NumRows(); i++)
-        {
-            for (size_t j = 0; j < input.NumColumns(); j++)
+        // Reshape the input into a vector, one band of rows per thread
+        ParallelForBlocks(input.NumRows(), [&](size_t begin, size_t end) {
+            size_t columnIndex = begin * input.NumColumns() * input.NumChannels();
+            for (size_t i = begin; i < end; i++)
             {
-                for (size_t k = 0; k < input.NumChannels(); k++)
+                for (size_t j = 0; j < input.NumColumns(); j++)
                 {
-                    _shapedInput[columnIndex++] = input(i, j, k);
+                    for (size_t k = 0; k < input.NumChannels(); k++)
+                    {
+                        _shapedInput[columnIndex++] = input(i, j, k);
+                    }
                 }
             }
-        }
+        });
 
         math::Operations::Multiply((ElementType)1.0f, _weights, _shapedInput, (ElementType)0.0f, _outputVector);
 
         // Reshape the output
-        columnIndex = 0;
-        for (size_t i = 0; i < output.NumRows(); i++)
+        ParallelForBlocks(output.NumRows(), [&](size_t begin, size_t end) {
+            size_t columnIndex = begin * output.NumColumns() * output.NumChannels();
+            for (size_t i = begin; i < end; i++)
+            {
+                for (size_t j = 0; j < output.NumColumns(); j++)
+                {
+                    for (size_t k = 0; k < output.NumChannels(); k++)
+                    {
+                        output(i, j, k) = _outputVector[columnIndex++];
+                    }
+                }
+            }
+        });
+    }
+
+    template <typename ElementType>
+    void FullyConnectedLayer<ElementType>::ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs)
+    {
+        // Reshape each input into a column of the input matrix
+        math::ColumnMatrix<ElementType> shapedInput(_shapedInput.Size(), inputs.size());
+        for (size_t index = 0; index < inputs.size(); index++)
         {
-            for (size_t j = 0; j < output.NumColumns(); j++)
+            const auto& input = inputs[index];
+            size_t rowIndex = 0;
+            for (size_t i = 0; i < input.NumRows(); i++)
             {
-                for (size_t k = 0; k < output.NumChannels(); k++)
+                for (size_t j = 0; j < input.NumColumns(); j++)
                 {
-                    output(i, j, k) = _outputVector[columnIndex++];
+                    for (size_t k = 0; k < input.NumChannels(); k++)
+                    {
+                        shapedInput(rowIndex++, index) = input(i, j, k);
+                    }
+                }
+            }
+        }
+
+        MatrixType outputMatrix(_outputVector.Size(), inputs.size());
+        math::Operations::Multiply((ElementType)1.0f, _weights, shapedInput, (ElementType)0.0f, outputMatrix);
+
+        // Reshape each column of the output matrix, into an output tensor that starts as a copy of the padded output
+        outputs.assign(inputs.size(), _output);
+        for (size_t index = 0; index < inputs.size(); index++)
+        {
+            auto output = GetOutputMinusPadding(outputs[index]);
+            size_t rowIndex = 0;
+            for (size_t i = 0; i < output.NumRows(); i++)
+            {
+                for (size_t j = 0; j < output.NumColumns(); j++)
+                {
+                    for (size_t k = 0; k < output.NumChannels(); k++)
+                    {
+                        output(i, j, k) = outputMatrix(rowIndex++, index);
+                    }
                 }
             }
         }
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     GroupedConvolutionalLayer.tcc (neural)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// stl
+#include <algorithm>
+#include <vector>
+
+namespace ell
+{
+namespace predictors
+{
+namespace neural
+{
+    template <typename ElementType>
+    GroupedConvolutionalLayer<ElementType>::GroupedConvolutionalLayer(const LayerParameters& layerParameters, const GroupedConvolutionalParameters& convolutionalParameters, TensorType weights) :
+        Layer<ElementType>(layerParameters),
+        _convolutionalParameters(convolutionalParameters),
+        _weights(std::move(weights)),
+        _shapedWeights(0, 0)
+    {
+        if (_weights.GetDataPointer() == nullptr)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::nullReference, "weights tensor has null data field");
+        }
+
+        const size_t numGroups = _convolutionalParameters.numGroups;
+        if (numGroups == 0 || _layerParameters.input.NumChannels() % numGroups != 0 || NumOutputChannels() % numGroups != 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "the number of input channels and the number of filters of a grouped convolutional layer must be multiples of the number of groups");
+        }
+
+        const size_t numGroupChannels = _layerParameters.input.NumChannels() / numGroups;
+        if (_weights.NumChannels() != numGroupChannels || _weights.Size() != (NumOutputChannels() * numGroupChannels * convolutionalParameters.receptiveField * convolutionalParameters.receptiveField))
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::sizeMismatch, "weights dimensions for a grouped convolutional layer should be the size of the receptive field area * number of channels per group * number of filters");
+        }
+
+        ShapeWeights();
+    }
+
+    template <typename ElementType>
+    void GroupedConvolutionalLayer<ElementType>::Compute()
+    {
+        auto output = GetOutputMinusPadding();
+        auto& input = _layerParameters.input;
+
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t stride = _convolutionalParameters.stride;
+        const size_t numGroups = _convolutionalParameters.numGroups;
+        const size_t numFilters = NumOutputChannels();
+        const size_t numGroupChannels = _weights.NumChannels();
+        const size_t numGroupFilters = numFilters / numGroups;
+        const size_t outputRows = NumOutputRowsMinusPadding();
+        const size_t outputColumns = NumOutputColumnsMinusPadding();
+
+        // Each output row is computed independently. For each output element, the weights of all the filters for one input
+        // element are a contiguous row of the shaped weights, so the innermost loops run over the filters.
+        ParallelForBlocks(outputRows, [&](size_t begin, size_t end) {
+            std::vector<ElementType> sums(numFilters);
+            for (size_t row = begin; row < end; row++)
+            {
+                for (size_t column = 0; column < outputColumns; column++)
+                {
+                    std::fill(sums.begin(), sums.end(), static_cast<ElementType>(0));
+                    for (size_t i = 0; i < receptiveField; i++)
+                    {
+                        for (size_t j = 0; j < receptiveField; j++)
+                        {
+                            const size_t inputRow = row * stride + i;
+                            const size_t inputColumn = column * stride + j;
+                            for (size_t c = 0; c < numGroupChannels; c++)
+                            {
+                                auto weights = _shapedWeights.GetMajorVector((i * receptiveField + j) * numGroupChannels + c);
+                                if (numGroupFilters == 1)
+                                {
+                                    // One filter per group, as in a depthwise convolution
+                                    for (size_t f = 0; f < numFilters; f++)
+                                    {
+                                        sums[f] += weights[f] * input(inputRow, inputColumn, f * numGroupChannels + c);
+                                    }
+                                }
+                                else
+                                {
+                                    for (size_t g = 0; g < numGroups; g++)
+                                    {
+                                        const ElementType value = input(inputRow, inputColumn, g * numGroupChannels + c);
+                                        for (size_t f = g * numGroupFilters; f < (g + 1) * numGroupFilters; f++)
+                                        {
+                                            sums[f] += weights[f] * value;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t f = 0; f < numFilters; f++)
+                    {
+                        output(row, column, f) = sums[f];
+                    }
+                }
+            }
+        });
+    }
+
+    template <typename ElementType>
+    void GroupedConvolutionalLayer<ElementType>::ShapeWeights()
+    {
+        const size_t receptiveField = _convolutionalParameters.receptiveField;
+        const size_t numGroupChannels = _weights.NumChannels();
+        const size_t numFilters = _layerParameters.outputShape[2];
+
+        _shapedWeights = MatrixType(receptiveField * receptiveField * numGroupChannels, numFilters);
+        for (size_t f = 0; f < numFilters; f++)
+        {
+            for (size_t i = 0; i < receptiveField; i++)
+            {
+                for (size_t j = 0; j < receptiveField; j++)
+                {
+                    for (size_t c = 0; c < numGroupChannels; c++)
+                    {
+                        _shapedWeights((i * receptiveField + j) * numGroupChannels + c, f) = _weights(f * receptiveField + i, j, c);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename ElementType>
+    void GroupedConvolutionalLayer<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
+    {
+        Layer<ElementType>::WriteToArchive(archiver);
+
+        archiver["receptiveField"] << _convolutionalParameters.receptiveField;
+        archiver["stride"] << _convolutionalParameters.stride;
+        archiver["numGroups"] << _convolutionalParameters.numGroups;
+
+        math::TensorArchiver::Write(_weights, "weights", archiver);
+    }
+
+    template <typename ElementType>
+    void GroupedConvolutionalLayer<ElementType>::ReadFromArchive(utilities::Unarchiver& archiver)
+    {
+        Layer<ElementType>::ReadFromArchive(archiver);
+
+        archiver["receptiveField"] >> _convolutionalParameters.receptiveField;
+        archiver["stride"] >> _convolutionalParameters.stride;
+        archiver["numGroups"] >> _convolutionalParameters.numGroups;
+
+        math::TensorArchiver::Read(_weights, "weights", archiver);
+        ShapeWeights();
+    }
+}
+}
+}
@@ -9,6 +9,7 @@
 #include "Layer.h"
 
 // stl
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <type_traits>
@@ -44,6 +45,26 @@ namespace neural
         return { outputShape[0]-2*paddingSize, outputShape[1]-2*paddingSize, outputShape[2] };
     }
 
+    template <typename ElementType>
+    void Layer<ElementType>::ParallelForBlocks(size_t size, const std::function<void(size_t, size_t)>& function) const
+    {
+        size_t numTasks = _threadPool ? std::min(_threadPool->NumThreads(), size) : 1;
+        if (numTasks <= 1)
+        {
+            function(0, size);
+            return;
+        }
+
+        // give each task a contiguous block, spreading the remainder over the first tasks
+        size_t blockSize = size / numTasks;
+        size_t remainder = size % numTasks;
+        _threadPool->ParallelFor(numTasks, [&](size_t task) {
+            size_t begin = task * blockSize + std::min(task, remainder);
+            size_t end = begin + blockSize + (task < remainder ? 1 : 0);
+            function(begin, end);
+        });
+    }
+
     template <typename ElementType>
     void Layer<ElementType>::InitializeOutputValues(TensorType& output, PaddingParameters outputPaddingParameters)
     {
@@ -89,6 +110,26 @@ namespace neural
         }
     }
 
+    template <typename ElementType>
+    void Layer<ElementType>::ComputeBatch(const std::vector<TensorType>& inputs, std::vector<TensorType>& outputs)
+    {
+        // Point the layer at each input in turn, and restore the configured input afterwards. The batch inputs
+        // are not overwritten, even if the layer normally computes in place.
+        auto input = _layerParameters.input;
+        auto computeInPlace = _computeInPlace;
+        _computeInPlace = false;
+        outputs.clear();
+        outputs.reserve(inputs.size());
+        for (const auto& batchInput : inputs)
+        {
+            _layerParameters.input = batchInput;
+            Compute();
+            outputs.push_back(_output);
+        }
+        _layerParameters.input = input;
+        _computeInPlace = computeInPlace;
+    }
+
     template <typename ElementType>
     void Layer<ElementType>::Print(std::ostream& os, size_t numValuesToPrint) const
     {
@@ -172,7 +213,13 @@ namespace neural
     template <typename ElementType>
     typename Layer<ElementType>::TensorReferenceType Layer<ElementType>::GetOutputMinusPadding()
     { 
-        return _output.GetSubTensor({ _layerParameters.outputPaddingParameters.paddingSize, _layerParameters.outputPaddingParameters.paddingSize, 0 }, { _output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize, _output.NumColumns() - 2 * _layerParameters.outputPaddingParameters.paddingSize, _output.NumChannels() });
+        return GetOutputMinusPadding(_output);
+    }
+
+    template <typename ElementType>
+    typename Layer<ElementType>::TensorReferenceType Layer<ElementType>::GetOutputMinusPadding(TensorType& output)
+    {
+        return output.GetSubTensor({ _layerParameters.outputPaddingParameters.paddingSize, _layerParameters.outputPaddingParameters.paddingSize, 0 }, { output.NumRows() - 2 * _layerParameters.outputPaddingParameters.paddingSize, output.NumColumns() - 2 * _layerParameters.outputPaddingParameters.paddingSize, output.NumChannels() });
     }
 
     template <typename ElementType>
@@ -29,43 +29,46 @@ namespace neural
         auto output = GetOutputMinusPadding();
         auto& input = _layerParameters.input;
 
-        for (size_t row = 0; row < output.NumRows(); row++)
-        {
-            const size_t startRow = row * _poolingParameters.stride;
-            for (size_t column = 0; column < output.NumColumns(); column++)
+        // Each band of output rows is pooled independently
+        ParallelForBlocks(output.NumRows(), [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++)
             {
-                const size_t startColumn = column * _poolingParameters.stride;
-                std::vector<PoolingFunctionType<ElementType>> poolingValues(output.NumChannels());
-
-                for (size_t pool_y = 0; pool_y < _poolingParameters.poolingSize; pool_y++)
+                const size_t startRow = row * _poolingParameters.stride;
+                for (size_t column = 0; column < output.NumColumns(); column++)
                 {
-                    for (size_t pool_x = 0; pool_x < _poolingParameters.poolingSize; pool_x++)
+                    const size_t startColumn = column * _poolingParameters.stride;
+                    std::vector<PoolingFunctionType<ElementType>> poolingValues(output.NumChannels());
+
+                    for (size_t pool_y = 0; pool_y < _poolingParameters.poolingSize; pool_y++)
                     {
-                        for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                        for (size_t pool_x = 0; pool_x < _poolingParameters.poolingSize; pool_x++)
                         {
-
-                            // Special case here for certain networks that rely on pooling fields that are even outside of
-                            // the specified padding.
-                            size_t inputRow = startRow + pool_y;
-                            size_t inputColumn = startColumn + pool_x;
-                            if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
-                            {
-                                poolingValues[channel].Accumulate(input(inputRow, inputColumn, channel));
-                            }
-                            else
+                            for (size_t channel = 0; channel < output.NumChannels(); channel++)
                             {
-                                poolingValues[channel].Accumulate(poolingValues[channel].GetValueAtPadding());
+
+                                // Special case here for certain networks that rely on pooling fields that are even outside of
+                                // the specified padding.
+                                size_t inputRow = startRow + pool_y;
+                                size_t inputColumn = startColumn + pool_x;
+                                if ((inputRow < input.NumRows()) && (inputColumn < input.NumColumns()))
+                                {
+                                    poolingValues[channel].Accumulate(input(inputRow, inputColumn, channel));
+                                }
+                                else
+                                {
+                                    poolingValues[channel].Accumulate(poolingValues[channel].GetValueAtPadding());
+                                }
                             }
                         }
                     }
-                }
 
-                for (size_t channel = 0; channel < output.NumChannels(); channel++)
-                {
-                    output(row, column, channel) = poolingValues[channel].GetValue();
+                    for (size_t channel = 0; channel < output.NumChannels(); channel++)
+                    {
+                        output(row, column, channel) = poolingValues[channel].GetValue();
+                    }
                 }
             }
-        }
+        });
     }
 
     template <typename ElementType, template <typename> class PoolingFunctionType>
@@ -8,8 +8,13 @@
 
 #include "NeuralNetworkPredictor.h"
 
+// utilities
+#include "JsonArchiver.h"
+
 //stl
 #include <iostream>
+#include <limits>
+#include <sstream>
 
 namespace ell
 {
@@ -23,6 +28,255 @@ namespace predictors
     {
     }
 
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::SetLayers(Layers&& layers)
+    {
+        _layers = std::move(layers);
+        ApplyThreadPool();
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::SetThreadPool(std::shared_ptr<utilities::ThreadPool> threadPool)
+    {
+        _threadPool = std::move(threadPool);
+        ApplyThreadPool();
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::ApplyThreadPool()
+    {
+        if (_inputLayer != nullptr)
+        {
+            _inputLayer->SetThreadPool(_threadPool);
+        }
+        for (auto& layer : _layers)
+        {
+            layer->SetThreadPool(_threadPool);
+        }
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::FoldLayers()
+    {
+        using VectorType = typename neural::Layer<ElementType>::VectorType;
+        using LayerParameters = typename neural::Layer<ElementType>::LayerParameters;
+
+        Layers layers;
+        size_t index = 0;
+        while (index < _layers.size())
+        {
+            // Find the run of affine layers that follows a layer with weights
+            size_t end = index + 1;
+            if (CanFoldInto(*_layers[index]))
+            {
+                while (end < _layers.size() && CanFold(*_layers[end]))
+                {
+                    end++;
+                }
+            }
+
+            // A single bias layer is already as cheap as it gets
+            if (end == index + 1 || (end == index + 2 && _layers[index + 1]->GetLayerType() == neural::LayerType::bias))
+            {
+                layers.insert(layers.end(), _layers.begin() + index, _layers.begin() + end);
+                index = end;
+                continue;
+            }
+
+            // Combine the run into one multiplication and one addition per channel
+            auto& layer = *_layers[index];
+            auto& lastLayer = *_layers[end - 1];
+            const size_t numChannels = layer.GetOutputShape()[2];
+            VectorType scale(numChannels);
+            VectorType offset(numChannels);
+            scale.Fill(1);
+            for (size_t affineIndex = index + 1; affineIndex < end; affineIndex++)
+            {
+                auto& affineLayer = *_layers[affineIndex];
+                switch (affineLayer.GetLayerType())
+                {
+                case neural::LayerType::batchNormalization:
+                {
+                    auto& batchNormalizationLayer = affineLayer.template As<neural::BatchNormalizationLayer<ElementType>>();
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        scale[channel] *= batchNormalizationLayer.GetScale()[channel];
+                        offset[channel] = offset[channel] * batchNormalizationLayer.GetScale()[channel] + batchNormalizationLayer.GetBias()[channel];
+                    }
+                    break;
+                }
+                case neural::LayerType::scaling:
+                {
+                    auto scalingValues = affineLayer.template As<neural::ScalingLayer<ElementType>>().GetScale();
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        scale[channel] *= scalingValues[channel];
+                        offset[channel] *= scalingValues[channel];
+                    }
+                    break;
+                }
+                default:
+                {
+                    auto biasValues = affineLayer.template As<neural::BiasLayer<ElementType>>().GetBias();
+                    for (size_t channel = 0; channel < numChannels; channel++)
+                    {
+                        offset[channel] += biasValues[channel];
+                    }
+                    break;
+                }
+                }
+            }
+
+            bool hasOffset = false;
+            for (size_t channel = 0; channel < numChannels; channel++)
+            {
+                hasOffset = hasOffset || offset[channel] != 0;
+            }
+
+            std::shared_ptr<neural::Layer<ElementType>> newLastLayer;
+            const auto& parameters = layer.GetLayerParameters();
+            if (hasOffset)
+            {
+                // The scaled layer keeps its output, and a bias layer writes the output of the run
+                auto scaledLayer = CreateScaledLayer(layer, parameters, scale);
+                const size_t padding = parameters.outputPaddingParameters.paddingSize;
+                auto scaledOutput = scaledLayer->GetOutput();
+                auto biasInput = scaledOutput.GetSubTensor(padding, padding, 0, scaledOutput.NumRows() - 2 * padding, scaledOutput.NumColumns() - 2 * padding, scaledOutput.NumChannels());
+                LayerParameters biasParameters{ biasInput, parameters.outputPaddingParameters, lastLayer.GetOutputShape(), lastLayer.GetLayerParameters().outputPaddingParameters };
+                newLastLayer = std::make_shared<neural::BiasLayer<ElementType>>(biasParameters, offset);
+                layers.push_back(scaledLayer);
+            }
+            else
+            {
+                // The scaled layer writes the output of the run directly
+                LayerParameters scaledParameters{ parameters.input, parameters.inputPaddingParameters, lastLayer.GetOutputShape(), lastLayer.GetLayerParameters().outputPaddingParameters };
+                newLastLayer = CreateScaledLayer(layer, scaledParameters, scale);
+            }
+            layers.push_back(newLastLayer);
+
+            if (end < _layers.size())
+            {
+                RedirectInput(*_layers[end], lastLayer, *newLastLayer);
+            }
+            index = end;
+        }
+
+        // An activation can overwrite the output of the previous layer when it reads all of it and has the same shape
+        for (size_t layerIndex = 1; layerIndex + 1 < layers.size(); layerIndex++)
+        {
+            auto& previousLayer = *layers[layerIndex - 1];
+            auto& layer = *layers[layerIndex];
+            auto& nextLayer = *layers[layerIndex + 1];
+            const auto& parameters = layer.GetLayerParameters();
+            if (layer.CanComputeInPlace() &&
+                !neural::HasPadding(previousLayer.GetLayerParameters().outputPaddingParameters) &&
+                !neural::HasPadding(parameters.inputPaddingParameters) &&
+                !neural::HasPadding(parameters.outputPaddingParameters) &&
+                parameters.input.GetDataPointer() == previousLayer.GetOutput().GetDataPointer() &&
+                layer.GetInputShape() == previousLayer.GetOutputShape() &&
+                layer.GetOutputShape() == previousLayer.GetOutputShape() &&
+                nextLayer.GetLayerParameters().input.GetDataPointer() == layer.GetOutput().GetDataPointer())
+            {
+                layer.SetComputeInPlace(true);
+                RedirectInput(nextLayer, layer, previousLayer);
+            }
+        }
+
+        _layers = std::move(layers);
+        ApplyThreadPool();
+    }
+
+    template <typename ElementType>
+    NeuralNetworkPredictor<ElementType> NeuralNetworkPredictor<ElementType>::GetFoldedCopy() const
+    {
+        // Write enough digits for the weights to be read back exactly
+        std::stringstream stream;
+        stream.precision(std::numeric_limits<ElementType>::max_digits10);
+        utilities::JsonArchiver archiver(stream);
+        WriteToArchive(archiver);
+
+        utilities::SerializationContext context;
+        RegisterNeuralNetworkPredictorTypes(context);
+        utilities::JsonUnarchiver unarchiver(stream, context);
+        NeuralNetworkPredictor copy;
+        copy.ReadFromArchive(unarchiver);
+        copy.SetThreadPool(_threadPool);
+        copy.FoldLayers();
+        return copy;
+    }
+
+    template <typename ElementType>
+    bool NeuralNetworkPredictor<ElementType>::CanFoldInto(const neural::Layer<ElementType>& layer)
+    {
+        auto layerType = layer.GetLayerType();
+        return layerType == neural::LayerType::convolution || layerType == neural::LayerType::fullyConnected || layerType == neural::LayerType::groupedConvolution;
+    }
+
+    template <typename ElementType>
+    bool NeuralNetworkPredictor<ElementType>::CanFold(const neural::Layer<ElementType>& layer)
+    {
+        auto layerType = layer.GetLayerType();
+        return layerType == neural::LayerType::batchNormalization || layerType == neural::LayerType::scaling || layerType == neural::LayerType::bias;
+    }
+
+    template <typename ElementType>
+    std::shared_ptr<neural::Layer<ElementType>> NeuralNetworkPredictor<ElementType>::CreateScaledLayer(neural::Layer<ElementType>& layer, const typename neural::Layer<ElementType>::LayerParameters& layerParameters, const typename neural::Layer<ElementType>::VectorType& scale)
+    {
+        // Scales the weights of each filter of a convolutional layer, whose rows are stacked in the weights tensor
+        auto scaleFilters = [&scale](TensorType& weights, size_t receptiveField) {
+            for (size_t row = 0; row < weights.NumRows(); row++)
+            {
+                for (size_t column = 0; column < weights.NumColumns(); column++)
+                {
+                    for (size_t channel = 0; channel < weights.NumChannels(); channel++)
+                    {
+                        weights(row, column, channel) *= scale[row / receptiveField];
+                    }
+                }
+            }
+        };
+
+        switch (layer.GetLayerType())
+        {
+        case neural::LayerType::convolution:
+        {
+            auto& convolutionalLayer = layer.template As<neural::ConvolutionalLayer<ElementType>>();
+            TensorType weights(convolutionalLayer.GetWeights());
+            scaleFilters(weights, convolutionalLayer.GetConvolutionalParameters().receptiveField);
+            return std::make_shared<neural::ConvolutionalLayer<ElementType>>(layerParameters, convolutionalLayer.GetConvolutionalParameters(), std::move(weights));
+        }
+        case neural::LayerType::groupedConvolution:
+        {
+            auto& groupedConvolutionalLayer = layer.template As<neural::GroupedConvolutionalLayer<ElementType>>();
+            TensorType weights(groupedConvolutionalLayer.GetWeights());
+            scaleFilters(weights, groupedConvolutionalLayer.GetConvolutionalParameters().receptiveField);
+            return std::make_shared<neural::GroupedConvolutionalLayer<ElementType>>(layerParameters, groupedConvolutionalLayer.GetConvolutionalParameters(), std::move(weights));
+        }
+        default:
+        {
+            // Each row of the weights of a fully connected layer computes one output, and the outputs are in row, column, channel order
+            typename neural::Layer<ElementType>::MatrixType weights(layer.template As<neural::FullyConnectedLayer<ElementType>>().GetWeights());
+            for (size_t row = 0; row < weights.NumRows(); row++)
+            {
+                weights.GetMajorVector(row) *= scale[row % scale.Size()];
+            }
+            return std::make_shared<neural::FullyConnectedLayer<ElementType>>(layerParameters, weights);
+        }
+        }
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::RedirectInput(neural::Layer<ElementType>& layer, const neural::Layer<ElementType>& previousLayer, const neural::Layer<ElementType>& newPreviousLayer)
+    {
+        // The input is a part of the previous layer's output, so it is replaced with the same part of the new layer's output,
+        // which has the same shape
+        auto& input = layer.GetLayerParameters().input;
+        auto previousOutput = previousLayer.GetOutput();
+        const size_t offset = input.GetDataPointer() - previousOutput.GetDataPointer();
+        const size_t rowSize = previousOutput.NumColumns() * previousOutput.NumChannels();
+        input = newPreviousLayer.GetOutput().GetSubTensor(offset / rowSize, (offset % rowSize) / previousOutput.NumChannels(), offset % previousOutput.NumChannels(), input.NumRows(), input.NumColumns(), input.NumChannels());
+    }
+
     template <typename ElementType>
     typename NeuralNetworkPredictor<ElementType>::Shape NeuralNetworkPredictor<ElementType>::GetInputShape() const
     {
@@ -62,20 +316,7 @@ namespace predictors
 
         if (_layers.size() > 0)
         {
-            auto output = _layers.back()->GetOutput();
-            size_t vectorIndex = 0;
-
-            //_output.resize(output.NumElements());
-            for (size_t i = 0; i < output.NumRows(); i++)
-            {
-                for (size_t j = 0; j < output.NumColumns(); j++)
-                {
-                    for (size_t k = 0; k < output.NumChannels(); k++)
-                    {
-                        _output[vectorIndex++] = output(i, j, k);
-                    }
-                }
-            }
+            CopyOutput(_layers.back()->GetOutput(), _output);
         }
         else
         {
@@ -85,6 +326,59 @@ namespace predictors
         return _output;
     }
 
+    template <typename ElementType>
+    std::vector<std::vector<ElementType>> NeuralNetworkPredictor<ElementType>::PredictBatch(const std::vector<DataVectorType>& dataVectors) const
+    {
+        std::vector<std::vector<ElementType>> results(dataVectors.size(), std::vector<ElementType>(_output.size(), 0));
+        if (_layers.size() == 0 || dataVectors.size() == 0)
+        {
+            return results;
+        }
+
+        // The input layer only copies and scales, so it is computed one input at a time
+        std::vector<TensorType> batch;
+        batch.reserve(dataVectors.size());
+        for (const auto& dataVector : dataVectors)
+        {
+            if (_inputLayer != nullptr)
+            {
+                _inputLayer->SetInput(dataVector);
+                _inputLayer->Compute();
+            }
+            batch.emplace_back(_layers.front()->GetLayerParameters().input);
+        }
+
+        // Forward feed the whole batch through each layer in turn
+        std::vector<TensorType> layerOutputs;
+        for (size_t i = 0; i < _layers.size(); i++)
+        {
+            _layers[i]->ComputeBatch(batch, layerOutputs);
+            batch.swap(layerOutputs);
+        }
+
+        for (size_t index = 0; index < batch.size(); index++)
+        {
+            CopyOutput(batch[index], results[index]);
+        }
+        return results;
+    }
+
+    template <typename ElementType>
+    void NeuralNetworkPredictor<ElementType>::CopyOutput(typename neural::Layer<ElementType>::ConstTensorReferenceType output, std::vector<ElementType>& result) const
+    {
+        size_t vectorIndex = 0;
+        for (size_t i = 0; i < output.NumRows(); i++)
+        {
+            for (size_t j = 0; j < output.NumColumns(); j++)
+            {
+                for (size_t k = 0; k < output.NumChannels(); k++)
+                {
+                    result[vectorIndex++] = output(i, j, k);
+                }
+            }
+        }
+    }
+
     template <typename ElementType>
     void NeuralNetworkPredictor<ElementType>::WriteToArchive(utilities::Archiver& archiver) const
     {
@@ -134,6 +428,7 @@ namespace predictors
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::BinaryConvolutionalLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::ConvolutionalLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::FullyConnectedLayer<ElementType>>();
+        context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::GroupedConvolutionalLayer<ElementType>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::PoolingLayer<ElementType, MaxPoolingFunction>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::PoolingLayer<ElementType, MeanPoolingFunction>>();
         context.GetTypeFactory().AddType<neural::Layer<ElementType>, neural::ScalingLayer<ElementType>>();
@@ -305,6 +305,14 @@ void FullyConnectedLayerTest()
     auto output = connectedLayer.GetOutput();
     testing::ProcessTest("Testing FullyConnectedLayer, values", Equals(output(1, 1, 0), 5.0) && Equals(output(1, 2, 0), 6.0) && Equals(output(1, 3, 0), 7.0));
     testing::ProcessTest("Testing FullyConnectedLayer, padding", output(0, 0, 0) == 0 && output(0, 1, 0) == 0 && output(1, 4, 0) == 0 && output(2, 4, 0) == 0);
+
+    // Verify a batch of inputs gives the same outputs as one input at a time
+    TensorType input2(2, 2, 1);
+    input2.Fill(2);
+    std::vector<TensorType> outputs;
+    connectedLayer.ComputeBatch({ input, input2 }, outputs);
+    testing::ProcessTest("Testing FullyConnectedLayer, batch values", outputs.size() == 2 && Equals(outputs[0](1, 1, 0), 5.0) && Equals(outputs[0](1, 2, 0), 6.0) && Equals(outputs[0](1, 3, 0), 7.0) && Equals(outputs[1](1, 1, 0), 10.0) && Equals(outputs[1](1, 2, 0), 12.0) && Equals(outputs[1](1, 3, 0), 14.0));
+    testing::ProcessTest("Testing FullyConnectedLayer, batch padding", outputs[1](0, 0, 0) == 0 && outputs[1](0, 1, 0) == 0 && outputs[1](1, 4, 0) == 0 && outputs[1](2, 4, 0) == 0);
 }
 
 template <typename ElementType>
@@ -392,6 +400,303 @@ void ConvolutionalLayerTest()
     auto output2 = convolutionalLayer2.GetOutput();
 
     testing::ProcessTest("Testing ConvolutionalLayer (regular), values", Equals(output2(0, 0, 0), 10) && Equals(output2(0, 0, 1), 15) && Equals(output2(0, 1, 0), 18) && Equals(output2(0, 1, 1), 18));
+
+    // Verify a batch of inputs gives the same outputs as one input at a time, for both methods
+    TensorType input2(3, 4, 2);
+    input2.Fill(0);
+    input2(1, 1, 0) = 4;
+    input2(1, 2, 0) = 2;
+    input2(1, 1, 1) = 6;
+    input2(1, 2, 1) = 4;
+    std::vector<TensorType> outputs;
+    convolutionalLayer.ComputeBatch({ input, input2 }, outputs);
+    testing::ProcessTest("Testing ConvolutionalLayer (diagonal), batch values", outputs.size() == 2 && Equals(outputs[0](0, 0, 0), 10) && Equals(outputs[0](0, 0, 1), 15) && Equals(outputs[0](0, 1, 0), 18) && Equals(outputs[0](0, 1, 1), 18) && Equals(outputs[1](0, 0, 0), 20) && Equals(outputs[1](0, 0, 1), 30) && Equals(outputs[1](0, 1, 0), 36) && Equals(outputs[1](0, 1, 1), 36));
+    convolutionalLayer2.ComputeBatch({ input2, input }, outputs);
+    testing::ProcessTest("Testing ConvolutionalLayer (regular), batch values", outputs.size() == 2 && Equals(outputs[1](0, 0, 0), 10) && Equals(outputs[1](0, 0, 1), 15) && Equals(outputs[1](0, 1, 0), 18) && Equals(outputs[1](0, 1, 1), 18) && Equals(outputs[0](0, 0, 0), 20) && Equals(outputs[0](0, 0, 1), 30) && Equals(outputs[0](0, 1, 0), 36) && Equals(outputs[0](0, 1, 1), 36));
+
+    // A memory budget smaller than one input splits the batch into sub-batches of one input each
+    convolutionalLayer2.SetBatchMemoryBudget(1);
+    convolutionalLayer2.ComputeBatch({ input, input2, input }, outputs);
+    testing::ProcessTest("Testing ConvolutionalLayer (regular), sub-batch values", outputs.size() == 3 && Equals(outputs[0](0, 0, 0), 10) && Equals(outputs[0](0, 1, 1), 18) && Equals(outputs[1](0, 0, 0), 20) && Equals(outputs[1](0, 0, 1), 30) && Equals(outputs[1](0, 1, 0), 36) && Equals(outputs[2](0, 0, 1), 15) && Equals(outputs[2](0, 1, 0), 18));
+}
+
+template <typename ElementType>
+void ConvolutionalLayerArchiveTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using DataVectorType = typename NeuralNetworkPredictor<ElementType>::DataVectorType;
+
+    // A 1x1 convolution, whose receptive field has the value of the diagonal method
+    typename InputLayer<ElementType>::InputParameters inputParameters{ { 3, 3, 2 }, NoPadding(), { 3, 3, 2 }, NoPadding(), 1 };
+    auto inputLayer = std::make_shared<InputLayer<ElementType>>(inputParameters);
+    TensorType weights(3, 1, 2);
+    weights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2); });
+    typename NeuralNetworkPredictor<ElementType>::Layers layers;
+    layers.push_back(std::make_shared<ConvolutionalLayer<ElementType>>(LayerParameters{ inputLayer->GetOutput(), NoPadding(), { 3, 3, 3 }, NoPadding() }, ConvolutionalParameters{ 1, 1, ConvolutionMethod::diagonal, 1 }, weights));
+    NeuralNetworkPredictor<ElementType> neuralNetwork(std::move(inputLayer), std::move(layers));
+
+    std::vector<double> inputValues(3 * 3 * 2);
+    for (size_t i = 0; i < inputValues.size(); i++)
+    {
+        inputValues[i] = static_cast<double>(i % 7) - 3;
+    }
+    auto output = neuralNetwork.Predict(DataVectorType(inputValues));
+
+    utilities::SerializationContext context;
+    NeuralNetworkPredictor<ElementType>::RegisterNeuralNetworkPredictorTypes(context);
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+    neuralNetwork.WriteToArchive(archiver);
+    auto archive = strstream.str();
+
+    auto readMethod = [&](const std::string& archive, std::vector<ElementType>& output) {
+        std::stringstream strstream(archive);
+        utilities::JsonUnarchiver unarchiver(strstream, context);
+        NeuralNetworkPredictor<ElementType> neuralNetwork;
+        neuralNetwork.ReadFromArchive(unarchiver);
+        output = neuralNetwork.Predict(DataVectorType(inputValues));
+        return dynamic_cast<const ConvolutionalLayer<ElementType>&>(*neuralNetwork.GetLayers()[0]).GetConvolutionalParameters().method;
+    };
+
+    std::vector<ElementType> output2;
+    auto method = readMethod(archive, output2);
+    testing::ProcessTest("Testing ConvolutionalLayer from archive", method == ConvolutionMethod::diagonal && output == output2);
+
+    // Older archives have no convolution method, and the receptive field under "method" is not read as the diagonal method
+    auto begin = archive.find("\"convolutionMethod\"");
+    auto end = archive.find('\n', begin);
+    if (begin != std::string::npos && end != std::string::npos)
+    {
+        archive.erase(begin, end + 1 - begin);
+    }
+    std::vector<ElementType> output3;
+    method = readMethod(archive, output3);
+    testing::ProcessTest("Testing ConvolutionalLayer from legacy archive", begin != std::string::npos && method == ConvolutionMethod::columnwise && output == output3);
+}
+
+template <typename ElementType>
+void WinogradConvolutionalLayerTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using TensorType = typename Layer<ElementType>::TensorType;
+
+    // An input of 5 x 7 x 3 with a border of zero padding, so the output tiles do not divide the output evenly
+    TensorType input(7, 9, 3);
+    input.Fill(0);
+    for (size_t i = 0; i < 5; i++)
+    {
+        for (size_t j = 0; j < 7; j++)
+        {
+            for (size_t k = 0; k < 3; k++)
+            {
+                input(i + 1, j + 1, k) = static_cast<ElementType>((i * 5 + j * 3 + k * 7) % 11) / 4 - 1;
+            }
+        }
+    }
+    TensorType weights(3 * 4, 3, 3);
+    weights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ * 5) % 9) / 3 - 1; });
+
+    ConvolutionalParameters convolutionalParams{ 3, 1, ConvolutionMethod::columnwise, 1 };
+    ConvolutionalLayer<ElementType> columnwiseLayer({ input, ZeroPadding(1), { 7, 9, 4 }, ZeroPadding(1) }, convolutionalParams, weights);
+    columnwiseLayer.Compute();
+
+    convolutionalParams.method = ConvolutionMethod::winograd;
+    ConvolutionalLayer<ElementType> winogradLayer({ input, ZeroPadding(1), { 7, 9, 4 }, ZeroPadding(1) }, convolutionalParams, weights);
+    winogradLayer.Compute();
+
+    auto expected = columnwiseLayer.GetOutput();
+    auto output = winogradLayer.GetOutput();
+    bool isEqual = winogradLayer.GetConvolutionalParameters().method == ConvolutionMethod::winograd;
+    for (size_t i = 0; i < output.NumRows(); i++)
+    {
+        for (size_t j = 0; j < output.NumColumns(); j++)
+        {
+            for (size_t k = 0; k < output.NumChannels(); k++)
+            {
+                isEqual = isEqual && Equals(output(i, j, k), expected(i, j, k));
+            }
+        }
+    }
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd), values", isEqual);
+
+    // Filters other than 3x3 with stride 1 fall back to the columnwise method
+    convolutionalParams.stride = 2;
+    ConvolutionalLayer<ElementType> stridedLayer({ input, ZeroPadding(1), { 3, 4, 4 }, NoPadding() }, convolutionalParams, weights);
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd), fallback", stridedLayer.GetConvolutionalParameters().method == ConvolutionMethod::columnwise);
+}
+
+template <typename ElementType, typename LayerType>
+bool ComputeWithThreadPoolEqualsSerial(LayerType& layer)
+{
+    using TensorType = typename predictors::neural::Layer<ElementType>::TensorType;
+
+    layer.SetThreadPool(nullptr);
+    layer.Compute();
+    TensorType expected(layer.GetOutput());
+
+    layer.SetThreadPool(std::make_shared<utilities::ThreadPool>(3));
+    layer.Compute();
+    return layer.GetOutput() == expected;
+}
+
+template <typename ElementType>
+void GroupedConvolutionalLayerTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using DataVectorType = typename NeuralNetworkPredictor<ElementType>::DataVectorType;
+
+    // A 6x6x4 input with a border of zero padding
+    TensorType input(8, 8, 4);
+    input.Fill(0);
+    for (size_t i = 0; i < 6; i++)
+    {
+        for (size_t j = 0; j < 6; j++)
+        {
+            for (size_t k = 0; k < 4; k++)
+            {
+                input(i + 1, j + 1, k) = static_cast<ElementType>((i * 5 + j * 3 + k * 7) % 9) - 4;
+            }
+        }
+    }
+
+    // Verify a grouped convolution against a regular convolution whose weights are zero outside of each filter's group
+    auto verifyGroupedConvolution = [&](size_t numGroups, size_t numFilters, size_t stride, const std::string& name) {
+        const size_t numGroupChannels = input.NumChannels() / numGroups;
+        const size_t numGroupFilters = numFilters / numGroups;
+        const size_t outputSize = (input.NumRows() - 3) / stride + 1;
+        TensorType groupedWeights(3 * numFilters, 3, numGroupChannels);
+        groupedWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 7) - 3); });
+        TensorType fullWeights(3 * numFilters, 3, input.NumChannels());
+        fullWeights.Fill(0);
+        for (size_t f = 0; f < numFilters; f++)
+        {
+            const size_t firstChannel = (f / numGroupFilters) * numGroupChannels;
+            for (size_t i = 0; i < 3; i++)
+            {
+                for (size_t j = 0; j < 3; j++)
+                {
+                    for (size_t c = 0; c < numGroupChannels; c++)
+                    {
+                        fullWeights(f * 3 + i, j, firstChannel + c) = groupedWeights(f * 3 + i, j, c);
+                    }
+                }
+            }
+        }
+
+        LayerParameters parameters{ input, ZeroPadding(1), { outputSize, outputSize, numFilters }, NoPadding() };
+        GroupedConvolutionalLayer<ElementType> groupedLayer(parameters, GroupedConvolutionalParameters{ 3, stride, numGroups }, groupedWeights);
+        groupedLayer.Compute();
+        ConvolutionalLayer<ElementType> convolutionalLayer(parameters, ConvolutionalParameters{ 3, stride, ConvolutionMethod::columnwise, 1 }, fullWeights);
+        convolutionalLayer.Compute();
+        testing::ProcessTest("Testing GroupedConvolutionalLayer (" + name + "), values", groupedLayer.GetOutput() == convolutionalLayer.GetOutput());
+        testing::ProcessTest("Testing GroupedConvolutionalLayer (" + name + ") with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(groupedLayer));
+    };
+    verifyGroupedConvolution(2, 6, 1, "2 groups");
+    verifyGroupedConvolution(4, 4, 1, "depthwise");
+    verifyGroupedConvolution(4, 8, 2, "depthwise with 2 filters per channel, stride 2");
+    verifyGroupedConvolution(1, 3, 1, "1 group");
+
+    // Weights that do not match the groups are rejected
+    bool threw = false;
+    try
+    {
+        GroupedConvolutionalLayer<ElementType> badLayer({ input, ZeroPadding(1), { 6, 6, 6 }, NoPadding() }, GroupedConvolutionalParameters{ 3, 1, 4 }, TensorType(3 * 6, 3, 1));
+    }
+    catch (const utilities::InputException&)
+    {
+        threw = true;
+    }
+    testing::ProcessTest("Testing GroupedConvolutionalLayer, number of filters not a multiple of the number of groups", threw);
+
+    // Verify that a network with a depthwise convolution can be archived and unarchived
+    typename InputLayer<ElementType>::InputParameters inputParameters{ { 6, 6, 4 }, NoPadding(), { 8, 8, 4 }, ZeroPadding(1), 1 };
+    auto inputLayer = std::make_shared<InputLayer<ElementType>>(inputParameters);
+    TensorType depthwiseWeights(3 * 4, 3, 1);
+    depthwiseWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2); });
+    typename NeuralNetworkPredictor<ElementType>::Layers layers;
+    layers.push_back(std::make_shared<GroupedConvolutionalLayer<ElementType>>(LayerParameters{ inputLayer->GetOutput(), ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, GroupedConvolutionalParameters{ 3, 1, 4 }, depthwiseWeights));
+    NeuralNetworkPredictor<ElementType> neuralNetwork(std::move(inputLayer), std::move(layers));
+
+    std::vector<double> inputValues(6 * 6 * 4);
+    for (size_t i = 0; i < inputValues.size(); i++)
+    {
+        inputValues[i] = static_cast<double>(i % 11) - 5;
+    }
+    auto output = neuralNetwork.Predict(DataVectorType(inputValues));
+
+    utilities::SerializationContext context;
+    NeuralNetworkPredictor<ElementType>::RegisterNeuralNetworkPredictorTypes(context);
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+    neuralNetwork.WriteToArchive(archiver);
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+    NeuralNetworkPredictor<ElementType> neuralNetwork2;
+    neuralNetwork2.ReadFromArchive(unarchiver);
+    auto output2 = neuralNetwork2.Predict(DataVectorType(inputValues));
+    testing::ProcessTest("Testing GroupedConvolutionalLayer from archive", output == output2);
+}
+
+template <typename ElementType>
+void LayerThreadPoolTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using MatrixType = typename Layer<ElementType>::MatrixType;
+    using VectorType = typename Layer<ElementType>::VectorType;
+
+    // An input with a border of zero padding, and the same input without the border
+    TensorType paddedInput(8, 8, 3);
+    paddedInput.Fill(0);
+    TensorType input(6, 6, 3);
+    for (size_t i = 0; i < 6; i++)
+    {
+        for (size_t j = 0; j < 6; j++)
+        {
+            for (size_t k = 0; k < 3; k++)
+            {
+                input(i, j, k) = static_cast<ElementType>((i * 7 + j * 3 + k) % 5) - 1;
+                paddedInput(i + 1, j + 1, k) = input(i, j, k);
+            }
+        }
+    }
+
+    // Verify that every layer that splits its work computes the same output with and without a thread pool
+    ConvolutionalParameters convolutionalParams{ 3, 1, ConvolutionMethod::columnwise, 2 };
+    TensorType weights(3 * 4, 3, 3);
+    weights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 7) - 3); });
+    ConvolutionalLayer<ElementType> convolutionalLayer({ paddedInput, ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, convolutionalParams, weights);
+    testing::ProcessTest("Testing ConvolutionalLayer (regular) with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(convolutionalLayer));
+
+    convolutionalParams.method = ConvolutionMethod::diagonal;
+    ConvolutionalLayer<ElementType> convolutionalLayer2({ paddedInput, ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, convolutionalParams, weights);
+    testing::ProcessTest("Testing ConvolutionalLayer (diagonal) with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(convolutionalLayer2));
+
+    convolutionalParams.method = ConvolutionMethod::winograd;
+    ConvolutionalLayer<ElementType> convolutionalLayer3({ paddedInput, ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, convolutionalParams, weights);
+    testing::ProcessTest("Testing ConvolutionalLayer (winograd) with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(convolutionalLayer3));
+
+    PoolingLayer<ElementType, MaxPoolingFunction> poolingLayer({ input, NoPadding(), { 5, 5, 3 }, ZeroPadding(1) }, PoolingParameters{ 2, 2 });
+    testing::ProcessTest("Testing PoolingLayer with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(poolingLayer));
+
+    ActivationLayer<ElementType, ReLUActivation> activationLayer({ input, NoPadding(), { 6, 6, 3 }, NoPadding() });
+    testing::ProcessTest("Testing ActivationLayer with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(activationLayer));
+
+    BatchNormalizationLayer<ElementType> bnLayer({ input, NoPadding(), { 8, 8, 3 }, ZeroPadding(1) }, VectorType({ 1, 2, 3 }), VectorType({ 4, 1, 9 }));
+    testing::ProcessTest("Testing BatchNormalizationLayer with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(bnLayer));
+
+    MatrixType fullyConnectedWeights(5, input.Size());
+    fullyConnectedWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2); });
+    FullyConnectedLayer<ElementType> connectedLayer({ input, NoPadding(), { 1, 5, 1 }, NoPadding() }, fullyConnectedWeights);
+    testing::ProcessTest("Testing FullyConnectedLayer with thread pool", ComputeWithThreadPoolEqualsSerial<ElementType>(connectedLayer));
 }
 
 template <typename ElementType>
@@ -481,6 +786,120 @@ void SoftmaxLayerTest()
     testing::ProcessTest("Testing SoftmaxLayer, padding", output(0, 0, 0) == 0 && output(0, 1, 0) == 0 && output(2, 2, 0) == 0 && output(2, 2, 1) == 0);
 }
 
+template <typename ElementType>
+void LayerFoldingTest()
+{
+    using namespace ell::predictors;
+    using namespace ell::predictors::neural;
+    using InputParameters = typename InputLayer<ElementType>::InputParameters;
+    using LayerParameters = typename Layer<ElementType>::LayerParameters;
+    using TensorType = typename Layer<ElementType>::TensorType;
+    using MatrixType = typename Layer<ElementType>::MatrixType;
+    using VectorType = typename Layer<ElementType>::VectorType;
+    using DataVectorType = typename NeuralNetworkPredictor<ElementType>::DataVectorType;
+
+    // Conv -> BatchNorm -> Scaling -> Bias -> ReLU -> Scaling (padded) -> depthwise conv -> Scaling -> FC -> BatchNorm -> LeakyReLU
+    auto createNetwork = [] {
+        auto inputLayer = std::make_shared<InputLayer<ElementType>>(InputParameters{ { 6, 6, 3 }, NoPadding(), { 8, 8, 3 }, ZeroPadding(1), 1 });
+        typename NeuralNetworkPredictor<ElementType>::Layers layers;
+
+        TensorType convolutionWeights(3 * 4, 3, 3);
+        convolutionWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 7) - 3) / 10; });
+        layers.push_back(std::make_shared<ConvolutionalLayer<ElementType>>(LayerParameters{ inputLayer->GetOutput(), ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, ConvolutionalParameters{ 3, 1, ConvolutionMethod::columnwise, 1 }, convolutionWeights));
+        layers.push_back(std::make_shared<BatchNormalizationLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 6, 6, 4 }, NoPadding() }, VectorType({ 0.5, -1, 0, 2 }), VectorType({ 4, 1, 0.25, 9 })));
+        layers.push_back(std::make_shared<ScalingLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 6, 6, 4 }, NoPadding() }, VectorType({ 2, -0.5, 1, 3 })));
+        layers.push_back(std::make_shared<BiasLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 6, 6, 4 }, NoPadding() }, VectorType({ 0.25, 1, -1, 0 })));
+        layers.push_back(std::make_shared<ActivationLayer<ElementType, ReLUActivation>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 6, 6, 4 }, NoPadding() }));
+        layers.push_back(std::make_shared<ScalingLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 8, 8, 4 }, ZeroPadding(1) }, VectorType({ 1, 2, 3, 4 })));
+
+        TensorType depthwiseWeights(3 * 4, 3, 1);
+        depthwiseWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 5) - 2) / 10; });
+        layers.push_back(std::make_shared<GroupedConvolutionalLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), ZeroPadding(1), { 6, 6, 4 }, NoPadding() }, GroupedConvolutionalParameters{ 3, 1, 4 }, depthwiseWeights));
+        layers.push_back(std::make_shared<ScalingLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 6, 6, 4 }, NoPadding() }, VectorType({ -1, 0.5, 2, 1 })));
+
+        MatrixType fullyConnectedWeights(5, 6 * 6 * 4);
+        fullyConnectedWeights.Generate([n = 0]() mutable { return static_cast<ElementType>((n++ % 9) - 4) / 100; });
+        layers.push_back(std::make_shared<FullyConnectedLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 5 }, NoPadding() }, fullyConnectedWeights));
+        layers.push_back(std::make_shared<BatchNormalizationLayer<ElementType>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 5 }, NoPadding() }, VectorType({ 0, 1, -1, 0.5, 2 }), VectorType({ 1, 4, 0.25, 1, 16 })));
+        layers.push_back(std::make_shared<ActivationLayer<ElementType, LeakyReLUActivation>>(LayerParameters{ layers.back()->GetOutput(), NoPadding(), { 1, 1, 5 }, NoPadding() }));
+        return NeuralNetworkPredictor<ElementType>(std::move(inputLayer), std::move(layers));
+    };
+
+    std::vector<DataVectorType> dataVectors;
+    for (size_t index = 0; index < 3; index++)
+    {
+        std::vector<double> inputValues(6 * 6 * 3);
+        for (size_t i = 0; i < inputValues.size(); i++)
+        {
+            inputValues[i] = static_cast<double>((i * (index + 2)) % 11) - 5;
+        }
+        dataVectors.emplace_back(inputValues);
+    }
+
+    auto network = createNetwork();
+    auto foldedNetwork = createNetwork();
+    foldedNetwork.FoldLayers();
+
+    std::vector<LayerType> expectedLayerTypes = { LayerType::convolution, LayerType::bias, LayerType::activation, LayerType::scaling, LayerType::groupedConvolution, LayerType::fullyConnected, LayerType::bias, LayerType::activation };
+    std::vector<LayerType> layerTypes;
+    for (const auto& layer : foldedNetwork.GetLayers())
+    {
+        layerTypes.push_back(layer->GetLayerType());
+    }
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers, layers", layerTypes == expectedLayerTypes);
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers, in place activations", foldedNetwork.GetLayers()[2]->IsComputedInPlace() && !foldedNetwork.GetLayers()[7]->IsComputedInPlace());
+
+    auto isClose = [](const std::vector<ElementType>& a, const std::vector<ElementType>& b) {
+        bool isEqual = a.size() == b.size();
+        for (size_t i = 0; isEqual && i < a.size(); i++)
+        {
+            isEqual = std::abs(a[i] - b[i]) <= 0.0001 * std::max<ElementType>(1, std::abs(b[i]));
+        }
+        return isEqual;
+    };
+
+    bool isEqual = true;
+    std::vector<std::vector<ElementType>> expectedOutputs;
+    for (const auto& dataVector : dataVectors)
+    {
+        expectedOutputs.push_back(network.Predict(dataVector));
+        isEqual = isEqual && isClose(foldedNetwork.Predict(dataVector), expectedOutputs.back());
+    }
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers, Predict", isEqual);
+
+    // Computing twice must give the same result, since the in place activation overwrites the output of the previous layer
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers, Predict again", isClose(foldedNetwork.Predict(dataVectors[0]), expectedOutputs[0]));
+
+    auto outputs = foldedNetwork.PredictBatch(dataVectors);
+    isEqual = outputs.size() == expectedOutputs.size();
+    for (size_t index = 0; isEqual && index < outputs.size(); index++)
+    {
+        isEqual = isClose(outputs[index], expectedOutputs[index]);
+    }
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers, PredictBatch", isEqual);
+
+    // A predictor read from an archive keeps the archived layers until they are folded
+    utilities::SerializationContext context;
+    NeuralNetworkPredictor<ElementType>::RegisterNeuralNetworkPredictorTypes(context);
+    std::stringstream strstream;
+    utilities::JsonArchiver archiver(strstream);
+    network.WriteToArchive(archiver);
+    utilities::JsonUnarchiver unarchiver(strstream, context);
+    NeuralNetworkPredictor<ElementType> unarchivedNetwork;
+    unarchivedNetwork.ReadFromArchive(unarchiver);
+    testing::ProcessTest("Testing NeuralNetworkPredictor from archive, layers not folded", unarchivedNetwork.GetLayers().size() == network.GetLayers().size());
+    testing::ProcessTest("Testing NeuralNetworkPredictor from archive, Predict", isClose(unarchivedNetwork.Predict(dataVectors[1]), expectedOutputs[1]));
+    unarchivedNetwork.FoldLayers();
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers from archive, layers", unarchivedNetwork.GetLayers().size() == expectedLayerTypes.size());
+    testing::ProcessTest("Testing NeuralNetworkPredictor::FoldLayers from archive, Predict", isClose(unarchivedNetwork.Predict(dataVectors[1]), expectedOutputs[1]));
+
+    // A folded copy has its own layers, so the original network is unchanged
+    auto foldedCopy = network.GetFoldedCopy();
+    testing::ProcessTest("Testing NeuralNetworkPredictor::GetFoldedCopy, layers", foldedCopy.GetLayers().size() == expectedLayerTypes.size() && network.GetLayers().size() == 11);
+    testing::ProcessTest("Testing NeuralNetworkPredictor::GetFoldedCopy, Predict", isClose(foldedCopy.Predict(dataVectors[2]), expectedOutputs[2]));
+    testing::ProcessTest("Testing NeuralNetworkPredictor::GetFoldedCopy, original Predict", isClose(network.Predict(dataVectors[2]), expectedOutputs[2]));
+}
+
 template <typename ElementType>
 void NeuralNetworkPredictorTest()
 {
@@ -504,11 +923,16 @@ void NeuralNetworkPredictorTest()
     BiasLayerTest<ElementType>();
     BinaryConvolutionalLayerTest<ElementType>();
     ConvolutionalLayerTest<ElementType>();
+    ConvolutionalLayerArchiveTest<ElementType>();
+    WinogradConvolutionalLayerTest<ElementType>();
+    GroupedConvolutionalLayerTest<ElementType>();
     FullyConnectedLayerTest<ElementType>();
     InputLayerTest<ElementType>();
     PoolingLayerTest<ElementType>();
     ScalingLayerTest<ElementType>();
     SoftmaxLayerTest<ElementType>();
+    LayerThreadPoolTest<ElementType>();
+    LayerFoldingTest<ElementType>();
 
     // Build an XOR net from previously trained values.
     typename NeuralNetworkPredictor<ElementType>::InputLayerReference inputLayer;
@@ -565,6 +989,21 @@ void NeuralNetworkPredictorTest()
     output = neuralNetwork.Predict(DataVectorType({ 1, 1 }));
     testing::ProcessTest("Testing NeuralNetworkPredictor, Predict of XOR net for 1 1 ", Equals(output[0], 0.0));
 
+    // Check that a batch gives the same results as one input at a time
+    std::vector<DataVectorType> dataVectors;
+    dataVectors.emplace_back(DataVectorType({ 0, 0 }));
+    dataVectors.emplace_back(DataVectorType({ 0, 1 }));
+    dataVectors.emplace_back(DataVectorType({ 1, 0 }));
+    dataVectors.emplace_back(DataVectorType({ 1, 1 }));
+    auto outputs = neuralNetwork.PredictBatch(dataVectors);
+    testing::ProcessTest("Testing NeuralNetworkPredictor, PredictBatch of XOR net", outputs.size() == 4 && Equals(outputs[0][0], 0.0) && Equals(outputs[1][0], 1.0) && Equals(outputs[2][0], 1.0) && Equals(outputs[3][0], 0.0));
+
+    // Check that a thread pool does not change the results
+    neuralNetwork.SetThreadPool(std::make_shared<utilities::ThreadPool>(2));
+    output = neuralNetwork.Predict(DataVectorType({ 0, 1 }));
+    testing::ProcessTest("Testing NeuralNetworkPredictor with thread pool, Predict of XOR net for 0 1 ", Equals(output[0], 1.0));
+    neuralNetwork.SetThreadPool(nullptr);
+
     // Verify that we can archive and unarchive the predictor
     utilities::SerializationContext context;
     NeuralNetworkPredictor<ElementType>::RegisterNeuralNetworkPredictorTypes(context);
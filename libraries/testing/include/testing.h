@@ -142,6 +142,17 @@ namespace testing
     ///
     /// <returns> true if one of the tests failed. </returns>
     bool DidTestFail();
+
+    /// <summary>
+    /// Gets a path for a scratch file in the system's temporary directory (as given by the TMPDIR,
+    /// TMP or TEMP environment variable), so that tests don't write into the working directory.
+    /// The caller removes the file when it is done with it.
+    /// </summary>
+    ///
+    /// <param name="filename"> The name of the file. </param>
+    ///
+    /// <returns> The path of the file. </returns>
+    std::string GetTempFilePath(const std::string& filename);
 }
 }
 
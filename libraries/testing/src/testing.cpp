@@ -10,6 +10,7 @@
 #include "testing.h"
 
 // stl
+#include <cstdlib>
 #include <iostream>
 #include <string>
 
@@ -212,6 +213,23 @@ namespace testing
         return testFailedFlag;
     }
 
+    std::string GetTempFilePath(const std::string& filename)
+    {
+        for (auto variable : { "TMPDIR", "TMP", "TEMP" })
+        {
+            auto directory = std::getenv(variable);
+            if (directory != nullptr && directory[0] != '\0')
+            {
+                return std::string(directory) + "/" + filename;
+            }
+        }
+#if defined(_WIN32)
+        return filename;
+#else
+        return "/tmp/" + filename;
+#endif
+    }
+
     template bool IsEqual(const std::vector<std::vector<float>>& a, const std::vector<std::vector<float>>& b, double tolerance);
     template bool IsEqual(const std::vector<std::vector<float>>& a, const std::vector<std::vector<double>>& b, double tolerance);
     template bool IsEqual(const std::vector<std::vector<double>>& a, const std::vector<std::vector<float>>& b, double tolerance);
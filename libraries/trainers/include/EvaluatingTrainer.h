@@ -45,6 +45,16 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Updates the internal trainer with a pass over a stream of examples. Unlike Update(), this
+        /// function does not evaluate the predictor, because a stream is often passed to the trainer in
+        /// several parts; call Evaluate() after the last part. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
+        /// <summary> Evaluates the current predictor. </summary>
+        void Evaluate();
+
         /// <summary> Gets a const reference to the current predictor. </summary>
         ///
         /// <returns> A const reference to the current predictor. </returns>
@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FeatureStatistics.h (trainers)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// data
+#include "AutoDataVector.h"
+#include "Dataset.h"
+#include "ExampleIterator.h"
+
+// math
+#include "Vector.h"
+
+// stl
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace ell
+{
+namespace trainers
+{
+    /// <summary> A mergeable sketch of a distribution of values, which answers approximate quantile
+    /// queries in bounded memory. The sketch keeps a sorted list of weighted centroids; when it grows
+    /// too large, adjacent centroids are merged as long as their combined weight stays below a fixed
+    /// fraction of the total weight. </summary>
+    class QuantileSketch
+    {
+    public:
+        /// <summary> Constructs an empty QuantileSketch. </summary>
+        ///
+        /// <param name="size"> The number of centroids that the sketch is compressed to. Quantiles are exact
+        /// as long as the sketch holds at most twice this number of values, and the rank error of a quantile
+        /// is roughly 1/size otherwise. </param>
+        QuantileSketch(size_t size = 128);
+
+        /// <summary> Adds a weighted value to the sketch. </summary>
+        ///
+        /// <param name="value"> The value. </param>
+        /// <param name="weight"> The weight. </param>
+        void Add(double value, double weight = 1.0);
+
+        /// <summary> Adds the contents of another sketch to this sketch. </summary>
+        ///
+        /// <param name="other"> The other sketch. </param>
+        void Merge(const QuantileSketch& other);
+
+        /// <summary> Gets the total weight of the values in the sketch. </summary>
+        ///
+        /// <returns> The total weight. </returns>
+        double GetTotalWeight() const { return _totalWeight; }
+
+        /// <summary> Gets an approximate quantile of the values in the sketch. </summary>
+        ///
+        /// <param name="q"> The quantile, between 0 and 1. </param>
+        ///
+        /// <returns> The approximate quantile, or zero if the sketch is empty. </returns>
+        double GetQuantile(double q) const;
+
+    private:
+        struct Centroid
+        {
+            double value;
+            double weight;
+        };
+
+        void Compress();
+
+        size_t _size;
+        double _totalWeight = 0;
+        std::vector<Centroid> _centroids;
+    };
+
+    /// <summary> Per-feature statistics of a set of data vectors: the number of non-zeros, mean, variance,
+    /// min, max, mean absolute value and approximate quantiles of each feature. Elements that a sparse data
+    /// vector does not store count as zeros. Statistics of disjoint sets of data vectors can be accumulated
+    /// separately (for example, on different threads) and then merged. The quantile sketches take far more
+    /// memory than the other statistics, so they can be turned off. </summary>
+    class FeatureStatistics
+    {
+    public:
+        /// <summary> Constructs an empty FeatureStatistics. </summary>
+        ///
+        /// <param name="quantileSketchSize"> The size of the quantile sketch kept for each feature (see QuantileSketch),
+        /// or zero to keep no sketches and compute no quantiles. </param>
+        FeatureStatistics(size_t quantileSketchSize = 128);
+
+        /// <summary> Adds a data vector to the statistics. </summary>
+        ///
+        /// <param name="dataVector"> The data vector. </param>
+        void Add(const data::AutoDataVector& dataVector);
+
+        /// <summary> Merges statistics of a disjoint set of data vectors into these statistics. </summary>
+        ///
+        /// <param name="other"> The other statistics. </param>
+        void Merge(const FeatureStatistics& other);
+
+        /// <summary> Checks if the statistics include quantiles. </summary>
+        ///
+        /// <returns> true if a quantile sketch is kept for each feature. </returns>
+        bool HasQuantiles() const { return _quantileSketchSize > 0; }
+
+        /// <summary> Gets the number of data vectors that were added. </summary>
+        ///
+        /// <returns> The number of data vectors. </returns>
+        size_t NumExamples() const { return _numExamples; }
+
+        /// <summary> Gets the number of features, which is the maximal prefix length of the data vectors. </summary>
+        ///
+        /// <returns> The number of features. </returns>
+        size_t NumFeatures() const { return _features.size(); }
+
+        /// <summary> Gets the number of data vectors in which a feature is non-zero. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The number of non-zeros. </returns>
+        size_t GetNonZeroCount(size_t index) const { return _features[index].count; }
+
+        /// <summary> Gets the mean of a feature. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The mean. </returns>
+        double GetMean(size_t index) const;
+
+        /// <summary> Gets the (population) variance of a feature. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The variance. </returns>
+        double GetVariance(size_t index) const;
+
+        /// <summary> Gets the mean absolute value of a feature. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The mean absolute value. </returns>
+        double GetMeanAbsoluteValue(size_t index) const;
+
+        /// <summary> Gets the minimal value of a feature. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The minimal value. </returns>
+        double GetMin(size_t index) const;
+
+        /// <summary> Gets the maximal value of a feature. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        ///
+        /// <returns> The maximal value. </returns>
+        double GetMax(size_t index) const;
+
+        /// <summary> Gets an approximate quantile of a feature. Throws if the statistics include no quantiles. </summary>
+        ///
+        /// <param name="index"> The feature index. </param>
+        /// <param name="q"> The quantile, between 0 and 1. </param>
+        ///
+        /// <returns> The approximate quantile. </returns>
+        double GetQuantile(size_t index, double q) const;
+
+        /// <summary> Gets the means of all the features. </summary>
+        ///
+        /// <returns> The vector of means. </returns>
+        math::RowVector<double> GetMeans() const;
+
+        /// <summary> Gets the variances of all the features. </summary>
+        ///
+        /// <returns> The vector of variances. </returns>
+        math::RowVector<double> GetVariances() const;
+
+        /// <summary> Gets the mean absolute values of all the features. </summary>
+        ///
+        /// <returns> The vector of mean absolute values. </returns>
+        math::RowVector<double> GetMeanAbsoluteValues() const;
+
+        /// <summary> Prints a table with the statistics of each feature to an output stream. The quantile
+        /// columns are omitted if the statistics include no quantiles. </summary>
+        ///
+        /// <param name="os"> [in,out] Stream to write to. </param>
+        void Print(std::ostream& os) const;
+
+    private:
+        // statistics of the non-zero values of a feature, the implicit zeros are accounted for by the getters
+        struct FeatureAccumulator
+        {
+            size_t count = 0;
+            double sum = 0;
+            double sumOfAbsoluteValues = 0;
+            double sumOfSquaredDeviations = 0;
+            double min = 0;
+            double max = 0;
+        };
+
+        void Resize(size_t numFeatures);
+
+        size_t _quantileSketchSize;
+        size_t _numExamples = 0;
+        std::vector<FeatureAccumulator> _features;
+        std::vector<QuantileSketch> _sketches; // empty if the quantile sketch size is zero
+    };
+
+    /// <summary> Parameters for CalculateFeatureStatistics. </summary>
+    struct FeatureStatisticsParameters
+    {
+        size_t numThreads = 0;
+        size_t quantileSketchSize = 128; // zero means no quantiles
+    };
+
+    /// <summary> Calculates per-feature statistics of the examples in a dataset, in a single pass over the
+    /// examples that is split between multiple threads. </summary>
+    ///
+    /// <param name="anyDataset"> The dataset. </param>
+    /// <param name="parameters"> The parameters, where zero threads means one thread per hardware thread. </param>
+    ///
+    /// <returns> The feature statistics. </returns>
+    FeatureStatistics CalculateFeatureStatistics(const data::AnyDataset& anyDataset, const FeatureStatisticsParameters& parameters = {});
+
+    /// <summary> Calculates per-feature statistics of a stream of examples, in a single pass over the stream.
+    /// Examples are read in chunks, and each chunk is split between multiple threads. </summary>
+    ///
+    /// <param name="exampleIterator"> The example iterator. </param>
+    /// <param name="parameters"> The parameters, where zero threads means one thread per hardware thread. </param>
+    ///
+    /// <returns> The feature statistics. </returns>
+    FeatureStatistics CalculateFeatureStatistics(data::AutoSupervisedExampleIterator exampleIterator, const FeatureStatisticsParameters& parameters = {});
+}
+}
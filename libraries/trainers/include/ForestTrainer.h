@@ -12,6 +12,7 @@
 
 // data
 #include "Dataset.h"
+#include "DatasetIndexView.h"
 #include "DenseDataVector.h"
 
 // predictors
@@ -132,6 +133,12 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Loads a stream of examples into memory, sets it as the trainer's dataset, and performs a
+        /// learning epoch. The forest grown so far is kept, so each call continues boosting on the new examples. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
         /// <summary> Gets a const reference to the current predictor. </summary>
         ///
         /// <returns> A const reference to the current predictor. </returns>
@@ -180,7 +187,7 @@ namespace trainers
         void UpdateCurrentOutputs(double value);
         void UpdateCurrentOutputs(Range range, const EdgePredictorType& edgePredictor);
 
-        // after performing a split, we rearrange the data set to ensure that each node's examples occupy contiguous rows in the dataset
+        // after performing a split, we rearrange the dataset view to ensure that each node's examples occupy contiguous positions in the view
         void SortNodeDataset(Range range, const SplitRuleType& splitRule);
 
         //
@@ -206,6 +213,9 @@ namespace trainers
 
         // the data set
         data::Dataset<TrainerExampleType> _dataset;
+
+        // the order of the examples, where each node's examples occupy a contiguous range; reordering the view moves indices rather than examples
+        data::DatasetIndexView<TrainerExampleType> _datasetView;
     };
 }
 }
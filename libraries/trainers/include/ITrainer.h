@@ -10,6 +10,7 @@
 
 // data
 #include "Dataset.h"
+#include "ExampleIterator.h"
 
 // stl
 #include <memory>
@@ -30,7 +31,8 @@ namespace trainers
     public:
         virtual ~ITrainer() = default;
 
-        /// <summary> Sets the trainer's dataset. </summary>
+        /// <summary> Sets the trainer's dataset. Trainers may refer to the examples of the dataset rather than
+        /// copy them, so the dataset must outlive the training session. </summary>
         ///
         /// <param name="anyDataset"> A dataset. </param>
         virtual void SetDataset(const data::AnyDataset& anyDataset) = 0;
@@ -38,6 +40,13 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() = 0;
 
+        /// <summary> Updates the state of the trainer by performing a learning pass over a stream of
+        /// examples. Online trainers do not store the examples, which allows training on datasets that do
+        /// not fit in memory; trainers that need the entire dataset load the stream into memory. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) = 0;
+
         /// <summary> Gets a const reference to the current predictor. </summary>
         ///
         /// <returns> A const reference to the current predictor. </returns>
@@ -49,7 +49,7 @@ namespace trainers
     template<typename TransformationType>
     math::RowVector<double> CalculateDenseTransformedMean(const data::AnyDataset& anyDataset, TransformationType transformation);
 
-    /// <summary> Calcluates the mean of data vectors in a dataset </summary>
+    /// <summary> Calcluates the mean of data vectors in a dataset, using multiple threads (see CalculateFeatureStatistics) </summary>
     ///
     /// <param name="anyDataset"> The dataset. </param>
     ///
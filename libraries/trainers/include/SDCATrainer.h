@@ -16,12 +16,14 @@
 // data
 #include "Dataset.h"
 #include "Example.h"
+#include "SharedDataset.h"
 
 // math
 #include "Vector.h"
 
 // stl
 #include <random>
+#include <vector>
 
 namespace ell
 {
@@ -68,6 +70,13 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Loads a stream of examples into memory, sets it as the trainer's dataset, and performs a
+        /// learning epoch. SDCA keeps a dual variable for each example, so this can only be called before any
+        /// other updates; additional epochs over the loaded examples are performed by calling Update. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
         /// <summary> Gets the trained predictor. </summary>
         ///
         /// <returns> A const reference to the predictor. </returns>
@@ -76,27 +85,13 @@ namespace trainers
         /// <summary> Gets information on the trained predictor. </summary>
         ///
         /// <returns> Information on the trained predictor. </returns>
-        double GetPredictorInfo() const { return _predictorInfo; }
+        const SDCAPredictorInfo& GetPredictorInfo() const { return _predictorInfo; }
 
     private:
-        struct TrainerMetadata
-        {
-            TrainerMetadata(const data::WeightLabel& weightLabel);
-
-            // weight and label
-            data::WeightLabel weightLabel;
-
-            // precomputed squared 2 norm of the data vector 
-            double norm2Squared = 0;
-
-            // dual variable
-            double dualVariable = 0;
-        };
-
         using DataVectorType = typename predictors::LinearPredictor::DataVectorType;
-        using TrainerExampleType = data::Example<DataVectorType, TrainerMetadata>;
+        using ExampleType = data::Example<DataVectorType, data::WeightLabel>;
 
-        void Step(TrainerExampleType& x);
+        void Step(size_t index);
         void ComputeObjectives();
         void ResizeTo(const data::AutoDataVector& x);
 
@@ -106,7 +101,12 @@ namespace trainers
         std::default_random_engine _random;
         double _inverseScaledRegularization;
 
-        data::Dataset<TrainerExampleType> _dataset;
+        // the examples are shared with other trainers, the per-example state is stored in parallel arrays
+        data::SharedDataset<ExampleType> _dataset;
+        data::Dataset<ExampleType> _streamedDataset;
+        std::vector<size_t> _permutation;
+        std::vector<double> _norm2Squared;
+        std::vector<double> _dualVariables;
 
         predictors::LinearPredictor _predictor;
         SDCAPredictorInfo _predictorInfo;
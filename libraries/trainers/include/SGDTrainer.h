@@ -16,12 +16,14 @@
 // data
 #include "Dataset.h"
 #include "Example.h"
+#include "SharedDataset.h"
 
 // stl
 #include <cstddef>
 #include <memory>
 #include <random>
 #include <string>
+#include <vector>
 
 namespace ell
 {
@@ -52,6 +54,13 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Updates the state of the trainer by performing a learning pass over a stream of
+        /// examples. The examples are visited in the order of the stream, which the caller can shuffle with
+        /// a ShufflingExampleIterator. SetDataset does not have to be called in this mode. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
         /// <summary> Returns The averaged predictor. </summary>
         ///
         /// <returns> A const reference to the averaged predictor. </returns>
@@ -63,8 +72,10 @@ namespace trainers
         virtual void DoFirstStep(const data::AutoDataVector& x, double y, double weight) = 0;
         virtual void DoNextStep(const data::AutoDataVector& x, double y, double weight) = 0;
         virtual const PredictorType& GetAveragedPredictor() const = 0;
+        void Step(const data::AutoSupervisedExample& example);
 
-        data::AutoSupervisedDataset _dataset;
+        data::SharedDataset<data::AutoSupervisedExample> _dataset;
+        std::vector<size_t> _permutation;
         std::default_random_engine _random;
         bool _firstIteration = true;
     };
@@ -13,6 +13,7 @@
 
 // data
 #include "Dataset.h"
+#include "SharedDataset.h"
 
 // evaluators
 #include "Evaluator.h"
@@ -41,9 +42,10 @@ namespace trainers
         /// <summary> Constructs an instance of SweepingTrainer. </summary>
         ///
         /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
-        SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers);
+        /// <param name="streamChunkSize"> The number of examples read into memory at a time by UpdateFromStream. </param>
+        SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, size_t streamChunkSize = 4096);
 
-        /// <summary> Sets the trainer's dataset. </summary>
+        /// <summary> Sets the dataset of all of the internal trainers, which share a single copy of the examples. </summary>
         ///
         /// <param name="anyDataset"> A dataset. </param>
         virtual void SetDataset(const data::AnyDataset& anyDataset) override;
@@ -51,24 +53,33 @@ namespace trainers
         /// <summary> Updates the state of the trainer by performing a learning epoch. </summary>
         virtual void Update() override;
 
+        /// <summary> Updates all of the internal trainers with a pass over a stream of examples, which is read
+        /// only once. The stream is read in chunks, and each chunk is passed to each of the internal trainers
+        /// before the next one is read. The predictors are evaluated at the end of the stream. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
         /// <summary> Gets a const reference to the current predictor. </summary>
         ///
         /// <returns> A const reference to the current predictor. </returns>
         virtual const PredictorType& GetPredictor() const override;
 
     private:
-        data::Dataset<ExampleType> _dataset;
+        data::SharedDataset<ExampleType> _dataset;
         std::vector<EvaluatingTrainerType> _evaluatingTrainers;
+        size_t _streamChunkSize;
     };
 
     /// <summary> Makes an incremental trainer that runs multiple internal trainers and chooses the best performing predictor. </summary>
     ///
     /// <typeparam name="PredictorType"> Type of the predictor returned by this trainer. </typeparam>
     /// <param name="evaluatingTrainers"> A vector of evaluating trainers. </param>
+    /// <param name="streamChunkSize"> The number of examples read into memory at a time by UpdateFromStream. </param>
     ///
     /// <returns> A unique_ptr to a sweeping trainer. </returns>
     template <typename PredictorType>
-    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers);
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, size_t streamChunkSize = 4096);
 }
 }
 
@@ -59,6 +59,12 @@ namespace trainers
         /// <param name="anyDataset"> A dataset. </param>
         void Update() override;
 
+        /// <summary> Loads a stream of examples into memory, sets it as the trainer's dataset, and trains a
+        /// ProtoNN model for it. </summary>
+        ///
+        /// <param name="exampleIterator"> An example iterator. </param>
+        virtual void UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator) override;
+
         /// <summary> Returns The ProtoNN predictor. </summary>
         ///
         /// <returns> A shared pointer to the current predictor. </returns>
@@ -10,6 +10,7 @@
 // stl
 #include <cassert>
 #include <cmath>
+#include <utility>
 
 // math
 #include "Vector.h"
@@ -47,8 +48,16 @@ namespace trainers
         math::ColumnMatrix<double> X(_dimemsion, anyDataset.NumExamples());
         math::ColumnMatrix<double> Y(_parameters.numLabels, anyDataset.NumExamples());
         ProtoNNTrainerUtils::GetDatasetAsMatrix(anyDataset, X, Y);
-        _X.CopyFrom(X);
-        _Y.CopyFrom(Y);
+        _X.Swap(X);
+        _Y.Swap(Y);
+    }
+
+    void ProtoNNTrainer::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        // SetDataset copies the examples into the trainer's matrices, which are sized by the AnyDataset's explicit size
+        auto dataset = data::MakeDataset(std::move(exampleIterator));
+        SetDataset(dataset.GetAnyDataset(0, dataset.NumExamples()));
+        Update();
     }
 
     void ProtoNNTrainer::Update()
@@ -278,6 +287,7 @@ namespace trainers
         math::ColumnMatrix<double> gradient_paramS(param.NumRows(), param.NumColumns());
         math::ColumnMatrix<double> paramQ(param.NumRows(), param.NumColumns());
 
+        math::ColumnMatrix<double> paramQ_new(param.NumRows(), param.NumColumns());
         math::ColumnMatrix<double> paramS(param.NumRows(), param.NumColumns());
 
         paramQ.CopyFrom(param);
@@ -316,30 +326,22 @@ namespace trainers
 
             gradient_paramS = gradf(paramS, idx1, idx2);
 
-            math::ColumnMatrix<double> paramQ_new(paramS.NumRows(), paramS.NumColumns());
-            math::Operations::Add(1.0, paramS, -stepSize, gradient_paramS, paramQ_new); //paramQ_new=paramS-stepSize*grad(paramS)
+            paramQ_new.CopyFrom(paramS - stepSize * gradient_paramS); //paramQ_new=paramS-stepSize*grad(paramS)
 
             prox(paramQ_new); //paramQ_new = HardThresholding(paramQ_new)
 
-            math::ColumnMatrix<double> paramS_new(paramQ_new.NumRows(), paramQ_new.NumColumns());
-            math::Operations::Add(1 - alpha, paramQ_new, alpha, paramQ, paramS_new);
-
-            // paramS_new = (1-alpha)*paramQ_new+alpha*paramQ; paramS=paramS_new
-            paramS.CopyFrom(paramS_new);
+            // paramS = (1-alpha)*paramQ_new+alpha*paramQ, the expressions are evaluated element by element, so paramS and paramAvg can be updated in place
+            paramS.CopyFrom((1 - alpha) * paramQ_new + alpha * paramQ);
 
             double runningAvgWeight = ((t - burn_period) > 1) ? (t - burn_period) : 1.0; //runningAvgWeight
             assert(runningAvgWeight >= 0.999999);
 
-            //Running average of all but first burn_period paramS's; paramAvg_new=(1-1/runningAvgWeight)*paramAvg+ 1/runningAvgWeight*paramS_new
-            math::ColumnMatrix<double> paramAvg_new(paramS_new.NumRows(), paramS_new.NumColumns());
-            math::Operations::Add(safe_div(1.0, runningAvgWeight), paramS_new, safe_div(runningAvgWeight - 1.0, runningAvgWeight), paramAvg, paramAvg_new);
+            //Running average of all but first burn_period paramS's; paramAvg=(1-1/runningAvgWeight)*paramAvg+ 1/runningAvgWeight*paramS
+            paramAvg.CopyFrom(safe_div(1.0, runningAvgWeight) * paramS + safe_div(runningAvgWeight - 1.0, runningAvgWeight) * paramAvg);
 
             //Initializing parameters for next iteration
             lambda = lambda_new;
-            paramQ = paramQ_new;
-
-            paramS.CopyFrom(paramS_new);
-            paramAvg.CopyFrom(paramAvg_new);
+            paramQ.Swap(paramQ_new);
         }
 
         param.CopyFrom(paramAvg);
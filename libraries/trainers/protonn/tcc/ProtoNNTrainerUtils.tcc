@@ -29,7 +29,7 @@ namespace trainers
 {
     void ProtoNNTrainerUtils::GetDatasetAsMatrix(const data::AutoSupervisedDataset& anyDataset, math::MatrixReference<double, math::MatrixLayout::columnMajor> X, math::MatrixReference<double, math::MatrixLayout::columnMajor> Y)
     {
-        auto exampleIterator = anyDataset.GetExampleIterator();
+        auto exampleIterator = anyDataset.GetExampleReferenceIterator();
         int colIdx = 0;
         while (exampleIterator.IsValid())
         {
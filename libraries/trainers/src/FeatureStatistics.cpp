@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     FeatureStatistics.cpp (trainers)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "FeatureStatistics.h"
+
+// data
+#include "SharedDataset.h"
+
+// utilities
+#include "Exception.h"
+
+// stl
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <thread>
+
+namespace ell
+{
+namespace trainers
+{
+    namespace
+    {
+        // spreading fewer examples than this over threads costs more than it saves
+        const size_t minExamplesPerThread = 1024;
+
+        size_t GetNumThreads(size_t numThreads, size_t numExamples)
+        {
+            if (numThreads == 0)
+            {
+                numThreads = std::thread::hardware_concurrency();
+                if (numThreads == 0) // std::thread::hardware_concurrency may return 0 if it isn't implemented
+                {
+                    numThreads = 1;
+                }
+            }
+            return std::max(size_t(1), std::min(numThreads, numExamples / minExamplesPerThread));
+        }
+
+        // adds a range of examples to each of the given statistics, one thread per statistics
+        template <typename ExampleContainerType>
+        void AddExamplesInParallel(const ExampleContainerType& examples, size_t numExamples, std::vector<FeatureStatistics>& statistics)
+        {
+            auto addRange = [&examples](FeatureStatistics& result, size_t fromIndex, size_t toIndex) {
+                for (size_t i = fromIndex; i < toIndex; ++i)
+                {
+                    result.Add(examples[i].GetDataVector());
+                }
+            };
+
+            size_t numThreads = statistics.size();
+            size_t blockSize = (numExamples + numThreads - 1) / numThreads;
+            std::vector<std::future<void>> futures;
+            for (size_t thread = 1; thread < numThreads; ++thread)
+            {
+                auto fromIndex = std::min(thread * blockSize, numExamples);
+                auto toIndex = std::min(fromIndex + blockSize, numExamples);
+                futures.push_back(std::async(std::launch::async, addRange, std::ref(statistics[thread]), fromIndex, toIndex));
+            }
+
+            // the first block is handled by the calling thread
+            addRange(statistics[0], 0, std::min(blockSize, numExamples));
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+
+        FeatureStatistics MergeAll(std::vector<FeatureStatistics>& statistics)
+        {
+            for (size_t i = 1; i < statistics.size(); ++i)
+            {
+                statistics[0].Merge(statistics[i]);
+            }
+            return std::move(statistics[0]);
+        }
+    }
+
+    //
+    // QuantileSketch
+    //
+
+    QuantileSketch::QuantileSketch(size_t size)
+        : _size(size)
+    {
+        if (size == 0)
+        {
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "quantile sketch size must be positive");
+        }
+    }
+
+    void QuantileSketch::Add(double value, double weight)
+    {
+        if (weight <= 0)
+        {
+            return;
+        }
+
+        _centroids.push_back({ value, weight });
+        _totalWeight += weight;
+        if (_centroids.size() > 2 * _size)
+        {
+            Compress();
+        }
+    }
+
+    void QuantileSketch::Merge(const QuantileSketch& other)
+    {
+        _centroids.insert(_centroids.end(), other._centroids.begin(), other._centroids.end());
+        _totalWeight += other._totalWeight;
+        if (_centroids.size() > 2 * _size)
+        {
+            Compress();
+        }
+    }
+
+    void QuantileSketch::Compress()
+    {
+        std::sort(_centroids.begin(), _centroids.end(), [](const Centroid& a, const Centroid& b) { return a.value < b.value; });
+
+        // any two adjacent centroids that remain weigh more than maxWeight together, so at most _size remain
+        double maxWeight = 2.0 * _totalWeight / _size;
+        size_t numCentroids = 0;
+        for (const auto& centroid : _centroids)
+        {
+            if (numCentroids > 0 && _centroids[numCentroids - 1].weight + centroid.weight <= maxWeight)
+            {
+                auto& last = _centroids[numCentroids - 1];
+                double weight = last.weight + centroid.weight;
+                last.value += (centroid.value - last.value) * centroid.weight / weight;
+                last.weight = weight;
+            }
+            else
+            {
+                _centroids[numCentroids++] = centroid;
+            }
+        }
+        _centroids.resize(numCentroids);
+    }
+
+    double QuantileSketch::GetQuantile(double q) const
+    {
+        if (_centroids.empty())
+        {
+            return 0.0;
+        }
+
+        auto centroids = _centroids;
+        std::sort(centroids.begin(), centroids.end(), [](const Centroid& a, const Centroid& b) { return a.value < b.value; });
+
+        // each centroid represents the rank at its center, and ranks in between are interpolated
+        double rank = std::min(std::max(q, 0.0), 1.0) * _totalWeight;
+        double position = centroids[0].weight / 2;
+        if (rank <= position)
+        {
+            return centroids[0].value;
+        }
+
+        for (size_t i = 1; i < centroids.size(); ++i)
+        {
+            double nextPosition = position + (centroids[i - 1].weight + centroids[i].weight) / 2;
+            if (rank <= nextPosition)
+            {
+                double fraction = (rank - position) / (nextPosition - position);
+                return centroids[i - 1].value + fraction * (centroids[i].value - centroids[i - 1].value);
+            }
+            position = nextPosition;
+        }
+        return centroids.back().value;
+    }
+
+    //
+    // FeatureStatistics
+    //
+
+    FeatureStatistics::FeatureStatistics(size_t quantileSketchSize)
+        : _quantileSketchSize(quantileSketchSize)
+    {
+    }
+
+    void FeatureStatistics::Resize(size_t numFeatures)
+    {
+        if (_features.size() < numFeatures)
+        {
+            _features.resize(numFeatures);
+        }
+        while (HasQuantiles() && _sketches.size() < numFeatures)
+        {
+            _sketches.emplace_back(_quantileSketchSize);
+        }
+    }
+
+    void FeatureStatistics::Add(const data::AutoDataVector& dataVector)
+    {
+        ++_numExamples;
+        Resize(dataVector.PrefixLength());
+        dataVector.ForEachElement<data::IterationPolicy::skipZeros>([this](data::IndexValue indexValue) {
+            auto& feature = _features[indexValue.index];
+            double value = indexValue.value;
+            if (feature.count == 0)
+            {
+                feature.min = value;
+                feature.max = value;
+            }
+            else
+            {
+                feature.min = std::min(feature.min, value);
+                feature.max = std::max(feature.max, value);
+            }
+
+            // Welford's update of the sum of squared deviations from the mean
+            double oldMean = feature.count == 0 ? 0.0 : feature.sum / feature.count;
+            ++feature.count;
+            feature.sum += value;
+            feature.sumOfSquaredDeviations += (value - oldMean) * (value - feature.sum / feature.count);
+            feature.sumOfAbsoluteValues += std::abs(value);
+            if (HasQuantiles())
+            {
+                _sketches[indexValue.index].Add(value);
+            }
+        });
+    }
+
+    void FeatureStatistics::Merge(const FeatureStatistics& other)
+    {
+        if (HasQuantiles() && !other.HasQuantiles())
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "cannot merge statistics without quantiles into statistics with quantiles");
+        }
+
+        _numExamples += other._numExamples;
+        Resize(other._features.size());
+        for (size_t i = 0; i < other._features.size(); ++i)
+        {
+            const auto& otherFeature = other._features[i];
+            auto& feature = _features[i];
+            if (otherFeature.count == 0)
+            {
+                continue;
+            }
+            if (feature.count == 0)
+            {
+                feature = otherFeature;
+                continue;
+            }
+
+            // Chan et al.'s formula for merging sums of squared deviations
+            double delta = otherFeature.sum / otherFeature.count - feature.sum / feature.count;
+            double count = static_cast<double>(feature.count);
+            double otherCount = static_cast<double>(otherFeature.count);
+            feature.sumOfSquaredDeviations += otherFeature.sumOfSquaredDeviations + delta * delta * count * otherCount / (count + otherCount);
+
+            feature.count += otherFeature.count;
+            feature.sum += otherFeature.sum;
+            feature.sumOfAbsoluteValues += otherFeature.sumOfAbsoluteValues;
+            feature.min = std::min(feature.min, otherFeature.min);
+            feature.max = std::max(feature.max, otherFeature.max);
+        }
+
+        for (size_t i = 0; HasQuantiles() && i < other._sketches.size(); ++i)
+        {
+            _sketches[i].Merge(other._sketches[i]);
+        }
+    }
+
+    double FeatureStatistics::GetMean(size_t index) const
+    {
+        return _numExamples == 0 ? 0.0 : _features[index].sum / _numExamples;
+    }
+
+    double FeatureStatistics::GetVariance(size_t index) const
+    {
+        const auto& feature = _features[index];
+        if (feature.count == 0)
+        {
+            return 0.0;
+        }
+
+        // merge the non-zeros with the implicit zeros, whose sum of squared deviations is zero
+        double nonZeroMean = feature.sum / feature.count;
+        double numZeros = static_cast<double>(_numExamples - feature.count);
+        double sumOfSquaredDeviations = feature.sumOfSquaredDeviations + nonZeroMean * nonZeroMean * feature.count * numZeros / _numExamples;
+        return sumOfSquaredDeviations / _numExamples;
+    }
+
+    double FeatureStatistics::GetMeanAbsoluteValue(size_t index) const
+    {
+        return _numExamples == 0 ? 0.0 : _features[index].sumOfAbsoluteValues / _numExamples;
+    }
+
+    double FeatureStatistics::GetMin(size_t index) const
+    {
+        const auto& feature = _features[index];
+        return feature.count < _numExamples ? std::min(feature.min, 0.0) : feature.min;
+    }
+
+    double FeatureStatistics::GetMax(size_t index) const
+    {
+        const auto& feature = _features[index];
+        return feature.count < _numExamples ? std::max(feature.max, 0.0) : feature.max;
+    }
+
+    double FeatureStatistics::GetQuantile(size_t index, double q) const
+    {
+        if (!HasQuantiles())
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "the feature statistics were calculated without quantiles");
+        }
+
+        const auto& feature = _features[index];
+        if (feature.count == _numExamples)
+        {
+            return _sketches[index].GetQuantile(q);
+        }
+
+        auto sketch = _sketches[index];
+        sketch.Add(0.0, static_cast<double>(_numExamples - feature.count));
+        return sketch.GetQuantile(q);
+    }
+
+    math::RowVector<double> FeatureStatistics::GetMeans() const
+    {
+        math::RowVector<double> result(NumFeatures());
+        for (size_t i = 0; i < NumFeatures(); ++i)
+        {
+            result[i] = GetMean(i);
+        }
+        return result;
+    }
+
+    math::RowVector<double> FeatureStatistics::GetVariances() const
+    {
+        math::RowVector<double> result(NumFeatures());
+        for (size_t i = 0; i < NumFeatures(); ++i)
+        {
+            result[i] = GetVariance(i);
+        }
+        return result;
+    }
+
+    math::RowVector<double> FeatureStatistics::GetMeanAbsoluteValues() const
+    {
+        math::RowVector<double> result(NumFeatures());
+        for (size_t i = 0; i < NumFeatures(); ++i)
+        {
+            result[i] = GetMeanAbsoluteValue(i);
+        }
+        return result;
+    }
+
+    void FeatureStatistics::Print(std::ostream& os) const
+    {
+        os << "feature\tnonzeros\tmean\tvariance\tmin\t" << (HasQuantiles() ? "25%\tmedian\t75%\t" : "") << "max\n";
+        for (size_t i = 0; i < NumFeatures(); ++i)
+        {
+            os << i << '\t' << GetNonZeroCount(i) << '\t' << GetMean(i) << '\t' << GetVariance(i) << '\t' << GetMin(i) << '\t';
+            if (HasQuantiles())
+            {
+                os << GetQuantile(i, 0.25) << '\t' << GetQuantile(i, 0.5) << '\t' << GetQuantile(i, 0.75) << '\t';
+            }
+            os << GetMax(i) << '\n';
+        }
+    }
+
+    //
+    // CalculateFeatureStatistics
+    //
+
+    FeatureStatistics CalculateFeatureStatistics(const data::AnyDataset& anyDataset, const FeatureStatisticsParameters& parameters)
+    {
+        data::SharedDataset<data::AutoSupervisedExample> dataset(anyDataset);
+        auto numThreads = GetNumThreads(parameters.numThreads, dataset.NumExamples());
+
+        std::vector<FeatureStatistics> statistics(numThreads, FeatureStatistics(parameters.quantileSketchSize));
+        AddExamplesInParallel(dataset, dataset.NumExamples(), statistics);
+        return MergeAll(statistics);
+    }
+
+    FeatureStatistics CalculateFeatureStatistics(data::AutoSupervisedExampleIterator exampleIterator, const FeatureStatisticsParameters& parameters)
+    {
+        auto numThreads = GetNumThreads(parameters.numThreads, std::numeric_limits<size_t>::max());
+        auto chunkSize = numThreads * minExamplesPerThread;
+
+        // each thread keeps its own statistics across chunks, and they are merged at the end
+        std::vector<FeatureStatistics> statistics(numThreads, FeatureStatistics(parameters.quantileSketchSize));
+        std::vector<data::AutoSupervisedExample> chunk;
+        chunk.reserve(chunkSize);
+        while (exampleIterator.IsValid())
+        {
+            chunk.clear();
+            while (exampleIterator.IsValid() && chunk.size() < chunkSize)
+            {
+                chunk.push_back(exampleIterator.Get());
+                exampleIterator.Next();
+            }
+            AddExamplesInParallel(chunk, chunk.size(), statistics);
+        }
+        return MergeAll(statistics);
+    }
+}
+}
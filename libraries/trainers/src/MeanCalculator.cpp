@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "MeanCalculator.h"
+#include "FeatureStatistics.h"
 
 namespace ell
 {
@@ -14,7 +15,10 @@ namespace trainers
 {
     math::RowVector<double> CalculateMean(const data::AnyDataset& anyDataset)
     {
-        return CalculateTransformedMean<data::IterationPolicy::skipZeros>(anyDataset, [](data::IndexValue x) {return x.value; });
+        // the means do not need the per-feature quantile sketches
+        FeatureStatisticsParameters parameters;
+        parameters.quantileSketchSize = 0;
+        return CalculateFeatureStatistics(anyDataset, parameters).GetMeans();
     }
 }
 }
@@ -8,6 +8,10 @@
 
 #include "SGDTrainer.h"
 
+// stl
+#include <numeric>
+#include <utility>
+
 namespace ell
 {
 namespace trainers
@@ -15,44 +19,51 @@ namespace trainers
 
     void SGDTrainerBase::SetDataset(const data::AnyDataset& anyDataset)
     {
-        _dataset = data::Dataset<data::AutoSupervisedExample>(anyDataset);
+        _dataset = data::SharedDataset<data::AutoSupervisedExample>(anyDataset);
+        _permutation.resize(_dataset.NumExamples());
+        std::iota(_permutation.begin(), _permutation.end(), 0);
     }
 
     void SGDTrainerBase::Update()
     {
-        // permute the data
-        _dataset.RandomPermute(_random);
+        // permute the order in which the examples are visited, the shared dataset is never modified
+        auto numExamples = _permutation.size();
+        for (size_t i = 0; i < numExamples; ++i)
+        {
+            std::uniform_int_distribution<size_t> dist(i, numExamples - 1);
+            std::swap(_permutation[i], _permutation[dist(_random)]);
+        }
 
-        // get example iterator
-        auto exampleIterator = _dataset.GetExampleReferenceIterator();
+        for (auto index : _permutation)
+        {
+            Step(_dataset[index]);
+        }
+    }
 
-        // first iteration handled separately
-        if (_firstIteration && exampleIterator.IsValid())
+    void SGDTrainerBase::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        while (exampleIterator.IsValid())
         {
-            const auto& example = exampleIterator.Get();
+            Step(exampleIterator.Get());
+            exampleIterator.Next();
+        }
+    }
 
-            const auto& x = example.GetDataVector();
-            double y = example.GetMetadata().label;
-            double weight = example.GetMetadata().weight;
+    void SGDTrainerBase::Step(const data::AutoSupervisedExample& example)
+    {
+        const auto& x = example.GetDataVector();
+        double y = example.GetMetadata().label;
+        double weight = example.GetMetadata().weight;
 
+        // first iteration handled separately
+        if (_firstIteration)
+        {
             DoFirstStep(x, y, weight);
-
-            exampleIterator.Next();
             _firstIteration = false;
         }
-
-        while (exampleIterator.IsValid())
+        else
         {
-            // get the Next example
-            const auto& example = exampleIterator.Get();
-
-            const auto& x = example.GetDataVector();
-            double y = example.GetMetadata().label;
-            double weight = example.GetMetadata().weight;
-
             DoNextStep(x, y, weight);
-
-            exampleIterator.Next();
         }
     }
 
@@ -33,6 +33,18 @@ namespace trainers
     void EvaluatingTrainer<PredictorType>::Update()
     {
         _internalTrainer->Update();
+        Evaluate();
+    }
+
+    template <typename PredictorType>
+    void EvaluatingTrainer<PredictorType>::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        _internalTrainer->UpdateFromStream(std::move(exampleIterator));
+    }
+
+    template <typename PredictorType>
+    void EvaluatingTrainer<PredictorType>::Evaluate()
+    {
         _evaluator->Evaluate(_internalTrainer->GetPredictor());
     }
 
@@ -24,6 +24,7 @@ namespace trainers
     {
         // materialize a dataset of dense DataVectors with metadata that contains both strong and weak weight and lables for each example
         _dataset = data::Dataset<TrainerExampleType>(anyDataset);
+        _datasetView = data::DatasetIndexView<TrainerExampleType>(_dataset);
 
         // initalizes the special fields in the dataset metadata: weak weight and label, currentOutput
         for (size_t rowIndex = 0; rowIndex < _dataset.NumExamples(); ++rowIndex)
@@ -36,6 +37,15 @@ namespace trainers
         }
     }
 
+    template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
+    void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        // SetDataset copies the examples, so the loaded dataset does not need to outlive this call
+        auto dataset = data::MakeDataset(std::move(exampleIterator));
+        SetDataset(dataset.GetAnyDataset());
+        Update();
+    }
+
     template <typename SplitRuleType, typename EdgePredictorType, typename BoosterType>
     void ForestTrainer<SplitRuleType, EdgePredictorType, BoosterType>::Update()
     {
@@ -116,7 +126,7 @@ namespace trainers
     {
         for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size; ++rowIndex)
         {
-            auto& example = _dataset[rowIndex];
+            auto& example = _datasetView[rowIndex];
             example.GetMetadata().currentOutput += edgePredictor.Predict(example.GetDataVector());
         }
     }
@@ -181,13 +191,13 @@ namespace trainers
     {
         if (splitRule.NumOutputs() == 2)
         {
-            _dataset.Partition([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()) == 0; },
+            _datasetView.Partition([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()) == 0; },
                                range.firstIndex,
                                range.size);
         }
         else
         {
-            _dataset.Sort([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()); },
+            _datasetView.Sort([splitRule](const data::Example<DataVectorType, TrainerMetadata>& example) { return splitRule.Predict(example.GetDataVector()); },
                           range.firstIndex,
                           range.size);
         }
@@ -75,9 +75,9 @@ namespace trainers
     auto HistogramForestTrainer<LossFunctionType, BoosterType, ThresholdFinderType>::CallThresholdFinder(Range range) -> std::vector<SplitRuleType>
     {
         // uniformly choose _candidatesPerInput from the range, without replacement
-        _dataset.RandomPermute(_random, range.firstIndex, range.size, _thresholdFinderSampleSize);
+        _datasetView.RandomPermute(_random, range.firstIndex, range.size, _thresholdFinderSampleSize);
 
-        auto thresholds = _thresholdFinder.GetThresholds(_dataset.GetExampleReferenceIterator(range.firstIndex, _thresholdFinderSampleSize));
+        auto thresholds = _thresholdFinder.GetThresholds(_datasetView.GetExampleReferenceIterator(range.firstIndex, _thresholdFinderSampleSize));
         return thresholds;
     }
 
@@ -87,7 +87,7 @@ namespace trainers
         Sums sums0;
         size_t size0 = 0;
 
-        auto exampleIterator = _dataset.GetExampleIterator(range.firstIndex, range.size);
+        auto exampleIterator = _datasetView.GetExampleReferenceIterator(range.firstIndex, range.size);
         while (exampleIterator.IsValid())
         {
             const auto& example = exampleIterator.Get();
@@ -17,7 +17,7 @@ namespace trainers
     math::RowVector<double> CalculateTransformedMean(const data::AnyDataset& anyDataset, TransformationType transformation)
     {
         // get example iterator
-        auto exampleIterator = anyDataset.GetExampleIterator<data::AutoSupervisedExample>();
+        auto exampleIterator = anyDataset.GetExampleConstIterator<data::AutoSupervisedExample>();
 
         math::RowVector<double> result;
         size_t count = 0;
@@ -9,8 +9,13 @@
 #include "DataVectorOperations.h"
 
 // utilities
+#include "Exception.h"
 #include "RandomEngines.h"
 
+// stl
+#include <numeric>
+#include <utility>
+
 namespace ell
 {
 namespace trainers
@@ -27,36 +32,60 @@ namespace trainers
     {
         DEBUG_THROW(_v.Norm0() != 0, utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "can only call SetDataset before updates"));
 
-        _dataset = data::Dataset<TrainerExampleType>(anyDataset);
+        _dataset = data::SharedDataset<ExampleType>(anyDataset);
         auto numExamples = _dataset.NumExamples();
         _inverseScaledRegularization = 1.0 / (numExamples * _parameters.regularization);
 
+        _permutation.resize(numExamples);
+        std::iota(_permutation.begin(), _permutation.end(), 0);
+        _norm2Squared.resize(numExamples);
+        _dualVariables.assign(numExamples, 0.0);
+
         _predictorInfo.primalObjective = 0;
         _predictorInfo.dualObjective = 0;
 
         // precompute the norm of each example
         for (size_t rowIndex = 0; rowIndex < numExamples; ++rowIndex)
         {
-            auto& example = _dataset[rowIndex];
-            example.GetMetadata().norm2Squared = example.GetDataVector().Norm2Squared();
+            const auto& example = _dataset[rowIndex];
+            _norm2Squared[rowIndex] = example.GetDataVector().Norm2Squared();
 
-            auto label = example.GetMetadata().weightLabel.label;
+            auto label = example.GetMetadata().label;
             _predictorInfo.primalObjective += _lossFunction(0, label) / numExamples;
         }
     }
 
+    template<typename LossFunctionType, typename RegularizerType>
+    void SDCATrainer<LossFunctionType, RegularizerType>::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        if (_dataset.NumExamples() != 0)
+        {
+            throw utilities::LogicException(utilities::LogicExceptionErrors::illegalState, "SDCA can only load a stream before updates, call Update to perform additional epochs");
+        }
+
+        // the trainer owns the loaded examples, so the shared dataset can refer to them without a copy
+        _streamedDataset = data::Dataset<ExampleType>(std::move(exampleIterator));
+        SetDataset(_streamedDataset.GetAnyDataset());
+        Update();
+    }
+
     template<typename LossFunctionType, typename RegularizerType>
     void SDCATrainer<LossFunctionType, RegularizerType>::Update() 
     {
+        auto numExamples = _permutation.size();
         if (_parameters.permute)
         {
-            _dataset.RandomPermute(_random);
+            for (size_t i = 0; i < numExamples; ++i)
+            {
+                std::uniform_int_distribution<size_t> dist(i, numExamples - 1);
+                std::swap(_permutation[i], _permutation[dist(_random)]);
+            }
         }
 
         // Iterate
-        for (size_t i = 0; i < _dataset.NumExamples(); ++i)
+        for (size_t i = 0; i < numExamples; ++i)
         {
-            Step(_dataset[i]);
+            Step(_permutation[i]);
         }
 
         // Finish
@@ -64,19 +93,16 @@ namespace trainers
     }
 
     template<typename LossFunctionType, typename RegularizerType>
-    SDCATrainer<LossFunctionType, RegularizerType>::TrainerMetadata::TrainerMetadata(const data::WeightLabel& original) : weightLabel(original)
-    {}
-
-    template<typename LossFunctionType, typename RegularizerType>
-    void SDCATrainer<LossFunctionType, RegularizerType>::Step(TrainerExampleType& example)
+    void SDCATrainer<LossFunctionType, RegularizerType>::Step(size_t index)
     {
+        const auto& example = _dataset[index];
         const auto& dataVector = example.GetDataVector();
         ResizeTo(dataVector);
 
-        auto weightLabel = example.GetMetadata().weightLabel;
-        auto norm2Squared = example.GetMetadata().norm2Squared + 1; // add one because of bias term
+        auto weightLabel = example.GetMetadata();
+        auto norm2Squared = _norm2Squared[index] + 1; // add one because of bias term
         auto lipschitz = norm2Squared * _inverseScaledRegularization;
-        auto dual = example.GetMetadata().dualVariable; 
+        auto dual = _dualVariables[index]; 
 
         if (lipschitz > 0)
         {
@@ -90,7 +116,7 @@ namespace trainers
                 _v.Transpose() += (-dualDiff * _inverseScaledRegularization) * dataVector;
                 _d += (-dualDiff * _inverseScaledRegularization);
                 _regularizer.ConjugateGradient(_v, _d, _predictor.GetWeights(), _predictor.GetBias());
-                example.GetMetadata().dualVariable = newDual;
+                _dualVariables[index] = newDual;
             }
         }
     }
@@ -105,10 +131,10 @@ namespace trainers
 
         for (size_t i = 0; i < _dataset.NumExamples(); ++i)
         {
-            const auto& example = _dataset.GetExample(i);
-            auto label = example.GetMetadata().weightLabel.label;
+            const auto& example = _dataset[i];
+            auto label = example.GetMetadata().label;
             auto prediction = _predictor.Predict(example.GetDataVector());
-            auto dualVariable = example.GetMetadata().dualVariable;
+            auto dualVariable = _dualVariables[i];
 
             _predictorInfo.primalObjective += invSize * _lossFunction(prediction, label);
             _predictorInfo.dualObjective -= invSize * _lossFunction.Conjugate(dualVariable, label);
@@ -68,10 +68,8 @@ namespace trainers
         double& averagedB = _averagedPredictor.GetBias();
 
         // update the average predictor
-        averagedW *= scaleCoefficient;
+        averagedW.CopyFrom(scaleCoefficient * averagedW + 1.0 / _t * lastW);
         averagedB *= scaleCoefficient;
-
-        averagedW += 1.0 / _t * lastW;
         averagedB += lastB / _t;
     }
 
@@ -145,8 +143,7 @@ namespace trainers
     {
         const double lambda = _parameters.regularization;
         _averagedPredictor.Resize(_v.Size());
-        _averagedPredictor.GetWeights().CopyFrom(-_h / (lambda * _t) * _v);
-        _averagedPredictor.GetWeights() += 1 / (lambda * _t) * _u;
+        _averagedPredictor.GetWeights().CopyFrom(-_h / (lambda * _t) * _v + 1 / (lambda * _t) * _u);
         _averagedPredictor.GetBias() = -_c / (lambda * _t);
         return _averagedPredictor;
     }
@@ -237,9 +234,7 @@ namespace trainers
         const double lambda = _parameters.regularization;
         const double coeff = 1.0 / (lambda * _t);
         _averagedPredictor.Resize(_v.Size());
-        _averagedPredictor.GetWeights().CopyFrom(-_h * coeff * _v);
-        _averagedPredictor.GetWeights() += coeff * _u;
-        _averagedPredictor.GetWeights() += _c * coeff * _center.Transpose();
+        _averagedPredictor.GetWeights().CopyFrom(-_h * coeff * _v + coeff * _u + _c * coeff * _center.Transpose());
 
         _averagedPredictor.GetBias() = -_s * coeff;
         return _averagedPredictor;
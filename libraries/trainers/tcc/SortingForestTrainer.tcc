@@ -19,7 +19,7 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType>
     auto SortingForestTrainer<LossFunctionType, BoosterType>::GetBestSplitRuleAtNode(SplittableNodeId nodeId, Range range, Sums sums) -> SplitCandidate
     {
-        auto numFeatures = _dataset.NumFeatures();
+        auto numFeatures = _datasetView.NumFeatures();
 
         SplitCandidate bestSplitCandidate(nodeId, range, sums);
 
@@ -31,15 +31,15 @@ namespace trainers
             Sums sums0;
 
             // consider all thresholds
-            double nextFeatureValue = _dataset[range.firstIndex].GetDataVector()[inputIndex];
+            double nextFeatureValue = _datasetView[range.firstIndex].GetDataVector()[inputIndex];
             for (size_t rowIndex = range.firstIndex; rowIndex < range.firstIndex + range.size - 1; ++rowIndex)
             {
                 // get friendly names
                 double currentFeatureValue = nextFeatureValue;
-                nextFeatureValue = _dataset[rowIndex + 1].GetDataVector()[inputIndex];
+                nextFeatureValue = _datasetView[rowIndex + 1].GetDataVector()[inputIndex];
 
                 // increment sums
-                sums0.Increment(_dataset[rowIndex].GetMetadata().weak);
+                sums0.Increment(_datasetView[rowIndex].GetMetadata().weak);
 
                 // only split between rows with different feature values
                 if (currentFeatureValue == nextFeatureValue)
@@ -76,7 +76,7 @@ namespace trainers
     template <typename LossFunctionType, typename BoosterType>
     void SortingForestTrainer<LossFunctionType, BoosterType>::SortNodeDataset(Range range, size_t inputIndex)
     {
-        _dataset.Sort([inputIndex](const data::Example<DataVectorType, TrainerMetadata>& example) { return example.GetDataVector()[inputIndex]; },
+        _datasetView.Sort([inputIndex](const data::Example<DataVectorType, TrainerMetadata>& example) { return example.GetDataVector()[inputIndex]; },
                       range.firstIndex,
                       range.size);
     }
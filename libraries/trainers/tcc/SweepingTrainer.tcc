@@ -11,16 +11,22 @@ namespace ell
 namespace trainers
 {
     template <typename PredictorType>
-    SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers)
-        : _evaluatingTrainers(std::move(evaluatingTrainers))
+    SweepingTrainer<PredictorType>::SweepingTrainer(std::vector<EvaluatingTrainerType>&& evaluatingTrainers, size_t streamChunkSize)
+        : _evaluatingTrainers(std::move(evaluatingTrainers)), _streamChunkSize(streamChunkSize)
     {
         assert(_evaluatingTrainers.size() > 0);
+        assert(_streamChunkSize > 0);
     }
 
     template <typename PredictorType>
     void SweepingTrainer<PredictorType>::SetDataset(const data::AnyDataset& anyDataset)
     {
-        _dataset = data::Dataset<ExampleType>(anyDataset);
+        // examples are converted at most once, and the internal trainers refer to the converted examples
+        _dataset = data::SharedDataset<ExampleType>(anyDataset);
+        for (auto& evaluatingTrainer : _evaluatingTrainers)
+        {
+            evaluatingTrainer.SetDataset(_dataset.GetAnyDataset());
+        }
     }
 
     template <typename PredictorType>
@@ -32,6 +38,31 @@ namespace trainers
         }
     }
 
+    template <typename PredictorType>
+    void SweepingTrainer<PredictorType>::UpdateFromStream(data::AutoSupervisedExampleIterator exampleIterator)
+    {
+        data::AutoSupervisedDataset chunk;
+        while (exampleIterator.IsValid())
+        {
+            chunk.Reset();
+            while (chunk.NumExamples() < _streamChunkSize && exampleIterator.IsValid())
+            {
+                chunk.AddExample(exampleIterator.Get());
+                exampleIterator.Next();
+            }
+
+            for (auto& evaluatingTrainer : _evaluatingTrainers)
+            {
+                evaluatingTrainer.UpdateFromStream(chunk.GetExampleIterator());
+            }
+        }
+
+        for (auto& evaluatingTrainer : _evaluatingTrainers)
+        {
+            evaluatingTrainer.Evaluate();
+        }
+    }
+
     template <typename PredictorType>
     const PredictorType& SweepingTrainer<PredictorType>::GetPredictor() const
     {
@@ -51,9 +82,9 @@ namespace trainers
     }
 
     template <typename PredictorType>
-    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers)
+    std::unique_ptr<ITrainer<PredictorType>> MakeSweepingTrainer(std::vector<EvaluatingTrainer<PredictorType>>&& evaluatingTrainers, size_t streamChunkSize)
     {
-        return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers));
+        return std::make_unique<SweepingTrainer<PredictorType>>(std::move(evaluatingTrainers), streamChunkSize);
     }
 }
 }
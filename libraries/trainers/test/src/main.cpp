@@ -7,18 +7,27 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // common
+#include "MakeEvaluator.h"
 #include "MakeTrainer.h"
 
 // data
 #include "Dataset.h"
 
 // trainers
-#include "SDCATrainer.h"
+#include "EvaluatingTrainer.h"
+#include "FeatureStatistics.h"
 #include "MeanCalculator.h"
+#include "SDCATrainer.h"
+#include "SweepingTrainer.h"
 
 // utilities
 #include "testing.h"
 
+// stl
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 using namespace ell;
 
 /// Runs all tests
@@ -46,6 +55,40 @@ void TestSDCATrainer()
     return;
 }
 
+void TestStreamingSGDTrainer()
+{
+    data::AutoSupervisedDataset dataset;
+    dataset.AddExample({ { 1.0, 0.0, 2.0, 0.0, 3.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 4.0, 5.0, 6.0, 7.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 8.0, 0.0, 9.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 10.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 3.0, 1.0, 0.0, 2.0 },{ 1.0, 1.0 } });
+    dataset.AddExample({ { 0.0, 0.0, 1.0, 0.0, 5.0 },{ 1.0, -1.0 } });
+    dataset.AddExample({ { 2.0, 2.0 },{ 1.0, 1.0 } });
+
+    common::LossFunctionArguments lossFunctionArguments{ common::LossFunctionArguments::LossFunction::log };
+    auto trainer = common::MakeSGDTrainer(lossFunctionArguments, { 1.0e-2, "XYZ" });
+    trainer->UpdateFromStream(dataset.GetExampleIterator());
+    trainer->UpdateFromStream(dataset.GetExampleIterator());
+
+    // a sweeping trainer reads the stream in chunks and passes each chunk to its internal trainers, which gives the same result
+    std::vector<trainers::EvaluatingTrainer<predictors::LinearPredictor>> evaluatingTrainers;
+    auto evaluator = common::MakeEvaluator<predictors::LinearPredictor>(dataset.GetAnyDataset(), { 1, false }, lossFunctionArguments);
+    evaluatingTrainers.push_back(trainers::MakeEvaluatingTrainer(common::MakeSGDTrainer(lossFunctionArguments, { 1.0e-2, "XYZ" }), evaluator));
+    auto sweepingTrainer = trainers::MakeSweepingTrainer(std::move(evaluatingTrainers), 3);
+    sweepingTrainer->UpdateFromStream(dataset.GetExampleIterator());
+    sweepingTrainer->UpdateFromStream(dataset.GetExampleIterator());
+
+    const auto& predictor = trainer->GetPredictor();
+    const auto& sweepingPredictor = sweepingTrainer->GetPredictor();
+    bool isEqual = predictor.Size() == 5 && sweepingPredictor.Size() == 5 && predictor.GetBias() == sweepingPredictor.GetBias();
+    for (size_t i = 0; i < predictor.Size(); ++i)
+    {
+        isEqual &= predictor.GetWeights()[i] == sweepingPredictor.GetWeights()[i];
+    }
+    testing::ProcessTest("TestStreamingSGDTrainer", isEqual && evaluator->GetGoodness() != 0);
+}
+
 void TestMeanCalculator()
 {
     data::AutoSupervisedDataset dataset;
@@ -60,8 +103,91 @@ void TestMeanCalculator()
     testing::ProcessTest("TestMeanCalculator", mean == r);
 }
 
+void TestFeatureStatistics()
+{
+    // feature 0 is dense and uniform in [0,1), feature 1 is non-zero in a tenth of the examples, feature 2 is never set
+    const size_t numExamples = 5000;
+    std::default_random_engine rng(1234);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    data::AutoSupervisedDataset dataset;
+    std::vector<double> values0;
+    std::vector<double> values1;
+    for (size_t i = 0; i < numExamples; ++i)
+    {
+        double x0 = uniform(rng);
+        double x1 = (i % 10 == 0) ? -3.0 * uniform(rng) : 0.0;
+        values0.push_back(x0);
+        values1.push_back(x1);
+        std::vector<data::IndexValue> indexValues{ { 0, x0 } };
+        if (x1 != 0.0)
+        {
+            indexValues.push_back({ 1, x1 });
+        }
+        dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector(indexValues), { 1.0, 1.0 }));
+    }
+    dataset.AddExample(data::AutoSupervisedExample(data::AutoDataVector(std::vector<data::IndexValue>{ { 0, 0.5 }, { 2, 0.0 }, { 3, 1.0 } }), { 1.0, 1.0 }));
+    values0.push_back(0.5);
+    values1.push_back(0.0);
+
+    // AutoDataVector may store each value with an error of up to 1e-9
+    auto mean = [](const std::vector<double>& v) { double sum = 0; for (auto x : v) sum += x; return sum / v.size(); };
+    auto variance = [&mean](const std::vector<double>& v) { double m = mean(v); double sum = 0; for (auto x : v) sum += (x - m) * (x - m); return sum / v.size(); };
+    auto median = [](std::vector<double> v) { std::sort(v.begin(), v.end()); return v[v.size() / 2]; };
+
+    trainers::FeatureStatisticsParameters singleThreadParameters;
+    singleThreadParameters.numThreads = 1;
+    trainers::FeatureStatisticsParameters multiThreadParameters;
+    multiThreadParameters.numThreads = 4;
+    auto statistics = trainers::CalculateFeatureStatistics(dataset.GetAnyDataset(), singleThreadParameters);
+    auto parallelStatistics = trainers::CalculateFeatureStatistics(dataset.GetAnyDataset(), multiThreadParameters);
+    auto streamingStatistics = trainers::CalculateFeatureStatistics(dataset.GetExampleIterator(), multiThreadParameters);
+
+    bool isCorrect = true;
+    for (const auto* pStatistics : { &statistics, &parallelStatistics, &streamingStatistics })
+    {
+        const auto& s = *pStatistics;
+        isCorrect &= s.NumExamples() == numExamples + 1 && s.NumFeatures() == 4;
+        isCorrect &= s.GetNonZeroCount(0) == numExamples + 1 && s.GetNonZeroCount(1) == numExamples / 10 && s.GetNonZeroCount(2) == 0 && s.GetNonZeroCount(3) == 1;
+        isCorrect &= testing::IsEqual(s.GetMean(0), mean(values0), 1.0e-8) && testing::IsEqual(s.GetMean(1), mean(values1), 1.0e-8);
+        isCorrect &= testing::IsEqual(s.GetVariance(0), variance(values0), 1.0e-8) && testing::IsEqual(s.GetVariance(1), variance(values1), 1.0e-8);
+        isCorrect &= testing::IsEqual(s.GetMin(0), *std::min_element(values0.begin(), values0.end()), 1.0e-8) && testing::IsEqual(s.GetMax(0), *std::max_element(values0.begin(), values0.end()), 1.0e-8);
+        isCorrect &= testing::IsEqual(s.GetMin(1), *std::min_element(values1.begin(), values1.end()), 1.0e-8) && s.GetMax(1) == 0.0;
+        isCorrect &= s.GetMean(2) == 0.0 && s.GetVariance(2) == 0.0 && s.GetMin(2) == 0.0 && s.GetMax(2) == 0.0;
+        isCorrect &= std::abs(s.GetQuantile(0, 0.5) - median(values0)) < 0.02 && std::abs(s.GetQuantile(1, 0.5)) < 0.02;
+        isCorrect &= std::abs(s.GetQuantile(0, 0.9) - 0.9) < 0.03 && std::abs(s.GetQuantile(1, 0.02) + 2.4) < 0.15;
+    }
+    testing::ProcessTest("TestFeatureStatistics", isCorrect);
+
+    // without quantile sketches, the other statistics are unchanged
+    trainers::FeatureStatisticsParameters noQuantileParameters;
+    noQuantileParameters.numThreads = 4;
+    noQuantileParameters.quantileSketchSize = 0;
+    auto noQuantileStatistics = trainers::CalculateFeatureStatistics(dataset.GetAnyDataset(), noQuantileParameters);
+    bool threwException = false;
+    try
+    {
+        noQuantileStatistics.GetQuantile(0, 0.5);
+    }
+    catch (const utilities::LogicException&)
+    {
+        threwException = true;
+    }
+    bool isSame = !noQuantileStatistics.HasQuantiles() && threwException && noQuantileStatistics.NumFeatures() == statistics.NumFeatures();
+    for (size_t i = 0; i < statistics.NumFeatures(); ++i)
+    {
+        isSame &= noQuantileStatistics.GetNonZeroCount(i) == statistics.GetNonZeroCount(i) && testing::IsEqual(noQuantileStatistics.GetMean(i), statistics.GetMean(i), 1.0e-12);
+        isSame &= testing::IsEqual(noQuantileStatistics.GetVariance(i), statistics.GetVariance(i), 1.0e-12) && noQuantileStatistics.GetMin(i) == statistics.GetMin(i) && noQuantileStatistics.GetMax(i) == statistics.GetMax(i);
+    }
+    testing::ProcessTest("TestFeatureStatistics: no quantiles", isSame);
+
+    auto means = trainers::CalculateMean(dataset.GetAnyDataset());
+    testing::ProcessTest("TestFeatureStatistics: CalculateMean", means == statistics.GetMeans());
+}
+
 int main()
 {
     TestSDCATrainer();
+    TestStreamingSGDTrainer();
     TestMeanCalculator();
+    TestFeatureStatistics();
 }
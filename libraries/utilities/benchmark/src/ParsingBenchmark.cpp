@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ParsingBenchmark.cpp (utilities_parsing_benchmark)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// utilities
+#include "CStringParser.h"
+#include "MillisecondTimer.h"
+
+// stl
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ell;
+
+// Measures the throughput of utilities::Parse on text that resembles a sparse dataset file, with the
+// C library functions as a baseline. The optional command line argument is the number of numbers.
+
+namespace
+{
+// creates a buffer of whitespace separated numbers, formatted with printf
+template <typename GeneratorType>
+std::string GenerateText(size_t count, const char* format, GeneratorType generator)
+{
+    std::string text;
+    char buffer[64];
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::snprintf(buffer, sizeof(buffer), format, generator());
+        text += buffer;
+        text += ' ';
+    }
+    return text;
+}
+
+template <typename ValueType>
+double SumWithParse(const std::string& text)
+{
+    double sum = 0;
+    const char* pStr = text.c_str();
+    while (true)
+    {
+        utilities::TrimLeadingWhitespace(pStr);
+        ValueType value;
+        if (utilities::Parse(pStr, value) != utilities::ParseResult::success)
+        {
+            break;
+        }
+        sum += value;
+    }
+    return sum;
+}
+
+template <typename FunctionType>
+double SumWithCLibrary(const std::string& text, FunctionType function)
+{
+    double sum = 0;
+    const char* pStr = text.c_str();
+    while (true)
+    {
+        char* pEnd;
+        auto value = function(pStr, &pEnd);
+        if (pEnd == pStr)
+        {
+            break;
+        }
+        sum += value;
+        pStr = pEnd;
+    }
+    return sum;
+}
+
+template <typename FunctionType>
+void Report(const std::string& name, const std::string& text, size_t count, FunctionType function)
+{
+    utilities::MillisecondTimer timer;
+    auto checksum = function(text);
+    auto milliseconds = timer.Elapsed();
+    auto megabytesPerSecond = milliseconds > 0 ? (text.size() / 1000.0) / milliseconds : 0;
+    auto nanosecondsPerNumber = 1000000.0 * milliseconds / count;
+    std::cout << name << "\t" << milliseconds << " ms\t" << megabytesPerSecond << " MB/s\t" << nanosecondsPerNumber << " ns/number\t(checksum " << checksum << ")" << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    size_t count = 2000000;
+    if (argc > 1)
+    {
+        count = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    std::default_random_engine engine(1234);
+    std::uniform_int_distribution<uint64_t> indexDistribution(0, 100000);
+    std::normal_distribution<double> valueDistribution(0.0, 10.0);
+
+    auto indexText = GenerateText(count, "%llu", [&]() { return static_cast<unsigned long long>(indexDistribution(engine)); });
+    auto shortValueText = GenerateText(count, "%.6g", [&]() { return valueDistribution(engine); });
+    auto longValueText = GenerateText(count, "%.17g", [&]() { return valueDistribution(engine); });
+
+    std::cout << "integers (" << count << ")" << std::endl;
+    Report("  Parse<size_t>", indexText, count, SumWithParse<size_t>);
+    Report("  strtoul", indexText, count, [](const std::string& text) { return SumWithCLibrary(text, [](const char* pStr, char** pEnd) { return std::strtoul(pStr, pEnd, 0); }); });
+
+    std::cout << "values with 6 significant digits (" << count << ")" << std::endl;
+    Report("  Parse<double>", shortValueText, count, SumWithParse<double>);
+    Report("  strtod", shortValueText, count, [](const std::string& text) { return SumWithCLibrary(text, [](const char* pStr, char** pEnd) { return std::strtod(pStr, pEnd); }); });
+    Report("  Parse<float>", shortValueText, count, SumWithParse<float>);
+    Report("  strtof", shortValueText, count, [](const std::string& text) { return SumWithCLibrary(text, [](const char* pStr, char** pEnd) { return std::strtof(pStr, pEnd); }); });
+
+    std::cout << "values with 17 significant digits (" << count << ")" << std::endl;
+    Report("  Parse<double>", longValueText, count, SumWithParse<double>);
+    Report("  strtod", longValueText, count, [](const std::string& text) { return SumWithCLibrary(text, [](const char* pStr, char** pEnd) { return std::strtod(pStr, pEnd); }); });
+
+    return 0;
+}
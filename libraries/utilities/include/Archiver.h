@@ -296,6 +296,14 @@ namespace utilities
         /// <param name="name"> The name of the property </param>
         PropertyUnarchiver operator[](const std::string& name);
 
+        /// <summary> Indicates if the next property to read has the given name, without reading it. This lets
+        /// objects read properties that were added after some archives were written. </summary>
+        ///
+        /// <param name="name"> The name of the property </param>
+        ///
+        /// <returns> true if the next property has the given name. </returns>
+        virtual bool HasNextPropertyName(const std::string& name) = 0;
+
         /// <summary> Set a new serialization context to be current </summary>
         ///
         /// <param name="context"> The context </param>
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryMappedFile.h (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <cstddef>
+#include <string>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A read-only view of an entire file, mapped into the address space of the process.
+    /// Several processes that map the same file share the same physical pages. </summary>
+    class MemoryMappedFile
+    {
+    public:
+        /// <summary> Maps a file into memory, and throws an exception if a problem occurs. </summary>
+        ///
+        /// <param name="filepath"> The path. </param>
+        MemoryMappedFile(const std::string& filepath);
+
+        MemoryMappedFile(MemoryMappedFile&& other);
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+        ~MemoryMappedFile();
+
+        MemoryMappedFile& operator=(MemoryMappedFile&& other);
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        /// <summary> Gets a pointer to the first byte of the mapped file. </summary>
+        ///
+        /// <returns> Pointer to the data, or nullptr if the file is empty. </returns>
+        const char* GetData() const { return _data; }
+
+        /// <summary> Gets the size of the mapped file in bytes. </summary>
+        ///
+        /// <returns> The size of the file. </returns>
+        size_t Size() const { return _size; }
+
+    private:
+        void Unmap();
+
+        const char* _data = nullptr;
+        size_t _size = 0;
+#if defined(_WIN32)
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+    };
+}
+}
@@ -47,6 +47,14 @@ namespace utilities
         /// <returns> The `ObjectArchive` containing the information  for the archived object </returns>
         const ObjectArchive& GetObjectArchive() { return _objectDescription; }
 
+        /// <summary> Indicates if the object has a property with the given name. The properties of an
+        /// `ObjectArchive` are not ordered, so any property of the object counts as the next one. </summary>
+        ///
+        /// <param name="name"> The name of the property </param>
+        ///
+        /// <returns> true if the object has the property. </returns>
+        virtual bool HasNextPropertyName(const std::string& name) override { return _objectDescription.HasProperty(name); }
+
     protected:
         // Serialization
         DECLARE_ARCHIVE_VALUE_OVERRIDE(bool);
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool.h (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// stl
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ell
+{
+namespace utilities
+{
+    /// <summary> A fixed set of worker threads that run data-parallel loops. The thread that calls
+    /// ParallelFor takes part in the loop, so a pool of n threads starts n - 1 workers. Several threads
+    /// can call ParallelFor at the same time, and ParallelFor can be called from inside a task. </summary>
+    class ThreadPool
+    {
+    public:
+        /// <summary> Constructs a thread pool. </summary>
+        ///
+        /// <param name="numThreads"> The number of threads that run each loop, including the calling thread.
+        /// Zero means one thread per hardware thread. </param>
+        ThreadPool(size_t numThreads = 0);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// <summary> Gets the number of threads that run each loop, including the calling thread. </summary>
+        ///
+        /// <returns> The number of threads. </returns>
+        size_t NumThreads() const { return _workers.size() + 1; }
+
+        /// <summary> Calls a function once for each task index in [0, numTasks), on the worker threads and
+        /// the calling thread, and returns when all the calls have returned. If a call throws, the remaining
+        /// tasks still run and the first exception is rethrown on the calling thread. </summary>
+        ///
+        /// <param name="numTasks"> The number of tasks. </param>
+        /// <param name="task"> The function, which takes a task index. </param>
+        void ParallelFor(size_t numTasks, const std::function<void(size_t)>& task);
+
+    private:
+        struct Job;
+
+        void WorkerLoop();
+        static void RunTasks(Job& job);
+
+        std::vector<std::thread> _workers;
+        std::deque<std::shared_ptr<Job>> _jobs;
+        std::mutex _mutex;
+        std::condition_variable _jobAvailable;
+        bool _stopping = false;
+    };
+}
+}
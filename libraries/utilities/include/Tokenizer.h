@@ -60,6 +60,13 @@ namespace utilities
         /// <returns> The next token, or the empty string if the end of file is reached. </returns>
         std::string PeekNextToken();
 
+        /// <summary> Gets the next tokens from the input stream without consuming them. </summary>
+        ///
+        /// <param name="numTokens"> The number of tokens to get. </param>
+        ///
+        /// <returns> The next tokens, which end with empty strings if the end of file is reached. </returns>
+        std::vector<std::string> PeekNextTokens(size_t numTokens);
+
         /// <summary> Consumes entire stream, printing tokens as they're read. For debugging. </summary>
         void PrintTokens();
 
@@ -111,6 +111,13 @@ namespace utilities
         /// <param name="inputStream"> The stream to read data from. </summary>
         XmlUnarchiver(std::istream& inputStream, SerializationContext context);
 
+        /// <summary> Indicates if the next property to read has the given name, without reading it. </summary>
+        ///
+        /// <param name="name"> The name of the property </param>
+        ///
+        /// <returns> true if the next property has the given name. </returns>
+        virtual bool HasNextPropertyName(const std::string& name) override;
+
     protected:
         DECLARE_UNARCHIVE_VALUE_OVERRIDE(bool);
         DECLARE_UNARCHIVE_VALUE_OVERRIDE(char);
@@ -2,7 +2,7 @@
 //
 //  Project:  Embedded Learning Library (ELL)
 //  File:     CStringParser.cpp (utilities)
-//  Authors:  Ofer Dekel
+//  Authors:  Ofer Dekel, agent
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -10,13 +10,333 @@
 
 // stl
 #include <cctype>
+#include <cfloat>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 
 namespace ell
 {
 namespace utilities
 {
+    namespace
+    {
+        // the fast floating point paths rely on every arithmetic operation being rounded to the precision of its type
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+        const bool useFastFloatingPointPath = true;
+#else
+        const bool useFastFloatingPointPath = false;
+#endif
+
+        // powers of ten that are exactly representable as doubles and as floats
+        const double exactDoublePowersOfTen[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        const float exactFloatPowersOfTen[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+        const int maxExactDoublePowerOfTen = 22;
+        const int maxExactFloatPowerOfTen = 10;
+        const uint64_t maxExactDoubleSignificand = uint64_t(1) << 53;
+        const uint64_t maxExactFloatSignificand = uint64_t(1) << 24;
+
+        // a significand with more digits than these is at least 10^16 > 2^53, or 10^8 > 2^24, so it can't be exact
+        const size_t maxExactDoubleDigits = 16;
+        const size_t maxExactFloatDigits = 8;
+        const size_t maxIntegerDigits = 18;
+        const size_t maxExponentDigits = 4;
+
+        // unlike std::isdigit, this does not depend on the locale
+        inline bool IsDecimalDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+        inline bool IsLittleEndian()
+        {
+            const uint16_t one = 1;
+            unsigned char firstByte;
+            std::memcpy(&firstByte, &one, 1);
+            return firstByte == 1;
+        }
+
+        // Converts eight decimal digits, packed into a little-endian 64-bit word, with a handful of
+        // multiplications. Each step combines adjacent pairs of lanes: 8 x 1-digit lanes become 4 x
+        // 2-digit lanes, then 2 x 4-digit lanes, then a single 8-digit value.
+        inline uint64_t ConvertEightDigits(uint64_t word)
+        {
+            word = ((word & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+            word = ((word & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+            return ((word & 0x0000FFFF0000FFFF) * 42949672960001) >> 32;
+        }
+
+        // Accumulates a run of decimal digits into a value. The caller guarantees that all of the
+        // characters in the run are digits, so the eight-byte loads never read past the run.
+        uint64_t AccumulateDigits(const char* pDigits, size_t numDigits, uint64_t value)
+        {
+            if (IsLittleEndian())
+            {
+                while (numDigits >= 8)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, pDigits, sizeof(word));
+                    value = value * 100000000 + ConvertEightDigits(word);
+                    pDigits += 8;
+                    numDigits -= 8;
+                }
+            }
+
+            for (; numDigits > 0; --numDigits, ++pDigits)
+            {
+                value = value * 10 + static_cast<uint64_t>(*pDigits - '0');
+            }
+            return value;
+        }
+
+        const char* SkipDigits(const char* pStr)
+        {
+            while (IsDecimalDigit(*pStr))
+            {
+                ++pStr;
+            }
+            return pStr;
+        }
+
+        // skips at most maxDigits + 1 digits, which tells the caller whether there are more than maxDigits, without
+        // scanning all of them
+        const char* SkipDigits(const char* pStr, size_t maxDigits)
+        {
+            for (size_t numDigits = 0; numDigits <= maxDigits && IsDecimalDigit(*pStr); ++numDigits)
+            {
+                ++pStr;
+            }
+            return pStr;
+        }
+
+        // hexadecimal and octal numbers are left to the C library
+        bool HasBasePrefix(const char* pStr)
+        {
+            return pStr[0] == '0' && (IsDecimalDigit(pStr[1]) || pStr[1] == 'x' || pStr[1] == 'X');
+        }
+
+        // Scans the decimal significand and exponent of a floating point number, without converting
+        // to floating point. Returns false as soon as the number has more than maxDigits significant
+        // digits or too large an exponent, or if it is not a plain decimal number.
+        bool ScanDecimal(const char* pStr, size_t maxDigits, const char*& pEnd, bool& isNegative, uint64_t& significand, int& exponent)
+        {
+            isNegative = false;
+            if (*pStr == '+' || *pStr == '-')
+            {
+                isNegative = *pStr == '-';
+                ++pStr;
+            }
+
+            if (pStr[0] == '0' && (pStr[1] == 'x' || pStr[1] == 'X'))
+            {
+                return false;
+            }
+
+            // leading zeros are not significant
+            bool hasDigits = false;
+            while (*pStr == '0')
+            {
+                ++pStr;
+                hasDigits = true;
+            }
+
+            // integer part
+            const char* pDigits = pStr;
+            pStr = SkipDigits(pStr, maxDigits);
+            size_t numDigits = pStr - pDigits;
+            if (numDigits > maxDigits)
+            {
+                return false;
+            }
+            significand = AccumulateDigits(pDigits, numDigits, 0);
+            size_t numSignificandDigits = numDigits;
+            hasDigits = hasDigits || numDigits > 0;
+            int fractionExponent = 0;
+
+            // fractional part
+            if (*pStr == '.')
+            {
+                ++pStr;
+                if (numSignificandDigits == 0)
+                {
+                    // zeros between the decimal point and the first non-zero digit are not significant
+                    const char* pZeros = pStr;
+                    while (*pStr == '0')
+                    {
+                        ++pStr;
+                    }
+                    fractionExponent = -static_cast<int>(pStr - pZeros);
+                    hasDigits = hasDigits || pStr > pZeros;
+                }
+
+                pDigits = pStr;
+                pStr = SkipDigits(pStr, maxDigits - numSignificandDigits);
+                numDigits = pStr - pDigits;
+                if (numSignificandDigits + numDigits > maxDigits)
+                {
+                    return false;
+                }
+                significand = AccumulateDigits(pDigits, numDigits, significand);
+                fractionExponent -= static_cast<int>(numDigits);
+                hasDigits = hasDigits || numDigits > 0;
+            }
+
+            if (!hasDigits)
+            {
+                return false;
+            }
+
+            // optional exponent, which is only consumed if it contains at least one digit
+            int explicitExponent = 0;
+            if (*pStr == 'e' || *pStr == 'E')
+            {
+                const char* pExponent = pStr + 1;
+                bool isExponentNegative = false;
+                if (*pExponent == '+' || *pExponent == '-')
+                {
+                    isExponentNegative = *pExponent == '-';
+                    ++pExponent;
+                }
+
+                if (IsDecimalDigit(*pExponent))
+                {
+                    while (*pExponent == '0')
+                    {
+                        ++pExponent;
+                    }
+                    pDigits = pExponent;
+                    pExponent = SkipDigits(pExponent, maxExponentDigits);
+                    numDigits = pExponent - pDigits;
+                    if (numDigits > maxExponentDigits)
+                    {
+                        return false;
+                    }
+                    explicitExponent = static_cast<int>(AccumulateDigits(pDigits, numDigits, 0));
+                    if (isExponentNegative)
+                    {
+                        explicitExponent = -explicitExponent;
+                    }
+                    pStr = pExponent;
+                }
+            }
+
+            exponent = explicitExponent + fractionExponent;
+            pEnd = pStr;
+            return true;
+        }
+
+        // Computes significand * 10^exponent with a single correctly rounded operation, when both
+        // operands are exactly representable (Clinger's fast path).
+        template <typename ValueType>
+        bool ComputeExactly(uint64_t significand, int exponent, uint64_t maxSignificand, const ValueType* powersOfTen, int maxPowerOfTen, ValueType& value)
+        {
+            if (significand == 0)
+            {
+                value = 0;
+                return true;
+            }
+
+            // move excess positive exponent into the significand, as long as it stays exact
+            while (exponent > maxPowerOfTen && significand <= maxSignificand / 10)
+            {
+                significand *= 10;
+                --exponent;
+            }
+
+            if (significand > maxSignificand || exponent > maxPowerOfTen || exponent < -maxPowerOfTen)
+            {
+                return false;
+            }
+
+            value = static_cast<ValueType>(significand);
+            if (exponent >= 0)
+            {
+                value *= powersOfTen[exponent];
+            }
+            else
+            {
+                value /= powersOfTen[-exponent];
+            }
+            return true;
+        }
+    }
+
+    namespace CStringParserDetail
+    {
+        bool FastParseInteger(const char* pStr, const char*& pEnd, bool allowSign, bool& isNegative, uint64_t& magnitude)
+        {
+            bool negative = false;
+            if (allowSign && (*pStr == '+' || *pStr == '-'))
+            {
+                negative = *pStr == '-';
+                ++pStr;
+            }
+
+            if (HasBasePrefix(pStr))
+            {
+                return false;
+            }
+
+            const char* pDigits = pStr;
+            pStr = SkipDigits(pStr);
+            size_t numDigits = pStr - pDigits;
+            if (numDigits == 0 || numDigits > maxIntegerDigits)
+            {
+                return false;
+            }
+
+            magnitude = AccumulateDigits(pDigits, numDigits, 0);
+            isNegative = negative;
+            pEnd = pStr;
+            return true;
+        }
+
+        bool FastParseDouble(const char* pStr, const char*& pEnd, double& value)
+        {
+            if (!useFastFloatingPointPath)
+            {
+                return false;
+            }
+
+            const char* pScanEnd;
+            bool isNegative;
+            uint64_t significand;
+            int exponent;
+            double result;
+            if (!ScanDecimal(pStr, maxExactDoubleDigits, pScanEnd, isNegative, significand, exponent) || !ComputeExactly(significand, exponent, maxExactDoubleSignificand, exactDoublePowersOfTen, maxExactDoublePowerOfTen, result))
+            {
+                return false;
+            }
+
+            value = isNegative ? -result : result;
+            pEnd = pScanEnd;
+            return true;
+        }
+
+        bool FastParseFloat(const char* pStr, const char*& pEnd, float& value)
+        {
+            if (!useFastFloatingPointPath)
+            {
+                return false;
+            }
+
+            const char* pScanEnd;
+            bool isNegative;
+            uint64_t significand;
+            int exponent;
+            float result;
+            if (!ScanDecimal(pStr, maxExactFloatDigits, pScanEnd, isNegative, significand, exponent) || !ComputeExactly(significand, exponent, maxExactFloatSignificand, exactFloatPowersOfTen, maxExactFloatPowerOfTen, result))
+            {
+                return false;
+            }
+
+            value = isNegative ? -result : result;
+            pEnd = pScanEnd;
+            return true;
+        }
+    }
+
     void TrimLeadingWhitespace(const char*& pStr)
     {
         while (std::isspace(*pStr))
@@ -12,53 +12,280 @@
 #include "Exception.h"
 
 // stl
+#include <array>
 #include <cassert>
 #include <cstring>
 #include <limits>
 #include <stdexcept>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define ELL_COMPRESSED_INTEGER_LIST_SSSE3
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
 namespace ell
 {
 namespace utilities
 {
-    void CompressedIntegerList::Iterator::Next()
+    namespace
     {
-        size_t delta;
-        _iter += _iter_increment;
-        uint8_t first_val = *_iter;
+        // the number of integers described by each control byte
+        const unsigned int groupSize = 4;
 
-        // chop off top 2 bits --- they encode the # of bytes needed for this delta
-        // 00 = 1 byte, 01 = 2 bytes, 10 = 4 bytes, 11 = 8 bytes
-        int total_bytes = 1 << ((first_val >> 6) & 0x03);
-        assert(total_bytes <= 8);
-        if (total_bytes == 1)
+        // each control byte holds four 2-bit length codes: 00 = 1 byte, 01 = 2 bytes, 10 = 4 bytes, 11 = 8 bytes
+        inline size_t DecodeLength(unsigned int code)
         {
-            // first_val &= 0x3f; // this is commented out because we don't need to strip off the top 2 bits of first_val in this case, because they're always zero
-            delta = first_val;
+            return size_t(1) << code;
         }
-        else
+
+        // the length code of the smallest number of bytes that can hold a delta
+        inline unsigned int EncodeLength(size_t delta)
+        {
+            if ((delta & 0xffffffffffffff00) == 0)
+            {
+                return 0; // just need 1 byte
+            }
+            else if ((delta & 0xffffffffffff0000) == 0)
+            {
+                return 1; // two bytes
+            }
+            else if ((delta & 0xffffffff00000000) == 0)
+            {
+                return 2; // four bytes
+            }
+            return 3; // 8 bytes
+        }
+
+        // decodes a single delta of a given length code
+        inline size_t ReadDelta(const uint8_t*& iter, unsigned int code)
+        {
+            // fixed-size copies compile to single loads, rather than calls to memcpy
+            switch (code)
+            {
+            case 0:
+                return *iter++;
+            case 1:
+            {
+                uint16_t delta;
+                std::memcpy(&delta, iter, sizeof(delta));
+                iter += sizeof(delta);
+                return delta;
+            }
+            case 2:
+            {
+                uint32_t delta;
+                std::memcpy(&delta, iter, sizeof(delta));
+                iter += sizeof(delta);
+                return delta;
+            }
+            default:
+            {
+                uint64_t delta;
+                std::memcpy(&delta, iter, sizeof(delta));
+                iter += sizeof(delta);
+                return static_cast<size_t>(delta);
+            }
+            }
+        }
+
+        // decodes a full group of four integers, one delta at a time
+        const uint8_t* DecodeGroupScalar(const uint8_t* iter, size_t& value, size_t* output)
+        {
+            auto control = *iter++;
+            for (unsigned int i = 0; i < groupSize; ++i)
+            {
+                value += ReadDelta(iter, (control >> (2 * i)) & 0x03);
+                output[i] = value;
+            }
+            return iter;
+        }
+
+        // groups whose control byte has no 8-byte code can be decoded with a single shuffle
+        inline bool IsShuffleDecodable(uint8_t control)
+        {
+            return (control & (control >> 1) & 0x55) == 0;
+        }
+
+#if defined(ELL_COMPRESSED_INTEGER_LIST_SSSE3)
+        // For each control byte without 8-byte codes, a pshufb mask that moves each delta into its own
+        // zero-extended 32-bit lane, and the number of data bytes in the group
+        struct ShuffleTable
+        {
+            ShuffleTable()
+            {
+                for (unsigned int control = 0; control < 256; ++control)
+                {
+                    auto& mask = masks[control];
+                    mask.fill(0x80); // a set high bit tells pshufb to write a zero
+                    if (!IsShuffleDecodable(static_cast<uint8_t>(control)))
+                    {
+                        continue;
+                    }
+
+                    uint8_t source = 0;
+                    for (unsigned int i = 0; i < groupSize; ++i)
+                    {
+                        auto numBytes = DecodeLength((control >> (2 * i)) & 0x03);
+                        for (unsigned int j = 0; j < numBytes; ++j)
+                        {
+                            mask[4 * i + j] = source++;
+                        }
+                    }
+                    lengths[control] = source;
+                }
+            }
+
+            std::array<std::array<uint8_t, 16>, 256> masks;
+            std::array<uint8_t, 256> lengths = {};
+        };
+
+        const ShuffleTable& GetShuffleTable()
+        {
+            static const ShuffleTable table;
+            return table;
+        }
+
+        bool IsSsse3Supported()
+        {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 9)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("ssse3") != 0;
+#endif
+        }
+
+        // Decodes full groups with SSSE3, for as long as the next group's data is shuffle decodable and
+        // at least 16 bytes can be safely loaded. Returns the number of groups decoded.
+#if !defined(_MSC_VER)
+        __attribute__((target("ssse3")))
+#endif
+        size_t
+        DecodeGroupsSsse3(const uint8_t*& iter, const uint8_t* end, size_t numGroups, size_t& value, size_t* output)
+        {
+            const auto& table = GetShuffleTable();
+            size_t group = 0;
+            for (; group < numGroups && end - iter > 16; ++group)
+            {
+                auto control = *iter;
+                if (!IsShuffleDecodable(control))
+                {
+                    break;
+                }
+
+                auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iter + 1));
+                auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.masks[control].data()));
+                uint32_t deltas[groupSize];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(deltas), _mm_shuffle_epi8(data, mask));
+                iter += 1 + table.lengths[control];
+
+                auto groupOutput = output + group * groupSize;
+                value += deltas[0];
+                groupOutput[0] = value;
+                value += deltas[1];
+                groupOutput[1] = value;
+                value += deltas[2];
+                groupOutput[2] = value;
+                value += deltas[3];
+                groupOutput[3] = value;
+            }
+            return group;
+        }
+#endif
+
+        // decodes full groups, using SIMD when possible
+        const uint8_t* DecodeGroups(const uint8_t* iter, const uint8_t* end, size_t numGroups, size_t& value, size_t* output)
+        {
+#if defined(ELL_COMPRESSED_INTEGER_LIST_SSSE3)
+            static const bool useSsse3 = IsSsse3Supported();
+#endif
+            size_t group = 0;
+            while (group < numGroups)
+            {
+#if defined(ELL_COMPRESSED_INTEGER_LIST_SSSE3)
+                if (useSsse3)
+                {
+                    group += DecodeGroupsSsse3(iter, end, numGroups - group, value, output + group * groupSize);
+                    if (group == numGroups)
+                    {
+                        break;
+                    }
+                }
+#endif
+                iter = DecodeGroupScalar(iter, value, output + group * groupSize);
+                ++group;
+            }
+            return iter;
+        }
+    }
+
+    constexpr size_t CompressedIntegerList::BlockIterator::MaxBlockSize;
+
+    void CompressedIntegerList::Iterator::Next()
+    {
+        --_remaining;
+        if (_remaining > 0)
+        {
+            ReadNext();
+        }
+    }
+
+    void CompressedIntegerList::Iterator::ReadNext()
+    {
+        if (_groupPosition == groupSize)
         {
-            // read in the Next bytes, shift them over to fit the 6 bits of first_val we're using, and Add first_val
-            delta = 0;
-            std::memcpy(&delta, _iter + 1, total_bytes - 1);
-            delta = (delta << 6) | (first_val & 0x3f);
+            _control = *_iter++;
+            _groupPosition = 0;
         }
 
-        _iter_increment = total_bytes;
-        _value += delta;
+        _value += ReadDelta(_iter, (_control >> (2 * _groupPosition)) & 0x03);
+        ++_groupPosition;
     }
 
-    CompressedIntegerList::Iterator::Iterator(const uint8_t* iter, const uint8_t* end)
-        : _iter(iter), _end(end), _value(0), _iter_increment(0)
+    CompressedIntegerList::Iterator::Iterator(const uint8_t* iter, size_t size)
+        : _iter(iter), _remaining(size), _value(0), _control(0), _groupPosition(groupSize)
     {
         if (IsValid())
         {
-            Next();
+            ReadNext();
+        }
+    }
+
+    CompressedIntegerList::BlockIterator::BlockIterator(const uint8_t* iter, const uint8_t* end, size_t size)
+        : _iter(iter), _end(end), _remaining(size), _value(0), _blockSize(0)
+    {
+        Next();
+    }
+
+    void CompressedIntegerList::BlockIterator::Next()
+    {
+        // blocks always start at a group boundary, since MaxBlockSize is a multiple of the group size
+        _blockSize = _remaining < MaxBlockSize ? _remaining : MaxBlockSize;
+        _remaining -= _blockSize;
+
+        auto numFullGroups = _blockSize / groupSize;
+        _iter = DecodeGroups(_iter, _end, numFullGroups, _value, _block);
+
+        // the last group of the list may be partial
+        auto numDecoded = numFullGroups * groupSize;
+        if (numDecoded < _blockSize)
+        {
+            auto control = *_iter++;
+            for (unsigned int i = 0; numDecoded < _blockSize; ++i, ++numDecoded)
+            {
+                _value += ReadDelta(_iter, (control >> (2 * i)) & 0x03);
+                _block[numDecoded] = _value;
+            }
         }
     }
 
     CompressedIntegerList::CompressedIntegerList()
-        : _last(std::numeric_limits<size_t>::max()), _size(0)
+        : _controlOffset(0), _last(std::numeric_limits<size_t>::max()), _size(0)
     {
     }
 
@@ -105,39 +332,34 @@ namespace utilities
         _last = value;
 
         // figure out how many bits we need to represent this value
-        int log2bytes = 0;
-        if ((delta & 0xffffffffffffffc0) == 0)
-        {
-            log2bytes = 0; // just need 1 byte
-        }
-        else if ((delta & 0xffffffffffffc000) == 0)
-        {
-            log2bytes = 1; // two bytes
-        }
-        else if ((delta & 0xffffffffc0000000) == 0)
-        {
-            log2bytes = 2; // four bytes
-        }
-        else
+        auto log2bytes = EncodeLength(delta);
+
+        // every fourth integer starts a new group, with a new control byte
+        auto groupPosition = _size % groupSize;
+        if (groupPosition == 0)
         {
-            log2bytes = 3; // 8 bytes
+            _controlOffset = _data.size();
+            _data.push_back(0);
         }
+        _data[_controlOffset] |= static_cast<uint8_t>(log2bytes << (2 * groupPosition));
 
-        int total_bytes = 1 << log2bytes;
+        auto total_bytes = DecodeLength(log2bytes);
         _data.resize(_data.size() + total_bytes); // make room for new data
         uint8_t* buf = _data.data() + _data.size() - total_bytes; // get pointer to correct place in array
-        unsigned int mask = log2bytes << 6; // mask == log2(# bytes) shifted to be high-order 2 bits of a byte
-        // splice the data length encoding in as the top 2 bits of the first byte
-        // So, move all high-order bits of the delta over by 2 to make room, Add the mask, and Add the residual low-order bits of the delta
-        size_t write_val = ((delta << 2) & 0xffffffffffffff00) | mask | (delta & 0x3f);
-        std::memcpy(buf, &write_val, total_bytes);
+        std::memcpy(buf, &delta, total_bytes);
 
         ++_size;
     }
 
+    size_t CompressedIntegerList::GetEncodedDeltaSize(size_t delta)
+    {
+        return DecodeLength(EncodeLength(delta));
+    }
+
     void CompressedIntegerList::Reset()
     {
         _data.resize(0);
+        _controlOffset = 0;
         _last = UINT64_MAX;
         _size = 0;
     }
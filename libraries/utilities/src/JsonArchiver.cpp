@@ -182,6 +182,13 @@ namespace utilities
     IMPLEMENT_UNARCHIVE_VALUE(JsonUnarchiver, float);
     IMPLEMENT_UNARCHIVE_VALUE(JsonUnarchiver, double);
 
+    bool JsonUnarchiver::HasNextPropertyName(const std::string& name)
+    {
+        // a property starts with its quoted name
+        auto tokens = _tokenizer.PeekNextTokens(2);
+        return tokens[0] == "\"" && tokens[1] == name;
+    }
+
     // strings
     void JsonUnarchiver::UnarchiveValue(const char* name, std::string& value)
     {
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     MemoryMappedFile.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MemoryMappedFile.h"
+
+// utilities
+#include "Exception.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// stl
+#include <utility>
+
+namespace ell
+{
+namespace utilities
+{
+#if defined(_WIN32)
+    MemoryMappedFile::MemoryMappedFile(const std::string& filepath)
+    {
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound, "error opening file " + filepath);
+        }
+        _fileHandle = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            Unmap();
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error reading the size of file " + filepath);
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+        {
+            return;
+        }
+
+        _mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mappingHandle == nullptr)
+        {
+            Unmap();
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filepath);
+        }
+
+        _data = static_cast<const char*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            Unmap();
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filepath);
+        }
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+        }
+        _data = nullptr;
+        _size = 0;
+        _mappingHandle = nullptr;
+        _fileHandle = nullptr;
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string& filepath)
+    {
+        int file = open(filepath.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotFound, "error opening file " + filepath);
+        }
+
+        struct stat fileStatus;
+        if (fstat(file, &fileStatus) != 0)
+        {
+            close(file);
+            throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error reading the size of file " + filepath);
+        }
+
+        _size = static_cast<size_t>(fileStatus.st_size);
+        if (_size > 0)
+        {
+            void* data = mmap(nullptr, _size, PROT_READ, MAP_SHARED, file, 0);
+            if (data == MAP_FAILED)
+            {
+                close(file);
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "error mapping file " + filepath);
+            }
+            _data = static_cast<const char*>(data);
+        }
+
+        // the mapping remains valid after the file descriptor is closed
+        close(file);
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (_data != nullptr)
+        {
+            munmap(const_cast<char*>(_data), _size);
+        }
+        _data = nullptr;
+        _size = 0;
+    }
+#endif
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other)
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Unmap();
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other)
+    {
+        if (this != &other)
+        {
+            Unmap();
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+#if defined(_WIN32)
+            std::swap(_fileHandle, other._fileHandle);
+            std::swap(_mappingHandle, other._mappingHandle);
+#endif
+        }
+        return *this;
+    }
+}
+}
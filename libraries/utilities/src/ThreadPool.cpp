@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+
+// stl
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace ell
+{
+namespace utilities
+{
+    // a call to ParallelFor, whose tasks are claimed one at a time by the threads that run it
+    struct ThreadPool::Job
+    {
+        Job(size_t numTasks, const std::function<void(size_t)>& task) : numTasks(numTasks), task(task) {}
+
+        const size_t numTasks;
+        const std::function<void(size_t)>& task;
+        std::atomic<size_t> nextTask{ 0 };
+
+        std::mutex mutex;
+        std::condition_variable allTasksDone;
+        size_t numTasksDone = 0;
+        std::exception_ptr exception;
+    };
+
+    ThreadPool::ThreadPool(size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        for (size_t i = 1; i < numThreads; ++i)
+        {
+            _workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _jobAvailable.notify_all();
+        for (auto& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(size_t numTasks, const std::function<void(size_t)>& task)
+    {
+        if (numTasks == 0)
+        {
+            return;
+        }
+
+        if (numTasks == 1 || _workers.empty())
+        {
+            for (size_t i = 0; i < numTasks; ++i)
+            {
+                task(i);
+            }
+            return;
+        }
+
+        auto job = std::make_shared<Job>(numTasks, task);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _jobs.push_back(job);
+        }
+        _jobAvailable.notify_all();
+
+        RunTasks(*job);
+
+        // the workers can no longer claim tasks from this job, so take it off the queue
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto iter = std::find(_jobs.begin(), _jobs.end(), job);
+            if (iter != _jobs.end())
+            {
+                _jobs.erase(iter);
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->allTasksDone.wait(lock, [&job]() { return job->numTasksDone == job->numTasks; });
+        if (job->exception)
+        {
+            std::rethrow_exception(job->exception);
+        }
+    }
+
+    void ThreadPool::WorkerLoop()
+    {
+        while (true)
+        {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _jobAvailable.wait(lock, [this]() { return _stopping || !_jobs.empty(); });
+                if (_stopping)
+                {
+                    return;
+                }
+
+                job = _jobs.front();
+                if (job->nextTask >= job->numTasks)
+                {
+                    // all tasks have been claimed
+                    _jobs.pop_front();
+                    continue;
+                }
+            }
+            RunTasks(*job);
+        }
+    }
+
+    void ThreadPool::RunTasks(Job& job)
+    {
+        while (true)
+        {
+            size_t index = job.nextTask++;
+            if (index >= job.numTasks)
+            {
+                return;
+            }
+
+            std::exception_ptr exception;
+            try
+            {
+                job.task(index);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(job.mutex);
+            if (exception && !job.exception)
+            {
+                job.exception = exception;
+            }
+            if (++job.numTasksDone == job.numTasks)
+            {
+                job.allTasksDone.notify_all();
+            }
+        }
+    }
+}
+}
@@ -120,6 +120,22 @@ namespace utilities
         return token;
     }
 
+    std::vector<std::string> Tokenizer::PeekNextTokens(size_t numTokens)
+    {
+        std::vector<std::string> tokens;
+        for (size_t index = 0; index < numTokens; ++index)
+        {
+            tokens.push_back(ReadNextToken());
+        }
+
+        // put back tokens are read last in first out
+        for (auto iter = tokens.rbegin(); iter != tokens.rend(); ++iter)
+        {
+            PutBackToken(*iter);
+        }
+        return tokens;
+    }
+
     void Tokenizer::PutBackToken(std::string token)
     {
         _peekedTokens.push_back(token);
@@ -199,6 +199,13 @@ namespace utilities
     }
 
     // IArchivable
+    bool XmlUnarchiver::HasNextPropertyName(const std::string& name)
+    {
+        // a property is an element that starts with its type name and its name attribute
+        auto tokens = _tokenizer.PeekNextTokens(6);
+        return tokens[0] == "<" && tokens[2] == "name" && tokens[3] == "=" && tokens[4] == "'" && tokens[5] == name;
+    }
+
     std::string XmlUnarchiver::BeginUnarchiveObject(const char* name, const std::string& typeName)
     {
         bool hasName = name != std::string("");
@@ -2,21 +2,65 @@
 //
 //  Project:  Embedded Learning Library (ELL)
 //  File:     CStringParser.tcc (utilities)
-//  Authors:  Ofer Dekel
+//  Authors:  Ofer Dekel, agent
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // stl
 #include <cctype>
 #include <cerrno>
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace ell
 {
 namespace utilities
 {
+    // Fast, locale-independent parsers for the common case of plain decimal numbers. Each function returns
+    // false, without touching its outputs, when the text is outside of the cases that it handles exactly
+    // (hexadecimal and octal prefixes, too many digits, large exponents, inf, nan, etc.); the caller then
+    // falls back to the C library.
+    namespace CStringParserDetail
+    {
+        // parses [+-]?[0-9]+ with at most 18 digits and no leading '0' followed by a digit or 'x'
+        bool FastParseInteger(const char* pStr, const char*& pEnd, bool allowSign, bool& isNegative, uint64_t& magnitude);
+
+        // parses [+-]?([0-9]+\.?[0-9]*|\.[0-9]+)([eE][+-]?[0-9]+)? when the result can be computed with a single correctly rounded operation
+        bool FastParseDouble(const char* pStr, const char*& pEnd, double& value);
+
+        // same as FastParseDouble, for floats
+        bool FastParseFloat(const char* pStr, const char*& pEnd, float& value);
+
+        template <typename ValueType>
+        bool FastParseInteger(const char* pStr, char*& pEnd, ValueType& value, ParseResult& result)
+        {
+            const char* pFastEnd;
+            bool isNegative = false;
+            uint64_t magnitude = 0;
+            if (!FastParseInteger(pStr, pFastEnd, std::is_signed<ValueType>::value, isNegative, magnitude))
+            {
+                return false;
+            }
+
+            pEnd = const_cast<char*>(pFastEnd);
+            auto maxMagnitude = static_cast<uint64_t>(std::numeric_limits<ValueType>::max()) + (isNegative ? 1 : 0);
+            if (magnitude > maxMagnitude)
+            {
+                result = ParseResult::outOfRange;
+                return true;
+            }
+
+            // negate in the unsigned domain, to correctly handle the minimal value of the type
+            value = isNegative ? static_cast<ValueType>(0 - magnitude) : static_cast<ValueType>(magnitude);
+            result = ParseResult::success;
+            return true;
+        }
+    }
+
     // wrapper for strtof
     inline ParseResult cParse(const char* pStr, char*& pEnd, float& value)
     {
@@ -25,6 +69,13 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        const char* pFastEnd;
+        if (CStringParserDetail::FastParseFloat(pStr, pFastEnd, value))
+        {
+            pEnd = const_cast<char*>(pFastEnd);
+            return ParseResult::success;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -51,6 +102,13 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        const char* pFastEnd;
+        if (CStringParserDetail::FastParseDouble(pStr, pFastEnd, value))
+        {
+            pEnd = const_cast<char*>(pFastEnd);
+            return ParseResult::success;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -77,6 +135,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -109,6 +173,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -141,6 +211,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -173,6 +249,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -199,6 +281,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -230,6 +318,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
@@ -277,6 +371,12 @@ namespace utilities
             return ParseResult::badFormat;
         }
 
+        ParseResult result;
+        if (CStringParserDetail::FastParseInteger(pStr, pEnd, value, result))
+        {
+            return result;
+        }
+
         auto tmp = errno;
         errno = 0;
 
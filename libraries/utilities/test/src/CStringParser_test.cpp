@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CStringParser_test.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CStringParser_test.h"
+
+// testing
+#include "testing.h"
+
+// utilities
+#include "CStringParser.h"
+
+// stl
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace ell
+{
+template <typename ValueType>
+void TestParse(const std::string& testName, const char* str, utilities::ParseResult expectedResult, ValueType expectedValue, size_t expectedLength)
+{
+    const char* pStr = str;
+    ValueType value = 0;
+    auto result = utilities::Parse(pStr, value);
+
+    bool isOk = result == expectedResult;
+    if (result != utilities::ParseResult::badFormat)
+    {
+        isOk = isOk && static_cast<size_t>(pStr - str) == expectedLength;
+    }
+    if (result == utilities::ParseResult::success)
+    {
+        // compare bits, to distinguish 0 from -0
+        isOk = isOk && std::memcmp(&value, &expectedValue, sizeof(ValueType)) == 0;
+    }
+    testing::ProcessTest(testName + " \"" + str + "\"", isOk);
+}
+
+// compares utilities::Parse with the C library, which is the reference for correct rounding
+template <typename ValueType, typename ReferenceFunctionType>
+bool IsParseConsistentWithReference(const char* str, ReferenceFunctionType referenceFunction)
+{
+    const char* pStr = str;
+    ValueType value = 0;
+    auto result = utilities::Parse(pStr, value);
+
+    char* pEnd;
+    auto savedErrno = errno;
+    errno = 0;
+    ValueType expectedValue = referenceFunction(str, &pEnd);
+    bool isOutOfRange = errno == ERANGE;
+    errno = savedErrno;
+
+    if (isOutOfRange)
+    {
+        return result == utilities::ParseResult::outOfRange && pStr == pEnd;
+    }
+    return result == utilities::ParseResult::success && pStr == pEnd && std::memcmp(&value, &expectedValue, sizeof(ValueType)) == 0;
+}
+
+void TestParseIntegers()
+{
+    using utilities::ParseResult;
+
+    TestParse<int>("utilities::Parse<int>", "0", ParseResult::success, 0, 1);
+    TestParse<int>("utilities::Parse<int>", "-17 ", ParseResult::success, -17, 3);
+    TestParse<int>("utilities::Parse<int>", "+5", ParseResult::success, 5, 2);
+    TestParse<int>("utilities::Parse<int>", "12ab", ParseResult::success, 12, 2);
+    TestParse<int>("utilities::Parse<int>", "2147483647", ParseResult::success, 2147483647, 10);
+    TestParse<int>("utilities::Parse<int>", "-2147483648", ParseResult::success, -2147483647 - 1, 11);
+    TestParse<int>("utilities::Parse<int>", "2147483648", ParseResult::outOfRange, 0, 10);
+    TestParse<int>("utilities::Parse<int>", "-", ParseResult::badFormat, 0, 0);
+    TestParse<short>("utilities::Parse<short>", "-32768", ParseResult::success, -32768, 6);
+    TestParse<short>("utilities::Parse<short>", "32768", ParseResult::outOfRange, 0, 5);
+    TestParse<unsigned short>("utilities::Parse<unsigned short>", "65535", ParseResult::success, 65535, 5);
+    TestParse<unsigned int>("utilities::Parse<unsigned int>", "4294967295", ParseResult::success, 4294967295u, 10);
+    TestParse<unsigned int>("utilities::Parse<unsigned int>", "4294967296", ParseResult::outOfRange, 0, 10);
+    TestParse<unsigned int>("utilities::Parse<unsigned int>", "-1", ParseResult::badFormat, 0, 0);
+    TestParse<uint64_t>("utilities::Parse<uint64_t>", "123456789012345678", ParseResult::success, 123456789012345678ull, 18);
+    TestParse<uint64_t>("utilities::Parse<uint64_t>", "18446744073709551615", ParseResult::success, 18446744073709551615ull, 20);
+
+    // hexadecimal and octal are still supported
+    TestParse<int>("utilities::Parse<int>", "0x1F", ParseResult::success, 31, 4);
+    TestParse<int>("utilities::Parse<int>", "017", ParseResult::success, 15, 3);
+    TestParse<unsigned int>("utilities::Parse<unsigned int>", "0X10", ParseResult::success, 16, 4);
+}
+
+void TestParseFloatingPoint()
+{
+    using utilities::ParseResult;
+
+    TestParse<double>("utilities::Parse<double>", "0", ParseResult::success, 0.0, 1);
+    TestParse<double>("utilities::Parse<double>", "-0", ParseResult::success, -0.0, 2);
+    TestParse<double>("utilities::Parse<double>", "1.", ParseResult::success, 1.0, 2);
+    TestParse<double>("utilities::Parse<double>", ".5", ParseResult::success, 0.5, 2);
+    TestParse<double>("utilities::Parse<double>", "-2.5e-3,", ParseResult::success, -2.5e-3, 7);
+    TestParse<double>("utilities::Parse<double>", "1e", ParseResult::success, 1.0, 1);
+    TestParse<double>("utilities::Parse<double>", "1e+", ParseResult::success, 1.0, 1);
+    TestParse<double>("utilities::Parse<double>", "0.1", ParseResult::success, 0.1, 3);
+    TestParse<double>("utilities::Parse<double>", "12345678.87654321", ParseResult::success, 12345678.87654321, 17);
+    TestParse<double>("utilities::Parse<double>", "1e23", ParseResult::success, 1e23, 4);
+    TestParse<double>("utilities::Parse<double>", "9007199254740993", ParseResult::success, 9007199254740992.0, 16);
+    TestParse<double>("utilities::Parse<double>", "0.123456789012345678901234e2 ", ParseResult::success, 0.123456789012345678901234e2, 28);
+    TestParse<double>("utilities::Parse<double>", "1.7976931348623157e308", ParseResult::success, 1.7976931348623157e308, 22);
+    TestParse<double>("utilities::Parse<double>", "1e400", ParseResult::outOfRange, 0.0, 5);
+    TestParse<double>("utilities::Parse<double>", "0x10", ParseResult::success, 16.0, 4);
+    TestParse<double>("utilities::Parse<double>", ".", ParseResult::badFormat, 0.0, 0);
+    TestParse<double>("utilities::Parse<double>", "-.e3", ParseResult::badFormat, 0.0, 0);
+    TestParse<float>("utilities::Parse<float>", "0.3", ParseResult::success, 0.3f, 3);
+    TestParse<float>("utilities::Parse<float>", "-1.5e10", ParseResult::success, -1.5e10f, 7);
+    TestParse<float>("utilities::Parse<float>", "16777217", ParseResult::success, 16777216.0f, 8);
+    TestParse<float>("utilities::Parse<float>", "1.2345678901", ParseResult::success, 1.2345678901f, 12);
+    TestParse<float>("utilities::Parse<float>", "3.4028235e38", ParseResult::success, 3.4028235e38f, 12);
+}
+
+void TestParseRandomFloatingPoint()
+{
+    std::default_random_engine engine(123);
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    std::uniform_int_distribution<uint64_t> bitsDistribution;
+    const char* formats[] = { "%.17g", "%.6g", "%.3f", "%.9g", "%.12e" };
+
+    bool doubleOk = true;
+    bool floatOk = true;
+    char buffer[64];
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        double number = distribution(engine);
+        if (i % 2 == 1)
+        {
+            // arbitrary bit patterns cover the full exponent range
+            auto bits = bitsDistribution(engine);
+            std::memcpy(&number, &bits, sizeof(number));
+            if (number != number || number - number != 0)
+            {
+                continue;
+            }
+        }
+
+        std::snprintf(buffer, sizeof(buffer), formats[i % 5], number);
+        doubleOk = doubleOk && IsParseConsistentWithReference<double>(buffer, [](const char* pStr, char** pEnd) { return std::strtod(pStr, pEnd); });
+        floatOk = floatOk && IsParseConsistentWithReference<float>(buffer, [](const char* pStr, char** pEnd) { return std::strtof(pStr, pEnd); });
+    }
+
+    testing::ProcessTest("utilities::Parse<double> agrees with strtod", doubleOk);
+    testing::ProcessTest("utilities::Parse<float> agrees with strtof", floatOk);
+}
+}
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     CompressedIntegerList_test.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "CompressedIntegerList_test.h"
+
+// testing
+#include "testing.h"
+
+// utilities
+#include "CompressedIntegerList.h"
+
+// stl
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace ell
+{
+// generates increasing integers, with deltas that need each of the possible encoded lengths
+std::vector<size_t> GetIncreasingIntegers(size_t count, std::default_random_engine& engine)
+{
+    std::uniform_int_distribution<size_t> lengthDistribution(0, 9);
+    std::uniform_int_distribution<size_t> oneByteDistribution(1, 255);
+    std::uniform_int_distribution<size_t> twoByteDistribution(1, 65535);
+    std::uniform_int_distribution<size_t> fourByteDistribution(1, 5000000000);
+    std::uniform_int_distribution<size_t> eightByteDistribution(1, size_t(1) << 40);
+
+    std::vector<size_t> values;
+    size_t value = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        values.push_back(value);
+        auto length = lengthDistribution(engine);
+        value += length < 6 ? oneByteDistribution(engine) : length < 8 ? twoByteDistribution(engine) : length < 9 ? fourByteDistribution(engine) : eightByteDistribution(engine);
+    }
+    return values;
+}
+
+void TestCompressedIntegerListIterator()
+{
+    std::default_random_engine engine(17);
+    bool isOk = true;
+
+    // sizes that are not multiples of four leave the last group partial
+    for (size_t count : { 0, 1, 3, 4, 5, 17, 1000 })
+    {
+        auto values = GetIncreasingIntegers(count, engine);
+        utilities::CompressedIntegerList list;
+        for (auto value : values)
+        {
+            list.Append(value);
+        }
+
+        size_t index = 0;
+        auto iterator = list.GetIterator();
+        while (iterator.IsValid())
+        {
+            isOk = isOk && index < count && iterator.Get() == values[index];
+            ++index;
+            iterator.Next();
+        }
+        isOk = isOk && index == count && list.Size() == count;
+    }
+
+    testing::ProcessTest("utilities::CompressedIntegerList::Iterator", isOk);
+}
+
+void TestCompressedIntegerListBlockIterator()
+{
+    std::default_random_engine engine(19);
+    bool isOk = true;
+
+    for (size_t count : { 0, 1, 3, 4, 5, 64, 65, 130, 1000 })
+    {
+        auto values = GetIncreasingIntegers(count, engine);
+        utilities::CompressedIntegerList list;
+        for (auto value : values)
+        {
+            list.Append(value);
+        }
+
+        size_t index = 0;
+        auto blockIterator = list.GetBlockIterator();
+        while (blockIterator.IsValid())
+        {
+            auto block = blockIterator.Get();
+            isOk = isOk && blockIterator.GetBlockSize() <= utilities::CompressedIntegerList::BlockIterator::MaxBlockSize;
+            for (size_t i = 0; i < blockIterator.GetBlockSize(); ++i)
+            {
+                isOk = isOk && index < count && block[i] == values[index];
+                ++index;
+            }
+            blockIterator.Next();
+        }
+        isOk = isOk && index == count;
+    }
+
+    testing::ProcessTest("utilities::CompressedIntegerList::BlockIterator", isOk);
+}
+}
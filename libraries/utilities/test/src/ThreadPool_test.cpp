@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ThreadPool_test.cpp (utilities)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool_test.h"
+
+// testing
+#include "testing.h"
+
+// utilities
+#include "Exception.h"
+#include "ThreadPool.h"
+
+// stl
+#include <atomic>
+#include <vector>
+
+namespace ell
+{
+void TestThreadPoolParallelFor()
+{
+    utilities::ThreadPool pool(4);
+    testing::ProcessTest("ThreadPool::NumThreads", pool.NumThreads() == 4);
+
+    std::vector<int> counts(1000, 0);
+    pool.ParallelFor(counts.size(), [&counts](size_t index) { counts[index] += 1; });
+
+    bool eachTaskRanOnce = true;
+    for (auto count : counts)
+    {
+        eachTaskRanOnce = eachTaskRanOnce && count == 1;
+    }
+    testing::ProcessTest("ThreadPool::ParallelFor", eachTaskRanOnce);
+}
+
+void TestThreadPoolNestedParallelFor()
+{
+    utilities::ThreadPool pool(3);
+    std::atomic<size_t> sum(0);
+    pool.ParallelFor(10, [&](size_t i) {
+        pool.ParallelFor(10, [&](size_t j) { sum += i * 10 + j; });
+    });
+    testing::ProcessTest("ThreadPool::ParallelFor nested", sum == 4950);
+}
+
+void TestThreadPoolException()
+{
+    utilities::ThreadPool pool(4);
+    std::atomic<size_t> numTasksRun(0);
+    bool caught = false;
+    try
+    {
+        pool.ParallelFor(100, [&](size_t index) {
+            ++numTasksRun;
+            if (index == 17)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument);
+            }
+        });
+    }
+    catch (const utilities::InputException&)
+    {
+        caught = true;
+    }
+    testing::ProcessTest("ThreadPool::ParallelFor exception", caught && numTasksRun == 100);
+}
+}
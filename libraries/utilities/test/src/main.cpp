@@ -6,11 +6,14 @@
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "CStringParser_test.h"
+#include "CompressedIntegerList_test.h"
 #include "Format_test.h"
 #include "FunctionUtils_test.h"
 #include "IArchivable_test.h"
 #include "Iterator_test.h"
 #include "ObjectArchive_test.h"
+#include "ThreadPool_test.h"
 #include "TypeFactory_test.h"
 #include "TypeName_test.h"
 #include "Variant_test.h"
@@ -36,6 +39,15 @@ int main()
 {
     try
     {
+        // CStringParser tests
+        TestParseIntegers();
+        TestParseFloatingPoint();
+        TestParseRandomFloatingPoint();
+
+        // CompressedIntegerList tests
+        TestCompressedIntegerListIterator();
+        TestCompressedIntegerListBlockIterator();
+
         // Format tests
         TestMatchFormat();
 
@@ -44,6 +56,11 @@ int main()
         TestTransformIterator();
         TestParallelTransformIterator();
 
+        // ThreadPool tests
+        TestThreadPoolParallelFor();
+        TestThreadPoolNestedParallelFor();
+        TestThreadPoolException();
+
         // TypeFactory tests
         TypeFactoryTest();
 
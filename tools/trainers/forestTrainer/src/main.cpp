@@ -80,8 +80,7 @@ int main(int argc, char* argv[])
 
         // load dataset
         if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
-        auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
 
         // predictor type
         using PredictorType = predictors::SimpleForestPredictor;
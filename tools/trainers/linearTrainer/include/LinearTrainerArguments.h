@@ -25,6 +25,7 @@ namespace ell
 
     Algorithm algorithm = Algorithm::SGD;
     bool normalize;
+    bool printFeatureStatistics;
     double regularization;
     double desiredPrecision;
     size_t maxEpochs;
@@ -26,6 +26,12 @@ namespace ell
             "Perform sparsity-preserving normalization",
             false);
 
+        parser.AddOption(printFeatureStatistics,
+            "printFeatureStatistics",
+            "pfs",
+            "Print the count, mean, variance, min, max and quartiles of each feature",
+            false);
+
         parser.AddOption(regularization,
             "regularization",
             "r",
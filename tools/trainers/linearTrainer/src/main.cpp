@@ -13,6 +13,7 @@
 #include "Exception.h"
 #include "Files.h"
 #include "OutputStreamImpostor.h"
+#include "RandomEngines.h"
 
 // data
 #include "Dataset.h"
@@ -27,6 +28,7 @@
 #include "MakeTrainer.h"
 #include "MapLoadArguments.h"
 #include "ModelSaveArguments.h"
+#include "StreamingArguments.h"
 #include "TrainerArguments.h"
 
 // model
@@ -37,6 +39,7 @@
 #include "LinearPredictorNode.h"
 
 // trainers
+#include "FeatureStatistics.h"
 #include "MeanCalculator.h"
 
 // evaluators
@@ -65,6 +68,7 @@ int main(int argc, char* argv[])
         common::ParsedModelSaveArguments modelSaveArguments;
         common::ParsedTrainerArguments trainerArguments;
         common::ParsedEvaluatorArguments evaluatorArguments;
+        common::ParsedStreamingArguments streamingArguments;
 
         commandLineParser.AddOptionSet(linearTrainerArguments);
         commandLineParser.AddOptionSet(dataLoadArguments);
@@ -72,6 +76,7 @@ int main(int argc, char* argv[])
         commandLineParser.AddOptionSet(modelSaveArguments);
         commandLineParser.AddOptionSet(trainerArguments);
         commandLineParser.AddOptionSet(evaluatorArguments);
+        commandLineParser.AddOptionSet(streamingArguments);
 
         // parse command line
         commandLineParser.Parse();
@@ -86,19 +91,67 @@ int main(int argc, char* argv[])
         mapLoadArguments.defaultInputSize = dataLoadArguments.parsedDataDimension;
         auto map = common::LoadMap(mapLoadArguments);
 
-        // load dataset
-        if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
-        auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        // load dataset, or only a sample for evaluation when training on a stream
+        data::AutoSupervisedDataset mappedDataset;
+        auto random = utilities::GetRandomEngine(linearTrainerArguments.randomSeedString);
+        if (streamingArguments.stream)
+        {
+            bool isStreamingAlgorithm = linearTrainerArguments.algorithm == LinearTrainerArguments::Algorithm::SGD || linearTrainerArguments.algorithm == LinearTrainerArguments::Algorithm::SparseDataSGD;
+            if (!isStreamingAlgorithm || linearTrainerArguments.normalize)
+            {
+                throw utilities::InputException(utilities::InputExceptionErrors::invalidArgument, "streaming is only supported by the SGD and SparseDataSGD algorithms, without normalization");
+            }
+
+            if (trainerArguments.verbose) std::cout << "Loading evaluation sample ..." << std::endl;
+            auto exampleIterator = common::GetMappedExampleIterator(dataLoadArguments, map);
+            while (exampleIterator.IsValid() && mappedDataset.NumExamples() < streamingArguments.evaluationSampleSize)
+            {
+                mappedDataset.AddExample(exampleIterator.Get());
+                exampleIterator.Next();
+            }
+        }
+        else
+        {
+            if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
+            mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
+        }
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
+        // calculate feature statistics, in a single multithreaded pass over the data
+        trainers::FeatureStatistics featureStatistics;
+        if (linearTrainerArguments.normalize || linearTrainerArguments.printFeatureStatistics)
+        {
+            if (trainerArguments.verbose) std::cout << "Calculating feature statistics ..." << std::endl;
+
+            // normalization only needs the means, the quantile sketches are only kept for printing
+            trainers::FeatureStatisticsParameters featureStatisticsParameters;
+            if (!linearTrainerArguments.printFeatureStatistics)
+            {
+                featureStatisticsParameters.quantileSketchSize = 0;
+            }
+
+            if (streamingArguments.stream)
+            {
+                featureStatistics = trainers::CalculateFeatureStatistics(common::GetMappedExampleIterator(dataLoadArguments, map), featureStatisticsParameters);
+            }
+            else
+            {
+                featureStatistics = trainers::CalculateFeatureStatistics(mappedDataset.GetAnyDataset(), featureStatisticsParameters);
+            }
+
+            if (linearTrainerArguments.printFeatureStatistics)
+            {
+                featureStatistics.Print(std::cout);
+            }
+        }
+
         // normalize data
         if (linearTrainerArguments.normalize)
         {
             if (trainerArguments.verbose) std::cout << "Sparisty-preserving data normalization ..." << std::endl;
 
             // find inverse absolute mean
-            auto scaleVector = trainers::CalculateSparseTransformedMean(mappedDataset.GetAnyDataset(), [](data::IndexValue x) { return std::abs(x.value); });
+            auto scaleVector = featureStatistics.GetMeanAbsoluteValues();
             scaleVector.Transform([](double x) {return x > 0.0 ? 1.0 / x : 0.0; });
 
             // create normalizer
@@ -143,12 +196,23 @@ int main(int argc, char* argv[])
 
         // Train the predictor
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
-        trainer->SetDataset(mappedDataset.GetAnyDataset());
-        
-        for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+        if (streamingArguments.stream)
         {
-            trainer->Update();
-            evaluator->Evaluate(trainer->GetPredictor());
+            for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+            {
+                trainer->UpdateFromStream(common::GetMappedExampleIterator(dataLoadArguments, map, streamingArguments.shuffleBufferSize, random));
+                evaluator->Evaluate(trainer->GetPredictor());
+            }
+        }
+        else
+        {
+            trainer->SetDataset(mappedDataset.GetAnyDataset());
+
+            for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+            {
+                trainer->Update();
+                evaluator->Evaluate(trainer->GetPredictor());
+            }
         }
         
         predictors::LinearPredictor predictor(trainer->GetPredictor());
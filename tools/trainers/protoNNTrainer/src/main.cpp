@@ -89,8 +89,7 @@ int main(int argc, char* argv[])
 
         mapLoadArguments.defaultInputSize = dataLoadArguments.parsedDataDimension;
         auto map = common::LoadMap(mapLoadArguments);
-        auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        auto mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // create protonn trainer
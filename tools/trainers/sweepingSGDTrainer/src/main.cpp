@@ -26,6 +26,7 @@
 #include "MapLoadArguments.h"
 #include "ModelSaveArguments.h"
 #include "ParametersEnumerator.h"
+#include "StreamingArguments.h"
 #include "TrainerArguments.h"
 
 // trainers
@@ -61,11 +62,13 @@ int main(int argc, char* argv[])
         common::ParsedDataLoadArguments dataLoadArguments;
         common::ParsedMapLoadArguments mapLoadArguments;
         common::ParsedModelSaveArguments modelSaveArguments;
+        common::ParsedStreamingArguments streamingArguments;
 
         commandLineParser.AddOptionSet(trainerArguments);
         commandLineParser.AddOptionSet(dataLoadArguments);
         commandLineParser.AddOptionSet(mapLoadArguments);
         commandLineParser.AddOptionSet(modelSaveArguments);
+        commandLineParser.AddOptionSet(streamingArguments);
 
         // parse command line
         commandLineParser.Parse();
@@ -83,10 +86,23 @@ int main(int argc, char* argv[])
         mapLoadArguments.defaultInputSize = dataLoadArguments.parsedDataDimension;
         auto map = common::LoadMap(mapLoadArguments);
 
-        // load dataset
-        if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
-        auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto mappedDataset = common::GetMappedDataset(stream, map);
+        // load dataset, or only a sample for evaluation when training on a stream
+        data::AutoSupervisedDataset mappedDataset;
+        if (streamingArguments.stream)
+        {
+            if (trainerArguments.verbose) std::cout << "Loading evaluation sample ..." << std::endl;
+            auto exampleIterator = common::GetMappedExampleIterator(dataLoadArguments, map);
+            while (exampleIterator.IsValid() && mappedDataset.NumExamples() < streamingArguments.evaluationSampleSize)
+            {
+                mappedDataset.AddExample(exampleIterator.Get());
+                exampleIterator.Next();
+            }
+        }
+        else
+        {
+            if (trainerArguments.verbose) std::cout << "Loading data ..." << std::endl;
+            mappedDataset = common::GetMappedDataset(dataLoadArguments, map);
+        }
         auto mappedDatasetDimension = map.GetOutput(0).Size();
 
         // get predictor type
@@ -111,8 +127,23 @@ int main(int argc, char* argv[])
 
         // train
         if (trainerArguments.verbose) std::cout << "Training ..." << std::endl;
-        trainer->SetDataset(mappedDataset.GetAnyDataset());
-        trainer->Update();
+        if (streamingArguments.stream)
+        {
+            // the stream is read once per epoch, and each part of it is passed to all of the internal trainers
+            auto random = utilities::GetRandomEngine("ABCDEFG");
+            for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+            {
+                trainer->UpdateFromStream(common::GetMappedExampleIterator(dataLoadArguments, map, streamingArguments.shuffleBufferSize, random));
+            }
+        }
+        else
+        {
+            trainer->SetDataset(mappedDataset.GetAnyDataset());
+            for (size_t epoch = 0; epoch < trainerArguments.numEpochs; ++epoch)
+            {
+                trainer->Update();
+            }
+        }
         predictors::LinearPredictor predictor(trainer->GetPredictor());
         predictor.Resize(mappedDatasetDimension);
 
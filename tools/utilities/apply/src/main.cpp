@@ -19,6 +19,7 @@
 #include "DataVectorOperations.h"
 #include "Dataset.h"
 #include "Example.h"
+#include "PrefetchingExampleIterator.h"
 
 // math
 #include "Vector.h"
@@ -67,7 +68,8 @@ int main(int argc, char* argv[])
 
         // get data iterator
         auto stream = utilities::OpenIfstream(dataLoadArguments.inputDataFilename);
-        auto exampleIterator = common::GetExampleIterator(stream);
+        // parsing happens on a background thread, and overlaps with computing the map
+        auto exampleIterator = data::MakePrefetchingExampleIterator(common::GetExampleIterator(stream));
 
         // get output stream
         auto& outputStream = dataSaveArguments.outputDataStream;
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConvertDatasetArguments.h (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// data
+#include "MappedDataset.h"
+
+// utilities
+#include "CommandLineParser.h"
+
+// stl
+#include <string>
+
+namespace ell
+{
+/// <summary> Command line arguments for the convertDataset executable. </summary>
+struct ConvertDatasetArguments
+{
+    /// <summary> Path to the output binary dataset file. </summary>
+    std::string outputDataFilename;
+
+    /// <summary> The type used to store the values in the output file. </summary>
+    data::MappedDatasetValueType valueType;
+};
+
+/// <summary> Parsed command line arguments for the convertDataset executable. </summary>
+struct ParsedConvertDatasetArguments : public ConvertDatasetArguments, public utilities::ParsedArgSet
+{
+    /// <summary> Adds the arguments to the command line parser. </summary>
+    ///
+    /// <param name="parser"> [in,out] The parser. </param>
+    virtual void AddArgs(utilities::CommandLineParser& parser) override;
+
+    /// <summary> Check the parsed arguments. </summary>
+    ///
+    /// <param name="parser"> The parser. </param>
+    ///
+    /// <returns> An utilities::CommandLineParseResult. </returns>
+    virtual utilities::CommandLineParseResult PostProcess(const utilities::CommandLineParser& parser) override;
+};
+}
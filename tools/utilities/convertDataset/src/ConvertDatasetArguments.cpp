@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     ConvertDatasetArguments.cpp (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ConvertDatasetArguments.h"
+
+namespace ell
+{
+void ParsedConvertDatasetArguments::AddArgs(utilities::CommandLineParser& parser)
+{
+    parser.AddOption(
+        outputDataFilename,
+        "outputDataFilename",
+        "odf",
+        "Path to the output binary dataset file",
+        "");
+
+    parser.AddOption(
+        valueType,
+        "valueType",
+        "vt",
+        "The type used to store the values in the output file",
+        { { "float", data::MappedDatasetValueType::floatValues }, { "double", data::MappedDatasetValueType::doubleValues } },
+        "float");
+}
+
+utilities::CommandLineParseResult ParsedConvertDatasetArguments::PostProcess(const utilities::CommandLineParser& parser)
+{
+    std::vector<std::string> errors;
+    if (outputDataFilename == "")
+    {
+        errors.push_back("An output data filename is required");
+    }
+    return errors;
+}
+}
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Project:  Embedded Learning Library (ELL)
+//  File:     main.cpp (convertDataset)
+//  Authors:  agent
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "ConvertDatasetArguments.h"
+
+// utilities
+#include "CommandLineParser.h"
+#include "Exception.h"
+
+// data
+#include "Dataset.h"
+#include "MappedDataset.h"
+
+// common
+#include "DataLoadArguments.h"
+#include "DataLoaders.h"
+
+// stl
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using namespace ell;
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        // create a command line parser
+        utilities::CommandLineParser commandLineParser(argc, argv);
+
+        // add arguments to the command line parser
+        common::ParsedDataLoadArguments dataLoadArguments;
+        ParsedConvertDatasetArguments convertDatasetArguments;
+
+        commandLineParser.AddOptionSet(dataLoadArguments);
+        commandLineParser.AddOptionSet(convertDatasetArguments);
+
+        // parse command line
+        commandLineParser.Parse();
+
+        std::ofstream outputStream(convertDatasetArguments.outputDataFilename, std::ios::binary);
+        if (!outputStream.is_open())
+        {
+            throw utilities::SystemException(utilities::SystemExceptionErrors::fileNotWritable, "error opening file " + convertDatasetArguments.outputDataFilename);
+        }
+
+        // a binary dataset that isn't hashed is re-encoded straight from its memory mapping
+        if (data::IsMappedDatasetFile(dataLoadArguments.inputDataFilename) && dataLoadArguments.numHashingBits == 0)
+        {
+            data::MappedDataset mappedDataset(dataLoadArguments.inputDataFilename);
+            data::SaveMappedDataset(mappedDataset, outputStream, convertDatasetArguments.valueType);
+        }
+        else
+        {
+            auto dataset = common::GetDataset(dataLoadArguments);
+            data::SaveMappedDataset(dataset, outputStream, convertDatasetArguments.valueType);
+        }
+    }
+    catch (const utilities::CommandLineParserPrintHelpException& exception)
+    {
+        std::cout << exception.GetHelpText() << std::endl;
+        return 0;
+    }
+    catch (const utilities::CommandLineParserErrorException& exception)
+    {
+        std::cerr << "Command line parse error:" << std::endl;
+        for (const auto& error : exception.GetParseErrors())
+        {
+            std::cerr << error.GetMessage() << std::endl;
+        }
+        return 1;
+    }
+    catch (const utilities::Exception& exception)
+    {
+        std::cerr << "exception: " << exception.GetMessage() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}